@@ -414,6 +414,16 @@ struct pid_effect_state
     struct hid_value_caps *actuator_override_switch_caps;
 };
 
+/* device state object, read directly from its compiled report field */
+struct device_state_op
+{
+    UINT index;
+    DWORD offset;
+    BOOL axis;
+    BOOL button;
+    struct hid_report_field field;
+};
+
 struct hid_joystick
 {
     struct dinput_device base;
@@ -433,6 +443,9 @@ struct hid_joystick
     USAGE_AND_PAGE *usages_buf;
     UINT usages_count;
 
+    struct device_state_op *state_ops;
+    UINT state_op_count;
+
     BYTE effect_inuse[255];
     struct list effect_list;
     struct pid_control_report pid_device_control;
@@ -1013,6 +1026,7 @@ static void hid_joystick_destroy( IDirectInputDevice8W *iface )
     struct hid_joystick *impl = impl_from_IDirectInputDevice8W( iface );
     TRACE( "iface %p.\n", iface );
 
+    free( impl->state_ops );
     free( impl->usages_buf );
     free( impl->feature_report_buf );
     free( impl->output_report_buf );
@@ -1478,6 +1492,37 @@ static BOOL read_device_state_value( struct dinput_device *device, UINT index, s
     return DIENUM_CONTINUE;
 }
 
+static void run_device_state_ops( struct hid_joystick *impl, struct parse_device_state_params *params )
+{
+    IDirectInputDevice8W *iface = &impl->base.IDirectInputDevice8W_iface;
+    const struct device_state_op *op, *end = impl->state_ops + impl->state_op_count;
+    const BYTE *report_buf = (const BYTE *)impl->input_report_buf;
+    struct object_properties *properties;
+    ULONG logical_value;
+    LONG value;
+
+    for (op = impl->state_ops; op != end; op++)
+    {
+        logical_value = hid_report_field_value( &op->field, report_buf );
+
+        if (op->button)
+        {
+            value = logical_value ? 0x80 : 0;
+            impl->base.device_state[op->offset] = value;
+            if (params->old_state[op->offset] != value) queue_event( iface, op->index, value, params->time, params->seq );
+            continue;
+        }
+
+        properties = impl->base.object_properties + op->index;
+        if (op->axis) value = scale_axis_value( logical_value, properties );
+        else value = scale_value( logical_value, properties );
+
+        *(LONG *)(impl->base.device_state + op->offset) = value;
+        if (*(LONG *)(params->old_state + op->offset) != value)
+            queue_event( iface, op->index, value, params->time, params->seq );
+    }
+}
+
 static HRESULT hid_joystick_read( IDirectInputDevice8W *iface )
 {
     static const DIPROPHEADER filter =
@@ -1516,11 +1561,16 @@ static HRESULT hid_joystick_read( IDirectInputDevice8W *iface )
             }
         }
 
-        count = impl->usages_count;
-        memset( impl->usages_buf, 0, count * sizeof(*impl->usages_buf) );
-        status = HidP_GetUsagesEx( HidP_Input, 0, impl->usages_buf, &count,
-                                   impl->preparsed, report_buf, report_len );
-        if (status != HIDP_STATUS_SUCCESS) WARN( "HidP_GetUsagesEx returned %#lx\n", status );
+        /* the device state report doesn't need the usage list when it has been compiled */
+        count = 0;
+        if (report_buf[0] != impl->base.device_state_report_id || !impl->state_ops)
+        {
+            count = impl->usages_count;
+            memset( impl->usages_buf, 0, count * sizeof(*impl->usages_buf) );
+            status = HidP_GetUsagesEx( HidP_Input, 0, impl->usages_buf, &count,
+                                       impl->preparsed, report_buf, report_len );
+            if (status != HIDP_STATUS_SUCCESS) WARN( "HidP_GetUsagesEx returned %#lx\n", status );
+        }
 
         if (report_buf[0] == impl->base.device_state_report_id)
         {
@@ -1530,19 +1580,23 @@ static HRESULT hid_joystick_read( IDirectInputDevice8W *iface )
             memset( params.buttons, 0, sizeof(params.buttons) );
             memset( impl->base.device_state, 0, format->dwDataSize );
 
-            while (count--)
+            if (impl->state_ops) run_device_state_ops( impl, &params );
+            else
             {
-                usages = impl->usages_buf + count;
-                if (usages->UsagePage != HID_USAGE_PAGE_BUTTON)
-                    WARN( "unimplemented usage page %x.\n", usages->UsagePage );
-                else if (usages->Usage >= 128)
-                    FIXME( "ignoring extraneous button %d.\n", usages->Usage );
-                else
-                    params.buttons[usages->Usage - 1] = 0x80;
-            }
+                while (count--)
+                {
+                    usages = impl->usages_buf + count;
+                    if (usages->UsagePage != HID_USAGE_PAGE_BUTTON)
+                        WARN( "unimplemented usage page %x.\n", usages->UsagePage );
+                    else if (usages->Usage >= 128)
+                        FIXME( "ignoring extraneous button %d.\n", usages->Usage );
+                    else
+                        params.buttons[usages->Usage - 1] = 0x80;
+                }
 
-            enum_objects( impl, &filter, DIDFT_AXIS | DIDFT_POV, read_device_state_value, &params );
-            enum_objects( impl, &filter, DIDFT_BUTTON, check_device_state_button, &params );
+                enum_objects( impl, &filter, DIDFT_AXIS | DIDFT_POV, read_device_state_value, &params );
+                enum_objects( impl, &filter, DIDFT_BUTTON, check_device_state_button, &params );
+            }
             if (impl->base.hEvent && memcmp( &params.old_state, impl->base.device_state, format->dwDataSize ))
                 SetEvent( impl->base.hEvent );
         }
@@ -1964,6 +2018,69 @@ static BOOL init_object_properties( struct dinput_device *device, UINT index, st
     return DIENUM_CONTINUE;
 }
 
+struct compile_device_state_params
+{
+    const struct hid_report_field *fields;
+    int count;
+};
+
+static BOOL init_device_state_op( struct dinput_device *device, UINT index, struct hid_value_caps *caps,
+                                  const DIDEVICEOBJECTINSTANCEW *instance, void *data )
+{
+    struct hid_joystick *impl = CONTAINING_RECORD( device, struct hid_joystick, base );
+    struct device_state_op *op = impl->state_ops + impl->state_op_count;
+    struct compile_device_state_params *params = data;
+    UCHAR report_id = device->device_state_report_id;
+
+    if (index == -1) return DIENUM_STOP;
+    if (instance->wReportId != report_id) return DIENUM_CONTINUE;
+
+    op->index = index;
+    op->offset = instance->dwOfs;
+    op->axis = !!(instance->dwType & DIDFT_AXIS);
+    op->button = !!(instance->dwType & DIDFT_BUTTON);
+
+    /* match the parsing in hid_joystick_read, buttons are only read from the button page */
+    if (!op->button)
+        op->field = hid_report_find_field( params->fields, params->count, report_id,
+                                           instance->wUsagePage, instance->wUsage, FALSE );
+    else if (instance->wUsage && instance->wUsage < 128)
+        op->field = hid_report_find_field( params->fields, params->count, report_id,
+                                           HID_USAGE_PAGE_BUTTON, instance->wUsage, TRUE );
+    else
+        memset( &op->field, 0, sizeof(op->field) );
+
+    impl->state_op_count++;
+    return DIENUM_CONTINUE;
+}
+
+static void compile_device_state( struct hid_joystick *impl )
+{
+    static const DIPROPHEADER filter =
+    {
+        .dwSize = sizeof(filter),
+        .dwHeaderSize = sizeof(filter),
+        .dwHow = DIPH_DEVICE,
+    };
+    struct hid_preparsed_data *preparsed = (struct hid_preparsed_data *)impl->preparsed;
+    struct compile_device_state_params params = {0};
+    struct hid_report_field *fields;
+
+    if ((params.count = hid_report_compile( preparsed, NULL, 0 )) <= 0) return;
+    if (!(fields = calloc( params.count, sizeof(*fields) ))) return;
+    hid_report_compile( preparsed, fields, params.count );
+    params.fields = fields;
+
+    /* every device state object is backed by one of the input fields */
+    if ((impl->state_ops = calloc( params.count, sizeof(*impl->state_ops) )))
+    {
+        enum_objects( impl, &filter, DIDFT_AXIS | DIDFT_POV | DIDFT_BUTTON, init_device_state_op, &params );
+        TRACE( "compiled %d report fields into %u device state operations\n", params.count, impl->state_op_count );
+    }
+
+    free( fields );
+}
+
 static BOOL init_pid_reports( struct dinput_device *device, UINT index, struct hid_value_caps *caps,
                               const DIDEVICEOBJECTINSTANCEW *instance, void *data )
 {
@@ -2378,6 +2495,7 @@ HRESULT hid_joystick_create_device( struct dinput *dinput, const GUID *guid, IDi
 
     if (FAILED(hr = dinput_device_init_device_format( &impl->base.IDirectInputDevice8W_iface ))) goto failed;
     enum_objects( impl, &filter, DIDFT_AXIS | DIDFT_POV, init_object_properties, NULL );
+    compile_device_state( impl );
 
     *out = &impl->base.IDirectInputDevice8W_iface;
     return DI_OK;
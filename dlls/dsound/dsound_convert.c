@@ -37,6 +37,9 @@
 
 #include <stdarg.h>
 #include <math.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "windef.h"
 #include "winbase.h"
@@ -62,9 +65,37 @@ static void get16(const IDirectSoundBufferImpl *dsb, BYTE *base, float *dst, uns
     DWORD channels = dsb->pwfx->nChannels;
     const BYTE *buf = base + 2 * channel;
     const SHORT *sbuf = (const SHORT*)(buf);
-    int i;
+    int i = 0;
+
+#ifdef __SSE2__
+    if (channels <= 2)
+    {
+        const __m128 scale = _mm_set1_ps(1.0f / 0x8000);
+        __m128i v;
+
+        /* Mono and stereo 16-bit are by far the most common formats. For
+         * stereo each 32-bit lane holds one frame, and the wanted channel is
+         * sign-extended out of it with shifts. */
+        for (; i + 4 <= samples; i += 4)
+        {
+            if (channels == 1)
+            {
+                v = _mm_loadl_epi64((const __m128i *)&sbuf[i]);
+                v = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+            }
+            else
+            {
+                v = _mm_loadu_si128((const __m128i *)((const SHORT *)base + i * 2));
+                if (!channel)
+                    v = _mm_slli_epi32(v, 16);
+                v = _mm_srai_epi32(v, 16);
+            }
+            _mm_storeu_ps(&dst[i], _mm_mul_ps(_mm_cvtepi32_ps(v), scale));
+        }
+    }
+#endif
 
-    for (i = 0; i < samples; ++i)
+    for (; i < samples; ++i)
         dst[i] = sbuf[i * channels] / (float)0x8000;
 }
 
@@ -291,9 +322,83 @@ void put_quad2stereo(const IDirectSoundBufferImpl *dsb, DWORD pos, DWORD channel
     }
 }
 
+/* Interleave the buffer's planar channels, each "stride" floats apart in src,
+ * into the temporary buffer, with output frames "ostride" bytes apart. This is
+ * the put() path for buffers that need no channel conversion. */
+void putieee32_planar(const IDirectSoundBufferImpl *dsb, const float *src, unsigned stride, UINT ostride, unsigned frames)
+{
+    float *dst = dsb->device->tmp_buffer;
+    UINT channels = dsb->mix_channels, dst_channels = ostride / sizeof(float);
+    unsigned i = 0, channel;
+
+    if (channels == 1 && dst_channels == 1)
+    {
+        memcpy(dst, src, frames * sizeof(float));
+        return;
+    }
+
+#ifdef __SSE2__
+    if (channels == 2 && dst_channels == 2)
+    {
+        const float *left = src, *right = src + stride;
+        __m128 l, r;
+
+        for (; i + 4 <= frames; i += 4)
+        {
+            l = _mm_loadu_ps(&left[i]);
+            r = _mm_loadu_ps(&right[i]);
+            _mm_storeu_ps(&dst[i * 2], _mm_unpacklo_ps(l, r));
+            _mm_storeu_ps(&dst[i * 2 + 4], _mm_unpackhi_ps(l, r));
+        }
+    }
+#endif
+
+    for (; i < frames; ++i)
+        for (channel = 0; channel < channels; ++channel)
+            dst[i * dst_channels + channel] = src[channel * stride + i];
+}
+
 void mixieee32(float *src, float *dst, unsigned samples)
 {
     TRACE("%p - %p %d\n", src, dst, samples);
+#ifdef __SSE2__
+    for (; samples >= 4; samples -= 4, src += 4, dst += 4)
+        _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_loadu_ps(src)));
+#endif
     while (samples--)
         *(dst++) += *(src++);
 }
+
+/* Scale interleaved frames by a per-channel volume and accumulate them into
+ * dst in a single pass. */
+void mixieee32_vol(const float *src, float *dst, unsigned frames, unsigned channels, const float *vols)
+{
+    unsigned samples = frames * channels, i = 0, j;
+
+    TRACE("%p - %p %u, %u channels\n", src, dst, frames, channels);
+
+#ifdef __SSE2__
+    {
+        float pattern[4 * DS_MAX_CHANNELS];
+        unsigned period;
+
+        /* Repeat the volumes over the smallest multiple of the channel count
+         * that fills whole vectors. */
+        period = channels % 4 ? (channels % 2 ? channels * 4 : channels * 2) : channels;
+        for (j = 0; j < period; ++j)
+            pattern[j] = vols[j % channels];
+
+        for (; i + period <= samples; i += period)
+        {
+            for (j = 0; j < period; j += 4)
+            {
+                __m128 s = _mm_mul_ps(_mm_loadu_ps(&src[i + j]), _mm_loadu_ps(&pattern[j]));
+                _mm_storeu_ps(&dst[i + j], _mm_add_ps(_mm_loadu_ps(&dst[i + j]), s));
+            }
+        }
+    }
+#endif
+
+    for (j = 0; i < samples; ++i, j = (j + 1) % channels)
+        dst[i] += src[i] * vols[j];
+}
@@ -49,7 +49,9 @@ extern const bitsgetfunc getbpp[4];
 void getieee32(const IDirectSoundBufferImpl *dsb, BYTE *base, float *dst, unsigned samples, DWORD channel);
 void putieee32(const IDirectSoundBufferImpl *dsb, DWORD pos, DWORD channel, float value);
 void putieee32_sum(const IDirectSoundBufferImpl *dsb, DWORD pos, DWORD channel, float value);
+void putieee32_planar(const IDirectSoundBufferImpl *dsb, const float *src, unsigned stride, UINT ostride, unsigned frames);
 void mixieee32(float *src, float *dst, unsigned samples);
+void mixieee32_vol(const float *src, float *dst, unsigned frames, unsigned channels, const float *vols);
 
 typedef struct _DSVOLUMEPAN
 {
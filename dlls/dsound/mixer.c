@@ -601,9 +601,12 @@ static UINT cp_fields_resample(IDirectSoundBufferImpl *dsb, UINT count, DWORD *f
                 required_input, count, intermediate + channel * required_input,
                 output + channel * (FIR_WIDTH - 1 + count));
 
-    for(i = 0; i < count; ++i)
-        for (channel = 0; channel < channels; channel++)
-            dsb->put(dsb, i * ostride, channel, output[channel * (FIR_WIDTH - 1 + count) + i]);
+    if (dsb->put == putieee32)
+        putieee32_planar(dsb, output, FIR_WIDTH - 1 + count, ostride, count);
+    else
+        for(i = 0; i < count; ++i)
+            for (channel = 0; channel < channels; channel++)
+                dsb->put(dsb, i * ostride, channel, output[channel * (FIR_WIDTH - 1 + count) + i]);
 
     return max_ipos;
 }
@@ -647,9 +650,12 @@ static UINT cp_fields_noresample(IDirectSoundBufferImpl *dsb, UINT count)
                     count - committed_samples, intermediate + channel * count + committed_samples);
     }
 
-    for (i = 0; i < count; i++)
-        for (channel = 0; channel < dsb->mix_channels; channel++)
-            dsb->put(dsb, i * ostride, channel, intermediate[channel * count + i]);
+    if (dsb->put == putieee32)
+        putieee32_planar(dsb, intermediate, count, ostride, count);
+    else
+        for (i = 0; i < count; i++)
+            for (channel = 0; channel < dsb->mix_channels; channel++)
+                dsb->put(dsb, i * ostride, channel, intermediate[channel * count + i]);
 
     return count;
 }
@@ -739,35 +745,35 @@ static void DSOUND_MixToTemporary(IDirectSoundBufferImpl *dsb, DWORD frames)
 	}
 }
 
-static void DSOUND_MixerVol(const IDirectSoundBufferImpl *dsb, INT frames)
+/**
+ * Compute the per-channel volumes of the given secondary buffer.
+ *
+ * Returns FALSE if no volume needs to be applied, in which case the
+ * temporary buffer can be mixed in as is.
+ */
+static BOOL DSOUND_MixerVol(const IDirectSoundBufferImpl *dsb, float *vols)
 {
-	INT	i;
-	float vols[DS_MAX_CHANNELS];
-	UINT channels = dsb->device->pwfx->nChannels, chan;
+	UINT channels = dsb->device->pwfx->nChannels, i;
 
-	TRACE("(%p,%d)\n",dsb,frames);
+	TRACE("(%p)\n",dsb);
 	TRACE("left = %lx, right = %lx\n", dsb->volpan.dwTotalAmpFactor[0],
 		dsb->volpan.dwTotalAmpFactor[1]);
 
 	if ((!(dsb->dsbd.dwFlags & DSBCAPS_CTRLPAN) || (dsb->volpan.lPan == 0)) &&
 	    (!(dsb->dsbd.dwFlags & DSBCAPS_CTRLVOLUME) || (dsb->volpan.lVolume == 0)) &&
 	     !(dsb->dsbd.dwFlags & DSBCAPS_CTRL3D))
-		return; /* Nothing to do */
+		return FALSE; /* Nothing to do */
 
 	if (channels > DS_MAX_CHANNELS)
 	{
 		FIXME("There is no support for %u channels\n", channels);
-		return;
+		return FALSE;
 	}
 
 	for (i = 0; i < channels; ++i)
 		vols[i] = dsb->volpan.dwTotalAmpFactor[i] / ((float)0xFFFF);
 
-	for(i = 0; i < frames; ++i){
-		for(chan = 0; chan < channels; ++chan){
-			dsb->device->tmp_buffer[i * channels + chan] *= vols[chan];
-		}
-	}
+	return TRUE;
 }
 
 /**
@@ -796,10 +802,14 @@ static DWORD DSOUND_MixInBuffer(IDirectSoundBufferImpl *dsb, float *mix_buffer,
 	ibuf = dsb->device->tmp_buffer;
 
 	if (secondarybuffer_is_audible(dsb)) {
-		/* Apply volume if needed */
-		DSOUND_MixerVol(dsb, frames);
-
-		mixieee32(ibuf, mix_buffer, frames * dsb->device->pwfx->nChannels);
+		UINT channels = dsb->device->pwfx->nChannels;
+		float vols[DS_MAX_CHANNELS];
+
+		/* Apply volume if needed, while accumulating */
+		if (DSOUND_MixerVol(dsb, vols))
+			mixieee32_vol(ibuf, mix_buffer, frames, channels, vols);
+		else
+			mixieee32(ibuf, mix_buffer, frames * channels);
 	}
 
 	/* check for notification positions */
@@ -912,7 +922,7 @@ static void DSOUND_WaveQueue(DirectSoundDevice *device, LPBYTE pos, DWORD bytes)
  *
  * secondary->buffer (secondary format)
  *   =[Resample]=> device->tmp_buffer (float format)
- *   =[Volume]=> device->tmp_buffer (float format)
+ *   =[Volume, Mix]=> primary buffer (float format)
  */
 static void DSOUND_PerformMix(DirectSoundDevice *device)
 {
@@ -1988,6 +1988,85 @@ static void test_primary_independent(void)
     IDirectSound8_Release(dso1);
 }
 
+static void test_surround71_secondary(WORD channels)
+{
+    DSBUFFERDESC bufdesc = {.dwSize = sizeof(bufdesc)};
+    IDirectSoundBuffer *primary, *secondary;
+    WAVEFORMATEXTENSIBLE fmtex;
+    DWORD size1, size2, pos, i;
+    WAVEFORMATEX wfx;
+    IDirectSound8 *dso;
+    void *ptr1, *ptr2;
+    float *samples;
+    HRESULT hr;
+
+    winetest_push_context("%u channels", channels);
+
+    hr = DirectSoundCreate8(NULL, &dso, NULL);
+    ok(hr == DS_OK || hr == DSERR_NODRIVER || hr == DSERR_ALLOCATED || hr == E_FAIL,
+       "DirectSoundCreate8() failed: %08lx\n", hr);
+    if (FAILED(hr))
+    {
+        winetest_pop_context();
+        return;
+    }
+
+    hr = IDirectSound8_SetCooperativeLevel(dso, get_hwnd(), DSSCL_PRIORITY);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+
+    bufdesc.dwFlags = DSBCAPS_PRIMARYBUFFER;
+    hr = IDirectSound8_CreateSoundBuffer(dso, &bufdesc, &primary, NULL);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+
+    fmtex.Format.cbSize = sizeof(WAVEFORMATEXTENSIBLE) - sizeof(WAVEFORMATEX);
+    fmtex.Format.wFormatTag = WAVE_FORMAT_EXTENSIBLE;
+    fmtex.Format.nChannels = 8;
+    fmtex.Format.nSamplesPerSec = 48000;
+    fmtex.Format.wBitsPerSample = 32;
+    fmtex.Format.nBlockAlign = fmtex.Format.nChannels * fmtex.Format.wBitsPerSample / 8;
+    fmtex.Format.nAvgBytesPerSec = fmtex.Format.nSamplesPerSec * fmtex.Format.nBlockAlign;
+    fmtex.Samples.wValidBitsPerSample = 32;
+    fmtex.dwChannelMask = KSAUDIO_SPEAKER_7POINT1_SURROUND;
+    fmtex.SubFormat = KSDATAFORMAT_SUBTYPE_IEEE_FLOAT;
+    hr = IDirectSoundBuffer_SetFormat(primary, (WAVEFORMATEX *)&fmtex);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+
+    /* Play a buffer with fewer channels than the primary format. The mix
+     * itself is done in the device format, so this only covers the mono and
+     * stereo to 7.1 conversion when the device has a 7.1 layout. */
+    init_format(&wfx, WAVE_FORMAT_IEEE_FLOAT, 48000, 32, channels);
+    bufdesc.dwFlags = DSBCAPS_GETCURRENTPOSITION2;
+    bufdesc.dwBufferBytes = wfx.nAvgBytesPerSec / 2;
+    bufdesc.lpwfxFormat = &wfx;
+    hr = IDirectSound8_CreateSoundBuffer(dso, &bufdesc, &secondary, NULL);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+
+    hr = IDirectSoundBuffer_Lock(secondary, 0, 0, &ptr1, &size1, &ptr2, &size2, DSBLOCK_ENTIREBUFFER);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+    ok(size1 == bufdesc.dwBufferBytes, "Got size %lu.\n", size1);
+    for (i = 0, samples = ptr1; i < size1 / sizeof(float); i++)
+        samples[i] = (i / channels) % 100 < 50 ? 0.25f : -0.25f;
+    hr = IDirectSoundBuffer_Unlock(secondary, ptr1, size1, ptr2, size2);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+
+    hr = IDirectSoundBuffer_Play(secondary, 0, 0, DSBPLAY_LOOPING);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+    Sleep(200);
+
+    hr = IDirectSoundBuffer_GetCurrentPosition(secondary, &pos, NULL);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+    ok(!(pos % wfx.nBlockAlign), "Got unaligned position %lu.\n", pos);
+    trace("play position %lu\n", pos);
+
+    hr = IDirectSoundBuffer_Stop(secondary);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+
+    IDirectSoundBuffer_Release(secondary);
+    IDirectSoundBuffer_Release(primary);
+    IDirectSound8_Release(dso);
+    winetest_pop_context();
+}
+
 START_TEST(dsound8)
 {
     DWORD cookie;
@@ -2014,6 +2093,8 @@ START_TEST(dsound8)
     CoRevokeClassObject(cookie);
 
     test_primary_independent();
+    test_surround71_secondary(1);
+    test_surround71_secondary(2);
 
     CoUninitialize();
 }
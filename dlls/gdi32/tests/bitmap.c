@@ -30,6 +30,7 @@
 #include "winerror.h"
 #include "wingdi.h"
 #include "winuser.h"
+#include "winreg.h"
 #include "mmsystem.h"
 #include "winternl.h"
 #include "ddk/d3dkmthk.h"
@@ -4120,6 +4121,143 @@ static void test_clipping(void)
     DeleteDC( hdcSrc );
 }
 
+static void draw_large_blits( HDC hdc, HDC hdc_src, int width, int height )
+{
+    static const TRIVERTEX vt[3] = { { 0,    0,  0xff00, 0x1000, 0x0000, 0x8000 },
+                                     { 500, 60,  0x0000, 0xff00, 0x2000, 0x4000 },
+                                     { 80, 480,  0x3000, 0x0000, 0xff00, 0xff00 } };
+    GRADIENT_RECT rect = { 0, 1 };
+    GRADIENT_TRIANGLE tri = { 0, 1, 2 };
+    BLENDFUNCTION blend = { AC_SRC_OVER, 0, 0xc0, AC_SRC_ALPHA };
+
+    SetStretchBltMode( hdc, COLORONCOLOR );
+    StretchBlt( hdc, 0, 0, width, height, hdc_src, 0, 0, width / 2 + 7, height / 2 + 3, SRCCOPY );
+    SetStretchBltMode( hdc, BLACKONWHITE );
+    StretchBlt( hdc, 0, height, width, -height, hdc_src, 3, 1, width - 5, height + 5, SRCCOPY );
+    if (pGdiGradientFill)
+    {
+        pGdiGradientFill( hdc, (TRIVERTEX *)vt, 3, &rect, 1, GRADIENT_FILL_RECT_V );
+        pGdiGradientFill( hdc, (TRIVERTEX *)vt, 3, &tri, 1, GRADIENT_FILL_TRIANGLE );
+    }
+    if (pGdiAlphaBlend) pGdiAlphaBlend( hdc, 0, 0, width, height, hdc_src, 0, 0, width, height, blend );
+}
+
+/* large operations may be split into bands internally, check that the result
+ * doesn't depend on how the destination is divided */
+static void test_large_blits_size( int width, int height )
+{
+    static const int band = 7;
+    HBITMAP bmp_src, bmp_dst, bmp_ref;
+    HDC hdc_src, hdc_dst, hdc_ref;
+    DWORD *src_bits, *dst_bits, *ref_bits;
+    BITMAPINFO bmi;
+    HRGN rgn;
+    int x, y;
+
+    hdc_src = CreateCompatibleDC( NULL );
+    hdc_dst = CreateCompatibleDC( NULL );
+    hdc_ref = CreateCompatibleDC( NULL );
+
+    memset( &bmi, 0, sizeof(bmi) );
+    bmi.bmiHeader.biSize = sizeof(bmi.bmiHeader);
+    bmi.bmiHeader.biWidth = width;
+    bmi.bmiHeader.biHeight = -height;
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biCompression = BI_RGB;
+    bmp_src = CreateDIBSection( hdc_src, &bmi, DIB_RGB_COLORS, (void **)&src_bits, NULL, 0 );
+    ok( bmp_src != NULL, "couldn't create bitmap\n" );
+    bmp_dst = CreateDIBSection( hdc_dst, &bmi, DIB_RGB_COLORS, (void **)&dst_bits, NULL, 0 );
+    ok( bmp_dst != NULL, "couldn't create bitmap\n" );
+    bmp_ref = CreateDIBSection( hdc_ref, &bmi, DIB_RGB_COLORS, (void **)&ref_bits, NULL, 0 );
+    ok( bmp_ref != NULL, "couldn't create bitmap\n" );
+    SelectObject( hdc_src, bmp_src );
+    SelectObject( hdc_dst, bmp_dst );
+    SelectObject( hdc_ref, bmp_ref );
+
+    for (y = 0; y < height; y++)
+    {
+        for (x = 0; x < width; x++)
+        {
+            BYTE alpha = (x * 7 + y * 3) & 0xff;
+            src_bits[y * width + x] = alpha << 24 | ((x ^ y) % (alpha + 1)) << 16 |
+                                      ((x * y) % (alpha + 1)) << 8 | ((x + y) % (alpha + 1));
+        }
+    }
+
+    draw_large_blits( hdc_dst, hdc_src, width, height );
+
+    /* the reference is drawn in bands too small to ever be split, and which
+     * don't line up with the bands of the full size operations */
+    rgn = CreateRectRgn( 0, 0, 0, 0 );
+    for (y = 0; y < height; y += band)
+    {
+        SetRectRgn( rgn, 0, y, width, y + band );
+        SelectClipRgn( hdc_ref, rgn );
+        draw_large_blits( hdc_ref, hdc_src, width, height );
+    }
+    DeleteObject( rgn );
+
+    for (y = 0; y < height; y++)
+    {
+        if (memcmp( dst_bits + y * width, ref_bits + y * width, width * sizeof(DWORD) )) break;
+    }
+    ok( y == height, "%dx%d: row %d differs\n", width, height, y );
+
+    DeleteDC( hdc_src );
+    DeleteDC( hdc_dst );
+    DeleteDC( hdc_ref );
+    DeleteObject( bmp_src );
+    DeleteObject( bmp_dst );
+    DeleteObject( bmp_ref );
+}
+
+static void test_large_blits(void)
+{
+    test_large_blits_size( 512, 512 );
+    test_large_blits_size( 509, 517 );
+    test_large_blits_size( 300, 257 );
+}
+
+/* Wine splits large operations across threads only when HKCU\Software\Wine\GDI\DibThreads
+ * is set when the process first draws, so run the same tests again in a child process */
+static void test_threaded_large_blits(void)
+{
+    DWORD threads = 4, old_threads, type, size = sizeof(old_threads);
+    PROCESS_INFORMATION info;
+    STARTUPINFOA startup;
+    char cmdline[MAX_PATH];
+    char **argv;
+    HKEY key;
+    LONG ret;
+
+    ret = RegCreateKeyExA( HKEY_CURRENT_USER, "Software\\Wine\\GDI", 0, NULL, 0,
+                           KEY_QUERY_VALUE | KEY_SET_VALUE, NULL, &key, NULL );
+    ok( !ret, "RegCreateKeyExA failed, error %ld\n", ret );
+    if (ret) return;
+    if (RegQueryValueExA( key, "DibThreads", NULL, &type, (BYTE *)&old_threads, &size ) ||
+        type != REG_DWORD)
+        size = 0;
+    ret = RegSetValueExA( key, "DibThreads", 0, REG_DWORD, (BYTE *)&threads, sizeof(threads) );
+    ok( !ret, "RegSetValueExA failed, error %ld\n", ret );
+
+    winetest_get_mainargs( &argv );
+    sprintf( cmdline, "\"%s\" bitmap large_blits", argv[0] );
+    memset( &startup, 0, sizeof(startup) );
+    startup.cb = sizeof(startup);
+    if (CreateProcessA( NULL, cmdline, NULL, NULL, FALSE, 0, NULL, NULL, &startup, &info ))
+    {
+        wait_child_process( &info );
+        CloseHandle( info.hProcess );
+        CloseHandle( info.hThread );
+    }
+    else ok( 0, "CreateProcess failed, error %lu\n", GetLastError() );
+
+    if (size) RegSetValueExA( key, "DibThreads", 0, REG_DWORD, (BYTE *)&old_threads, sizeof(old_threads) );
+    else RegDeleteValueA( key, "DibThreads" );
+    RegCloseKey( key );
+}
+
 static void test_32bit_ddb(void)
 {
     char buffer[sizeof(BITMAPINFOHEADER) + sizeof(DWORD)];
@@ -6467,6 +6605,7 @@ static void test_GdiTransparentBlt(void)
 START_TEST(bitmap)
 {
     HMODULE hdll;
+    char **argv;
 
     hdll = GetModuleHandleA("gdi32.dll");
     pD3DKMTCreateDCFromMemory  = (void *)GetProcAddress( hdll, "D3DKMTCreateDCFromMemory" );
@@ -6474,6 +6613,12 @@ START_TEST(bitmap)
     pGdiAlphaBlend             = (void *)GetProcAddress( hdll, "GdiAlphaBlend" );
     pGdiGradientFill           = (void *)GetProcAddress( hdll, "GdiGradientFill" );
 
+    if (winetest_get_mainargs( &argv ) >= 3)
+    {
+        if (!strcmp( argv[2], "large_blits" )) test_large_blits();
+        return;
+    }
+
     test_createdibitmap();
     test_dibsections();
     test_dib_formats();
@@ -6500,6 +6645,8 @@ START_TEST(bitmap)
     test_bitmapinfoheadersize();
     test_get16dibits();
     test_clipping();
+    test_large_blits();
+    test_threaded_large_blits();
     test_GetDIBits_top_down(16);
     test_GetDIBits_top_down(24);
     test_GetDIBits_top_down(32);
@@ -3529,11 +3529,126 @@ static void test_simple_graphics(void)
     DeleteDC(mem_dc);
 }
 
+static void create_benchmark_dib(HDC hdc, int bpp, void **bits, HBITMAP *old)
+{
+    char bmibuf[sizeof(BITMAPINFO) + 256 * sizeof(RGBQUAD)];
+    BITMAPINFO *bmi = (BITMAPINFO *)bmibuf;
+    HBITMAP dib;
+
+    memset(bmibuf, 0, sizeof(bmibuf));
+    bmi->bmiHeader.biSize = sizeof(bmi->bmiHeader);
+    bmi->bmiHeader.biWidth = 1024;
+    bmi->bmiHeader.biHeight = -1024;
+    bmi->bmiHeader.biPlanes = 1;
+    bmi->bmiHeader.biBitCount = bpp;
+    bmi->bmiHeader.biCompression = BI_RGB;
+
+    dib = CreateDIBSection(0, bmi, DIB_RGB_COLORS, bits, NULL, 0);
+    ok(dib != NULL, "CreateDIBSection failed\n");
+    *old = SelectObject(hdc, dib);
+}
+
+enum benchmark_op
+{
+    BENCHMARK_PATINVERT,
+    BENCHMARK_SRCCOPY,
+    BENCHMARK_SRCINVERT,
+    BENCHMARK_CONSTANT_ALPHA,
+    BENCHMARK_PER_PIXEL_ALPHA,
+};
+
+static void run_benchmark(const char *name, HDC dst_dc, HDC src_dc, HBRUSH brush, enum benchmark_op op)
+{
+    BLENDFUNCTION blend = { AC_SRC_OVER, 0, 0x80, 0 };
+    HBRUSH old_brush;
+    DWORD start;
+    int i;
+
+    if (op == BENCHMARK_PER_PIXEL_ALPHA)
+    {
+        blend.SourceConstantAlpha = 0xff;
+        blend.AlphaFormat = AC_SRC_ALPHA;
+    }
+
+    old_brush = SelectObject(dst_dc, brush);
+    start = GetTickCount();
+    for (i = 0; i < 200; i++)
+    {
+        switch (op)
+        {
+        case BENCHMARK_PATINVERT:
+            PatBlt(dst_dc, 0, 0, 1024, 1024, PATINVERT);
+            break;
+        case BENCHMARK_SRCCOPY:
+            BitBlt(dst_dc, 0, 0, 1024, 1024, src_dc, 0, 0, SRCCOPY);
+            break;
+        case BENCHMARK_SRCINVERT:
+            BitBlt(dst_dc, 0, 0, 1024, 1024, src_dc, 0, 0, SRCINVERT);
+            break;
+        case BENCHMARK_CONSTANT_ALPHA:
+        case BENCHMARK_PER_PIXEL_ALPHA:
+            GdiAlphaBlend(dst_dc, 0, 0, 1024, 1024, src_dc, 0, 0, 1024, 1024, blend);
+            break;
+        }
+    }
+    GdiFlush();
+    trace("%s ran in %lu ms\n", name, GetTickCount() - start);
+    SelectObject(dst_dc, old_brush);
+}
+
+/* Time the operations that go through the vectorized row helpers. Stretching
+ * is not included, since stretch_row_*() copies scalar pixels. */
+static void run_benchmarks(void)
+{
+    HDC dst_dc = CreateCompatibleDC(0), src_dc = CreateCompatibleDC(0);
+    HBRUSH solid = CreateSolidBrush(RGB(0x12, 0x34, 0x56));
+    HBRUSH hatch = CreateHatchBrush(HS_DIAGCROSS, RGB(0x65, 0x43, 0x21));
+    HBITMAP old_dst, old_src;
+    void *dst_bits, *src_bits;
+    DWORD *pixel;
+    int i;
+
+    SetBkColor(dst_dc, RGB(0xaa, 0xbb, 0xcc));
+    create_benchmark_dib(dst_dc, 32, &dst_bits, &old_dst);
+    create_benchmark_dib(src_dc, 32, &src_bits, &old_src);
+    for (i = 0, pixel = src_bits; i < 1024 * 1024; i++)
+        pixel[i] = (i & 0xff) * 0x01010101;
+
+    run_benchmark("32-bpp solid PATINVERT", dst_dc, src_dc, solid, BENCHMARK_PATINVERT);
+    run_benchmark("32-bpp hatched PATINVERT", dst_dc, src_dc, hatch, BENCHMARK_PATINVERT);
+    run_benchmark("32-bpp SRCCOPY", dst_dc, src_dc, solid, BENCHMARK_SRCCOPY);
+    run_benchmark("32-bpp SRCINVERT", dst_dc, src_dc, solid, BENCHMARK_SRCINVERT);
+    run_benchmark("32-bpp constant alpha blend", dst_dc, src_dc, solid, BENCHMARK_CONSTANT_ALPHA);
+    run_benchmark("32-bpp per-pixel alpha blend", dst_dc, src_dc, solid, BENCHMARK_PER_PIXEL_ALPHA);
+
+    DeleteObject(SelectObject(src_dc, old_src));
+    create_benchmark_dib(src_dc, 16, &src_bits, &old_src);
+    memset(src_bits, 0x5a, 1024 * 1024 * 2);
+    run_benchmark("555 to 32-bpp conversion", dst_dc, src_dc, solid, BENCHMARK_SRCCOPY);
+
+    DeleteObject(SelectObject(dst_dc, old_dst));
+    create_benchmark_dib(dst_dc, 16, &dst_bits, &old_dst);
+    run_benchmark("16-bpp solid PATINVERT", dst_dc, src_dc, solid, BENCHMARK_PATINVERT);
+    run_benchmark("16-bpp hatched PATINVERT", dst_dc, src_dc, hatch, BENCHMARK_PATINVERT);
+    run_benchmark("16-bpp SRCCOPY", dst_dc, src_dc, solid, BENCHMARK_SRCCOPY);
+    run_benchmark("16-bpp SRCINVERT", dst_dc, src_dc, solid, BENCHMARK_SRCINVERT);
+
+    DeleteObject(SelectObject(dst_dc, old_dst));
+    DeleteObject(SelectObject(src_dc, old_src));
+    DeleteObject(solid);
+    DeleteObject(hatch);
+    DeleteDC(dst_dc);
+    DeleteDC(src_dc);
+}
+
 START_TEST(dib)
 {
     CryptAcquireContextW(&crypt_prov, NULL, NULL, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT);
 
     test_simple_graphics();
 
+    if (winetest_interactive)
+        run_benchmarks();
+
     CryptReleaseContext(crypt_prov, 0);
 }
@@ -216,6 +216,103 @@ static struct hid_report *hid_queue_pop_report( struct hid_queue *queue )
     return report;
 }
 
+/* only the creator may write to the section, everyone else may only map it for reading */
+static void init_shared_input_security( SECURITY_DESCRIPTOR *sd, ACL *acl, ULONG acl_size )
+{
+    static const SID world_sid = {SID_REVISION, 1, {SECURITY_WORLD_SID_AUTHORITY}, {SECURITY_WORLD_RID}};
+    static const SID system_sid = {SID_REVISION, 1, {SECURITY_NT_AUTHORITY}, {SECURITY_LOCAL_SYSTEM_RID}};
+
+    RtlCreateSecurityDescriptor( sd, SECURITY_DESCRIPTOR_REVISION );
+    RtlCreateAcl( acl, acl_size, ACL_REVISION );
+    RtlAddAccessAllowedAce( acl, ACL_REVISION, SECTION_ALL_ACCESS, (SID *)&system_sid );
+    RtlAddAccessAllowedAce( acl, ACL_REVISION, SECTION_QUERY | SECTION_MAP_READ, (SID *)&world_sid );
+    RtlSetDaclSecurityDescriptor( sd, TRUE, acl, FALSE );
+}
+
+void hid_device_create_shared_input( struct phys_device *pdo )
+{
+    static const WCHAR dirW[] = L"\\BaseNamedObjects\\";
+    ULONG max_length = pdo->collection_desc->InputLength;
+    WCHAR buffer[MAX_PATH + ARRAY_SIZE(dirW)];
+    BYTE acl_buffer[sizeof(ACL) + 2 * (sizeof(ACCESS_ALLOWED_ACE) + sizeof(SID))];
+    SECURITY_DESCRIPTOR sd;
+    OBJECT_ATTRIBUTES attr;
+    SIZE_T view_size = 0;
+    UNICODE_STRING name;
+    LARGE_INTEGER size;
+    NTSTATUS status;
+    void *view = NULL;
+
+    if (!max_length) return;
+
+    /* only game controllers, as read by xinput, publish their reports */
+    if (pdo->collection_desc->UsagePage != HID_USAGE_PAGE_GENERIC) return;
+    if (pdo->collection_desc->Usage != HID_USAGE_GENERIC_GAMEPAD &&
+        pdo->collection_desc->Usage != HID_USAGE_GENERIC_JOYSTICK &&
+        pdo->collection_desc->Usage != HID_USAGE_GENERIC_MULTI_AXIS_CONTROLLER) return;
+
+    wcscpy( buffer, dirW );
+    hid_shared_input_name( pdo->link_name.Buffer, pdo->link_name.Length / sizeof(WCHAR),
+                           buffer + wcslen( dirW ), ARRAY_SIZE(buffer) - wcslen( dirW ) );
+    RtlInitUnicodeString( &name, buffer );
+    init_shared_input_security( &sd, (ACL *)acl_buffer, sizeof(acl_buffer) );
+    InitializeObjectAttributes( &attr, &name, OBJ_CASE_INSENSITIVE, NULL, &sd );
+    size.QuadPart = offsetof( struct hid_shared_input, report[max_length] );
+
+    if (!NT_SUCCESS(status = ZwCreateSection( &pdo->shared_section, SECTION_ALL_ACCESS, &attr, &size,
+                                              PAGE_READWRITE, SEC_COMMIT, NULL )))
+    {
+        WARN( "Failed to create section %s, status %#lx.\n", debugstr_w(buffer), status );
+        pdo->shared_section = NULL;
+        return;
+    }
+
+    if ((status = ZwMapViewOfSection( pdo->shared_section, NtCurrentProcess(), &view, 0, 0, NULL,
+                                      &view_size, ViewUnmap, 0, PAGE_READWRITE )))
+    {
+        WARN( "Failed to map section %s, status %#lx.\n", debugstr_w(buffer), status );
+        ZwClose( pdo->shared_section );
+        pdo->shared_section = NULL;
+        return;
+    }
+
+    TRACE( "pdo %p, created shared input section %s\n", pdo, debugstr_w(buffer) );
+    pdo->shared_input = view;
+    pdo->shared_input->max_length = max_length;
+}
+
+void hid_device_destroy_shared_input( struct phys_device *pdo )
+{
+    struct hid_shared_input *shared;
+    KIRQL irql;
+
+    if (!pdo->shared_section) return;
+
+    KeAcquireSpinLock( &pdo->lock, &irql );
+    shared = pdo->shared_input;
+    pdo->shared_input = NULL;
+    KeReleaseSpinLock( &pdo->lock, irql );
+
+    ZwUnmapViewOfSection( NtCurrentProcess(), shared );
+    ZwClose( pdo->shared_section );
+    pdo->shared_section = NULL;
+}
+
+/* publish the latest input report, pdo->lock must be held */
+static void hid_device_update_shared_input( struct phys_device *pdo, HID_XFER_PACKET *packet, ULONG report_len )
+{
+    struct hid_shared_input *shared = pdo->shared_input;
+    ULONG length = min( packet->reportBufferLen, shared->max_length );
+    ULONGLONG time = KeQueryPerformanceCounter( NULL );
+
+    InterlockedIncrement( &shared->seq );
+    memcpy( shared->report, packet->reportBuffer, length );
+    memset( shared->report + length, 0, shared->max_length - length );
+    shared->length = min( report_len, shared->max_length );
+    shared->time.QuadPart = time;
+    InterlockedIncrement( &shared->seq );
+}
+
 static void hid_device_queue_input( struct phys_device *pdo, HID_XFER_PACKET *packet, BOOL polled )
 {
     HIDP_COLLECTION_DESC *desc = pdo->collection_desc;
@@ -264,6 +361,7 @@ static void hid_device_queue_input( struct phys_device *pdo, HID_XFER_PACKET *pa
     InitializeListHead( &completed );
 
     KeAcquireSpinLock( &pdo->lock, &irql );
+    if (!pdo->removed && pdo->shared_input) hid_device_update_shared_input( pdo, packet, report_len );
     if (pdo->removed) WARN( "Device has been removed, dropping report\n" );
     else LIST_FOR_EACH_ENTRY( queue, &pdo->queues, struct hid_queue, entry )
     {
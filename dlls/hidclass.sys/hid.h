@@ -89,6 +89,9 @@ struct phys_device
     UNICODE_STRING mouse_link_name;
     BOOL is_keyboard;
     UNICODE_STRING keyboard_link_name;
+
+    HANDLE shared_section;
+    struct hid_shared_input *shared_input;
 };
 
 static inline struct phys_device *pdo_from_DEVICE_OBJECT( DEVICE_OBJECT *device )
@@ -143,6 +146,8 @@ HIDP_REPORT_IDS *find_report_with_type_and_id( HIDP_DEVICE_DESC *desc, UCHAR col
 DWORD CALLBACK hid_device_thread(void *args);
 void hid_queue_remove_pending_irps( struct hid_queue *queue );
 void hid_queue_destroy( struct hid_queue *queue );
+void hid_device_create_shared_input( struct phys_device *pdo );
+void hid_device_destroy_shared_input( struct phys_device *pdo );
 
 NTSTATUS WINAPI pdo_ioctl( DEVICE_OBJECT *device, IRP *irp );
 NTSTATUS WINAPI pdo_read( DEVICE_OBJECT *device, IRP *irp );
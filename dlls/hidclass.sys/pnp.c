@@ -574,6 +574,8 @@ static NTSTATUS pdo_pnp( DEVICE_OBJECT *device, IRP *irp )
                     pdo->is_keyboard = TRUE;
             }
 
+            hid_device_create_shared_input( pdo );
+
             IoSetDeviceInterfaceState( &pdo->link_name, TRUE );
             if (pdo->is_mouse) IoSetDeviceInterfaceState( &pdo->mouse_link_name, TRUE );
             if (pdo->is_keyboard) IoSetDeviceInterfaceState( &pdo->keyboard_link_name, TRUE );
@@ -594,6 +596,7 @@ static NTSTATUS pdo_pnp( DEVICE_OBJECT *device, IRP *irp )
                 hid_queue_destroy( queue );
             KeReleaseSpinLock( &pdo->lock, irql );
 
+            hid_device_destroy_shared_input( pdo );
             RtlFreeUnicodeString( &pdo->link_name );
 
             irp->IoStatus.Status = STATUS_SUCCESS;
@@ -379,6 +379,7 @@ static HRESULT stream_init(struct audio_client *client, const BOOLEAN force_def_
                            REFERENCE_TIME duration, REFERENCE_TIME period,
                            const WAVEFORMATEX *fmt, const GUID *sessionguid)
 {
+    struct render_shared_state *render_shared = NULL;
     struct create_stream_params params;
     UINT32 i, channel_count;
     stream_handle stream;
@@ -495,6 +496,7 @@ static HRESULT stream_init(struct audio_client *client, const BOOLEAN force_def_
     params.fmt           = fmt;
     params.channel_count = &channel_count;
     params.stream        = &stream;
+    params.shared        = &render_shared;
 
     wine_unix_call(create_stream, &params);
 
@@ -523,6 +525,7 @@ exit:
     } else {
         list_add_tail(&client->session->clients, &client->entry);
         client->stream = stream;
+        client->render_shared = render_shared;
         client->channel_count = channel_count;
         set_stream_volumes(client);
     }
@@ -1433,10 +1436,36 @@ static ULONG WINAPI render_Release(IAudioRenderClient *iface)
     return IAudioClient3_Release(&This->IAudioClient3_iface);
 }
 
+/* Read a consistent snapshot of the driver's ring buffer counters, including
+ * buffers released but not yet seen by the driver. */
+static void render_shared_read(const struct render_shared_state *shared, UINT32 *held, UINT32 *wri_offs)
+{
+    UINT32 held_bytes, lcl_offs_bytes;
+    LONG seq;
+
+    for (;;)
+    {
+        if (!((seq = ReadAcquire(&shared->seq)) & 1))
+        {
+            held_bytes = shared->held_bytes + ReadNoFence(&shared->pending_bytes);
+            lcl_offs_bytes = shared->lcl_offs_bytes;
+            MemoryBarrier();
+            if (ReadNoFence(&shared->seq) == seq)
+                break;
+        }
+        YieldProcessor();
+    }
+
+    *held = held_bytes;
+    *wri_offs = (lcl_offs_bytes + held_bytes) % shared->ring_bytes;
+}
+
 static HRESULT WINAPI render_GetBuffer(IAudioRenderClient *iface, UINT32 frames, BYTE **data)
 {
     struct audio_client *This = impl_from_IAudioRenderClient(iface);
+    struct render_shared_state *shared = This->render_shared;
     struct get_render_buffer_params params;
+    UINT32 held, wri_offs, bytes;
 
     TRACE("(%p)->(%u, %p)\n", This, frames, data);
 
@@ -1448,6 +1477,26 @@ static HRESULT WINAPI render_GetBuffer(IAudioRenderClient *iface, UINT32 frames,
 
     *data = NULL;
 
+    if (shared && frames)
+    {
+        if (shared->locked_bytes)
+            return AUDCLNT_E_OUT_OF_ORDER;
+
+        render_shared_read(shared, &held, &wri_offs);
+        if (held / shared->frame_size + frames > shared->bufsize_frames)
+            return AUDCLNT_E_BUFFER_TOO_LARGE;
+
+        /* Buffers wrapping around the end of the ring need the driver. */
+        bytes = frames * shared->frame_size;
+        if (wri_offs + bytes <= shared->ring_bytes)
+        {
+            *data = (BYTE *)shared - shared->ring_offset + wri_offs;
+            memset(*data, shared->silence, bytes);
+            shared->locked_bytes = bytes;
+            return S_OK;
+        }
+    }
+
     params.stream = This->stream;
     params.frames = frames;
     params.data   = data;
@@ -1461,13 +1510,34 @@ static HRESULT WINAPI render_ReleaseBuffer(IAudioRenderClient *iface, UINT32 wri
                                            DWORD flags)
 {
     struct audio_client *This = impl_from_IAudioRenderClient(iface);
+    struct render_shared_state *shared = This->render_shared;
     struct release_render_buffer_params params;
+    UINT32 held, wri_offs, bytes;
 
     TRACE("(%p)->(%u, %lx)\n", This, written_frames, flags);
 
     if (!This->stream)
         return AUDCLNT_E_NOT_INITIALIZED;
 
+    if (shared && shared->locked_bytes > 0)
+    {
+        bytes = written_frames * shared->frame_size;
+        if (bytes > (UINT32)shared->locked_bytes)
+            return AUDCLNT_E_INVALID_SIZE;
+
+        if (bytes)
+        {
+            if (flags & AUDCLNT_BUFFERFLAGS_SILENT)
+            {
+                render_shared_read(shared, &held, &wri_offs);
+                memset((BYTE *)shared - shared->ring_offset + wri_offs, shared->silence, bytes);
+            }
+            InterlockedAdd(&shared->pending_bytes, bytes);
+        }
+        WriteRelease(&shared->locked_bytes, 0);
+        return S_OK;
+    }
+
     params.stream         = This->stream;
     params.written_frames = written_frames;
     params.flags          = flags;
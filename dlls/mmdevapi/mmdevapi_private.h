@@ -74,6 +74,7 @@ struct audio_client {
     float *vols;
     UINT32 channel_count;
     stream_handle stream;
+    struct render_shared_state *render_shared;
 
     struct audio_session *session;
     struct audio_session_wrapper *session_wrapper;
@@ -65,6 +65,28 @@ struct get_endpoint_ids_params
     unsigned int default_idx;
 };
 
+/* Ring buffer state of a render stream that a driver may share with the PE
+ * side, which can then hand out and release buffers without a Unix call.
+ * The ring buffer starts "ring_offset" bytes before this structure.
+ *
+ * The driver keeps "seq" odd while it updates the counters. Buffers released
+ * on the PE side are added to "pending_bytes" and folded into the driver's
+ * own counters the next time it runs. "locked_bytes" is the size of a buffer
+ * handed out by the PE side, or -1 while one is handed out by the driver. */
+struct render_shared_state
+{
+    LONG seq;
+    UINT32 frame_size;
+    UINT32 bufsize_frames;
+    UINT32 ring_bytes;
+    UINT32 ring_offset;
+    UINT32 lcl_offs_bytes;
+    UINT32 held_bytes;
+    LONG pending_bytes;
+    LONG locked_bytes;
+    BYTE silence;
+};
+
 struct create_stream_params
 {
     const WCHAR *name;
@@ -78,6 +100,7 @@ struct create_stream_params
     HRESULT result;
     UINT32 *channel_count;
     stream_handle *stream;
+    struct render_shared_state **shared; /* optional, left untouched by drivers without support */
 };
 
 struct release_stream_params
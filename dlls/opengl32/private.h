@@ -78,4 +78,65 @@ extern BOOL alloc_context_objects( enum object_type type, UINT n, const GLuint *
 extern GLuint *del_context_objects( enum object_type type, UINT n, GLuint *handles );
 extern GLuint *map_context_objects( enum object_type type, UINT n, GLuint *handles );
 
+/* When HKCU\Software\Wine\OpenGL\BatchCalls is set, calls which only set current
+ * vertex attributes are recorded in a per-thread stream instead of being made
+ * right away. The stream is executed in a single Unix call before any other call. */
+
+#define GL_COMMAND_STREAM_SIZE 4096
+
+struct gl_command_stream
+{
+    UINT32 size;
+    UINT64 data[GL_COMMAND_STREAM_SIZE / sizeof(UINT64)];
+};
+
+extern BOOL batch_calls;
+extern struct gl_command_stream *get_command_stream(void);
+extern void flush_command_stream(void);
+
+static inline void flush_commands(void)
+{
+    if (batch_calls) flush_command_stream();
+}
+
+static inline BOOL record_command_array( enum unix_funcs code, const void *args, UINT32 size,
+                                         const void *const *array, UINT32 array_size )
+{
+    struct gl_command_stream *stream;
+    struct gl_command_header *header;
+    UINT32 args_size, total;
+    BYTE *data;
+
+    if (!batch_calls) return FALSE;
+    if (!(stream = get_command_stream())) return FALSE;
+
+    args_size = (size + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1);
+    total = sizeof(*header) + args_size + ((array_size + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1));
+    if (stream->size + total > sizeof(stream->data))
+    {
+        /* flushing may replace the stream */
+        flush_commands();
+        if (!(stream = get_command_stream())) return FALSE;
+    }
+
+    header = (struct gl_command_header *)((BYTE *)stream->data + stream->size);
+    header->code = code;
+    header->size = total;
+    data = (BYTE *)(header + 1);
+    memcpy( data, args, size );
+    if (array)
+    {
+        /* the caller may reuse its array before the command is executed */
+        memcpy( data + args_size, *array, array_size );
+        *(const void **)(data + ((const BYTE *)array - (const BYTE *)args)) = data + args_size;
+    }
+    stream->size += total;
+    return TRUE;
+}
+
+static inline BOOL record_command( enum unix_funcs code, const void *args, UINT32 size )
+{
+    return record_command_array( code, args, size, NULL, 0 );
+}
+
 #endif /* __WINE_OPENGL32_PRIVATE_H */
@@ -28,6 +28,7 @@
 #include "winerror.h"
 #include "wingdi.h"
 #include "winuser.h"
+#include "winreg.h"
 #include "winternl.h"
 #include "ddk/d3dkmthk.h"
 
@@ -5040,6 +5041,145 @@ static void test_gl_error( HDC hdc )
     wglMakeCurrent( hdc, old_rc );
 }
 
+static void test_current_attribs( HDC hdc )
+{
+    GLfloat normal[3] = {0.0f, 1.0f, 0.0f}, values[4];
+    HGLRC rc, old_rc;
+    BOOL ret;
+    int i;
+
+    old_rc = wglGetCurrentContext();
+    rc = wglCreateContext( hdc );
+    ok( !!rc, "got %p\n", rc );
+    ret = wglMakeCurrent( hdc, rc );
+    ok( ret, "got %u\n", ret );
+
+    glColor4f( 0.25f, 0.5f, 0.75f, 1.0f );
+    glNormal3fv( normal );
+    /* the array must be read when the call is made */
+    normal[1] = -1.0f;
+    glTexCoord2f( 0.5f, 0.25f );
+
+    glGetFloatv( GL_CURRENT_COLOR, values );
+    ok( values[0] == 0.25f && values[1] == 0.5f && values[2] == 0.75f && values[3] == 1.0f,
+        "got color %f %f %f %f\n", values[0], values[1], values[2], values[3] );
+    glGetFloatv( GL_CURRENT_NORMAL, values );
+    ok( values[0] == 0.0f && values[1] == 1.0f && values[2] == 0.0f,
+        "got normal %f %f %f\n", values[0], values[1], values[2] );
+    glGetFloatv( GL_CURRENT_TEXTURE_COORDS, values );
+    ok( values[0] == 0.5f && values[1] == 0.25f, "got texcoord %f %f\n", values[0], values[1] );
+    check_gl_error( GL_NO_ERROR );
+
+    glBegin( GL_TRIANGLES );
+    for (i = 0; i < 3000; i++)
+    {
+        glColor3f( (i & 0xff) / 256.0f, (i >> 8) / 256.0f, 0.0f );
+        glVertex3f( i % 3, i % 5, 0.0f );
+    }
+    glEnd();
+    check_gl_error( GL_NO_ERROR );
+
+    glGetFloatv( GL_CURRENT_COLOR, values );
+    ok( values[0] == (2999 & 0xff) / 256.0f && values[1] == (2999 >> 8) / 256.0f,
+        "got color %f %f\n", values[0], values[1] );
+
+    wglMakeCurrent( hdc, old_rc );
+    wglDeleteContext( rc );
+}
+
+/* with HKCU\Software\Wine\OpenGL\BatchCalls set, Wine queues calls which only set
+ * current attributes, check that later calls still see them in order */
+static void test_batched_calls( HDC hdc )
+{
+    GLfloat values[4];
+    GLboolean flag;
+    HGLRC rc, rc2, old_rc;
+    BOOL ret;
+    int i;
+
+    old_rc = wglGetCurrentContext();
+    rc = wglCreateContext( hdc );
+    ok( !!rc, "got %p\n", rc );
+    rc2 = wglCreateContext( hdc );
+    ok( !!rc2, "got %p\n", rc2 );
+    ret = wglMakeCurrent( hdc, rc );
+    ok( ret, "got %u\n", ret );
+
+    glEdgeFlag( GL_FALSE );
+    glGetBooleanv( GL_EDGE_FLAG, &flag );
+    ok( flag == GL_FALSE, "got edge flag %u\n", flag );
+    glEdgeFlag( GL_TRUE );
+    glGetBooleanv( GL_EDGE_FLAG, &flag );
+    ok( flag == GL_TRUE, "got edge flag %u\n", flag );
+
+    /* queued calls apply to the context which was current when they were made */
+    glColor4f( 0.5f, 0.25f, 0.125f, 1.0f );
+    ret = wglMakeCurrent( hdc, rc2 );
+    ok( ret, "got %u\n", ret );
+    glGetFloatv( GL_CURRENT_COLOR, values );
+    ok( values[0] == 1.0f && values[1] == 1.0f && values[2] == 1.0f && values[3] == 1.0f,
+        "got color %f %f %f %f\n", values[0], values[1], values[2], values[3] );
+    ret = wglMakeCurrent( hdc, rc );
+    ok( ret, "got %u\n", ret );
+    glGetFloatv( GL_CURRENT_COLOR, values );
+    ok( values[0] == 0.5f && values[1] == 0.25f && values[2] == 0.125f && values[3] == 1.0f,
+        "got color %f %f %f %f\n", values[0], values[1], values[2], values[3] );
+
+    /* more calls than fit in a single batch */
+    for (i = 0; i < 10000; i++) glTexCoord2f( i, -i );
+    glGetFloatv( GL_CURRENT_TEXTURE_COORDS, values );
+    ok( values[0] == 9999.0f && values[1] == -9999.0f, "got texcoord %f %f\n", values[0], values[1] );
+
+    glNormal3f( 0.0f, 0.0f, -1.0f );
+    glFinish();
+    glGetFloatv( GL_CURRENT_NORMAL, values );
+    ok( values[0] == 0.0f && values[1] == 0.0f && values[2] == -1.0f,
+        "got normal %f %f %f\n", values[0], values[1], values[2] );
+    check_gl_error( GL_NO_ERROR );
+
+    wglMakeCurrent( hdc, old_rc );
+    wglDeleteContext( rc2 );
+    wglDeleteContext( rc );
+}
+
+/* BatchCalls is only read when opengl32 is loaded, run the tests again in a child process */
+static void test_batched_calls_process(void)
+{
+    DWORD value = 1, old_value, type, size = sizeof(old_value);
+    PROCESS_INFORMATION info;
+    STARTUPINFOA startup;
+    char cmdline[MAX_PATH];
+    char **argv;
+    HKEY key;
+    LONG ret;
+
+    ret = RegCreateKeyExA( HKEY_CURRENT_USER, "Software\\Wine\\OpenGL", 0, NULL, 0,
+                           KEY_QUERY_VALUE | KEY_SET_VALUE, NULL, &key, NULL );
+    ok( !ret, "RegCreateKeyExA failed, error %ld\n", ret );
+    if (ret) return;
+    if (RegQueryValueExA( key, "BatchCalls", NULL, &type, (BYTE *)&old_value, &size ) ||
+        type != REG_DWORD)
+        size = 0;
+    ret = RegSetValueExA( key, "BatchCalls", 0, REG_DWORD, (BYTE *)&value, sizeof(value) );
+    ok( !ret, "RegSetValueExA failed, error %ld\n", ret );
+
+    winetest_get_mainargs( &argv );
+    sprintf( cmdline, "\"%s\" opengl batch_calls", argv[0] );
+    memset( &startup, 0, sizeof(startup) );
+    startup.cb = sizeof(startup);
+    if (CreateProcessA( NULL, cmdline, NULL, NULL, FALSE, 0, NULL, NULL, &startup, &info ))
+    {
+        wait_child_process( &info );
+        CloseHandle( info.hProcess );
+        CloseHandle( info.hThread );
+    }
+    else ok( 0, "CreateProcess failed, error %lu\n", GetLastError() );
+
+    if (size) RegSetValueExA( key, "BatchCalls", 0, REG_DWORD, (BYTE *)&old_value, sizeof(old_value) );
+    else RegDeleteValueA( key, "BatchCalls" );
+    RegCloseKey( key );
+}
+
 static void test_memory_map( HDC hdc)
 {
     unsigned int i, major = 0, minor = 0;
@@ -5307,6 +5447,7 @@ START_TEST(opengl)
     int format, res;
     const char *tmp;
     HGLRC hglrc;
+    char **argv;
     HWND hwnd;
     HDC hdc;
 
@@ -5331,6 +5472,17 @@ START_TEST(opengl)
     ok_ptr( hglrc, ==, NULL );
     ok_ret( ERROR_INVALID_PIXEL_FORMAT, GetLastError() );
     ok_ret( TRUE, SetPixelFormat( hdc, format, &pfd ) );
+
+    if (winetest_get_mainargs( &argv ) >= 3)
+    {
+        if (!strcmp( argv[2], "batch_calls" ))
+        {
+            test_current_attribs( hdc );
+            test_batched_calls( hdc );
+        }
+        goto cleanup;
+    }
+
     ok_ptr( glGetString( GL_RENDERER ), ==, NULL );
     ok_ptr( glGetString( GL_VERSION ), ==, NULL );
     ok_ptr( glGetString( GL_VENDOR ), ==, NULL );
@@ -5389,6 +5541,9 @@ START_TEST(opengl)
     test_framebuffer();
     test_memory_map( hdc );
     test_gl_error( hdc );
+    test_current_attribs( hdc );
+    test_batched_calls( hdc );
+    test_batched_calls_process();
 
     tmp = ext.wglGetExtensionsStringEXT();
     ok( tmp && *tmp, "got wgl_extensions %s\n", debugstr_a(tmp) );
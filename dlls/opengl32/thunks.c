@@ -185,6 +185,7 @@ void WINAPI glColor3b( GLbyte red, GLbyte green, GLbyte blue )
     struct glColor3b_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glColor3b, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor3b, &args ))) WARN( "glColor3b returned %#lx\n", status );
 }
 
@@ -193,6 +194,7 @@ void WINAPI glColor3bv( const GLbyte *v )
     struct glColor3bv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor3bv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor3bv, &args ))) WARN( "glColor3bv returned %#lx\n", status );
 }
 
@@ -201,6 +203,7 @@ void WINAPI glColor3d( GLdouble red, GLdouble green, GLdouble blue )
     struct glColor3d_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
+    if (record_command( unix_glColor3d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor3d, &args ))) WARN( "glColor3d returned %#lx\n", status );
 }
 
@@ -209,6 +212,7 @@ void WINAPI glColor3dv( const GLdouble *v )
     struct glColor3dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor3dv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor3dv, &args ))) WARN( "glColor3dv returned %#lx\n", status );
 }
 
@@ -217,6 +221,7 @@ void WINAPI glColor3f( GLfloat red, GLfloat green, GLfloat blue )
     struct glColor3f_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
+    if (record_command( unix_glColor3f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor3f, &args ))) WARN( "glColor3f returned %#lx\n", status );
 }
 
@@ -225,6 +230,7 @@ void WINAPI glColor3fv( const GLfloat *v )
     struct glColor3fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor3fv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor3fv, &args ))) WARN( "glColor3fv returned %#lx\n", status );
 }
 
@@ -233,6 +239,7 @@ void WINAPI glColor3i( GLint red, GLint green, GLint blue )
     struct glColor3i_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glColor3i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor3i, &args ))) WARN( "glColor3i returned %#lx\n", status );
 }
 
@@ -241,6 +248,7 @@ void WINAPI glColor3iv( const GLint *v )
     struct glColor3iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor3iv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor3iv, &args ))) WARN( "glColor3iv returned %#lx\n", status );
 }
 
@@ -249,6 +257,7 @@ void WINAPI glColor3s( GLshort red, GLshort green, GLshort blue )
     struct glColor3s_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glColor3s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor3s, &args ))) WARN( "glColor3s returned %#lx\n", status );
 }
 
@@ -257,6 +266,7 @@ void WINAPI glColor3sv( const GLshort *v )
     struct glColor3sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor3sv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor3sv, &args ))) WARN( "glColor3sv returned %#lx\n", status );
 }
 
@@ -265,6 +275,7 @@ void WINAPI glColor3ub( GLubyte red, GLubyte green, GLubyte blue )
     struct glColor3ub_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glColor3ub, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor3ub, &args ))) WARN( "glColor3ub returned %#lx\n", status );
 }
 
@@ -273,6 +284,7 @@ void WINAPI glColor3ubv( const GLubyte *v )
     struct glColor3ubv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor3ubv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor3ubv, &args ))) WARN( "glColor3ubv returned %#lx\n", status );
 }
 
@@ -281,6 +293,7 @@ void WINAPI glColor3ui( GLuint red, GLuint green, GLuint blue )
     struct glColor3ui_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glColor3ui, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor3ui, &args ))) WARN( "glColor3ui returned %#lx\n", status );
 }
 
@@ -289,6 +302,7 @@ void WINAPI glColor3uiv( const GLuint *v )
     struct glColor3uiv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor3uiv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor3uiv, &args ))) WARN( "glColor3uiv returned %#lx\n", status );
 }
 
@@ -297,6 +311,7 @@ void WINAPI glColor3us( GLushort red, GLushort green, GLushort blue )
     struct glColor3us_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glColor3us, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor3us, &args ))) WARN( "glColor3us returned %#lx\n", status );
 }
 
@@ -305,6 +320,7 @@ void WINAPI glColor3usv( const GLushort *v )
     struct glColor3usv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor3usv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor3usv, &args ))) WARN( "glColor3usv returned %#lx\n", status );
 }
 
@@ -313,6 +329,7 @@ void WINAPI glColor4b( GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha )
     struct glColor4b_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
+    if (record_command( unix_glColor4b, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor4b, &args ))) WARN( "glColor4b returned %#lx\n", status );
 }
 
@@ -321,6 +338,7 @@ void WINAPI glColor4bv( const GLbyte *v )
     struct glColor4bv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor4bv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor4bv, &args ))) WARN( "glColor4bv returned %#lx\n", status );
 }
 
@@ -329,6 +347,7 @@ void WINAPI glColor4d( GLdouble red, GLdouble green, GLdouble blue, GLdouble alp
     struct glColor4d_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
+    if (record_command( unix_glColor4d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor4d, &args ))) WARN( "glColor4d returned %#lx\n", status );
 }
 
@@ -337,6 +356,7 @@ void WINAPI glColor4dv( const GLdouble *v )
     struct glColor4dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor4dv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor4dv, &args ))) WARN( "glColor4dv returned %#lx\n", status );
 }
 
@@ -345,6 +365,7 @@ void WINAPI glColor4f( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
     struct glColor4f_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
+    if (record_command( unix_glColor4f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor4f, &args ))) WARN( "glColor4f returned %#lx\n", status );
 }
 
@@ -353,6 +374,7 @@ void WINAPI glColor4fv( const GLfloat *v )
     struct glColor4fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor4fv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor4fv, &args ))) WARN( "glColor4fv returned %#lx\n", status );
 }
 
@@ -361,6 +383,7 @@ void WINAPI glColor4i( GLint red, GLint green, GLint blue, GLint alpha )
     struct glColor4i_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
+    if (record_command( unix_glColor4i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor4i, &args ))) WARN( "glColor4i returned %#lx\n", status );
 }
 
@@ -369,6 +392,7 @@ void WINAPI glColor4iv( const GLint *v )
     struct glColor4iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor4iv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor4iv, &args ))) WARN( "glColor4iv returned %#lx\n", status );
 }
 
@@ -377,6 +401,7 @@ void WINAPI glColor4s( GLshort red, GLshort green, GLshort blue, GLshort alpha )
     struct glColor4s_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
+    if (record_command( unix_glColor4s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor4s, &args ))) WARN( "glColor4s returned %#lx\n", status );
 }
 
@@ -385,6 +410,7 @@ void WINAPI glColor4sv( const GLshort *v )
     struct glColor4sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor4sv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor4sv, &args ))) WARN( "glColor4sv returned %#lx\n", status );
 }
 
@@ -393,6 +419,7 @@ void WINAPI glColor4ub( GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha
     struct glColor4ub_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
+    if (record_command( unix_glColor4ub, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor4ub, &args ))) WARN( "glColor4ub returned %#lx\n", status );
 }
 
@@ -401,6 +428,7 @@ void WINAPI glColor4ubv( const GLubyte *v )
     struct glColor4ubv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor4ubv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor4ubv, &args ))) WARN( "glColor4ubv returned %#lx\n", status );
 }
 
@@ -409,6 +437,7 @@ void WINAPI glColor4ui( GLuint red, GLuint green, GLuint blue, GLuint alpha )
     struct glColor4ui_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
+    if (record_command( unix_glColor4ui, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor4ui, &args ))) WARN( "glColor4ui returned %#lx\n", status );
 }
 
@@ -417,6 +446,7 @@ void WINAPI glColor4uiv( const GLuint *v )
     struct glColor4uiv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor4uiv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor4uiv, &args ))) WARN( "glColor4uiv returned %#lx\n", status );
 }
 
@@ -425,6 +455,7 @@ void WINAPI glColor4us( GLushort red, GLushort green, GLushort blue, GLushort al
     struct glColor4us_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
+    if (record_command( unix_glColor4us, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glColor4us, &args ))) WARN( "glColor4us returned %#lx\n", status );
 }
 
@@ -433,6 +464,7 @@ void WINAPI glColor4usv( const GLushort *v )
     struct glColor4usv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glColor4usv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glColor4usv, &args ))) WARN( "glColor4usv returned %#lx\n", status );
 }
 
@@ -606,6 +638,7 @@ void WINAPI glEdgeFlag( GLboolean flag )
     struct glEdgeFlag_params args = { .teb = NtCurrentTeb(), .flag = flag };
     NTSTATUS status;
     TRACE( "flag %d\n", flag );
+    if (record_command( unix_glEdgeFlag, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glEdgeFlag, &args ))) WARN( "glEdgeFlag returned %#lx\n", status );
 }
 
@@ -622,6 +655,7 @@ void WINAPI glEdgeFlagv( const GLboolean *flag )
     struct glEdgeFlagv_params args = { .teb = NtCurrentTeb(), .flag = flag };
     NTSTATUS status;
     TRACE( "flag %p\n", flag );
+    if (record_command_array( unix_glEdgeFlagv, &args, sizeof(args), (const void *const *)&args.flag, 1 * sizeof(*flag) )) return;
     if ((status = UNIX_CALL( glEdgeFlagv, &args ))) WARN( "glEdgeFlagv returned %#lx\n", status );
 }
 
@@ -662,6 +696,7 @@ void WINAPI glEvalCoord1d( GLdouble u )
     struct glEvalCoord1d_params args = { .teb = NtCurrentTeb(), .u = u };
     NTSTATUS status;
     TRACE( "u %f\n", u );
+    if (record_command( unix_glEvalCoord1d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glEvalCoord1d, &args ))) WARN( "glEvalCoord1d returned %#lx\n", status );
 }
 
@@ -670,6 +705,7 @@ void WINAPI glEvalCoord1dv( const GLdouble *u )
     struct glEvalCoord1dv_params args = { .teb = NtCurrentTeb(), .u = u };
     NTSTATUS status;
     TRACE( "u %p\n", u );
+    if (record_command_array( unix_glEvalCoord1dv, &args, sizeof(args), (const void *const *)&args.u, 1 * sizeof(*u) )) return;
     if ((status = UNIX_CALL( glEvalCoord1dv, &args ))) WARN( "glEvalCoord1dv returned %#lx\n", status );
 }
 
@@ -678,6 +714,7 @@ void WINAPI glEvalCoord1f( GLfloat u )
     struct glEvalCoord1f_params args = { .teb = NtCurrentTeb(), .u = u };
     NTSTATUS status;
     TRACE( "u %f\n", u );
+    if (record_command( unix_glEvalCoord1f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glEvalCoord1f, &args ))) WARN( "glEvalCoord1f returned %#lx\n", status );
 }
 
@@ -686,6 +723,7 @@ void WINAPI glEvalCoord1fv( const GLfloat *u )
     struct glEvalCoord1fv_params args = { .teb = NtCurrentTeb(), .u = u };
     NTSTATUS status;
     TRACE( "u %p\n", u );
+    if (record_command_array( unix_glEvalCoord1fv, &args, sizeof(args), (const void *const *)&args.u, 1 * sizeof(*u) )) return;
     if ((status = UNIX_CALL( glEvalCoord1fv, &args ))) WARN( "glEvalCoord1fv returned %#lx\n", status );
 }
 
@@ -694,6 +732,7 @@ void WINAPI glEvalCoord2d( GLdouble u, GLdouble v )
     struct glEvalCoord2d_params args = { .teb = NtCurrentTeb(), .u = u, .v = v };
     NTSTATUS status;
     TRACE( "u %f, v %f\n", u, v );
+    if (record_command( unix_glEvalCoord2d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glEvalCoord2d, &args ))) WARN( "glEvalCoord2d returned %#lx\n", status );
 }
 
@@ -702,6 +741,7 @@ void WINAPI glEvalCoord2dv( const GLdouble *u )
     struct glEvalCoord2dv_params args = { .teb = NtCurrentTeb(), .u = u };
     NTSTATUS status;
     TRACE( "u %p\n", u );
+    if (record_command_array( unix_glEvalCoord2dv, &args, sizeof(args), (const void *const *)&args.u, 2 * sizeof(*u) )) return;
     if ((status = UNIX_CALL( glEvalCoord2dv, &args ))) WARN( "glEvalCoord2dv returned %#lx\n", status );
 }
 
@@ -710,6 +750,7 @@ void WINAPI glEvalCoord2f( GLfloat u, GLfloat v )
     struct glEvalCoord2f_params args = { .teb = NtCurrentTeb(), .u = u, .v = v };
     NTSTATUS status;
     TRACE( "u %f, v %f\n", u, v );
+    if (record_command( unix_glEvalCoord2f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glEvalCoord2f, &args ))) WARN( "glEvalCoord2f returned %#lx\n", status );
 }
 
@@ -718,6 +759,7 @@ void WINAPI glEvalCoord2fv( const GLfloat *u )
     struct glEvalCoord2fv_params args = { .teb = NtCurrentTeb(), .u = u };
     NTSTATUS status;
     TRACE( "u %p\n", u );
+    if (record_command_array( unix_glEvalCoord2fv, &args, sizeof(args), (const void *const *)&args.u, 2 * sizeof(*u) )) return;
     if ((status = UNIX_CALL( glEvalCoord2fv, &args ))) WARN( "glEvalCoord2fv returned %#lx\n", status );
 }
 
@@ -742,6 +784,7 @@ void WINAPI glEvalPoint1( GLint i )
     struct glEvalPoint1_params args = { .teb = NtCurrentTeb(), .i = i };
     NTSTATUS status;
     TRACE( "i %d\n", i );
+    if (record_command( unix_glEvalPoint1, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glEvalPoint1, &args ))) WARN( "glEvalPoint1 returned %#lx\n", status );
 }
 
@@ -750,6 +793,7 @@ void WINAPI glEvalPoint2( GLint i, GLint j )
     struct glEvalPoint2_params args = { .teb = NtCurrentTeb(), .i = i, .j = j };
     NTSTATUS status;
     TRACE( "i %d, j %d\n", i, j );
+    if (record_command( unix_glEvalPoint2, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glEvalPoint2, &args ))) WARN( "glEvalPoint2 returned %#lx\n", status );
 }
 
@@ -1112,6 +1156,7 @@ void WINAPI glIndexd( GLdouble c )
     struct glIndexd_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %f\n", c );
+    if (record_command( unix_glIndexd, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glIndexd, &args ))) WARN( "glIndexd returned %#lx\n", status );
 }
 
@@ -1120,6 +1165,7 @@ void WINAPI glIndexdv( const GLdouble *c )
     struct glIndexdv_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %p\n", c );
+    if (record_command_array( unix_glIndexdv, &args, sizeof(args), (const void *const *)&args.c, 1 * sizeof(*c) )) return;
     if ((status = UNIX_CALL( glIndexdv, &args ))) WARN( "glIndexdv returned %#lx\n", status );
 }
 
@@ -1128,6 +1174,7 @@ void WINAPI glIndexf( GLfloat c )
     struct glIndexf_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %f\n", c );
+    if (record_command( unix_glIndexf, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glIndexf, &args ))) WARN( "glIndexf returned %#lx\n", status );
 }
 
@@ -1136,6 +1183,7 @@ void WINAPI glIndexfv( const GLfloat *c )
     struct glIndexfv_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %p\n", c );
+    if (record_command_array( unix_glIndexfv, &args, sizeof(args), (const void *const *)&args.c, 1 * sizeof(*c) )) return;
     if ((status = UNIX_CALL( glIndexfv, &args ))) WARN( "glIndexfv returned %#lx\n", status );
 }
 
@@ -1144,6 +1192,7 @@ void WINAPI glIndexi( GLint c )
     struct glIndexi_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %d\n", c );
+    if (record_command( unix_glIndexi, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glIndexi, &args ))) WARN( "glIndexi returned %#lx\n", status );
 }
 
@@ -1152,6 +1201,7 @@ void WINAPI glIndexiv( const GLint *c )
     struct glIndexiv_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %p\n", c );
+    if (record_command_array( unix_glIndexiv, &args, sizeof(args), (const void *const *)&args.c, 1 * sizeof(*c) )) return;
     if ((status = UNIX_CALL( glIndexiv, &args ))) WARN( "glIndexiv returned %#lx\n", status );
 }
 
@@ -1160,6 +1210,7 @@ void WINAPI glIndexs( GLshort c )
     struct glIndexs_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %d\n", c );
+    if (record_command( unix_glIndexs, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glIndexs, &args ))) WARN( "glIndexs returned %#lx\n", status );
 }
 
@@ -1168,6 +1219,7 @@ void WINAPI glIndexsv( const GLshort *c )
     struct glIndexsv_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %p\n", c );
+    if (record_command_array( unix_glIndexsv, &args, sizeof(args), (const void *const *)&args.c, 1 * sizeof(*c) )) return;
     if ((status = UNIX_CALL( glIndexsv, &args ))) WARN( "glIndexsv returned %#lx\n", status );
 }
 
@@ -1176,6 +1228,7 @@ void WINAPI glIndexub( GLubyte c )
     struct glIndexub_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %d\n", c );
+    if (record_command( unix_glIndexub, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glIndexub, &args ))) WARN( "glIndexub returned %#lx\n", status );
 }
 
@@ -1184,6 +1237,7 @@ void WINAPI glIndexubv( const GLubyte *c )
     struct glIndexubv_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %p\n", c );
+    if (record_command_array( unix_glIndexubv, &args, sizeof(args), (const void *const *)&args.c, 1 * sizeof(*c) )) return;
     if ((status = UNIX_CALL( glIndexubv, &args ))) WARN( "glIndexubv returned %#lx\n", status );
 }
 
@@ -1496,6 +1550,7 @@ void WINAPI glNormal3b( GLbyte nx, GLbyte ny, GLbyte nz )
     struct glNormal3b_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
+    if (record_command( unix_glNormal3b, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glNormal3b, &args ))) WARN( "glNormal3b returned %#lx\n", status );
 }
 
@@ -1504,6 +1559,7 @@ void WINAPI glNormal3bv( const GLbyte *v )
     struct glNormal3bv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glNormal3bv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glNormal3bv, &args ))) WARN( "glNormal3bv returned %#lx\n", status );
 }
 
@@ -1512,6 +1568,7 @@ void WINAPI glNormal3d( GLdouble nx, GLdouble ny, GLdouble nz )
     struct glNormal3d_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %f, ny %f, nz %f\n", nx, ny, nz );
+    if (record_command( unix_glNormal3d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glNormal3d, &args ))) WARN( "glNormal3d returned %#lx\n", status );
 }
 
@@ -1520,6 +1577,7 @@ void WINAPI glNormal3dv( const GLdouble *v )
     struct glNormal3dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glNormal3dv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glNormal3dv, &args ))) WARN( "glNormal3dv returned %#lx\n", status );
 }
 
@@ -1528,6 +1586,7 @@ void WINAPI glNormal3f( GLfloat nx, GLfloat ny, GLfloat nz )
     struct glNormal3f_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %f, ny %f, nz %f\n", nx, ny, nz );
+    if (record_command( unix_glNormal3f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glNormal3f, &args ))) WARN( "glNormal3f returned %#lx\n", status );
 }
 
@@ -1536,6 +1595,7 @@ void WINAPI glNormal3fv( const GLfloat *v )
     struct glNormal3fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glNormal3fv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glNormal3fv, &args ))) WARN( "glNormal3fv returned %#lx\n", status );
 }
 
@@ -1544,6 +1604,7 @@ void WINAPI glNormal3i( GLint nx, GLint ny, GLint nz )
     struct glNormal3i_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
+    if (record_command( unix_glNormal3i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glNormal3i, &args ))) WARN( "glNormal3i returned %#lx\n", status );
 }
 
@@ -1552,6 +1613,7 @@ void WINAPI glNormal3iv( const GLint *v )
     struct glNormal3iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glNormal3iv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glNormal3iv, &args ))) WARN( "glNormal3iv returned %#lx\n", status );
 }
 
@@ -1560,6 +1622,7 @@ void WINAPI glNormal3s( GLshort nx, GLshort ny, GLshort nz )
     struct glNormal3s_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
+    if (record_command( unix_glNormal3s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glNormal3s, &args ))) WARN( "glNormal3s returned %#lx\n", status );
 }
 
@@ -1568,6 +1631,7 @@ void WINAPI glNormal3sv( const GLshort *v )
     struct glNormal3sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glNormal3sv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glNormal3sv, &args ))) WARN( "glNormal3sv returned %#lx\n", status );
 }
 
@@ -2133,6 +2197,7 @@ void WINAPI glTexCoord1d( GLdouble s )
     struct glTexCoord1d_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %f\n", s );
+    if (record_command( unix_glTexCoord1d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord1d, &args ))) WARN( "glTexCoord1d returned %#lx\n", status );
 }
 
@@ -2141,6 +2206,7 @@ void WINAPI glTexCoord1dv( const GLdouble *v )
     struct glTexCoord1dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord1dv, &args, sizeof(args), (const void *const *)&args.v, 1 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord1dv, &args ))) WARN( "glTexCoord1dv returned %#lx\n", status );
 }
 
@@ -2149,6 +2215,7 @@ void WINAPI glTexCoord1f( GLfloat s )
     struct glTexCoord1f_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %f\n", s );
+    if (record_command( unix_glTexCoord1f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord1f, &args ))) WARN( "glTexCoord1f returned %#lx\n", status );
 }
 
@@ -2157,6 +2224,7 @@ void WINAPI glTexCoord1fv( const GLfloat *v )
     struct glTexCoord1fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord1fv, &args, sizeof(args), (const void *const *)&args.v, 1 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord1fv, &args ))) WARN( "glTexCoord1fv returned %#lx\n", status );
 }
 
@@ -2165,6 +2233,7 @@ void WINAPI glTexCoord1i( GLint s )
     struct glTexCoord1i_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %d\n", s );
+    if (record_command( unix_glTexCoord1i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord1i, &args ))) WARN( "glTexCoord1i returned %#lx\n", status );
 }
 
@@ -2173,6 +2242,7 @@ void WINAPI glTexCoord1iv( const GLint *v )
     struct glTexCoord1iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord1iv, &args, sizeof(args), (const void *const *)&args.v, 1 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord1iv, &args ))) WARN( "glTexCoord1iv returned %#lx\n", status );
 }
 
@@ -2181,6 +2251,7 @@ void WINAPI glTexCoord1s( GLshort s )
     struct glTexCoord1s_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %d\n", s );
+    if (record_command( unix_glTexCoord1s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord1s, &args ))) WARN( "glTexCoord1s returned %#lx\n", status );
 }
 
@@ -2189,6 +2260,7 @@ void WINAPI glTexCoord1sv( const GLshort *v )
     struct glTexCoord1sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord1sv, &args, sizeof(args), (const void *const *)&args.v, 1 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord1sv, &args ))) WARN( "glTexCoord1sv returned %#lx\n", status );
 }
 
@@ -2197,6 +2269,7 @@ void WINAPI glTexCoord2d( GLdouble s, GLdouble t )
     struct glTexCoord2d_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %f, t %f\n", s, t );
+    if (record_command( unix_glTexCoord2d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord2d, &args ))) WARN( "glTexCoord2d returned %#lx\n", status );
 }
 
@@ -2205,6 +2278,7 @@ void WINAPI glTexCoord2dv( const GLdouble *v )
     struct glTexCoord2dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord2dv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord2dv, &args ))) WARN( "glTexCoord2dv returned %#lx\n", status );
 }
 
@@ -2213,6 +2287,7 @@ void WINAPI glTexCoord2f( GLfloat s, GLfloat t )
     struct glTexCoord2f_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %f, t %f\n", s, t );
+    if (record_command( unix_glTexCoord2f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord2f, &args ))) WARN( "glTexCoord2f returned %#lx\n", status );
 }
 
@@ -2221,6 +2296,7 @@ void WINAPI glTexCoord2fv( const GLfloat *v )
     struct glTexCoord2fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord2fv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord2fv, &args ))) WARN( "glTexCoord2fv returned %#lx\n", status );
 }
 
@@ -2229,6 +2305,7 @@ void WINAPI glTexCoord2i( GLint s, GLint t )
     struct glTexCoord2i_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
+    if (record_command( unix_glTexCoord2i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord2i, &args ))) WARN( "glTexCoord2i returned %#lx\n", status );
 }
 
@@ -2237,6 +2314,7 @@ void WINAPI glTexCoord2iv( const GLint *v )
     struct glTexCoord2iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord2iv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord2iv, &args ))) WARN( "glTexCoord2iv returned %#lx\n", status );
 }
 
@@ -2245,6 +2323,7 @@ void WINAPI glTexCoord2s( GLshort s, GLshort t )
     struct glTexCoord2s_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
+    if (record_command( unix_glTexCoord2s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord2s, &args ))) WARN( "glTexCoord2s returned %#lx\n", status );
 }
 
@@ -2253,6 +2332,7 @@ void WINAPI glTexCoord2sv( const GLshort *v )
     struct glTexCoord2sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord2sv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord2sv, &args ))) WARN( "glTexCoord2sv returned %#lx\n", status );
 }
 
@@ -2261,6 +2341,7 @@ void WINAPI glTexCoord3d( GLdouble s, GLdouble t, GLdouble r )
     struct glTexCoord3d_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f\n", s, t, r );
+    if (record_command( unix_glTexCoord3d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord3d, &args ))) WARN( "glTexCoord3d returned %#lx\n", status );
 }
 
@@ -2269,6 +2350,7 @@ void WINAPI glTexCoord3dv( const GLdouble *v )
     struct glTexCoord3dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord3dv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord3dv, &args ))) WARN( "glTexCoord3dv returned %#lx\n", status );
 }
 
@@ -2277,6 +2359,7 @@ void WINAPI glTexCoord3f( GLfloat s, GLfloat t, GLfloat r )
     struct glTexCoord3f_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f\n", s, t, r );
+    if (record_command( unix_glTexCoord3f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord3f, &args ))) WARN( "glTexCoord3f returned %#lx\n", status );
 }
 
@@ -2285,6 +2368,7 @@ void WINAPI glTexCoord3fv( const GLfloat *v )
     struct glTexCoord3fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord3fv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord3fv, &args ))) WARN( "glTexCoord3fv returned %#lx\n", status );
 }
 
@@ -2293,6 +2377,7 @@ void WINAPI glTexCoord3i( GLint s, GLint t, GLint r )
     struct glTexCoord3i_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
+    if (record_command( unix_glTexCoord3i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord3i, &args ))) WARN( "glTexCoord3i returned %#lx\n", status );
 }
 
@@ -2301,6 +2386,7 @@ void WINAPI glTexCoord3iv( const GLint *v )
     struct glTexCoord3iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord3iv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord3iv, &args ))) WARN( "glTexCoord3iv returned %#lx\n", status );
 }
 
@@ -2309,6 +2395,7 @@ void WINAPI glTexCoord3s( GLshort s, GLshort t, GLshort r )
     struct glTexCoord3s_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
+    if (record_command( unix_glTexCoord3s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord3s, &args ))) WARN( "glTexCoord3s returned %#lx\n", status );
 }
 
@@ -2317,6 +2404,7 @@ void WINAPI glTexCoord3sv( const GLshort *v )
     struct glTexCoord3sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord3sv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord3sv, &args ))) WARN( "glTexCoord3sv returned %#lx\n", status );
 }
 
@@ -2325,6 +2413,7 @@ void WINAPI glTexCoord4d( GLdouble s, GLdouble t, GLdouble r, GLdouble q )
     struct glTexCoord4d_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f, q %f\n", s, t, r, q );
+    if (record_command( unix_glTexCoord4d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord4d, &args ))) WARN( "glTexCoord4d returned %#lx\n", status );
 }
 
@@ -2333,6 +2422,7 @@ void WINAPI glTexCoord4dv( const GLdouble *v )
     struct glTexCoord4dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord4dv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord4dv, &args ))) WARN( "glTexCoord4dv returned %#lx\n", status );
 }
 
@@ -2341,6 +2431,7 @@ void WINAPI glTexCoord4f( GLfloat s, GLfloat t, GLfloat r, GLfloat q )
     struct glTexCoord4f_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f, q %f\n", s, t, r, q );
+    if (record_command( unix_glTexCoord4f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord4f, &args ))) WARN( "glTexCoord4f returned %#lx\n", status );
 }
 
@@ -2349,6 +2440,7 @@ void WINAPI glTexCoord4fv( const GLfloat *v )
     struct glTexCoord4fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord4fv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord4fv, &args ))) WARN( "glTexCoord4fv returned %#lx\n", status );
 }
 
@@ -2357,6 +2449,7 @@ void WINAPI glTexCoord4i( GLint s, GLint t, GLint r, GLint q )
     struct glTexCoord4i_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
+    if (record_command( unix_glTexCoord4i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord4i, &args ))) WARN( "glTexCoord4i returned %#lx\n", status );
 }
 
@@ -2365,6 +2458,7 @@ void WINAPI glTexCoord4iv( const GLint *v )
     struct glTexCoord4iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord4iv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord4iv, &args ))) WARN( "glTexCoord4iv returned %#lx\n", status );
 }
 
@@ -2373,6 +2467,7 @@ void WINAPI glTexCoord4s( GLshort s, GLshort t, GLshort r, GLshort q )
     struct glTexCoord4s_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
+    if (record_command( unix_glTexCoord4s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glTexCoord4s, &args ))) WARN( "glTexCoord4s returned %#lx\n", status );
 }
 
@@ -2381,6 +2476,7 @@ void WINAPI glTexCoord4sv( const GLshort *v )
     struct glTexCoord4sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glTexCoord4sv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glTexCoord4sv, &args ))) WARN( "glTexCoord4sv returned %#lx\n", status );
 }
 
@@ -2557,6 +2653,7 @@ void WINAPI glVertex2d( GLdouble x, GLdouble y )
     struct glVertex2d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
+    if (record_command( unix_glVertex2d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex2d, &args ))) WARN( "glVertex2d returned %#lx\n", status );
 }
 
@@ -2565,6 +2662,7 @@ void WINAPI glVertex2dv( const GLdouble *v )
     struct glVertex2dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex2dv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex2dv, &args ))) WARN( "glVertex2dv returned %#lx\n", status );
 }
 
@@ -2573,6 +2671,7 @@ void WINAPI glVertex2f( GLfloat x, GLfloat y )
     struct glVertex2f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
+    if (record_command( unix_glVertex2f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex2f, &args ))) WARN( "glVertex2f returned %#lx\n", status );
 }
 
@@ -2581,6 +2680,7 @@ void WINAPI glVertex2fv( const GLfloat *v )
     struct glVertex2fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex2fv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex2fv, &args ))) WARN( "glVertex2fv returned %#lx\n", status );
 }
 
@@ -2589,6 +2689,7 @@ void WINAPI glVertex2i( GLint x, GLint y )
     struct glVertex2i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
+    if (record_command( unix_glVertex2i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex2i, &args ))) WARN( "glVertex2i returned %#lx\n", status );
 }
 
@@ -2597,6 +2698,7 @@ void WINAPI glVertex2iv( const GLint *v )
     struct glVertex2iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex2iv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex2iv, &args ))) WARN( "glVertex2iv returned %#lx\n", status );
 }
 
@@ -2605,6 +2707,7 @@ void WINAPI glVertex2s( GLshort x, GLshort y )
     struct glVertex2s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
+    if (record_command( unix_glVertex2s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex2s, &args ))) WARN( "glVertex2s returned %#lx\n", status );
 }
 
@@ -2613,6 +2716,7 @@ void WINAPI glVertex2sv( const GLshort *v )
     struct glVertex2sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex2sv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex2sv, &args ))) WARN( "glVertex2sv returned %#lx\n", status );
 }
 
@@ -2621,6 +2725,7 @@ void WINAPI glVertex3d( GLdouble x, GLdouble y, GLdouble z )
     struct glVertex3d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
+    if (record_command( unix_glVertex3d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex3d, &args ))) WARN( "glVertex3d returned %#lx\n", status );
 }
 
@@ -2629,6 +2734,7 @@ void WINAPI glVertex3dv( const GLdouble *v )
     struct glVertex3dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex3dv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex3dv, &args ))) WARN( "glVertex3dv returned %#lx\n", status );
 }
 
@@ -2637,6 +2743,7 @@ void WINAPI glVertex3f( GLfloat x, GLfloat y, GLfloat z )
     struct glVertex3f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
+    if (record_command( unix_glVertex3f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex3f, &args ))) WARN( "glVertex3f returned %#lx\n", status );
 }
 
@@ -2645,6 +2752,7 @@ void WINAPI glVertex3fv( const GLfloat *v )
     struct glVertex3fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex3fv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex3fv, &args ))) WARN( "glVertex3fv returned %#lx\n", status );
 }
 
@@ -2653,6 +2761,7 @@ void WINAPI glVertex3i( GLint x, GLint y, GLint z )
     struct glVertex3i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
+    if (record_command( unix_glVertex3i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex3i, &args ))) WARN( "glVertex3i returned %#lx\n", status );
 }
 
@@ -2661,6 +2770,7 @@ void WINAPI glVertex3iv( const GLint *v )
     struct glVertex3iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex3iv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex3iv, &args ))) WARN( "glVertex3iv returned %#lx\n", status );
 }
 
@@ -2669,6 +2779,7 @@ void WINAPI glVertex3s( GLshort x, GLshort y, GLshort z )
     struct glVertex3s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
+    if (record_command( unix_glVertex3s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex3s, &args ))) WARN( "glVertex3s returned %#lx\n", status );
 }
 
@@ -2677,6 +2788,7 @@ void WINAPI glVertex3sv( const GLshort *v )
     struct glVertex3sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex3sv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex3sv, &args ))) WARN( "glVertex3sv returned %#lx\n", status );
 }
 
@@ -2685,6 +2797,7 @@ void WINAPI glVertex4d( GLdouble x, GLdouble y, GLdouble z, GLdouble w )
     struct glVertex4d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
+    if (record_command( unix_glVertex4d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex4d, &args ))) WARN( "glVertex4d returned %#lx\n", status );
 }
 
@@ -2693,6 +2806,7 @@ void WINAPI glVertex4dv( const GLdouble *v )
     struct glVertex4dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex4dv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex4dv, &args ))) WARN( "glVertex4dv returned %#lx\n", status );
 }
 
@@ -2701,6 +2815,7 @@ void WINAPI glVertex4f( GLfloat x, GLfloat y, GLfloat z, GLfloat w )
     struct glVertex4f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
+    if (record_command( unix_glVertex4f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex4f, &args ))) WARN( "glVertex4f returned %#lx\n", status );
 }
 
@@ -2709,6 +2824,7 @@ void WINAPI glVertex4fv( const GLfloat *v )
     struct glVertex4fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex4fv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex4fv, &args ))) WARN( "glVertex4fv returned %#lx\n", status );
 }
 
@@ -2717,6 +2833,7 @@ void WINAPI glVertex4i( GLint x, GLint y, GLint z, GLint w )
     struct glVertex4i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
+    if (record_command( unix_glVertex4i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex4i, &args ))) WARN( "glVertex4i returned %#lx\n", status );
 }
 
@@ -2725,6 +2842,7 @@ void WINAPI glVertex4iv( const GLint *v )
     struct glVertex4iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex4iv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex4iv, &args ))) WARN( "glVertex4iv returned %#lx\n", status );
 }
 
@@ -2733,6 +2851,7 @@ void WINAPI glVertex4s( GLshort x, GLshort y, GLshort z, GLshort w )
     struct glVertex4s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
+    if (record_command( unix_glVertex4s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glVertex4s, &args ))) WARN( "glVertex4s returned %#lx\n", status );
 }
 
@@ -2741,6 +2860,7 @@ void WINAPI glVertex4sv( const GLshort *v )
     struct glVertex4sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glVertex4sv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glVertex4sv, &args ))) WARN( "glVertex4sv returned %#lx\n", status );
 }
 
@@ -7263,6 +7383,7 @@ static void WINAPI glFogCoordd( GLdouble coord )
     struct glFogCoordd_params args = { .teb = NtCurrentTeb(), .coord = coord };
     NTSTATUS status;
     TRACE( "coord %f\n", coord );
+    if (record_command( unix_glFogCoordd, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glFogCoordd, &args ))) WARN( "glFogCoordd returned %#lx\n", status );
 }
 
@@ -7279,6 +7400,7 @@ static void WINAPI glFogCoorddv( const GLdouble *coord )
     struct glFogCoorddv_params args = { .teb = NtCurrentTeb(), .coord = coord };
     NTSTATUS status;
     TRACE( "coord %p\n", coord );
+    if (record_command_array( unix_glFogCoorddv, &args, sizeof(args), (const void *const *)&args.coord, 1 * sizeof(*coord) )) return;
     if ((status = UNIX_CALL( glFogCoorddv, &args ))) WARN( "glFogCoorddv returned %#lx\n", status );
 }
 
@@ -7295,6 +7417,7 @@ static void WINAPI glFogCoordf( GLfloat coord )
     struct glFogCoordf_params args = { .teb = NtCurrentTeb(), .coord = coord };
     NTSTATUS status;
     TRACE( "coord %f\n", coord );
+    if (record_command( unix_glFogCoordf, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glFogCoordf, &args ))) WARN( "glFogCoordf returned %#lx\n", status );
 }
 
@@ -7311,6 +7434,7 @@ static void WINAPI glFogCoordfv( const GLfloat *coord )
     struct glFogCoordfv_params args = { .teb = NtCurrentTeb(), .coord = coord };
     NTSTATUS status;
     TRACE( "coord %p\n", coord );
+    if (record_command_array( unix_glFogCoordfv, &args, sizeof(args), (const void *const *)&args.coord, 1 * sizeof(*coord) )) return;
     if ((status = UNIX_CALL( glFogCoordfv, &args ))) WARN( "glFogCoordfv returned %#lx\n", status );
 }
 
@@ -13805,6 +13929,7 @@ static void WINAPI glMultiTexCoord1d( GLenum target, GLdouble s )
     struct glMultiTexCoord1d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
+    if (record_command( unix_glMultiTexCoord1d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord1d, &args ))) WARN( "glMultiTexCoord1d returned %#lx\n", status );
 }
 
@@ -13829,6 +13954,7 @@ static void WINAPI glMultiTexCoord1dv( GLenum target, const GLdouble *v )
     struct glMultiTexCoord1dv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord1dv, &args, sizeof(args), (const void *const *)&args.v, 1 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord1dv, &args ))) WARN( "glMultiTexCoord1dv returned %#lx\n", status );
 }
 
@@ -13853,6 +13979,7 @@ static void WINAPI glMultiTexCoord1f( GLenum target, GLfloat s )
     struct glMultiTexCoord1f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
+    if (record_command( unix_glMultiTexCoord1f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord1f, &args ))) WARN( "glMultiTexCoord1f returned %#lx\n", status );
 }
 
@@ -13877,6 +14004,7 @@ static void WINAPI glMultiTexCoord1fv( GLenum target, const GLfloat *v )
     struct glMultiTexCoord1fv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord1fv, &args, sizeof(args), (const void *const *)&args.v, 1 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord1fv, &args ))) WARN( "glMultiTexCoord1fv returned %#lx\n", status );
 }
 
@@ -13917,6 +14045,7 @@ static void WINAPI glMultiTexCoord1i( GLenum target, GLint s )
     struct glMultiTexCoord1i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
+    if (record_command( unix_glMultiTexCoord1i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord1i, &args ))) WARN( "glMultiTexCoord1i returned %#lx\n", status );
 }
 
@@ -13941,6 +14070,7 @@ static void WINAPI glMultiTexCoord1iv( GLenum target, const GLint *v )
     struct glMultiTexCoord1iv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord1iv, &args, sizeof(args), (const void *const *)&args.v, 1 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord1iv, &args ))) WARN( "glMultiTexCoord1iv returned %#lx\n", status );
 }
 
@@ -13965,6 +14095,7 @@ static void WINAPI glMultiTexCoord1s( GLenum target, GLshort s )
     struct glMultiTexCoord1s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
+    if (record_command( unix_glMultiTexCoord1s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord1s, &args ))) WARN( "glMultiTexCoord1s returned %#lx\n", status );
 }
 
@@ -13989,6 +14120,7 @@ static void WINAPI glMultiTexCoord1sv( GLenum target, const GLshort *v )
     struct glMultiTexCoord1sv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord1sv, &args, sizeof(args), (const void *const *)&args.v, 1 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord1sv, &args ))) WARN( "glMultiTexCoord1sv returned %#lx\n", status );
 }
 
@@ -14045,6 +14177,7 @@ static void WINAPI glMultiTexCoord2d( GLenum target, GLdouble s, GLdouble t )
     struct glMultiTexCoord2d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
+    if (record_command( unix_glMultiTexCoord2d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord2d, &args ))) WARN( "glMultiTexCoord2d returned %#lx\n", status );
 }
 
@@ -14069,6 +14202,7 @@ static void WINAPI glMultiTexCoord2dv( GLenum target, const GLdouble *v )
     struct glMultiTexCoord2dv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord2dv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord2dv, &args ))) WARN( "glMultiTexCoord2dv returned %#lx\n", status );
 }
 
@@ -14093,6 +14227,7 @@ static void WINAPI glMultiTexCoord2f( GLenum target, GLfloat s, GLfloat t )
     struct glMultiTexCoord2f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
+    if (record_command( unix_glMultiTexCoord2f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord2f, &args ))) WARN( "glMultiTexCoord2f returned %#lx\n", status );
 }
 
@@ -14117,6 +14252,7 @@ static void WINAPI glMultiTexCoord2fv( GLenum target, const GLfloat *v )
     struct glMultiTexCoord2fv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord2fv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord2fv, &args ))) WARN( "glMultiTexCoord2fv returned %#lx\n", status );
 }
 
@@ -14157,6 +14293,7 @@ static void WINAPI glMultiTexCoord2i( GLenum target, GLint s, GLint t )
     struct glMultiTexCoord2i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
+    if (record_command( unix_glMultiTexCoord2i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord2i, &args ))) WARN( "glMultiTexCoord2i returned %#lx\n", status );
 }
 
@@ -14181,6 +14318,7 @@ static void WINAPI glMultiTexCoord2iv( GLenum target, const GLint *v )
     struct glMultiTexCoord2iv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord2iv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord2iv, &args ))) WARN( "glMultiTexCoord2iv returned %#lx\n", status );
 }
 
@@ -14205,6 +14343,7 @@ static void WINAPI glMultiTexCoord2s( GLenum target, GLshort s, GLshort t )
     struct glMultiTexCoord2s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
+    if (record_command( unix_glMultiTexCoord2s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord2s, &args ))) WARN( "glMultiTexCoord2s returned %#lx\n", status );
 }
 
@@ -14229,6 +14368,7 @@ static void WINAPI glMultiTexCoord2sv( GLenum target, const GLshort *v )
     struct glMultiTexCoord2sv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord2sv, &args, sizeof(args), (const void *const *)&args.v, 2 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord2sv, &args ))) WARN( "glMultiTexCoord2sv returned %#lx\n", status );
 }
 
@@ -14285,6 +14425,7 @@ static void WINAPI glMultiTexCoord3d( GLenum target, GLdouble s, GLdouble t, GLd
     struct glMultiTexCoord3d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
+    if (record_command( unix_glMultiTexCoord3d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord3d, &args ))) WARN( "glMultiTexCoord3d returned %#lx\n", status );
 }
 
@@ -14309,6 +14450,7 @@ static void WINAPI glMultiTexCoord3dv( GLenum target, const GLdouble *v )
     struct glMultiTexCoord3dv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord3dv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord3dv, &args ))) WARN( "glMultiTexCoord3dv returned %#lx\n", status );
 }
 
@@ -14333,6 +14475,7 @@ static void WINAPI glMultiTexCoord3f( GLenum target, GLfloat s, GLfloat t, GLflo
     struct glMultiTexCoord3f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
+    if (record_command( unix_glMultiTexCoord3f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord3f, &args ))) WARN( "glMultiTexCoord3f returned %#lx\n", status );
 }
 
@@ -14357,6 +14500,7 @@ static void WINAPI glMultiTexCoord3fv( GLenum target, const GLfloat *v )
     struct glMultiTexCoord3fv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord3fv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord3fv, &args ))) WARN( "glMultiTexCoord3fv returned %#lx\n", status );
 }
 
@@ -14397,6 +14541,7 @@ static void WINAPI glMultiTexCoord3i( GLenum target, GLint s, GLint t, GLint r )
     struct glMultiTexCoord3i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
+    if (record_command( unix_glMultiTexCoord3i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord3i, &args ))) WARN( "glMultiTexCoord3i returned %#lx\n", status );
 }
 
@@ -14421,6 +14566,7 @@ static void WINAPI glMultiTexCoord3iv( GLenum target, const GLint *v )
     struct glMultiTexCoord3iv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord3iv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord3iv, &args ))) WARN( "glMultiTexCoord3iv returned %#lx\n", status );
 }
 
@@ -14445,6 +14591,7 @@ static void WINAPI glMultiTexCoord3s( GLenum target, GLshort s, GLshort t, GLsho
     struct glMultiTexCoord3s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
+    if (record_command( unix_glMultiTexCoord3s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord3s, &args ))) WARN( "glMultiTexCoord3s returned %#lx\n", status );
 }
 
@@ -14469,6 +14616,7 @@ static void WINAPI glMultiTexCoord3sv( GLenum target, const GLshort *v )
     struct glMultiTexCoord3sv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord3sv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord3sv, &args ))) WARN( "glMultiTexCoord3sv returned %#lx\n", status );
 }
 
@@ -14525,6 +14673,7 @@ static void WINAPI glMultiTexCoord4d( GLenum target, GLdouble s, GLdouble t, GLd
     struct glMultiTexCoord4d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
+    if (record_command( unix_glMultiTexCoord4d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord4d, &args ))) WARN( "glMultiTexCoord4d returned %#lx\n", status );
 }
 
@@ -14549,6 +14698,7 @@ static void WINAPI glMultiTexCoord4dv( GLenum target, const GLdouble *v )
     struct glMultiTexCoord4dv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord4dv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord4dv, &args ))) WARN( "glMultiTexCoord4dv returned %#lx\n", status );
 }
 
@@ -14573,6 +14723,7 @@ static void WINAPI glMultiTexCoord4f( GLenum target, GLfloat s, GLfloat t, GLflo
     struct glMultiTexCoord4f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
+    if (record_command( unix_glMultiTexCoord4f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord4f, &args ))) WARN( "glMultiTexCoord4f returned %#lx\n", status );
 }
 
@@ -14597,6 +14748,7 @@ static void WINAPI glMultiTexCoord4fv( GLenum target, const GLfloat *v )
     struct glMultiTexCoord4fv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord4fv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord4fv, &args ))) WARN( "glMultiTexCoord4fv returned %#lx\n", status );
 }
 
@@ -14637,6 +14789,7 @@ static void WINAPI glMultiTexCoord4i( GLenum target, GLint s, GLint t, GLint r,
     struct glMultiTexCoord4i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
+    if (record_command( unix_glMultiTexCoord4i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord4i, &args ))) WARN( "glMultiTexCoord4i returned %#lx\n", status );
 }
 
@@ -14661,6 +14814,7 @@ static void WINAPI glMultiTexCoord4iv( GLenum target, const GLint *v )
     struct glMultiTexCoord4iv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord4iv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord4iv, &args ))) WARN( "glMultiTexCoord4iv returned %#lx\n", status );
 }
 
@@ -14685,6 +14839,7 @@ static void WINAPI glMultiTexCoord4s( GLenum target, GLshort s, GLshort t, GLsho
     struct glMultiTexCoord4s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
+    if (record_command( unix_glMultiTexCoord4s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord4s, &args ))) WARN( "glMultiTexCoord4s returned %#lx\n", status );
 }
 
@@ -14709,6 +14864,7 @@ static void WINAPI glMultiTexCoord4sv( GLenum target, const GLshort *v )
     struct glMultiTexCoord4sv_params args = { .teb = NtCurrentTeb(), .target = target, .v = v };
     NTSTATUS status;
     TRACE( "target %d, v %p\n", target, v );
+    if (record_command_array( unix_glMultiTexCoord4sv, &args, sizeof(args), (const void *const *)&args.v, 4 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glMultiTexCoord4sv, &args ))) WARN( "glMultiTexCoord4sv returned %#lx\n", status );
 }
 
@@ -18976,6 +19132,7 @@ static void WINAPI glSecondaryColor3b( GLbyte red, GLbyte green, GLbyte blue )
     struct glSecondaryColor3b_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glSecondaryColor3b, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3b, &args ))) WARN( "glSecondaryColor3b returned %#lx\n", status );
 }
 
@@ -18992,6 +19149,7 @@ static void WINAPI glSecondaryColor3bv( const GLbyte *v )
     struct glSecondaryColor3bv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glSecondaryColor3bv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3bv, &args ))) WARN( "glSecondaryColor3bv returned %#lx\n", status );
 }
 
@@ -19008,6 +19166,7 @@ static void WINAPI glSecondaryColor3d( GLdouble red, GLdouble green, GLdouble bl
     struct glSecondaryColor3d_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
+    if (record_command( unix_glSecondaryColor3d, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3d, &args ))) WARN( "glSecondaryColor3d returned %#lx\n", status );
 }
 
@@ -19024,6 +19183,7 @@ static void WINAPI glSecondaryColor3dv( const GLdouble *v )
     struct glSecondaryColor3dv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glSecondaryColor3dv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3dv, &args ))) WARN( "glSecondaryColor3dv returned %#lx\n", status );
 }
 
@@ -19040,6 +19200,7 @@ static void WINAPI glSecondaryColor3f( GLfloat red, GLfloat green, GLfloat blue
     struct glSecondaryColor3f_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
+    if (record_command( unix_glSecondaryColor3f, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3f, &args ))) WARN( "glSecondaryColor3f returned %#lx\n", status );
 }
 
@@ -19056,6 +19217,7 @@ static void WINAPI glSecondaryColor3fv( const GLfloat *v )
     struct glSecondaryColor3fv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glSecondaryColor3fv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3fv, &args ))) WARN( "glSecondaryColor3fv returned %#lx\n", status );
 }
 
@@ -19088,6 +19250,7 @@ static void WINAPI glSecondaryColor3i( GLint red, GLint green, GLint blue )
     struct glSecondaryColor3i_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glSecondaryColor3i, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3i, &args ))) WARN( "glSecondaryColor3i returned %#lx\n", status );
 }
 
@@ -19104,6 +19267,7 @@ static void WINAPI glSecondaryColor3iv( const GLint *v )
     struct glSecondaryColor3iv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glSecondaryColor3iv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3iv, &args ))) WARN( "glSecondaryColor3iv returned %#lx\n", status );
 }
 
@@ -19120,6 +19284,7 @@ static void WINAPI glSecondaryColor3s( GLshort red, GLshort green, GLshort blue
     struct glSecondaryColor3s_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glSecondaryColor3s, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3s, &args ))) WARN( "glSecondaryColor3s returned %#lx\n", status );
 }
 
@@ -19136,6 +19301,7 @@ static void WINAPI glSecondaryColor3sv( const GLshort *v )
     struct glSecondaryColor3sv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glSecondaryColor3sv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3sv, &args ))) WARN( "glSecondaryColor3sv returned %#lx\n", status );
 }
 
@@ -19152,6 +19318,7 @@ static void WINAPI glSecondaryColor3ub( GLubyte red, GLubyte green, GLubyte blue
     struct glSecondaryColor3ub_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glSecondaryColor3ub, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3ub, &args ))) WARN( "glSecondaryColor3ub returned %#lx\n", status );
 }
 
@@ -19168,6 +19335,7 @@ static void WINAPI glSecondaryColor3ubv( const GLubyte *v )
     struct glSecondaryColor3ubv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glSecondaryColor3ubv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3ubv, &args ))) WARN( "glSecondaryColor3ubv returned %#lx\n", status );
 }
 
@@ -19184,6 +19352,7 @@ static void WINAPI glSecondaryColor3ui( GLuint red, GLuint green, GLuint blue )
     struct glSecondaryColor3ui_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glSecondaryColor3ui, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3ui, &args ))) WARN( "glSecondaryColor3ui returned %#lx\n", status );
 }
 
@@ -19200,6 +19369,7 @@ static void WINAPI glSecondaryColor3uiv( const GLuint *v )
     struct glSecondaryColor3uiv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glSecondaryColor3uiv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3uiv, &args ))) WARN( "glSecondaryColor3uiv returned %#lx\n", status );
 }
 
@@ -19216,6 +19386,7 @@ static void WINAPI glSecondaryColor3us( GLushort red, GLushort green, GLushort b
     struct glSecondaryColor3us_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
+    if (record_command( unix_glSecondaryColor3us, &args, sizeof(args) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3us, &args ))) WARN( "glSecondaryColor3us returned %#lx\n", status );
 }
 
@@ -19232,6 +19403,7 @@ static void WINAPI glSecondaryColor3usv( const GLushort *v )
     struct glSecondaryColor3usv_params args = { .teb = NtCurrentTeb(), .v = v };
     NTSTATUS status;
     TRACE( "v %p\n", v );
+    if (record_command_array( unix_glSecondaryColor3usv, &args, sizeof(args), (const void *const *)&args.v, 3 * sizeof(*v) )) return;
     if ((status = UNIX_CALL( glSecondaryColor3usv, &args ))) WARN( "glSecondaryColor3usv returned %#lx\n", status );
 }
 
@@ -89,6 +89,7 @@ extern NTSTATUS process_attach( void *args );
 extern NTSTATUS thread_attach( void *args );
 extern NTSTATUS process_detach( void *args );
 extern NTSTATUS get_pixel_formats( void *args );
+extern NTSTATUS process_commands( void *args );
 extern void set_context_attribute( TEB *teb, GLenum name, const void *value, size_t size );
 extern void set_current_fbo( TEB *teb, GLenum target, GLuint framebuffer );
 extern GLuint get_default_fbo( TEB *teb, GLenum target );
@@ -30504,6 +30504,7 @@ const unixlib_entry_t __wine_unix_call_funcs[] =
     thread_attach,
     process_detach,
     get_pixel_formats,
+    process_commands,
     wgl_wglCopyContext,
     wgl_wglDeleteContext,
     wgl_wglGetPixelFormat,
@@ -33604,6 +33605,7 @@ C_ASSERT(ARRAYSIZE(__wine_unix_call_funcs) == funcs_count);
 extern NTSTATUS wow64_thread_attach( void *args );
 extern NTSTATUS wow64_process_detach( void *args );
 extern NTSTATUS wow64_get_pixel_formats( void *args );
+extern NTSTATUS wow64_process_commands( void *args );
 
 static NTSTATUS wow64_wgl_wglCopyContext( void *args )
 {
@@ -86715,6 +86717,7 @@ const unixlib_entry_t __wine_unix_call_wow64_funcs[] =
     wow64_thread_attach,
     wow64_process_detach,
     wow64_get_pixel_formats,
+    wow64_process_commands,
     wow64_wgl_wglCopyContext,
     wow64_wgl_wglDeleteContext,
     wow64_wgl_wglGetPixelFormat,
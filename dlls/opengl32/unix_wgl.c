@@ -1752,6 +1752,33 @@ NTSTATUS get_pixel_formats( void *args )
     return STATUS_SUCCESS;
 }
 
+static NTSTATUS execute_commands( const unixlib_entry_t *funcs, const BYTE *data, UINT32 size )
+{
+    const struct gl_command_header *header;
+    UINT32 offset;
+    NTSTATUS status;
+
+    for (offset = 0; offset < size; offset += header->size)
+    {
+        header = (const struct gl_command_header *)(data + offset);
+        if (size - offset < sizeof(*header) || header->size < sizeof(*header) || header->size > size - offset ||
+            header->code >= funcs_count || header->code == unix_process_commands)
+        {
+            ERR( "invalid command at offset %u, stream size %u\n", offset, size );
+            return STATUS_INVALID_PARAMETER;
+        }
+        if ((status = funcs[header->code]( (void *)(header + 1) )))
+            WARN( "command %u returned %#x\n", header->code, (int)status );
+    }
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS process_commands( void *args )
+{
+    struct process_commands_params *params = args;
+    return execute_commands( __wine_unix_call_funcs, params->data, params->size );
+}
+
 #ifdef _WIN64
 
 static pthread_mutex_t wgl_lock = PTHREAD_MUTEX_INITIALIZER;
@@ -2441,4 +2468,14 @@ NTSTATUS wow64_get_pixel_formats( void *args )
     return status;
 }
 
+NTSTATUS wow64_process_commands( void *args )
+{
+    struct
+    {
+        PTR32 data;
+        UINT32 size;
+    } *params32 = args;
+    return execute_commands( __wine_unix_call_wow64_funcs, ULongToPtr(params32->data), params32->size );
+}
+
 #endif
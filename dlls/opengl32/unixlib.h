@@ -25785,12 +25785,25 @@ struct get_pixel_formats_params
     unsigned int num_onscreen_formats;
 };
 
+struct gl_command_header
+{
+    UINT32 code;
+    UINT32 size; /* including the header */
+};
+
+struct process_commands_params
+{
+    const void *data;
+    UINT32 size;
+};
+
 enum unix_funcs
 {
     unix_process_attach,
     unix_thread_attach,
     unix_process_detach,
     unix_get_pixel_formats,
+    unix_process_commands,
     unix_wglCopyContext,
     unix_wglDeleteContext,
     unix_wglGetPixelFormat,
@@ -28898,6 +28911,6 @@ struct gl_debug_message_callback_params
     char message[1];
 };
 
-#define UNIX_CALL( func, params ) WINE_UNIX_CALL( unix_ ## func, params )
+#define UNIX_CALL( func, params ) (flush_commands(), WINE_UNIX_CALL( unix_ ## func, params ))
 
 #endif /* __WINE_OPENGL32_UNIXLIB_H */
@@ -46,6 +46,9 @@ static const MAT2 identity = { {0,1},{0,0},{0,0},{0,1} };
 #define WINE_GL_RESERVED_FORMATS_PTR      3
 #define WINE_GL_RESERVED_FORMATS_NUM      4
 #define WINE_GL_RESERVED_FORMATS_ONSCREEN 5
+#define WINE_GL_RESERVED_COMMANDS         6
+
+BOOL batch_calls;
 
 static CRITICAL_SECTION wgl_cs;
 static CRITICAL_SECTION_DEBUG wgl_cs_debug = {
@@ -2817,6 +2820,59 @@ const GLchar * WINAPI wglQueryRendererStringWINE( HDC dc, GLint renderer, GLenum
 
 typedef void (WINAPI *gl_debug_message)(GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar *, const void *);
 
+struct gl_command_stream *get_command_stream(void)
+{
+    struct gl_command_stream *stream;
+
+    if ((stream = NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_COMMANDS])) return stream;
+    if (!(stream = calloc( 1, sizeof(*stream) ))) return NULL;
+    NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_COMMANDS] = stream;
+    return stream;
+}
+
+void flush_command_stream(void)
+{
+    struct gl_command_stream *stream;
+    struct process_commands_params params;
+    NTSTATUS status;
+
+    while ((stream = NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_COMMANDS]) && stream->size)
+    {
+        /* detach the stream while it executes, so that calls recorded from
+         * a debug callback go to a new stream instead of overwriting it */
+        NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_COMMANDS] = NULL;
+        params.data = stream->data;
+        params.size = stream->size;
+        if ((status = WINE_UNIX_CALL( unix_process_commands, &params )))
+            WARN( "unix_process_commands returned %#lx\n", status );
+        stream->size = 0;
+
+        /* execute the commands recorded meanwhile, keeping a single stream */
+        if (NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_COMMANDS]) free( stream );
+        else NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_COMMANDS] = stream;
+    }
+}
+
+static void free_command_stream(void)
+{
+    flush_commands();
+    free( NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_COMMANDS] );
+    NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_COMMANDS] = NULL;
+}
+
+static void init_batch_calls(void)
+{
+    DWORD value, size = sizeof(value);
+
+    /* @@ Wine registry key: HKCU\Software\Wine\OpenGL */
+    if (!RegGetValueA( HKEY_CURRENT_USER, "Software\\Wine\\OpenGL", "BatchCalls",
+                       RRF_RT_REG_DWORD, NULL, &value, &size ) && value)
+    {
+        TRACE( "batching vertex attribute calls\n" );
+        batch_calls = TRUE;
+    }
+}
+
 static NTSTATUS WINAPI call_gl_debug_message_callback( void *args, ULONG size )
 {
     struct gl_debug_message_callback_params *params = args;
@@ -2848,6 +2904,7 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
             ERR( "Failed to load unixlib, status %#lx\n", status );
             return FALSE;
         }
+        init_batch_calls();
 
         /* fallthrough */
     case DLL_THREAD_ATTACH:
@@ -2866,6 +2923,7 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
 #endif
         /* fallthrough */
     case DLL_THREAD_DETACH:
+        free_command_stream();
         if ((context = get_current_context())) context->base.current_tid = 0;
         free( NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_FORMATS_PTR] );
         return TRUE;
@@ -17,6 +17,7 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
 
 #define COBJMACROS
 #include "initguid.h"
@@ -79,6 +80,8 @@ struct list async_result_cache = LIST_INIT(async_result_cache);
 static LONG startup_count;
 static LONG platform_lock;
 static CO_MTA_USAGE_COOKIE mta_cookie;
+static BOOL use_work_pool;
+static DWORD work_pool_tls = TLS_OUT_OF_INDEXES;
 
 static struct queue_handle *get_queue_obj(DWORD handle)
 {
@@ -155,6 +158,9 @@ struct work_item
         TP_WAIT *wait_object;
         TP_TIMER *timer_object;
     } u;
+    /* Data used for work pool items only. */
+    struct list pool_entry;
+    LARGE_INTEGER submit_time;
 };
 
 static struct work_item *work_item_impl_from_IUnknown(IUnknown *iface)
@@ -171,6 +177,38 @@ static const TP_CALLBACK_PRIORITY priorities[] =
 
 struct queue;
 struct queue_desc;
+struct work_pool;
+
+/* Optional replacement for the threadpool work objects of pool queues. Each
+ * worker thread owns one list per callback priority; items are added to the
+ * submitting worker, or to the worker that last ran an item of the same serial
+ * queue, and idle workers steal from the others. */
+struct queue_worker
+{
+    struct work_pool *pool;
+    unsigned int index;
+    HANDLE thread;
+    SRWLOCK lock;
+    struct list lanes[ARRAY_SIZE(priorities)];
+};
+
+#define WORK_POOL_LATENCY_BUCKETS 16
+
+struct work_pool
+{
+    struct queue *queue;
+    struct queue_worker *workers;
+    unsigned int worker_count;
+    LONG next_worker;
+    LONG queued;
+    LONG idle;
+    BOOL shutdown;
+    SRWLOCK sleep_lock;
+    CONDITION_VARIABLE wake;
+    LARGE_INTEGER frequency;
+    /* Submit to start latency, bucket n counts items started in less than 2^n us. */
+    LONG latency[WORK_POOL_LATENCY_BUCKETS];
+};
 
 struct queue_ops
 {
@@ -195,9 +233,14 @@ struct queue
     CRITICAL_SECTION cs;
     struct list pending_items;
     DWORD id;
+    struct work_pool *work_pool;
     /* Data used for serial queues only. */
     PTP_SIMPLE_CALLBACK finalization_callback;
     DWORD target_queue;
+    /* Worker that last ran an item of this queue. The pool is only compared,
+     * never dereferenced, as it may have been destroyed since. */
+    struct work_pool *affinity_pool;
+    unsigned int affinity_index;
 };
 
 static void shutdown_queue(struct queue *queue);
@@ -332,6 +375,234 @@ static void CALLBACK standard_queue_cleanup_callback(void *object_data, void *gr
 {
 }
 
+static void CALLBACK standard_queue_worker(TP_CALLBACK_INSTANCE *instance, void *context, TP_WORK *work);
+
+static TP_CALLBACK_PRIORITY get_callback_priority(const struct work_item *item)
+{
+    if (item->priority == 0)
+        return TP_CALLBACK_PRIORITY_NORMAL;
+    else if (item->priority < 0)
+        return TP_CALLBACK_PRIORITY_LOW;
+    else
+        return TP_CALLBACK_PRIORITY_HIGH;
+}
+
+static struct work_item *queue_worker_pop(struct queue_worker *worker, BOOL steal)
+{
+    struct work_item *item = NULL;
+    struct list *entry;
+    unsigned int i;
+
+    if (steal)
+    {
+        if (!TryAcquireSRWLockExclusive(&worker->lock))
+            return NULL;
+    }
+    else
+        AcquireSRWLockExclusive(&worker->lock);
+
+    for (i = 0; i < ARRAY_SIZE(worker->lanes); ++i)
+    {
+        if ((entry = list_head(&worker->lanes[i])))
+        {
+            list_remove(entry);
+            item = LIST_ENTRY(entry, struct work_item, pool_entry);
+            break;
+        }
+    }
+
+    ReleaseSRWLockExclusive(&worker->lock);
+
+    return item;
+}
+
+static void queue_worker_run_item(struct queue_worker *worker, struct work_item *item)
+{
+    struct work_pool *pool = worker->pool;
+    PTP_SIMPLE_CALLBACK finalization_callback = item->finalization_callback;
+    LARGE_INTEGER now;
+    ULONGLONG us;
+    unsigned int bucket = 0;
+
+    QueryPerformanceCounter(&now);
+    us = (now.QuadPart - item->submit_time.QuadPart) * 1000000 / pool->frequency.QuadPart;
+    while (us && bucket < WORK_POOL_LATENCY_BUCKETS - 1)
+    {
+        us >>= 1;
+        ++bucket;
+    }
+    InterlockedIncrement(&pool->latency[bucket]);
+
+    /* Keep following items of the same serial queue on this worker. */
+    if (item->queue != pool->queue)
+    {
+        item->queue->affinity_index = worker->index;
+        item->queue->affinity_pool = pool;
+    }
+
+    standard_queue_worker(NULL, item, NULL);
+    if (finalization_callback)
+        finalization_callback(NULL, item);
+}
+
+static DWORD WINAPI queue_worker_proc(void *arg)
+{
+    struct queue_worker *worker = arg;
+    struct work_pool *pool = worker->pool;
+    struct work_item *item;
+    unsigned int i;
+    BOOL done;
+
+    TlsSetValue(work_pool_tls, worker);
+
+    for (;;)
+    {
+        item = queue_worker_pop(worker, FALSE);
+        for (i = 1; !item && i < pool->worker_count; ++i)
+            item = queue_worker_pop(&pool->workers[(worker->index + i) % pool->worker_count], TRUE);
+
+        if (item)
+        {
+            InterlockedDecrement(&pool->queued);
+            queue_worker_run_item(worker, item);
+            continue;
+        }
+
+        AcquireSRWLockExclusive(&pool->sleep_lock);
+        InterlockedIncrement(&pool->idle);
+        while (!ReadAcquire(&pool->queued) && !pool->shutdown)
+            SleepConditionVariableSRW(&pool->wake, &pool->sleep_lock, INFINITE, 0);
+        InterlockedDecrement(&pool->idle);
+        done = pool->shutdown && !ReadAcquire(&pool->queued);
+        ReleaseSRWLockExclusive(&pool->sleep_lock);
+
+        if (done)
+            break;
+    }
+
+    return 0;
+}
+
+static void work_pool_destroy(struct work_pool *pool)
+{
+    struct queue_worker *current = TlsGetValue(work_pool_tls);
+    unsigned int i;
+
+    AcquireSRWLockExclusive(&pool->sleep_lock);
+    pool->shutdown = TRUE;
+    WakeAllConditionVariable(&pool->wake);
+    ReleaseSRWLockExclusive(&pool->sleep_lock);
+
+    if (current && current->pool == pool)
+    {
+        WARN("Queue %p is shut down from its own worker thread, leaking worker pool.\n", pool->queue);
+        return;
+    }
+
+    for (i = 0; i < pool->worker_count; ++i)
+    {
+        WaitForSingleObject(pool->workers[i].thread, INFINITE);
+        CloseHandle(pool->workers[i].thread);
+    }
+
+    if (TRACE_ON(mfplat))
+    {
+        for (i = 0; i < WORK_POOL_LATENCY_BUCKETS; ++i)
+        {
+            if (pool->latency[i])
+                TRACE("queue %p, %ld items started within %u us.\n", pool->queue, pool->latency[i], 1u << i);
+        }
+    }
+
+    free(pool->workers);
+    free(pool);
+}
+
+static struct work_pool *work_pool_create(struct queue *queue, unsigned int worker_count)
+{
+    struct work_pool *pool;
+    unsigned int i, j;
+
+    if (!(pool = calloc(1, sizeof(*pool))))
+        return NULL;
+    if (!(pool->workers = calloc(worker_count, sizeof(*pool->workers))))
+    {
+        free(pool);
+        return NULL;
+    }
+
+    pool->queue = queue;
+    InitializeSRWLock(&pool->sleep_lock);
+    InitializeConditionVariable(&pool->wake);
+    QueryPerformanceFrequency(&pool->frequency);
+
+    for (i = 0; i < worker_count; ++i)
+    {
+        struct queue_worker *worker = &pool->workers[i];
+
+        worker->pool = pool;
+        worker->index = i;
+        InitializeSRWLock(&worker->lock);
+        for (j = 0; j < ARRAY_SIZE(worker->lanes); ++j)
+            list_init(&worker->lanes[j]);
+    }
+
+    for (i = 0; i < worker_count; ++i)
+    {
+        if (!(pool->workers[i].thread = CreateThread(NULL, 0, queue_worker_proc, &pool->workers[i], 0, NULL)))
+        {
+            WARN("Failed to create worker thread, error %lu.\n", GetLastError());
+            break;
+        }
+        pool->worker_count = i + 1;
+    }
+
+    if (!pool->worker_count)
+    {
+        free(pool->workers);
+        free(pool);
+        return NULL;
+    }
+
+    TRACE("Created work pool %p with %u workers for queue %p.\n", pool, pool->worker_count, queue);
+    return pool;
+}
+
+static void work_pool_submit(struct work_pool *pool, struct work_item *item)
+{
+    struct queue *queue = item->queue;
+    struct queue_worker *worker;
+
+    if (queue->affinity_pool == pool && queue->affinity_index < pool->worker_count)
+        worker = &pool->workers[queue->affinity_index];
+    else
+    {
+        worker = TlsGetValue(work_pool_tls);
+        if (!worker || worker->pool != pool)
+            worker = &pool->workers[(ULONG)InterlockedIncrement(&pool->next_worker) % pool->worker_count];
+    }
+
+    /* Running the item releases one reference, the finalization callback the other. */
+    if (item->finalization_callback)
+        IUnknown_AddRef(&item->IUnknown_iface);
+    item->type = WORK_ITEM_WORK;
+    QueryPerformanceCounter(&item->submit_time);
+
+    AcquireSRWLockExclusive(&worker->lock);
+    list_add_tail(&worker->lanes[get_callback_priority(item)], &item->pool_entry);
+    ReleaseSRWLockExclusive(&worker->lock);
+
+    InterlockedIncrement(&pool->queued);
+    if (ReadNoFence(&pool->idle))
+    {
+        AcquireSRWLockExclusive(&pool->sleep_lock);
+        WakeConditionVariable(&pool->wake);
+        ReleaseSRWLockExclusive(&pool->sleep_lock);
+    }
+
+    TRACE("queued %p on worker %u.\n", item->result, worker->index);
+}
+
 static HRESULT pool_queue_init(const struct queue_desc *desc, struct queue *queue)
 {
     TP_CALLBACK_ENVIRON_V3 env;
@@ -359,6 +630,10 @@ static HRESULT pool_queue_init(const struct queue_desc *desc, struct queue *queu
     SetThreadpoolThreadMinimum(queue->pool, 1);
     SetThreadpoolThreadMaximum(queue->pool, max_thread);
 
+    /* Waits and timers still go through the threadpool. */
+    if (use_work_pool)
+        queue->work_pool = work_pool_create(queue, max_thread);
+
     if (desc->queue_type == RTWQ_WINDOW_WORKQUEUE)
         FIXME("RTWQ_WINDOW_WORKQUEUE is not supported.\n");
 
@@ -370,6 +645,11 @@ static BOOL pool_queue_shutdown(struct queue *queue)
     if (!queue->pool)
         return FALSE;
 
+    if (queue->work_pool)
+    {
+        work_pool_destroy(queue->work_pool);
+        queue->work_pool = NULL;
+    }
     CloseThreadpoolCleanupGroupMembers(queue->envs[0].CleanupGroup, FALSE, NULL);
     CloseThreadpool(queue->pool);
     queue->pool = NULL;
@@ -395,17 +675,15 @@ static void CALLBACK standard_queue_worker(TP_CALLBACK_INSTANCE *instance, void
 
 static void pool_queue_submit(struct queue *queue, struct work_item *item)
 {
-    TP_CALLBACK_PRIORITY callback_priority;
     TP_CALLBACK_ENVIRON_V3 env;
 
-    if (item->priority == 0)
-        callback_priority = TP_CALLBACK_PRIORITY_NORMAL;
-    else if (item->priority < 0)
-        callback_priority = TP_CALLBACK_PRIORITY_LOW;
-    else
-        callback_priority = TP_CALLBACK_PRIORITY_HIGH;
+    if (queue->work_pool)
+    {
+        work_pool_submit(queue->work_pool, item);
+        return;
+    }
 
-    env = queue->envs[callback_priority];
+    env = queue->envs[get_callback_priority(item)];
     env.FinalizationCallback = item->finalization_callback;
     /* Worker pool callback will release one reference. Grab one more to keep object alive when
        we need finalization callback. */
@@ -1262,6 +1540,7 @@ HRESULT WINAPI RtwqUnlockPlatform(void)
 static void init_system_queues(void)
 {
     struct queue_desc desc;
+    char buffer[8];
     HRESULT hr;
 
     /* Always initialize standard queue, keep the rest lazy. */
@@ -1277,6 +1556,13 @@ static void init_system_queues(void)
     if (FAILED(hr = CoIncrementMTAUsage(&mta_cookie)))
         WARN("Failed to initialize MTA, hr %#lx.\n", hr);
 
+    if (GetEnvironmentVariableA("WINE_RTWQ_WORK_POOL", buffer, sizeof(buffer)) && atoi(buffer))
+    {
+        if (work_pool_tls == TLS_OUT_OF_INDEXES)
+            work_pool_tls = TlsAlloc();
+        use_work_pool = work_pool_tls != TLS_OUT_OF_INDEXES;
+    }
+
     desc.queue_type = RTWQ_STANDARD_WORKQUEUE;
     desc.ops = &pool_queue_ops;
     desc.target_queue = 0;
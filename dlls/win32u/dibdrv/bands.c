@@ -0,0 +1,173 @@
+/*
+ * DIB driver band splitting of large operations
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#if 0
+#pragma makedep unix
+#endif
+
+#include <pthread.h>
+#include "ntgdi_private.h"
+#include "dibdrv.h"
+
+#include "wine/debug.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(dib);
+
+/* Large operations are split into horizontal bands of destination rows that are
+ * processed concurrently by the calling thread and a small pool of worker threads.
+ * Bands never share destination rows, so the result is identical to the serial path.
+ * This is disabled unless HKCU\Software\Wine\GDI\DibThreads is set to more than 1. */
+
+#define MAX_BAND_THREADS    16
+#define MIN_BAND_HEIGHT     16
+#define MIN_BAND_PIXELS     (256 * 256)
+
+struct band_job
+{
+    void (*func)( void *arg, int first, int last );
+    void         *arg;
+    int           first;
+    int           last;
+    int           count;
+    int           band_height;
+    LONG          next;
+    unsigned int  active;
+};
+
+static pthread_once_t band_init_once = PTHREAD_ONCE_INIT;
+static unsigned int band_threads;  /* number of threads taking part in a job, including the caller */
+
+static pthread_mutex_t band_submit_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t band_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t band_start_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t band_done_cond = PTHREAD_COND_INITIALIZER;
+static struct band_job *current_job;
+static unsigned int current_serial;
+
+static void process_bands( struct band_job *job )
+{
+    int band, first;
+
+    while ((band = InterlockedIncrement( &job->next ) - 1) < job->count)
+    {
+        first = job->first + band * job->band_height;
+        job->func( job->arg, first, min( first + job->band_height, job->last ));
+    }
+}
+
+static void *band_worker( void *arg )
+{
+    unsigned int serial = 0;
+    struct band_job *job;
+
+    pthread_mutex_lock( &band_lock );
+    for (;;)
+    {
+        while (serial == current_serial) pthread_cond_wait( &band_start_cond, &band_lock );
+        serial = current_serial;
+        if (!(job = current_job)) continue;
+        job->active++;
+        pthread_mutex_unlock( &band_lock );
+
+        process_bands( job );
+
+        pthread_mutex_lock( &band_lock );
+        if (!--job->active) pthread_cond_signal( &band_done_cond );
+    }
+    return NULL;
+}
+
+static void init_band_threads(void)
+{
+    char buffer[FIELD_OFFSET(KEY_VALUE_PARTIAL_INFORMATION, Data[12 * sizeof(WCHAR)])];
+    KEY_VALUE_PARTIAL_INFORMATION *info = (void *)buffer;
+    DWORD count = 0;
+    unsigned int i;
+    pthread_t thread;
+    HKEY hkey;
+
+    /* @@ Wine registry key: HKCU\Software\Wine\GDI */
+    if ((hkey = reg_open_hkcu_key( "Software\\Wine\\GDI" )))
+    {
+        if (query_reg_ascii_value( hkey, "DibThreads", info, sizeof(buffer) ))
+        {
+            if (info->Type == REG_DWORD) memcpy( &count, info->Data, sizeof(count) );
+            else count = wcstol( (const WCHAR *)info->Data, NULL, 10 );
+        }
+        NtClose( hkey );
+    }
+    count = min( count, MAX_BAND_THREADS );
+
+    for (i = 1; i < count; i++)
+    {
+        if (pthread_create( &thread, NULL, band_worker, NULL ))
+        {
+            WARN( "failed to create band thread %u\n", i );
+            break;
+        }
+        pthread_detach( thread );
+    }
+    band_threads = i;
+    if (band_threads > 1) TRACE( "using %u threads for large DIB operations\n", band_threads );
+}
+
+/***********************************************************************
+ *           run_in_bands
+ *
+ * Call func for consecutive bands covering the [first, last) row range, possibly
+ * from several threads at once. func must only touch the destination rows of its band.
+ */
+void run_in_bands( void (*func)( void *arg, int first, int last ), void *arg,
+                   int first, int last, int width )
+{
+    struct band_job job;
+    int rows = last - first;
+
+    pthread_once( &band_init_once, init_band_threads );
+
+    if (band_threads <= 1 || rows < 2 * MIN_BAND_HEIGHT || (INT64)rows * width < MIN_BAND_PIXELS ||
+        pthread_mutex_trylock( &band_submit_lock ))
+    {
+        func( arg, first, last );
+        return;
+    }
+
+    job.func = func;
+    job.arg = arg;
+    job.first = first;
+    job.last = last;
+    job.band_height = max( MIN_BAND_HEIGHT, (rows + band_threads * 2 - 1) / (band_threads * 2) );
+    job.count = (rows + job.band_height - 1) / job.band_height;
+    job.next = 0;
+    job.active = 0;
+
+    pthread_mutex_lock( &band_lock );
+    current_job = &job;
+    current_serial++;
+    pthread_cond_broadcast( &band_start_cond );
+    pthread_mutex_unlock( &band_lock );
+
+    process_bands( &job );
+
+    pthread_mutex_lock( &band_lock );
+    while (job.active) pthread_cond_wait( &band_done_cond, &band_lock );
+    current_job = NULL;
+    pthread_mutex_unlock( &band_lock );
+
+    pthread_mutex_unlock( &band_submit_lock );
+}
@@ -585,17 +585,46 @@ static void mask_rect( dib_info *dst, const RECT *dst_rect, const dib_info *src,
     }
 }
 
+struct blend_bands
+{
+    const dib_info             *dst;
+    const dib_info             *src;
+    const struct clipped_rects *clipped_rects;
+    POINT                       offset;
+    BLENDFUNCTION               blend;
+};
+
+static void blend_band( void *arg, int first, int last )
+{
+    const struct blend_bands *params = arg;
+    const struct clipped_rects *clipped_rects = params->clipped_rects;
+    RECT band, rc;
+    int i;
+
+    SetRect( &band, INT_MIN, first, INT_MAX, last );
+    for (i = 0; i < clipped_rects->count; i++)
+    {
+        if (!intersect_rect( &rc, &clipped_rects->rects[i], &band )) continue;
+        params->dst->funcs->blend_rects( params->dst, 1, &rc, params->src, &params->offset, params->blend );
+    }
+}
+
 static DWORD blend_rect( dib_info *dst, const RECT *dst_rect, const dib_info *src, const RECT *src_rect,
                          HRGN clip, BLENDFUNCTION blend )
 {
-    POINT offset;
+    struct blend_bands params;
     struct clipped_rects clipped_rects;
 
     if (!get_clipped_rects( dst, dst_rect, clip, &clipped_rects )) return ERROR_SUCCESS;
 
-    offset.x = src_rect->left - dst_rect->left;
-    offset.y = src_rect->top  - dst_rect->top;
-    dst->funcs->blend_rects( dst, clipped_rects.count, clipped_rects.rects, src, &offset, blend );
+    params.dst = dst;
+    params.src = src;
+    params.clipped_rects = &clipped_rects;
+    params.offset.x = src_rect->left - dst_rect->left;
+    params.offset.y = src_rect->top  - dst_rect->top;
+    params.blend = blend;
+    run_in_bands( blend_band, &params, clipped_rects.rects[0].top,
+                  clipped_rects.rects[clipped_rects.count - 1].bottom, dst_rect->right - dst_rect->left );
 
     free_clipped_rects( &clipped_rects );
     return ERROR_SUCCESS;
@@ -680,19 +709,51 @@ static void get_gradient_triangle_vertices( const GRADIENT_TRIANGLE *tri, const
     bounds->bottom = v[2].y;
 }
 
-static BOOL gradient_rect( dib_info *dib, TRIVERTEX *v, int mode, HRGN clip, const RECT *bounds )
+struct gradient_bands
 {
+    const dib_info             *dib;
+    const struct clipped_rects *clipped_rects;
+    const TRIVERTEX            *v;
+    int                         mode;
+    BOOL                        ret;
+};
+
+static void gradient_band( void *arg, int first, int last )
+{
+    struct gradient_bands *params = arg;
+    const struct clipped_rects *clipped_rects = params->clipped_rects;
+    RECT band, rc;
     int i;
-    struct clipped_rects clipped_rects;
-    BOOL ret = TRUE;
 
-    if (!get_clipped_rects( dib, bounds, clip, &clipped_rects )) return TRUE;
-    for (i = 0; i < clipped_rects.count; i++)
+    SetRect( &band, INT_MIN, first, INT_MAX, last );
+    for (i = 0; i < clipped_rects->count; i++)
     {
-        if (!(ret = dib->funcs->gradient_rect( dib, &clipped_rects.rects[i], v, mode ))) break;
+        if (!intersect_rect( &rc, &clipped_rects->rects[i], &band )) continue;
+        if (!params->dib->funcs->gradient_rect( params->dib, &rc, params->v, params->mode ))
+        {
+            params->ret = FALSE;
+            break;
+        }
     }
+}
+
+static BOOL gradient_rect( dib_info *dib, TRIVERTEX *v, int mode, HRGN clip, const RECT *bounds )
+{
+    struct gradient_bands params;
+    struct clipped_rects clipped_rects;
+
+    if (!get_clipped_rects( dib, bounds, clip, &clipped_rects )) return TRUE;
+
+    params.dib = dib;
+    params.clipped_rects = &clipped_rects;
+    params.v = v;
+    params.mode = mode;
+    params.ret = TRUE;
+    run_in_bands( gradient_band, &params, clipped_rects.rects[0].top,
+                  clipped_rects.rects[clipped_rects.count - 1].bottom, bounds->right - bounds->left );
+
     free_clipped_rects( &clipped_rects );
-    return ret;
+    return params.ret;
 }
 
 static DWORD copy_src_bits( dib_info *src, RECT *src_rect )
@@ -1198,6 +1259,91 @@ static DWORD calc_1d_stretch_params( INT dst_start, INT dst_length, INT dst_vis_
 }
 
 
+struct stretch_bands
+{
+    const dib_info        *dst_dib;
+    const dib_info        *src_dib;
+    POINT                  dst_start;
+    POINT                  src_start;
+    struct stretch_params  h_params;
+    struct stretch_params  v_params;
+    int                    row_width;
+    int                    mode;
+    void (* row_fn)(const dib_info *dst_dib, const POINT *dst_start,
+                    const dib_info *src_dib, const POINT *src_start,
+                    const struct stretch_params *params, int mode, BOOL keep_dst);
+};
+
+/* vertical stretching, destination rows [first, last) */
+static void stretch_band( void *arg, int first, int last )
+{
+    const struct stretch_bands *params = arg;
+    POINT dst_start = params->dst_start, src_start = params->src_start;
+    int i, err = params->v_params.err_start;
+    BOOL need_row = TRUE;
+    RECT last_row, this_row;
+
+    last_row.left = 0;
+    last_row.right = params->row_width;
+
+    for (i = 0; i < last; i++)
+    {
+        if (i >= first)
+        {
+            /* the first row of a band can't be copied from the previous band */
+            if (need_row || i == first)
+            {
+                params->row_fn( params->dst_dib, &dst_start, params->src_dib, &src_start,
+                                &params->h_params, params->mode, FALSE );
+                need_row = FALSE;
+            }
+            else
+            {
+                last_row.top = dst_start.y - params->v_params.dst_inc;
+                last_row.bottom = last_row.top + 1;
+                this_row = last_row;
+                OffsetRect( &this_row, 0, params->v_params.dst_inc );
+                copy_rect( (dib_info *)params->dst_dib, &this_row, params->dst_dib, &last_row, NULL, R2_COPYPEN );
+            }
+        }
+
+        if (err > 0)
+        {
+            src_start.y += params->v_params.src_inc;
+            need_row = TRUE;
+            err += params->v_params.err_add_1;
+        }
+        else err += params->v_params.err_add_2;
+        dst_start.y += params->v_params.dst_inc;
+    }
+}
+
+/* vertical shrinking, source rows merged into destination rows [first, last) */
+static void shrink_band( void *arg, int first, int last )
+{
+    const struct stretch_bands *params = arg;
+    POINT dst_start = params->dst_start, src_start = params->src_start;
+    int i, dst_row = 0, merged_rows = 0, err = params->v_params.err_start;
+
+    for (i = 0; i < params->v_params.length && dst_row < last; i++)
+    {
+        if (dst_row >= first && (params->mode != STRETCH_DELETESCANS || !merged_rows))
+            params->row_fn( params->dst_dib, &dst_start, params->src_dib, &src_start,
+                            &params->h_params, params->mode, merged_rows != 0 );
+        merged_rows++;
+
+        if (err > 0)
+        {
+            dst_start.y += params->v_params.dst_inc;
+            dst_row++;
+            merged_rows = 0;
+            err += params->v_params.err_add_1;
+        }
+        else err += params->v_params.err_add_2;
+        src_start.y += params->v_params.src_inc;
+    }
+}
+
 DWORD stretch_bitmapinfo( const BITMAPINFO *src_info, void *src_bits, struct bitblt_coords *src,
                           const BITMAPINFO *dst_info, void *dst_bits, struct bitblt_coords *dst,
                           INT mode )
@@ -1207,11 +1353,8 @@ DWORD stretch_bitmapinfo( const BITMAPINFO *src_info, void *src_bits, struct bit
     RECT rect;
     BOOL hstretch, vstretch;
     struct stretch_params v_params, h_params;
-    int err;
+    struct stretch_bands params;
     DWORD ret;
-    void (* row_fn)(const dib_info *dst_dib, const POINT *dst_start,
-                    const dib_info *src_dib, const POINT *src_start,
-                    const struct stretch_params *params, int mode, BOOL keep_dst);
 
     TRACE("dst %d, %d - %d x %d visrect %s src %d, %d - %d x %d visrect %s\n",
           dst->x, dst->y, dst->width, dst->height, wine_dbgstr_rect(&dst->visrect),
@@ -1251,64 +1394,23 @@ DWORD stretch_bitmapinfo( const BITMAPINFO *src_info, void *src_bits, struct bit
     dst_start.x -= dst->visrect.left;
     dst_start.y -= dst->visrect.top;
 
-    err = v_params.err_start;
-
-    row_fn = hstretch ? dst_dib.funcs->stretch_row : dst_dib.funcs->shrink_row;
+    params.dst_dib = &dst_dib;
+    params.src_dib = &src_dib;
+    params.dst_start = dst_start;
+    params.src_start = src_start;
+    params.h_params = h_params;
+    params.v_params = v_params;
+    params.row_width = dst->visrect.right - dst->visrect.left;
+    params.mode = mode;
+    params.row_fn = hstretch ? dst_dib.funcs->stretch_row : dst_dib.funcs->shrink_row;
 
     if (vstretch)
     {
-        BOOL need_row = TRUE;
-        RECT last_row, this_row;
-        if (hstretch) mode = STRETCH_DELETESCANS;
-        last_row.left = 0;
-        last_row.right = dst->visrect.right - dst->visrect.left;
-
-        while (v_params.length--)
-        {
-            if (need_row)
-            {
-                row_fn( &dst_dib, &dst_start, &src_dib, &src_start, &h_params, mode, FALSE );
-                need_row = FALSE;
-            }
-            else
-            {
-                last_row.top = dst_start.y - v_params.dst_inc;
-                last_row.bottom = last_row.top + 1;
-                this_row = last_row;
-                OffsetRect( &this_row, 0, v_params.dst_inc );
-                copy_rect( &dst_dib, &this_row, &dst_dib, &last_row, NULL, R2_COPYPEN );
-            }
-
-            if (err > 0)
-            {
-                src_start.y += v_params.src_inc;
-                need_row = TRUE;
-                err += v_params.err_add_1;
-            }
-            else err += v_params.err_add_2;
-            dst_start.y += v_params.dst_inc;
-        }
-    }
-    else
-    {
-        int merged_rows = 0;
-
-        while (v_params.length--)
-        {
-            if (mode != STRETCH_DELETESCANS || !merged_rows)
-                row_fn( &dst_dib, &dst_start, &src_dib, &src_start, &h_params, mode, merged_rows != 0 );
-            merged_rows++;
-
-            if (err > 0)
-            {
-                dst_start.y += v_params.dst_inc;
-                merged_rows = 0;
-                err += v_params.err_add_1;
-            }
-            else err += v_params.err_add_2;
-            src_start.y += v_params.src_inc;
-        }
+        if (hstretch) params.mode = STRETCH_DELETESCANS;
+        run_in_bands( stretch_band, &params, 0, v_params.length, h_params.length );
     }
+    else run_in_bands( shrink_band, &params, 0, abs( dst_end.y - dst->visrect.top - dst_start.y ) + 1,
+                       h_params.length );
 
 done:
     /* update coordinates, the destination rectangle is always stored at 0,0 */
@@ -264,6 +264,8 @@ extern int clip_line(const POINT *start, const POINT *end, const RECT *clip,
                      const bres_params *params, POINT *pt1, POINT *pt2);
 extern void release_cached_font( struct cached_font *font );
 extern BOOL fill_with_pixel( DC *dc, dib_info *dib, DWORD pixel, int num, const RECT *rects, INT rop );
+extern void run_in_bands( void (*func)( void *arg, int first, int last ), void *arg,
+                          int first, int last, int width );
 
 static inline void init_clipped_rects( struct clipped_rects *clip_rects )
 {
@@ -47,6 +47,12 @@ enum glyph_type
 #define GLYPH_CACHE_PAGE_SIZE  0x100
 #define GLYPH_CACHE_PAGES      (0x10000 / GLYPH_CACHE_PAGE_SIZE)
 
+/* The least recently used fonts that are no longer selected are evicted while the
+ * cache is larger than FONT_CACHE_MAX_SIZE, but at least FONT_CACHE_MIN_UNUSED of
+ * them are always kept. */
+#define FONT_CACHE_MIN_UNUSED  5
+#define FONT_CACHE_MAX_SIZE    (8 * 1024 * 1024)
+
 struct cached_font
 {
     struct list           entry;
@@ -55,10 +61,16 @@ struct cached_font
     LOGFONTW              lf;
     XFORM                 xform;
     UINT                  aa_flags;
+    LONG                  size;     /* size of the structure and cached glyphs */
+    LONG                  hits;
+    LONG                  misses;
     struct cached_glyph **glyphs[GLYPH_NBTYPES][GLYPH_CACHE_PAGES];
 };
 
 static struct list font_cache = LIST_INIT( font_cache );
+static LONG font_cache_size;
+static LONG font_cache_hits;
+static LONG font_cache_misses;
 
 static pthread_mutex_t font_cache_lock = PTHREAD_MUTEX_INITIALIZER;
 
@@ -551,10 +563,33 @@ static int font_cache_cmp( const struct cached_font *p1, const struct cached_fon
     return ret;
 }
 
+static void free_cached_font( struct cached_font *font )
+{
+    UINT i, j, k;
+
+    TRACE( "%d %s %p: %d bytes, %d hits, %d misses (total %d bytes, %d hits, %d misses)\n",
+           font->lf.lfHeight, debugstr_w(font->lf.lfFaceName), font, font->size, font->hits,
+           font->misses, font_cache_size, font_cache_hits, font_cache_misses );
+
+    for (i = 0; i < GLYPH_NBTYPES; i++)
+    {
+        for (j = 0; j < GLYPH_CACHE_PAGES; j++)
+        {
+            if (!font->glyphs[i][j]) continue;
+            for (k = 0; k < GLYPH_CACHE_PAGE_SIZE; k++)
+                free( font->glyphs[i][j][k] );
+            free( font->glyphs[i][j] );
+        }
+    }
+    InterlockedExchangeAdd( &font_cache_size, -font->size );
+    list_remove( &font->entry );
+    free( font );
+}
+
 static struct cached_font *add_cached_font( DC *dc, HFONT hfont, UINT aa_flags )
 {
-    struct cached_font font, *ptr, *last_unused = NULL;
-    UINT i = 0, j, k;
+    struct cached_font font, *ptr, *next;
+    UINT unused = 0;
 
     NtGdiExtGetObjectW( hfont, sizeof(font.lf), &font.lf );
     font.xform = dc->xformWorld2Vport;
@@ -578,29 +613,19 @@ static struct cached_font *add_cached_font( DC *dc, HFONT hfont, UINT aa_flags )
             list_remove( &ptr->entry );
             goto done;
         }
-        if (!ptr->ref)
-        {
-            i++;
-            last_unused = ptr;
-        }
+        if (!ptr->ref) unused++;
     }
 
-    if (i > 5)  /* keep at least 5 of the most-recently used fonts around */
+    /* the list is in most-recently used order, evict from the tail */
+    LIST_FOR_EACH_ENTRY_SAFE_REV( ptr, next, &font_cache, struct cached_font, entry )
     {
-        ptr = last_unused;
-        for (i = 0; i < GLYPH_NBTYPES; i++)
-        {
-            for (j = 0; j < GLYPH_CACHE_PAGES; j++)
-            {
-                if (!ptr->glyphs[i][j]) continue;
-                for (k = 0; k < GLYPH_CACHE_PAGE_SIZE; k++)
-                    free( ptr->glyphs[i][j][k] );
-                free( ptr->glyphs[i][j] );
-            }
-        }
-        list_remove( &ptr->entry );
+        if (unused <= FONT_CACHE_MIN_UNUSED || font_cache_size <= FONT_CACHE_MAX_SIZE) break;
+        if (ptr->ref) continue;
+        free_cached_font( ptr );
+        unused--;
     }
-    else if (!(ptr = malloc( sizeof(*ptr) )))
+
+    if (!(ptr = malloc( sizeof(*ptr) )))
     {
         pthread_mutex_unlock( &font_cache_lock );
         return NULL;
@@ -608,7 +633,10 @@ static struct cached_font *add_cached_font( DC *dc, HFONT hfont, UINT aa_flags )
 
     *ptr = font;
     ptr->ref = 1;
+    ptr->size = sizeof(*ptr);
+    ptr->hits = ptr->misses = 0;
     memset( ptr->glyphs, 0, sizeof(ptr->glyphs) );
+    InterlockedExchangeAdd( &font_cache_size, ptr->size );
 done:
     list_add_head( &font_cache, &ptr->entry );
     pthread_mutex_unlock( &font_cache_lock );
@@ -622,7 +650,7 @@ void release_cached_font( struct cached_font *font )
 }
 
 static struct cached_glyph *add_cached_glyph( struct cached_font *font, UINT index, UINT flags,
-                                              struct cached_glyph *glyph )
+                                              struct cached_glyph *glyph, LONG size )
 {
     struct cached_glyph *ret;
     enum glyph_type type = (flags & ETO_GLYPH_INDEX) ? GLYPH_INDEX : GLYPH_WCHAR;
@@ -643,7 +671,12 @@ static struct cached_glyph *add_cached_glyph( struct cached_font *font, UINT ind
             free( ptr );
     }
     ret = InterlockedCompareExchangePointer( (void **)&font->glyphs[type][page][entry], glyph, NULL );
-    if (!ret) ret = glyph;
+    if (!ret)
+    {
+        InterlockedExchangeAdd( &font->size, size );
+        InterlockedExchangeAdd( &font_cache_size, size );
+        ret = glyph;
+    }
     else free( glyph );
     return ret;
 }
@@ -804,14 +837,14 @@ static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font
 
 done:
     glyph->metrics = metrics;
-    return add_cached_glyph( font, index, flags, glyph );
+    return add_cached_glyph( font, index, flags, glyph, FIELD_OFFSET( struct cached_glyph, bits[size] ));
 }
 
 static void render_string( DC *dc, dib_info *dib, struct cached_font *font, INT x, INT y,
                            UINT flags, const WCHAR *str, UINT count, const INT *dx,
                            const struct clipped_rects *clipped_rects, RECT *bounds )
 {
-    UINT i;
+    UINT i, misses = 0;
     struct cached_glyph *glyph;
     dib_info glyph_dib;
     DWORD text_color;
@@ -832,8 +865,11 @@ static void render_string( DC *dc, dib_info *dib, struct cached_font *font, INT
 
     for (i = 0; i < count; i++)
     {
-        if (!(glyph = get_cached_glyph( font, str[i], flags )) &&
-            !(glyph = cache_glyph_bitmap( dc, font, str[i], flags ))) continue;
+        if (!(glyph = get_cached_glyph( font, str[i], flags )))
+        {
+            misses++;
+            if (!(glyph = cache_glyph_bitmap( dc, font, str[i], flags ))) continue;
+        }
 
         glyph_dib.width       = glyph->metrics.gmBlackBoxX;
         glyph_dib.height      = glyph->metrics.gmBlackBoxY;
@@ -860,6 +896,17 @@ static void render_string( DC *dc, dib_info *dib, struct cached_font *font, INT
             y += glyph->metrics.gmCellIncY;
         }
     }
+
+    if (count > misses)
+    {
+        InterlockedExchangeAdd( &font->hits, count - misses );
+        InterlockedExchangeAdd( &font_cache_hits, count - misses );
+    }
+    if (misses)
+    {
+        InterlockedExchangeAdd( &font->misses, misses );
+        InterlockedExchangeAdd( &font_cache_misses, misses );
+    }
 }
 
 BOOL render_aa_text_bitmapinfo( DC *dc, BITMAPINFO *info, struct gdi_image_bits *bits,
@@ -23,6 +23,11 @@
 #endif
 
 #include <assert.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 #include "ntgdi_private.h"
 #include "dibdrv.h"
@@ -176,17 +181,6 @@ static inline void do_rop_codes_mask_8(BYTE *dst, BYTE src, struct rop_codes *co
     do_rop_mask_8( dst, (src & codes->a1) ^ codes->a2, (src & codes->x1) ^ codes->x2, mask );
 }
 
-static inline void do_rop_codes_line_16(WORD *dst, const WORD *src, struct rop_codes *codes, int len)
-{
-    for (; len > 0; len--, src++, dst++) do_rop_codes_16( dst, *src, codes );
-}
-
-static inline void do_rop_codes_line_rev_16(WORD *dst, const WORD *src, struct rop_codes *codes, int len)
-{
-    for (src += len - 1, dst += len - 1; len > 0; len--, src--, dst--)
-        do_rop_codes_16( dst, *src, codes );
-}
-
 static inline void do_rop_codes_line_8(BYTE *dst, const BYTE *src, struct rop_codes *codes, int len)
 {
     for (; len > 0; len--, src++, dst++) do_rop_codes_8( dst, *src, codes );
@@ -268,10 +262,210 @@ static inline void memset_16( WORD *start, WORD val, DWORD size )
 #endif
 }
 
+/* The SSE2 and NEON helpers below process a row in vector sized chunks and hand the
+ * remaining pixels to the scalar code; results are bit-identical to the scalar loops. */
+
+static inline void do_rop_line_32( DWORD *ptr, DWORD and, DWORD xor, int len )
+{
+#ifdef __SSE2__
+    __m128i and_vec = _mm_set1_epi32( and ), xor_vec = _mm_set1_epi32( xor );
+
+    for (; len >= 4; len -= 4, ptr += 4)
+    {
+        __m128i val = _mm_loadu_si128( (__m128i *)ptr );
+        _mm_storeu_si128( (__m128i *)ptr, _mm_xor_si128( _mm_and_si128( val, and_vec ), xor_vec ));
+    }
+#elif defined(__aarch64__)
+    uint32x4_t and_vec = vdupq_n_u32( and ), xor_vec = vdupq_n_u32( xor );
+
+    for (; len >= 4; len -= 4, ptr += 4)
+        vst1q_u32( ptr, veorq_u32( vandq_u32( vld1q_u32( ptr ), and_vec ), xor_vec ));
+#endif
+    for (; len > 0; len--) do_rop_32( ptr++, and, xor );
+}
+
+static inline void do_rop_line_16( WORD *ptr, WORD and, WORD xor, int len )
+{
+#ifdef __SSE2__
+    __m128i and_vec = _mm_set1_epi16( and ), xor_vec = _mm_set1_epi16( xor );
+
+    for (; len >= 8; len -= 8, ptr += 8)
+    {
+        __m128i val = _mm_loadu_si128( (__m128i *)ptr );
+        _mm_storeu_si128( (__m128i *)ptr, _mm_xor_si128( _mm_and_si128( val, and_vec ), xor_vec ));
+    }
+#elif defined(__aarch64__)
+    uint16x8_t and_vec = vdupq_n_u16( and ), xor_vec = vdupq_n_u16( xor );
+
+    for (; len >= 8; len -= 8, ptr += 8)
+        vst1q_u16( ptr, veorq_u16( vandq_u16( vld1q_u16( ptr ), and_vec ), xor_vec ));
+#endif
+    for (; len > 0; len--) do_rop_16( ptr++, and, xor );
+}
+
+static inline void do_rop_pattern_line_32( DWORD *ptr, const DWORD *and, const DWORD *xor, int len )
+{
+#ifdef __SSE2__
+    for (; len >= 4; len -= 4, ptr += 4, and += 4, xor += 4)
+    {
+        __m128i val = _mm_loadu_si128( (__m128i *)ptr );
+        val = _mm_and_si128( val, _mm_loadu_si128( (const __m128i *)and ));
+        _mm_storeu_si128( (__m128i *)ptr, _mm_xor_si128( val, _mm_loadu_si128( (const __m128i *)xor )));
+    }
+#elif defined(__aarch64__)
+    for (; len >= 4; len -= 4, ptr += 4, and += 4, xor += 4)
+        vst1q_u32( ptr, veorq_u32( vandq_u32( vld1q_u32( ptr ), vld1q_u32( and )), vld1q_u32( xor )));
+#endif
+    for (; len > 0; len--) do_rop_32( ptr++, *and++, *xor++ );
+}
+
+static inline void do_rop_pattern_line_16( WORD *ptr, const WORD *and, const WORD *xor, int len )
+{
+#ifdef __SSE2__
+    for (; len >= 8; len -= 8, ptr += 8, and += 8, xor += 8)
+    {
+        __m128i val = _mm_loadu_si128( (__m128i *)ptr );
+        val = _mm_and_si128( val, _mm_loadu_si128( (const __m128i *)and ));
+        _mm_storeu_si128( (__m128i *)ptr, _mm_xor_si128( val, _mm_loadu_si128( (const __m128i *)xor )));
+    }
+#elif defined(__aarch64__)
+    for (; len >= 8; len -= 8, ptr += 8, and += 8, xor += 8)
+        vst1q_u16( ptr, veorq_u16( vandq_u16( vld1q_u16( ptr ), vld1q_u16( and )), vld1q_u16( xor )));
+#endif
+    for (; len > 0; len--) do_rop_16( ptr++, *and++, *xor++ );
+}
+
+/* The source rows of the ROP copy lines may overlap the destination. Each vector is
+ * loaded before it is stored, which keeps forward copies to the left and reverse
+ * copies to the right correct, like in the scalar loops. */
+
+#ifdef __SSE2__
+static inline __m128i do_rop_codes_vec( __m128i dst, __m128i src, __m128i a1, __m128i a2, __m128i x1, __m128i x2 )
+{
+    __m128i and = _mm_xor_si128( _mm_and_si128( src, a1 ), a2 );
+    __m128i xor = _mm_xor_si128( _mm_and_si128( src, x1 ), x2 );
+    return _mm_xor_si128( _mm_and_si128( dst, and ), xor );
+}
+#elif defined(__aarch64__)
+static inline uint32x4_t do_rop_codes_vec( uint32x4_t dst, uint32x4_t src, uint32x4_t a1, uint32x4_t a2,
+                                           uint32x4_t x1, uint32x4_t x2 )
+{
+    uint32x4_t and = veorq_u32( vandq_u32( src, a1 ), a2 );
+    uint32x4_t xor = veorq_u32( vandq_u32( src, x1 ), x2 );
+    return veorq_u32( vandq_u32( dst, and ), xor );
+}
+#endif
+
+static inline void do_rop_codes_line_32(DWORD *dst, const DWORD *src, struct rop_codes *codes, int len)
+{
+#ifdef __SSE2__
+    __m128i a1 = _mm_set1_epi32( codes->a1 ), a2 = _mm_set1_epi32( codes->a2 );
+    __m128i x1 = _mm_set1_epi32( codes->x1 ), x2 = _mm_set1_epi32( codes->x2 );
+
+    for (; len >= 4; len -= 4, src += 4, dst += 4)
+        _mm_storeu_si128( (__m128i *)dst, do_rop_codes_vec( _mm_loadu_si128( (__m128i *)dst ),
+                          _mm_loadu_si128( (const __m128i *)src ), a1, a2, x1, x2 ));
+#elif defined(__aarch64__)
+    uint32x4_t a1 = vdupq_n_u32( codes->a1 ), a2 = vdupq_n_u32( codes->a2 );
+    uint32x4_t x1 = vdupq_n_u32( codes->x1 ), x2 = vdupq_n_u32( codes->x2 );
+
+    for (; len >= 4; len -= 4, src += 4, dst += 4)
+        vst1q_u32( dst, do_rop_codes_vec( vld1q_u32( dst ), vld1q_u32( src ), a1, a2, x1, x2 ));
+#endif
+    for (; len > 0; len--, src++, dst++) do_rop_codes_32( dst, *src, codes );
+}
+
+static inline void do_rop_codes_line_rev_32(DWORD *dst, const DWORD *src, struct rop_codes *codes, int len)
+{
+    src += len;
+    dst += len;
+#ifdef __SSE2__
+    {
+        __m128i a1 = _mm_set1_epi32( codes->a1 ), a2 = _mm_set1_epi32( codes->a2 );
+        __m128i x1 = _mm_set1_epi32( codes->x1 ), x2 = _mm_set1_epi32( codes->x2 );
+
+        for (; len >= 4; len -= 4)
+        {
+            src -= 4;
+            dst -= 4;
+            _mm_storeu_si128( (__m128i *)dst, do_rop_codes_vec( _mm_loadu_si128( (__m128i *)dst ),
+                              _mm_loadu_si128( (const __m128i *)src ), a1, a2, x1, x2 ));
+        }
+    }
+#elif defined(__aarch64__)
+    {
+        uint32x4_t a1 = vdupq_n_u32( codes->a1 ), a2 = vdupq_n_u32( codes->a2 );
+        uint32x4_t x1 = vdupq_n_u32( codes->x1 ), x2 = vdupq_n_u32( codes->x2 );
+
+        for (; len >= 4; len -= 4)
+        {
+            src -= 4;
+            dst -= 4;
+            vst1q_u32( dst, do_rop_codes_vec( vld1q_u32( dst ), vld1q_u32( src ), a1, a2, x1, x2 ));
+        }
+    }
+#endif
+    for (; len > 0; len--) do_rop_codes_32( --dst, *--src, codes );
+}
+
+static inline void do_rop_codes_line_16(WORD *dst, const WORD *src, struct rop_codes *codes, int len)
+{
+#ifdef __SSE2__
+    __m128i a1 = _mm_set1_epi16( codes->a1 ), a2 = _mm_set1_epi16( codes->a2 );
+    __m128i x1 = _mm_set1_epi16( codes->x1 ), x2 = _mm_set1_epi16( codes->x2 );
+
+    for (; len >= 8; len -= 8, src += 8, dst += 8)
+        _mm_storeu_si128( (__m128i *)dst, do_rop_codes_vec( _mm_loadu_si128( (__m128i *)dst ),
+                          _mm_loadu_si128( (const __m128i *)src ), a1, a2, x1, x2 ));
+#elif defined(__aarch64__)
+    uint32x4_t a1 = vreinterpretq_u32_u16( vdupq_n_u16( codes->a1 )), a2 = vreinterpretq_u32_u16( vdupq_n_u16( codes->a2 ));
+    uint32x4_t x1 = vreinterpretq_u32_u16( vdupq_n_u16( codes->x1 )), x2 = vreinterpretq_u32_u16( vdupq_n_u16( codes->x2 ));
+
+    for (; len >= 8; len -= 8, src += 8, dst += 8)
+        vst1q_u16( dst, vreinterpretq_u16_u32( do_rop_codes_vec( vreinterpretq_u32_u16( vld1q_u16( dst )),
+                   vreinterpretq_u32_u16( vld1q_u16( src )), a1, a2, x1, x2 )));
+#endif
+    for (; len > 0; len--, src++, dst++) do_rop_codes_16( dst, *src, codes );
+}
+
+static inline void do_rop_codes_line_rev_16(WORD *dst, const WORD *src, struct rop_codes *codes, int len)
+{
+    src += len;
+    dst += len;
+#ifdef __SSE2__
+    {
+        __m128i a1 = _mm_set1_epi16( codes->a1 ), a2 = _mm_set1_epi16( codes->a2 );
+        __m128i x1 = _mm_set1_epi16( codes->x1 ), x2 = _mm_set1_epi16( codes->x2 );
+
+        for (; len >= 8; len -= 8)
+        {
+            src -= 8;
+            dst -= 8;
+            _mm_storeu_si128( (__m128i *)dst, do_rop_codes_vec( _mm_loadu_si128( (__m128i *)dst ),
+                              _mm_loadu_si128( (const __m128i *)src ), a1, a2, x1, x2 ));
+        }
+    }
+#elif defined(__aarch64__)
+    {
+        uint32x4_t a1 = vreinterpretq_u32_u16( vdupq_n_u16( codes->a1 )), a2 = vreinterpretq_u32_u16( vdupq_n_u16( codes->a2 ));
+        uint32x4_t x1 = vreinterpretq_u32_u16( vdupq_n_u16( codes->x1 )), x2 = vreinterpretq_u32_u16( vdupq_n_u16( codes->x2 ));
+
+        for (; len >= 8; len -= 8)
+        {
+            src -= 8;
+            dst -= 8;
+            vst1q_u16( dst, vreinterpretq_u16_u32( do_rop_codes_vec( vreinterpretq_u32_u16( vld1q_u16( dst )),
+                       vreinterpretq_u32_u16( vld1q_u16( src )), a1, a2, x1, x2 )));
+        }
+    }
+#endif
+    for (; len > 0; len--) do_rop_codes_16( --dst, *--src, codes );
+}
+
 static void solid_rects_32(const dib_info *dib, int num, const RECT *rc, DWORD and, DWORD xor)
 {
-    DWORD *ptr, *start;
-    int x, y, i;
+    DWORD *start;
+    int y, i;
 
     for(i = 0; i < num; i++, rc++)
     {
@@ -280,8 +474,7 @@ static void solid_rects_32(const dib_info *dib, int num, const RECT *rc, DWORD a
         start = get_pixel_ptr_32(dib, rc->left, rc->top);
         if (and)
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 4)
-                for(x = rc->left, ptr = start; x < rc->right; x++)
-                    do_rop_32(ptr++, and, xor);
+                do_rop_line_32( start, and, xor, rc->right - rc->left );
         else
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 4)
                 memset_32( start, xor, rc->right - rc->left );
@@ -421,8 +614,8 @@ static void solid_rects_24(const dib_info *dib, int num, const RECT *rc, DWORD a
 
 static void solid_rects_16(const dib_info *dib, int num, const RECT *rc, DWORD and, DWORD xor)
 {
-    WORD *ptr, *start;
-    int x, y, i;
+    WORD *start;
+    int y, i;
 
     for(i = 0; i < num; i++, rc++)
     {
@@ -431,8 +624,7 @@ static void solid_rects_16(const dib_info *dib, int num, const RECT *rc, DWORD a
         start = get_pixel_ptr_16(dib, rc->left, rc->top);
         if (and)
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 2)
-                for(x = rc->left, ptr = start; x < rc->right; x++)
-                    do_rop_16(ptr++, and, xor);
+                do_rop_line_16( start, and, xor, rc->right - rc->left );
         else
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 2)
                 memset_16( start, xor, rc->right - rc->left );
@@ -822,7 +1014,7 @@ static inline POINT calc_brush_offset(const RECT *rc, const dib_info *brush, con
 static void pattern_rects_32(const dib_info *dib, int num, const RECT *rc, const POINT *origin,
                              const dib_info *brush, const rop_mask_bits *bits)
 {
-    DWORD *ptr, *start, *start_and, *and_ptr, *start_xor, *xor_ptr;
+    DWORD *start, *start_and, *start_xor;
     int x, y, i, len, brush_x;
     POINT offset;
 
@@ -838,17 +1030,11 @@ static void pattern_rects_32(const dib_info *dib, int num, const RECT *rc, const
 
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 4)
             {
-                and_ptr = start_and + offset.x;
-                xor_ptr = start_xor + offset.x;
-
-                for(x = rc->left, ptr = start; x < rc->right; x++)
+                for (x = rc->left, brush_x = offset.x; x < rc->right; x += len)
                 {
-                    do_rop_32(ptr++, *and_ptr++, *xor_ptr++);
-                    if(and_ptr == start_and + brush->width)
-                    {
-                        and_ptr = start_and;
-                        xor_ptr = start_xor;
-                    }
+                    len = min( rc->right - x, brush->width - brush_x );
+                    do_rop_pattern_line_32( start + x - rc->left, start_and + brush_x, start_xor + brush_x, len );
+                    brush_x = 0;
                 }
 
                 offset.y++;
@@ -962,7 +1148,7 @@ static void pattern_rects_24(const dib_info *dib, int num, const RECT *rc, const
 static void pattern_rects_16(const dib_info *dib, int num, const RECT *rc, const POINT *origin,
                              const dib_info *brush, const rop_mask_bits *bits)
 {
-    WORD *ptr, *start, *start_and, *and_ptr, *start_xor, *xor_ptr;
+    WORD *start, *start_and, *start_xor;
     int x, y, i, len, brush_x;
     POINT offset;
 
@@ -978,17 +1164,11 @@ static void pattern_rects_16(const dib_info *dib, int num, const RECT *rc, const
             start_and = (WORD*)bits->and + offset.y * brush->stride / 2;
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 2)
             {
-                and_ptr = start_and + offset.x;
-                xor_ptr = start_xor + offset.x;
-
-                for(x = rc->left, ptr = start; x < rc->right; x++)
+                for (x = rc->left, brush_x = offset.x; x < rc->right; x += len)
                 {
-                    do_rop_16(ptr++, *and_ptr++, *xor_ptr++);
-                    if(and_ptr == start_and + brush->width)
-                    {
-                        and_ptr = start_and;
-                        xor_ptr = start_xor;
-                    }
+                    len = min( rc->right - x, brush->width - brush_x );
+                    do_rop_pattern_line_16( start + x - rc->left, start_and + brush_x, start_xor + brush_x, len );
+                    brush_x = 0;
                 }
 
                 offset.y++;
@@ -1338,53 +1518,12 @@ static void pattern_rects_null(const dib_info *dib, int num, const RECT *rc, con
     return;
 }
 
-static inline void copy_rect_bits_32( DWORD *dst_start, const DWORD *src_start, const SIZE *size,
-                                      int dst_stride, int src_stride, int rop2 )
-{
-    const DWORD *src;
-    DWORD *dst;
-    int x, y;
-
-#define LOOP( op )                                                                     \
-    for (y = 0; y < size->cy; y++, dst_start += dst_stride, src_start += src_stride)   \
-        for (x = 0, src = src_start, dst = dst_start; x < size->cx; x++, src++, dst++) \
-            op;
-
-    switch (rop2)
-    {
-        ROPS_WITHOUT_COPY( dst[0], src[0] )
-    }
-#undef LOOP
-}
-
-static inline void copy_rect_bits_rev_32( DWORD *dst_start, const DWORD *src_start, const SIZE *size,
-                                          int dst_stride, int src_stride, int rop2 )
-{
-    const DWORD *src;
-    DWORD *dst;
-    int x, y;
-
-    src_start += size->cx - 1;
-    dst_start += size->cx - 1;
-
-#define LOOP( op )                                                                     \
-    for (y = 0; y < size->cy; y++, dst_start += dst_stride, src_start += src_stride)   \
-        for (x = 0, src = src_start, dst = dst_start; x < size->cx; x++, src--, dst--) \
-            op;
-
-    switch (rop2)
-    {
-        ROPS_WITHOUT_COPY( dst[0], src[0] )
-    }
-#undef LOOP
-}
-
 static void copy_rect_32(const dib_info *dst, const RECT *rc,
                          const dib_info *src, const POINT *origin, int rop2, int overlap)
 {
     DWORD *dst_start, *src_start;
     int y, dst_stride, src_stride;
-    SIZE size;
+    struct rop_codes codes;
 
     if (overlap & OVERLAP_BELOW)
     {
@@ -1408,13 +1547,14 @@ static void copy_rect_32(const dib_info *dst, const RECT *rc,
         return;
     }
 
-    size.cx = rc->right - rc->left;
-    size.cy = rc->bottom - rc->top;
-
-    if (overlap & OVERLAP_RIGHT)
-        copy_rect_bits_rev_32( dst_start, src_start, &size, dst_stride, src_stride, rop2 );
-    else
-        copy_rect_bits_32( dst_start, src_start, &size, dst_stride, src_stride, rop2 );
+    get_rop_codes( rop2, &codes );
+    for (y = rc->top; y < rc->bottom; y++, dst_start += dst_stride, src_start += src_stride)
+    {
+        if (overlap & OVERLAP_RIGHT)
+            do_rop_codes_line_rev_32( dst_start, src_start, &codes, rc->right - rc->left );
+        else
+            do_rop_codes_line_32( dst_start, src_start, &codes, rc->right - rc->left );
+    }
 }
 
 static void copy_rect_24(const dib_info *dst, const RECT *rc,
@@ -2219,6 +2359,55 @@ static inline BOOL bit_fields_match(const dib_info *d1, const dib_info *d2)
            d1->blue_mask  == d2->blue_mask;
 }
 
+static inline void convert_line_555_to_8888( DWORD *dst, const WORD *src, int len )
+{
+    DWORD src_val;
+
+#ifdef __SSE2__
+    __m128i mask = _mm_set1_epi16( 0x1f );
+
+    for (; len >= 8; len -= 8, src += 8, dst += 8)
+    {
+        __m128i val = _mm_loadu_si128( (const __m128i *)src );
+        __m128i r = _mm_and_si128( _mm_srli_epi16( val, 10 ), mask );
+        __m128i g = _mm_and_si128( _mm_srli_epi16( val, 5 ), mask );
+        __m128i b = _mm_and_si128( val, mask );
+
+        r = _mm_or_si128( _mm_slli_epi16( r, 3 ), _mm_srli_epi16( r, 2 ));
+        g = _mm_or_si128( _mm_slli_epi16( g, 3 ), _mm_srli_epi16( g, 2 ));
+        b = _mm_or_si128( _mm_slli_epi16( b, 3 ), _mm_srli_epi16( b, 2 ));
+        b = _mm_or_si128( b, _mm_slli_epi16( g, 8 ));
+        _mm_storeu_si128( (__m128i *)dst, _mm_unpacklo_epi16( b, r ));
+        _mm_storeu_si128( (__m128i *)(dst + 4), _mm_unpackhi_epi16( b, r ));
+    }
+#elif defined(__aarch64__)
+    uint16x8_t mask = vdupq_n_u16( 0x1f );
+
+    for (; len >= 8; len -= 8, src += 8, dst += 8)
+    {
+        uint16x8_t val = vld1q_u16( src );
+        uint16x8_t r = vandq_u16( vshrq_n_u16( val, 10 ), mask );
+        uint16x8_t g = vandq_u16( vshrq_n_u16( val, 5 ), mask );
+        uint16x8_t b = vandq_u16( val, mask );
+        uint16x8x2_t res;
+
+        r = vorrq_u16( vshlq_n_u16( r, 3 ), vshrq_n_u16( r, 2 ));
+        g = vorrq_u16( vshlq_n_u16( g, 3 ), vshrq_n_u16( g, 2 ));
+        b = vorrq_u16( vshlq_n_u16( b, 3 ), vshrq_n_u16( b, 2 ));
+        res = vzipq_u16( vorrq_u16( b, vshlq_n_u16( g, 8 )), r );
+        vst1q_u32( dst, vreinterpretq_u32_u16( res.val[0] ));
+        vst1q_u32( dst + 4, vreinterpretq_u32_u16( res.val[1] ));
+    }
+#endif
+    for (; len > 0; len--)
+    {
+        src_val = *src++;
+        *dst++ = ((src_val << 9) & 0xf80000) | ((src_val << 4) & 0x070000) |
+                 ((src_val << 6) & 0x00f800) | ((src_val << 1) & 0x000700) |
+                 ((src_val << 3) & 0x0000f8) | ((src_val >> 2) & 0x000007);
+    }
+}
+
 static void convert_to_8888(dib_info *dst, const dib_info *src, const RECT *src_rect, BOOL dither)
 {
     DWORD *dst_start = get_pixel_ptr_32(dst, 0, 0), *dst_pixel, src_val;
@@ -2314,16 +2503,8 @@ static void convert_to_8888(dib_info *dst, const dib_info *src, const RECT *src_
         {
             for(y = src_rect->top; y < src_rect->bottom; y++)
             {
-                dst_pixel = dst_start;
-                src_pixel = src_start;
-                for(x = src_rect->left; x < src_rect->right; x++)
-                {
-                    src_val = *src_pixel++;
-                    *dst_pixel++ = ((src_val << 9) & 0xf80000) | ((src_val << 4) & 0x070000) |
-                                   ((src_val << 6) & 0x00f800) | ((src_val << 1) & 0x000700) |
-                                   ((src_val << 3) & 0x0000f8) | ((src_val >> 2) & 0x000007);
-                }
-                if(pad_size) memset(dst_pixel, 0, pad_size);
+                convert_line_555_to_8888( dst_start, src_start, src_rect->right - src_rect->left );
+                if(pad_size) memset(dst_start + (src_rect->right - src_rect->left), 0, pad_size);
                 dst_start += dst->stride / 4;
                 src_start += src->stride / 2;
             }
@@ -4664,6 +4845,153 @@ static inline DWORD blend_argb_alpha( DWORD dst, DWORD src, DWORD alpha )
             (alpha + ((BYTE)(dst >> 24) * (255 - alpha) + 127) / 255) << 24);
 }
 
+#ifdef __SSE2__
+
+/* (val + 127) / 255 for val <= 255 * 255, computed on 16-bit lanes */
+static inline __m128i div255_epu16( __m128i val )
+{
+    val = _mm_add_epi16( val, _mm_set1_epi16( 128 ));
+    return _mm_srli_epi16( _mm_add_epi16( val, _mm_srli_epi16( val, 8 )), 8 );
+}
+
+static inline __m128i broadcast_alpha_epu16( __m128i val )
+{
+    return _mm_shufflehi_epi16( _mm_shufflelo_epi16( val, 0xff ), 0xff );
+}
+
+/* returns FALSE if a channel overflowed, in which case the scalar code has to handle the pixels */
+static inline BOOL blend_argb_sse2( DWORD *dst, const DWORD *src, DWORD alpha )
+{
+    __m128i zero = _mm_setzero_si128(), max = _mm_set1_epi16( 255 );
+    __m128i s = _mm_loadu_si128( (const __m128i *)src ), d = _mm_loadu_si128( (__m128i *)dst );
+    __m128i s_lo = _mm_unpacklo_epi8( s, zero ), s_hi = _mm_unpackhi_epi8( s, zero );
+    __m128i d_lo = _mm_unpacklo_epi8( d, zero ), d_hi = _mm_unpackhi_epi8( d, zero );
+
+    if (alpha != 255)
+    {
+        __m128i a = _mm_set1_epi16( alpha );
+        s_lo = div255_epu16( _mm_mullo_epi16( s_lo, a ));
+        s_hi = div255_epu16( _mm_mullo_epi16( s_hi, a ));
+    }
+    d_lo = div255_epu16( _mm_mullo_epi16( d_lo, _mm_sub_epi16( max, broadcast_alpha_epu16( s_lo ))));
+    d_hi = div255_epu16( _mm_mullo_epi16( d_hi, _mm_sub_epi16( max, broadcast_alpha_epu16( s_hi ))));
+    d_lo = _mm_add_epi16( d_lo, s_lo );
+    d_hi = _mm_add_epi16( d_hi, s_hi );
+    if (_mm_movemask_epi8( _mm_or_si128( _mm_cmpgt_epi16( d_lo, max ), _mm_cmpgt_epi16( d_hi, max ))))
+        return FALSE;
+    _mm_storeu_si128( (__m128i *)dst, _mm_packus_epi16( d_lo, d_hi ));
+    return TRUE;
+}
+
+static inline void blend_argb_constant_alpha_sse2( DWORD *dst, const DWORD *src, DWORD alpha, DWORD src_or )
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i a = _mm_set1_epi16( alpha ), inv_a = _mm_set1_epi16( 255 - alpha );
+    __m128i s = _mm_or_si128( _mm_loadu_si128( (const __m128i *)src ), _mm_set1_epi32( src_or ));
+    __m128i d = _mm_loadu_si128( (__m128i *)dst );
+    __m128i lo = _mm_add_epi16( _mm_mullo_epi16( _mm_unpacklo_epi8( s, zero ), a ),
+                                _mm_mullo_epi16( _mm_unpacklo_epi8( d, zero ), inv_a ));
+    __m128i hi = _mm_add_epi16( _mm_mullo_epi16( _mm_unpackhi_epi8( s, zero ), a ),
+                                _mm_mullo_epi16( _mm_unpackhi_epi8( d, zero ), inv_a ));
+
+    _mm_storeu_si128( (__m128i *)dst, _mm_packus_epi16( div255_epu16( lo ), div255_epu16( hi )));
+}
+
+#elif defined(__aarch64__)
+
+/* (val + 127) / 255 for val <= 255 * 255, narrowed to 8 bits */
+static inline uint8x8_t div255_u16( uint16x8_t val )
+{
+    val = vaddq_u16( val, vdupq_n_u16( 128 ));
+    return vmovn_u16( vshrq_n_u16( vaddq_u16( val, vshrq_n_u16( val, 8 )), 8 ));
+}
+
+static inline uint8x16_t div255_u16x2( uint16x8_t lo, uint16x8_t hi )
+{
+    return vcombine_u8( div255_u16( lo ), div255_u16( hi ));
+}
+
+static inline uint8x16_t mul_div255_u8( uint8x16_t a, uint8x16_t b )
+{
+    return div255_u16x2( vmull_u8( vget_low_u8( a ), vget_low_u8( b )),
+                         vmull_u8( vget_high_u8( a ), vget_high_u8( b )));
+}
+
+/* returns FALSE if a channel overflowed, in which case the scalar code has to handle the pixels */
+static inline BOOL blend_argb_neon( DWORD *dst, const DWORD *src, DWORD alpha )
+{
+    uint8x16x4_t s = vld4q_u8( (const BYTE *)src ), d = vld4q_u8( (const BYTE *)dst );
+    uint8x16_t overflow = vdupq_n_u8( 0 ), inv_a;
+    int i;
+
+    if (alpha != 255)
+        for (i = 0; i < 4; i++) s.val[i] = mul_div255_u8( s.val[i], vdupq_n_u8( alpha ));
+    inv_a = vmvnq_u8( s.val[3] );
+    for (i = 0; i < 4; i++)
+    {
+        uint8x16_t val = mul_div255_u8( d.val[i], inv_a );
+        d.val[i] = vaddq_u8( val, s.val[i] );
+        overflow = vorrq_u8( overflow, vcltq_u8( d.val[i], val ));
+    }
+    if (vmaxvq_u8( overflow )) return FALSE;
+    vst4q_u8( (BYTE *)dst, d );
+    return TRUE;
+}
+
+static inline void blend_argb_constant_alpha_neon( DWORD *dst, const DWORD *src, DWORD alpha, DWORD src_or )
+{
+    uint8x16x4_t s = vld4q_u8( (const BYTE *)src ), d = vld4q_u8( (const BYTE *)dst );
+    uint8x8_t a = vdup_n_u8( alpha ), inv_a = vdup_n_u8( 255 - alpha );
+    int i;
+
+    if (src_or) s.val[3] = vdupq_n_u8( 0xff );
+    for (i = 0; i < 4; i++)
+    {
+        uint16x8_t lo = vmlal_u8( vmull_u8( vget_low_u8( s.val[i] ), a ), vget_low_u8( d.val[i] ), inv_a );
+        uint16x8_t hi = vmlal_u8( vmull_u8( vget_high_u8( s.val[i] ), a ), vget_high_u8( d.val[i] ), inv_a );
+        d.val[i] = div255_u16x2( lo, hi );
+    }
+    vst4q_u8( (BYTE *)dst, d );
+}
+
+#endif
+
+static inline void blend_pixels_argb( DWORD *dst, const DWORD *src, DWORD alpha, int len )
+{
+    if (alpha == 255)
+        for (; len > 0; len--, dst++, src++) *dst = blend_argb( *dst, *src );
+    else
+        for (; len > 0; len--, dst++, src++) *dst = blend_argb_alpha( *dst, *src, alpha );
+}
+
+static inline void blend_line_argb( DWORD *dst, const DWORD *src, DWORD alpha, int len )
+{
+#ifdef __SSE2__
+    for (; len >= 4; len -= 4, dst += 4, src += 4)
+        if (!blend_argb_sse2( dst, src, alpha )) blend_pixels_argb( dst, src, alpha, 4 );
+#elif defined(__aarch64__)
+    for (; len >= 16; len -= 16, dst += 16, src += 16)
+        if (!blend_argb_neon( dst, src, alpha )) blend_pixels_argb( dst, src, alpha, 16 );
+#endif
+    blend_pixels_argb( dst, src, alpha, len );
+}
+
+static inline void blend_line_argb_constant_alpha( DWORD *dst, const DWORD *src, DWORD alpha,
+                                                   BOOL src_has_alpha, int len )
+{
+#ifdef __SSE2__
+    for (; len >= 4; len -= 4, dst += 4, src += 4)
+        blend_argb_constant_alpha_sse2( dst, src, alpha, src_has_alpha ? 0 : 0xff000000 );
+#elif defined(__aarch64__)
+    for (; len >= 16; len -= 16, dst += 16, src += 16)
+        blend_argb_constant_alpha_neon( dst, src, alpha, !src_has_alpha );
+#endif
+    if (src_has_alpha)
+        for (; len > 0; len--, dst++, src++) *dst = blend_argb_constant_alpha( *dst, *src, alpha );
+    else
+        for (; len > 0; len--, dst++, src++) *dst = blend_argb_no_src_alpha( *dst, *src, alpha );
+}
+
 static inline DWORD blend_rgb( BYTE dst_r, BYTE dst_g, BYTE dst_b, DWORD src, BLENDFUNCTION blend )
 {
     if (blend.AlphaFormat & AC_SRC_ALPHA)
@@ -4685,7 +5013,7 @@ static inline DWORD blend_rgb( BYTE dst_r, BYTE dst_g, BYTE dst_b, DWORD src, BL
 static void blend_rects_8888(const dib_info *dst, int num, const RECT *rc,
                              const dib_info *src, const POINT *offset, BLENDFUNCTION blend)
 {
-    int i, x, y;
+    int i, y;
 
     for (i = 0; i < num; i++, rc++)
     {
@@ -4693,24 +5021,12 @@ static void blend_rects_8888(const dib_info *dst, int num, const RECT *rc,
         DWORD *dst_ptr = get_pixel_ptr_32( dst, rc->left, rc->top );
 
         if (blend.AlphaFormat & AC_SRC_ALPHA)
-        {
-            if (blend.SourceConstantAlpha == 255)
-                for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                    for (x = 0; x < rc->right - rc->left; x++)
-                        dst_ptr[x] = blend_argb( dst_ptr[x], src_ptr[x] );
-            else
-                for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                    for (x = 0; x < rc->right - rc->left; x++)
-                        dst_ptr[x] = blend_argb_alpha( dst_ptr[x], src_ptr[x], blend.SourceConstantAlpha );
-        }
-        else if (src->compression == BI_RGB)
             for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                for (x = 0; x < rc->right - rc->left; x++)
-                    dst_ptr[x] = blend_argb_constant_alpha( dst_ptr[x], src_ptr[x], blend.SourceConstantAlpha );
+                blend_line_argb( dst_ptr, src_ptr, blend.SourceConstantAlpha, rc->right - rc->left );
         else
             for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                for (x = 0; x < rc->right - rc->left; x++)
-                    dst_ptr[x] = blend_argb_no_src_alpha( dst_ptr[x], src_ptr[x], blend.SourceConstantAlpha );
+                blend_line_argb_constant_alpha( dst_ptr, src_ptr, blend.SourceConstantAlpha,
+                                                src->compression == BI_RGB, rc->right - rc->left );
     }
 }
 
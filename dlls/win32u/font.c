@@ -6767,6 +6767,7 @@ UINT font_init(void)
         load_font_list_from_cache();
     }
 
+    font_funcs->update_font_index();
     reorder_font_list();
     load_gdi_font_subst();
     load_gdi_font_replacements();
@@ -39,6 +39,7 @@
 #include <stdio.h>
 #include <assert.h>
 #include <unistd.h>
+#include <pthread.h>
 
 #ifdef __APPLE__
 #include <CoreText/CoreText.h>
@@ -857,7 +858,13 @@ static WCHAR *decode_opentype_name( struct opentype_name *name )
     }
     else
     {
-        CPTABLEINFO *cptable = get_cptable( name->codepage );
+        static pthread_mutex_t cptable_lock = PTHREAD_MUTEX_INITIALIZER;
+        CPTABLEINFO *cptable;
+
+        /* faces may be parsed from several threads at startup */
+        pthread_mutex_lock( &cptable_lock );
+        cptable = get_cptable( name->codepage );
+        pthread_mutex_unlock( &cptable_lock );
         if (!cptable) return NULL;
         len = win32u_mbtowc( cptable, buffer, ARRAY_SIZE(buffer), name->bytes, name->length );
     }
@@ -885,17 +892,92 @@ struct unix_face
     struct bitmap_font_size size;
 };
 
-static struct unix_face *unix_face_create( const char *unix_name, void *data_ptr, UINT data_size,
-                                           UINT face_index, UINT flags )
+/* results of parsing the OpenType tables of a face, the names point into the font data */
+struct opentype_face
 {
-    static const WCHAR space_w[] = {' ',0};
+    DWORD num_faces;
+    DWORD font_version;
+    FONTSIGNATURE fs;
+    DWORD ntm_flags;
+    UINT weight;
+    struct family_names_data family_names;
+    struct face_name_data style_name;
+    struct face_name_data full_name;
+};
 
+/* this may be called from font prefetch threads and must not write any debug output */
+static BOOL opentype_face_parse( const void *data_ptr, UINT data_size, UINT face_index, struct opentype_face *face )
+{
     const struct ttc_sfnt_v1 *ttc_sfnt_v1;
     const struct tt_name_v0 *tt_name_v0;
+    LANGID primary_langid = system_lcid;
+
+    if (!opentype_get_ttc_sfnt_v1( data_ptr, data_size, face_index, &face->num_faces, &ttc_sfnt_v1 ) ||
+        !opentype_get_tt_name_v0( data_ptr, data_size, ttc_sfnt_v1, &tt_name_v0 ) ||
+        !opentype_get_properties( data_ptr, data_size, ttc_sfnt_v1, &face->font_version,
+                                  &face->fs, &face->ntm_flags, &face->weight ))
+        return FALSE;
+
+    memset( &face->family_names, 0, sizeof(face->family_names) );
+    face->family_names.primary_langid = primary_langid;
+    opentype_enum_family_names( tt_name_v0, search_family_names_callback, &face->family_names );
+
+    memset( &face->style_name, 0, sizeof(face->style_name) );
+    face->style_name.primary_langid = primary_langid;
+    opentype_enum_style_names( tt_name_v0, search_face_name_callback, &face->style_name );
+
+    memset( &face->full_name, 0, sizeof(face->full_name) );
+    face->full_name.primary_langid = primary_langid;
+    opentype_enum_full_names( tt_name_v0, search_face_name_callback, &face->full_name );
+    return TRUE;
+}
+
+static struct unix_face *unix_face_from_opentype( struct opentype_face *face )
+{
+    static const WCHAR space_w[] = {' ',0};
     struct unix_face *This;
+    int length;
+
+    if (!(This = calloc( 1, sizeof(*This) ))) return NULL;
+
+    This->scalable = TRUE;
+    This->num_faces = face->num_faces;
+    This->font_version = face->font_version;
+    This->fs = face->fs;
+    This->ntm_flags = face->ntm_flags;
+    This->weight = face->weight;
+
+    This->family_name = decode_opentype_name( &face->family_names.family_name );
+    This->second_name = decode_opentype_name( &face->family_names.second_name );
+    This->style_name = decode_opentype_name( &face->style_name.face_name );
+    This->full_name = decode_opentype_name( &face->full_name.face_name );
+
+    TRACE( "parsed font names family_name %s, second_name %s, primary_seen %d, english_seen %d, "
+           "full_name %s, style_name %s\n",
+           debugstr_w(This->family_name), debugstr_w(This->second_name),
+           face->family_names.primary_seen, face->family_names.english_seen,
+           debugstr_w(This->full_name), debugstr_w(This->style_name) );
+
+    if (!This->full_name && This->family_name && This->style_name)
+    {
+        length = lstrlenW( This->family_name ) + lstrlenW( space_w ) + lstrlenW( This->style_name ) + 1;
+        This->full_name = malloc( length * sizeof(WCHAR) );
+        lstrcpyW( This->full_name, This->family_name );
+        lstrcatW( This->full_name, space_w );
+        lstrcatW( This->full_name, This->style_name );
+        WARN( "full name not found, using %s instead\n", debugstr_w(This->full_name) );
+    }
+
+    return This;
+}
+
+static struct unix_face *unix_face_create( const char *unix_name, void *data_ptr, UINT data_size,
+                                           UINT face_index, UINT flags )
+{
+    struct opentype_face opentype_face;
+    struct unix_face *This = NULL;
     struct stat st;
-    DWORD face_count;
-    int fd, length;
+    int fd;
 
     TRACE( "unix_name %s, face_index %u, data_ptr %p, data_size %u, flags %#x\n",
            unix_name, face_index, data_ptr, data_size, flags );
@@ -914,54 +996,10 @@ static struct unix_face *unix_face_create( const char *unix_name, void *data_ptr
         if (data_ptr == MAP_FAILED) return NULL;
     }
 
-    if (!(This = calloc( 1, sizeof(*This) ))) goto done;
-
-    if (opentype_get_ttc_sfnt_v1( data_ptr, data_size, face_index, &face_count, &ttc_sfnt_v1 ) &&
-        opentype_get_tt_name_v0( data_ptr, data_size, ttc_sfnt_v1, &tt_name_v0 ) &&
-        opentype_get_properties( data_ptr, data_size, ttc_sfnt_v1, &This->font_version,
-                                 &This->fs, &This->ntm_flags, &This->weight ))
-    {
-        struct family_names_data family_names;
-        struct face_name_data style_name;
-        struct face_name_data full_name;
-        LANGID primary_langid = system_lcid;
-
-        This->scalable = TRUE;
-        This->num_faces = face_count;
-
-        memset( &family_names, 0, sizeof(family_names) );
-        family_names.primary_langid = primary_langid;
-        opentype_enum_family_names( tt_name_v0, search_family_names_callback, &family_names );
-        This->family_name = decode_opentype_name( &family_names.family_name );
-        This->second_name = decode_opentype_name( &family_names.second_name );
-
-        memset( &style_name, 0, sizeof(style_name) );
-        style_name.primary_langid = primary_langid;
-        opentype_enum_style_names( tt_name_v0, search_face_name_callback, &style_name );
-        This->style_name = decode_opentype_name( &style_name.face_name );
-
-        memset( &full_name, 0, sizeof(full_name) );
-        full_name.primary_langid = primary_langid;
-        opentype_enum_full_names( tt_name_v0, search_face_name_callback, &full_name );
-        This->full_name = decode_opentype_name( &full_name.face_name );
-
-        TRACE( "parsed font names family_name %s, second_name %s, primary_seen %d, english_seen %d, "
-               "full_name %s, style_name %s\n",
-               debugstr_w(This->family_name), debugstr_w(This->second_name),
-               family_names.primary_seen, family_names.english_seen,
-               debugstr_w(This->full_name), debugstr_w(This->style_name) );
-
-        if (!This->full_name && This->family_name && This->style_name)
-        {
-            length = lstrlenW( This->family_name ) + lstrlenW( space_w ) + lstrlenW( This->style_name ) + 1;
-            This->full_name = malloc( length * sizeof(WCHAR) );
-            lstrcpyW( This->full_name, This->family_name );
-            lstrcatW( This->full_name, space_w );
-            lstrcatW( This->full_name, This->style_name );
-            WARN( "full name not found, using %s instead\n", debugstr_w(This->full_name) );
-        }
-    }
-    else if ((This->ft_face = new_ft_face( unix_name, data_ptr, data_size, face_index, flags & ADDFONT_ALLOW_BITMAP )))
+    if (opentype_face_parse( data_ptr, data_size, face_index, &opentype_face ))
+        This = unix_face_from_opentype( &opentype_face );
+    else if ((This = calloc( 1, sizeof(*This) )) &&
+             (This->ft_face = new_ft_face( unix_name, data_ptr, data_size, face_index, flags & ADDFONT_ALLOW_BITMAP )))
     {
         TT_OS2 *os2;
 
@@ -1001,7 +1039,6 @@ static struct unix_face *unix_face_create( const char *unix_name, void *data_ptr
         This = NULL;
     }
 
-done:
     if (unix_name) munmap( data_ptr, data_size );
     return This;
 }
@@ -1016,21 +1053,620 @@ static void unix_face_destroy( struct unix_face *This )
     free( This );
 }
 
+/* The results of parsing font files are kept in an index file in the prefix, so that
+ * later processes don't need to map and parse every system font again at startup.
+ * Entries are sorted by file name and face index, and are only used as long as the
+ * size and modification time of the font file match. The whole index is rebuilt
+ * when it was written by a different Wine build. */
+
+#define FONT_INDEX_MAGIC    0x58444946 /* "FIDX" */
+#define FONT_INDEX_VERSION  2
+
+struct font_index_header
+{
+    UINT magic;
+    UINT version;
+    UINT entry_size;
+    UINT lcid;
+    UINT count;
+    UINT build_id;     /* hash of the Wine version and build strings */
+};
+
+struct font_index_entry
+{
+    UINT64 file_size;
+    INT64  mtime;
+    UINT   name;         /* offset of the unix file name */
+    UINT   face_index;
+    UINT   num_faces;    /* 0 if the face couldn't be parsed */
+    UINT   scalable;
+    UINT   ntm_flags;
+    UINT   weight;
+    UINT   font_version;
+    UINT   family_name;  /* offsets of the face names, 0 if missing */
+    UINT   second_name;
+    UINT   style_name;
+    UINT   full_name;
+    FONTSIGNATURE fs;
+    struct bitmap_font_size size;
+    UINT   padding;
+};
+
+enum font_index_state
+{
+    FONT_INDEX_UNUSED,
+    FONT_INDEX_VALID,
+    FONT_INDEX_STALE,
+};
+
+struct font_index_item
+{
+    struct list      entry;
+    char            *unix_name;
+    UINT             face_index;
+    UINT64           file_size;
+    INT64            mtime;
+    struct unix_face face;
+};
+
+static BOOL font_index_active;
+static char *font_index_path;
+static const struct font_index_header *font_index;
+static SIZE_T font_index_size;
+static BYTE *font_index_states;
+static BOOL font_index_dirty;
+static struct list font_index_new_items = LIST_INIT( font_index_new_items );
+static UINT font_index_hits, font_index_misses;
+
+static inline const struct font_index_entry *get_font_index_entries(void)
+{
+    return (const struct font_index_entry *)(font_index + 1);
+}
+
+static inline void *get_font_index_data( UINT offset )
+{
+    return offset ? (char *)font_index + offset : NULL;
+}
+
+static UINT get_font_index_build_id(void)
+{
+    static UINT build_id;
+    char buffer[256];
+    ULONG i, len = 0;
+    UINT hash;
+
+    if (build_id) return build_id;
+
+    /* the version, build, system name and release strings, only keep the first two */
+    memset( buffer, 0, sizeof(buffer) );
+    NtQuerySystemInformation( SystemWineVersionInformation, buffer, sizeof(buffer) - 1, NULL );
+    len = strlen( buffer ) + 1;
+    if (len < sizeof(buffer)) len += strlen( buffer + len );
+
+    hash = 0x811c9dc5;
+    for (i = 0; i < len; i++) hash = (hash ^ (BYTE)buffer[i]) * 0x01000193;
+    return build_id = hash ? hash : 1;
+}
+
+static BOOL is_valid_font_index_entry( const struct font_index_entry *entry )
+{
+    if (!entry->name || entry->name >= font_index_size) return FALSE;
+    if (entry->family_name >= font_index_size || (entry->family_name & 1)) return FALSE;
+    if (entry->second_name >= font_index_size || (entry->second_name & 1)) return FALSE;
+    if (entry->style_name >= font_index_size || (entry->style_name & 1)) return FALSE;
+    if (entry->full_name >= font_index_size || (entry->full_name & 1)) return FALSE;
+    return TRUE;
+}
+
+static void open_font_index(void)
+{
+    const char *prefix = getenv( "WINEPREFIX" );
+    const struct font_index_header *header;
+    const WCHAR *end;
+    void *ptr = MAP_FAILED;
+    struct stat st;
+    UINT i;
+    int fd;
+
+    if (prefix) asprintf( &font_index_path, "%s/.font-index", prefix );
+    else asprintf( &font_index_path, "%s/.wine/.font-index", getenv( "HOME" ) );
+    if (!font_index_path) return;
+    font_index_active = TRUE;
+
+    if ((fd = open( font_index_path, O_RDONLY )) == -1)
+    {
+        font_index_dirty = TRUE;
+        return;
+    }
+    if (!fstat( fd, &st ) && st.st_size >= sizeof(*header) + sizeof(WCHAR) && st.st_size < 0x7fffffff)
+        ptr = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if (ptr == MAP_FAILED)
+    {
+        font_index_dirty = TRUE;
+        return;
+    }
+
+    font_index = header = ptr;
+    font_index_size = st.st_size;
+    end = (const WCHAR *)((const char *)ptr + font_index_size) - 1;
+
+    if (header->magic != FONT_INDEX_MAGIC || header->version != FONT_INDEX_VERSION ||
+        header->entry_size != sizeof(struct font_index_entry) || header->lcid != system_lcid ||
+        header->build_id != get_font_index_build_id() ||
+        header->count > (font_index_size - sizeof(*header)) / sizeof(struct font_index_entry) || *end)
+        goto invalid;
+    for (i = 0; i < header->count; i++)
+        if (!is_valid_font_index_entry( get_font_index_entries() + i )) goto invalid;
+
+    if (!(font_index_states = calloc( header->count, 1 ))) goto invalid;
+    TRACE( "using %u entries from %s\n", header->count, debugstr_a(font_index_path) );
+    return;
+
+invalid:
+    WARN( "ignoring invalid font index %s\n", debugstr_a(font_index_path) );
+    munmap( ptr, font_index_size );
+    font_index = NULL;
+    font_index_size = 0;
+    font_index_dirty = TRUE;
+}
+
+static int compare_font_index_key( const char *name1, UINT index1, const char *name2, UINT index2 )
+{
+    int ret = strcmp( name1, name2 );
+    if (ret) return ret;
+    return index1 < index2 ? -1 : index1 > index2;
+}
+
+static const struct font_index_entry *find_font_index_entry( const char *unix_name, UINT face_index )
+{
+    const struct font_index_entry *entry, *entries = get_font_index_entries();
+    int min = 0, max, pos, res;
+
+    if (!font_index) return NULL;
+
+    max = font_index->count - 1;
+    while (min <= max)
+    {
+        pos = (min + max) / 2;
+        entry = entries + pos;
+        res = compare_font_index_key( unix_name, face_index, get_font_index_data( entry->name ), entry->face_index );
+        if (res < 0) max = pos - 1;
+        else if (res > 0) min = pos + 1;
+        else return entry;
+    }
+    return NULL;
+}
+
+static BOOL font_index_lookup( const char *unix_name, UINT face_index, const struct stat *st,
+                               struct unix_face *face )
+{
+    const struct font_index_entry *entry;
+    UINT pos;
+
+    if ((entry = find_font_index_entry( unix_name, face_index )))
+    {
+        pos = entry - get_font_index_entries();
+        if (entry->file_size != st->st_size || entry->mtime != st->st_mtime)
+        {
+            TRACE( "%s has changed\n", debugstr_a(unix_name) );
+            font_index_states[pos] = FONT_INDEX_STALE;
+            font_index_dirty = TRUE;
+        }
+        else
+        {
+            font_index_states[pos] = FONT_INDEX_VALID;
+
+            memset( face, 0, sizeof(*face) );
+            face->scalable = entry->scalable;
+            face->num_faces = entry->num_faces;
+            face->family_name = get_font_index_data( entry->family_name );
+            face->second_name = get_font_index_data( entry->second_name );
+            face->style_name = get_font_index_data( entry->style_name );
+            face->full_name = get_font_index_data( entry->full_name );
+            face->ntm_flags = entry->ntm_flags;
+            face->weight = entry->weight;
+            face->font_version = entry->font_version;
+            face->fs = entry->fs;
+            face->size = entry->size;
+            font_index_hits++;
+            return TRUE;
+        }
+    }
+
+    font_index_misses++;
+    return FALSE;
+}
+
+static void font_index_add( const char *unix_name, UINT face_index, const struct stat *st,
+                            const struct unix_face *face )
+{
+    struct font_index_item *item;
+
+    if (!(item = calloc( 1, sizeof(*item) ))) return;
+    if (!(item->unix_name = strdup( unix_name )))
+    {
+        free( item );
+        return;
+    }
+    item->face_index = face_index;
+    item->file_size = st->st_size;
+    item->mtime = st->st_mtime;
+    if (face)
+    {
+        item->face = *face;
+        item->face.ft_face = NULL;
+        if (face->family_name) item->face.family_name = wcsdup( face->family_name );
+        if (face->second_name) item->face.second_name = wcsdup( face->second_name );
+        if (face->style_name) item->face.style_name = wcsdup( face->style_name );
+        if (face->full_name) item->face.full_name = wcsdup( face->full_name );
+    }
+    list_add_tail( &font_index_new_items, &item->entry );
+    font_index_dirty = TRUE;
+}
+
+static int __cdecl compare_font_index_items( const void *p1, const void *p2 )
+{
+    const struct font_index_item *item1 = *(const struct font_index_item **)p1;
+    const struct font_index_item *item2 = *(const struct font_index_item **)p2;
+    return compare_font_index_key( item1->unix_name, item1->face_index, item2->unix_name, item2->face_index );
+}
+
+static UINT put_font_index_data( char *buffer, UINT *pos, const void *data, UINT size )
+{
+    UINT offset = *pos;
+
+    if (!data) return 0;
+    if (buffer) memcpy( buffer + offset, data, size );
+    *pos += (size + 1) & ~1;
+    return offset;
+}
+
+static UINT put_font_index_string( char *buffer, UINT *pos, const WCHAR *str )
+{
+    return put_font_index_data( buffer, pos, str, str ? (lstrlenW( str ) + 1) * sizeof(WCHAR) : 0 );
+}
+
+/* fill the index buffer, or just compute its size if buffer is NULL */
+static UINT build_font_index( char *buffer, struct font_index_item **items, UINT count )
+{
+    struct font_index_header *header = (struct font_index_header *)buffer;
+    struct font_index_entry *entry = (struct font_index_entry *)(header + 1);
+    UINT i, pos = sizeof(*header) + count * sizeof(*entry);
+
+    for (i = 0; i < count; i++, entry++)
+    {
+        struct font_index_item *item = items[i];
+        struct font_index_entry data;
+
+        data.file_size = item->file_size;
+        data.mtime = item->mtime;
+        data.name = put_font_index_data( buffer, &pos, item->unix_name, strlen( item->unix_name ) + 1 );
+        data.face_index = item->face_index;
+        data.num_faces = item->face.num_faces;
+        data.scalable = item->face.scalable;
+        data.ntm_flags = item->face.ntm_flags;
+        data.weight = item->face.weight;
+        data.font_version = item->face.font_version;
+        data.family_name = put_font_index_string( buffer, &pos, item->face.family_name );
+        data.second_name = put_font_index_string( buffer, &pos, item->face.second_name );
+        data.style_name = put_font_index_string( buffer, &pos, item->face.style_name );
+        data.full_name = put_font_index_string( buffer, &pos, item->face.full_name );
+        data.fs = item->face.fs;
+        data.size = item->face.size;
+        data.padding = 0;
+        if (buffer) *entry = data;
+    }
+    pos += sizeof(WCHAR);  /* terminator */
+
+    if (buffer)
+    {
+        header->magic = FONT_INDEX_MAGIC;
+        header->version = FONT_INDEX_VERSION;
+        header->entry_size = sizeof(*entry);
+        header->lcid = system_lcid;
+        header->count = count;
+        header->build_id = get_font_index_build_id();
+    }
+    return pos;
+}
+
+static void write_font_index(void)
+{
+    const struct font_index_entry *entry;
+    struct font_index_item **items, *old_items = NULL, *item;
+    UINT i, count = 0, old_count = 0, size;
+    char *buffer, *tmp_path;
+    struct stat st;
+    ssize_t ret;
+    int fd;
+
+    if (font_index) old_count = font_index->count;
+    if (!(items = malloc( (old_count + list_count( &font_index_new_items )) * sizeof(*items) ))) return;
+    if (old_count && !(old_items = calloc( old_count, sizeof(*old_items) )))
+    {
+        free( items );
+        return;
+    }
+
+    /* keep the entries of the old index that are still valid, even if this process didn't use them */
+    for (i = 0, entry = get_font_index_entries(); i < old_count; i++, entry++)
+    {
+        item = old_items + i;
+        item->unix_name = get_font_index_data( entry->name );
+        if (font_index_states[i] == FONT_INDEX_STALE) continue;
+        if (font_index_states[i] == FONT_INDEX_UNUSED &&
+            (stat( item->unix_name, &st ) || entry->file_size != st.st_size || entry->mtime != st.st_mtime))
+            continue;
+
+        item->face_index = entry->face_index;
+        item->file_size = entry->file_size;
+        item->mtime = entry->mtime;
+        item->face.num_faces = entry->num_faces;
+        item->face.scalable = entry->scalable;
+        item->face.family_name = get_font_index_data( entry->family_name );
+        item->face.second_name = get_font_index_data( entry->second_name );
+        item->face.style_name = get_font_index_data( entry->style_name );
+        item->face.full_name = get_font_index_data( entry->full_name );
+        item->face.ntm_flags = entry->ntm_flags;
+        item->face.weight = entry->weight;
+        item->face.font_version = entry->font_version;
+        item->face.fs = entry->fs;
+        item->face.size = entry->size;
+        items[count++] = item;
+    }
+    LIST_FOR_EACH_ENTRY( item, &font_index_new_items, struct font_index_item, entry )
+        items[count++] = item;
+
+    qsort( items, count, sizeof(*items), compare_font_index_items );
+    for (i = size = 0; i < count; i++)
+    {
+        if (size && !compare_font_index_items( &items[size - 1], &items[i] )) continue;
+        items[size++] = items[i];
+    }
+    count = size;
+
+    size = build_font_index( NULL, items, count );
+    if ((buffer = calloc( 1, size )))
+    {
+        build_font_index( buffer, items, count );
+
+        /* write to a temporary file first, so that other processes never see a partial index */
+        if (asprintf( &tmp_path, "%s.%u", font_index_path, (unsigned int)getpid() ) != -1)
+        {
+            if ((fd = open( tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0666 )) != -1)
+            {
+                for (i = 0; i < size; i += ret)
+                    if ((ret = write( fd, buffer + i, size - i )) <= 0) break;
+                close( fd );
+                if (i < size || rename( tmp_path, font_index_path ))
+                {
+                    WARN( "failed to write font index %s\n", debugstr_a(font_index_path) );
+                    unlink( tmp_path );
+                }
+                else TRACE( "wrote %u entries to %s\n", count, debugstr_a(font_index_path) );
+            }
+            free( tmp_path );
+        }
+        free( buffer );
+    }
+
+    free( old_items );
+    free( items );
+}
+
+/*************************************************************
+ * freetype_update_font_index
+ *
+ * Called once all the startup fonts have been loaded.
+ */
+static void freetype_update_font_index(void)
+{
+    struct font_index_item *item, *next;
+
+    if (!font_index_active) return;
+    font_index_active = FALSE;
+
+    TRACE( "%u faces found in font index, %u parsed\n", font_index_hits, font_index_misses );
+    if (font_index_dirty) write_font_index();
+    font_index_dirty = FALSE;
+
+    LIST_FOR_EACH_ENTRY_SAFE( item, next, &font_index_new_items, struct font_index_item, entry )
+    {
+        list_remove( &item->entry );
+        free( item->face.full_name );
+        free( item->face.style_name );
+        free( item->face.second_name );
+        free( item->face.family_name );
+        free( item->unix_name );
+        free( item );
+    }
+    if (font_index) munmap( (void *)font_index, font_index_size );
+    font_index = NULL;
+    font_index_size = 0;
+    free( font_index_states );
+    font_index_states = NULL;
+    free( font_index_path );
+    font_index_path = NULL;
+}
+
+/* When many fonts need to be parsed at startup, typically on the first run in a new
+ * prefix, the faces are parsed ahead of time by a few threads. The parsed faces are
+ * then picked up by add_unix_face() in the usual order, so the resulting font list
+ * doesn't depend on which thread finished first. The prefetch threads are not Wine
+ * threads, so they only parse the OpenType tables, without writing any debug output
+ * or calling into ntdll. Names are decoded when the face is picked up, and faces that
+ * would have needed a message or the FreeType fallback are parsed again from there. */
+
+#define MAX_PREFETCH_THREADS  8
+#define MIN_PREFETCH_FACES    16
+
+struct face_prefetch
+{
+    char                *unix_name;
+    UINT                 face_index;
+    void                *data;  /* mapped font file, NULL if the face wasn't parsed */
+    UINT                 size;
+    struct opentype_face face;
+};
+
+struct face_prefetch_job
+{
+    struct face_prefetch *prefetches;
+    UINT                  count;
+    LONG                  next;
+};
+
+static struct face_prefetch *face_prefetches;
+static UINT face_prefetch_count;
+
+static void prefetch_face( struct face_prefetch *prefetch )
+{
+    BOOL suppressed = FALSE;
+    struct stat st;
+    void *data;
+    int fd;
+
+    if ((fd = open( prefetch->unix_name, O_RDONLY )) == -1) return;
+    if (fstat( fd, &st ) == -1)
+    {
+        close( fd );
+        return;
+    }
+    data = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if (data == MAP_FAILED) return;
+
+    opentype_suppress_messages( &suppressed );
+    if (opentype_face_parse( data, st.st_size, prefetch->face_index, &prefetch->face ) && !suppressed)
+    {
+        prefetch->data = data;
+        prefetch->size = st.st_size;
+        return;
+    }
+    munmap( data, st.st_size );
+}
+
+static void *prefetch_thread( void *arg )
+{
+    struct face_prefetch_job *job = arg;
+    UINT i;
+
+    while ((i = InterlockedIncrement( &job->next ) - 1) < job->count)
+        prefetch_face( job->prefetches + i );
+    opentype_suppress_messages( NULL );
+    return NULL;
+}
+
+static int __cdecl compare_face_prefetches( const void *p1, const void *p2 )
+{
+    const struct face_prefetch *prefetch1 = p1, *prefetch2 = p2;
+    return compare_font_index_key( prefetch1->unix_name, prefetch1->face_index,
+                                   prefetch2->unix_name, prefetch2->face_index );
+}
+
+/* parse the given faces in parallel, takes ownership of the array */
+static void prefetch_unix_faces( struct face_prefetch *prefetches, UINT count )
+{
+    pthread_t threads[MAX_PREFETCH_THREADS - 1];
+    struct face_prefetch_job job;
+    UINT i, thread_count = 0;
+    long cpus;
+
+    if ((cpus = sysconf( _SC_NPROCESSORS_ONLN )) > 1 && count >= MIN_PREFETCH_FACES)
+    {
+        job.prefetches = prefetches;
+        job.count = count;
+        job.next = 0;
+
+        cpus = min( cpus, MAX_PREFETCH_THREADS );
+        while (thread_count < cpus - 1 && !pthread_create( &threads[thread_count], NULL, prefetch_thread, &job ))
+            thread_count++;
+    }
+
+    if (!thread_count)
+    {
+        for (i = 0; i < count; i++) free( prefetches[i].unix_name );
+        free( prefetches );
+        return;
+    }
+
+    TRACE( "parsing %u faces with %u threads\n", count, thread_count + 1 );
+    prefetch_thread( &job );
+    for (i = 0; i < thread_count; i++) pthread_join( threads[i], NULL );
+
+    qsort( prefetches, count, sizeof(*prefetches), compare_face_prefetches );
+    face_prefetches = prefetches;
+    face_prefetch_count = count;
+}
+
+static struct unix_face *get_prefetched_face( const char *unix_name, UINT face_index )
+{
+    struct face_prefetch key, *prefetch;
+    struct unix_face *face;
+
+    if (!face_prefetch_count) return NULL;
+
+    key.unix_name = (char *)unix_name;
+    key.face_index = face_index;
+    if (!(prefetch = bsearch( &key, face_prefetches, face_prefetch_count, sizeof(*prefetch),
+                              compare_face_prefetches )))
+        return NULL;
+
+    if (!prefetch->data) return NULL;
+
+    TRACE( "using prefetched face %s, face_index %u\n", unix_name, face_index );
+    face = unix_face_from_opentype( &prefetch->face );
+    munmap( prefetch->data, prefetch->size );
+    prefetch->data = NULL;
+    return face;
+}
+
+static void free_prefetched_faces(void)
+{
+    UINT i;
+
+    for (i = 0; i < face_prefetch_count; i++)
+    {
+        if (face_prefetches[i].data) munmap( face_prefetches[i].data, face_prefetches[i].size );
+        free( face_prefetches[i].unix_name );
+    }
+    free( face_prefetches );
+    face_prefetches = NULL;
+    face_prefetch_count = 0;
+}
+
 static int add_unix_face( const char *unix_name, const WCHAR *file, void *data_ptr, SIZE_T data_size,
                           DWORD face_index, DWORD flags, DWORD *num_faces )
 {
-    struct unix_face *unix_face;
+    struct unix_face *unix_face, indexed_face;
+    BOOL use_index;
+    struct stat st;
     int ret;
 
     if (num_faces) *num_faces = 0;
 
-    if (!(unix_face = unix_face_create( unix_name, data_ptr, data_size, face_index, flags )))
-        return 0;
+    use_index = unix_name && font_index_active && !stat( unix_name, &st );
+    if (use_index && font_index_lookup( unix_name, face_index, &st, &indexed_face ))
+    {
+        if (!indexed_face.num_faces) return 0;
+        if (!indexed_face.scalable && !(flags & ADDFONT_ALLOW_BITMAP)) return 0;
+        unix_face = &indexed_face;
+    }
+    else
+    {
+        if (!unix_name || !(unix_face = get_prefetched_face( unix_name, face_index )))
+            unix_face = unix_face_create( unix_name, data_ptr, data_size, face_index, flags );
+        /* bitmap fonts fail to load without ADDFONT_ALLOW_BITMAP, don't remember that */
+        if (use_index && (unix_face || (flags & ADDFONT_ALLOW_BITMAP)))
+            font_index_add( unix_name, face_index, &st, unix_face );
+        if (!unix_face) return 0;
+    }
 
     if (unix_face->family_name[0] == '.') /* Ignore fonts with names beginning with a dot */
     {
         TRACE("Ignoring %s since its family name begins with a dot\n", debugstr_a(unix_name));
-        unix_face_destroy( unix_face );
+        if (unix_face != &indexed_face) unix_face_destroy( unix_face );
         return 0;
     }
 
@@ -1046,7 +1682,7 @@ static int add_unix_face( const char *unix_name, const WCHAR *file, void *data_p
           unix_face->fs.fsUsb[2], unix_face->fs.fsUsb[3]);
 
     if (num_faces) *num_faces = unix_face->num_faces;
-    unix_face_destroy( unix_face );
+    if (unix_face != &indexed_face) unix_face_destroy( unix_face );
     return ret;
 }
 
@@ -1188,18 +1824,13 @@ static FcPattern *create_family_pattern( const char *name, FcPattern **cached )
     return ret;
 }
 
-static void fontconfig_add_font( FcPattern *pattern, UINT flags )
+static const char *fontconfig_get_font_file( FcPattern *pattern, UINT flags, int *face_index )
 {
     const char *unix_name, *format;
-    WCHAR *dos_name;
     FcBool scalable;
-    DWORD aa_flags;
-    int face_index;
-
-    TRACE( "(%p %#x)\n", pattern, flags );
 
     if (pFcPatternGetString( pattern, FC_FILE, 0, (FcChar8 **)&unix_name ) != FcResultMatch)
-        return;
+        return NULL;
 
     if (pFcPatternGetBool( pattern, FC_SCALABLE, 0, &scalable ) != FcResultMatch)
         scalable = FALSE;
@@ -1207,27 +1838,41 @@ static void fontconfig_add_font( FcPattern *pattern, UINT flags )
     if (pFcPatternGetString( pattern, FC_FONTFORMAT, 0, (FcChar8 **)&format ) != FcResultMatch)
     {
         TRACE( "ignoring unknown font format %s\n", debugstr_a(unix_name) );
-        return;
+        return NULL;
     }
 
     if (!strcmp( format, "Type 1" ))
     {
         TRACE( "ignoring Type 1 font %s\n", debugstr_a(unix_name) );
-        return;
+        return NULL;
     }
 
     if (!scalable && !(flags & ADDFONT_ALLOW_BITMAP))
     {
         TRACE( "ignoring non-scalable font %s\n", debugstr_a(unix_name) );
-        return;
+        return NULL;
     }
 
+    if (pFcPatternGetInteger( pattern, FC_INDEX, 0, face_index ) != FcResultMatch)
+        *face_index = 0;
+
+    return unix_name;
+}
+
+static void fontconfig_add_font( FcPattern *pattern, UINT flags )
+{
+    const char *unix_name;
+    WCHAR *dos_name;
+    DWORD aa_flags;
+    int face_index;
+
+    TRACE( "(%p %#x)\n", pattern, flags );
+
+    if (!(unix_name = fontconfig_get_font_file( pattern, flags, &face_index ))) return;
+
     if (!(aa_flags = parse_aa_pattern( pattern ))) aa_flags = default_aa_flags;
     flags |= ADDFONT_AA_FLAGS(aa_flags);
 
-    if (pFcPatternGetInteger( pattern, FC_INDEX, 0, &face_index ) != FcResultMatch)
-        face_index = 0;
-
     ntdll_get_dos_file_name( unix_name, &dos_name, FILE_OPEN );
     add_unix_face( unix_name, dos_name, NULL, 0, face_index, flags, NULL );
     free( dos_name );
@@ -1292,7 +1937,61 @@ static void init_fontconfig(void)
     }
 }
 
-static void fontconfig_add_fonts_from_dir_list( FcConfig *config, FcStrList *dir_list, FcStrSet *done_set, UINT flags )
+struct fontconfig_font_sets
+{
+    FcFontSet **sets;
+    UINT        count;
+    UINT        size;
+};
+
+static BOOL fontconfig_append_font_set( struct fontconfig_font_sets *sets, FcFontSet *font_set )
+{
+    FcFontSet **new_sets;
+    UINT new_size;
+
+    if (sets->count == sets->size)
+    {
+        new_size = max( 16, sets->size * 2 );
+        if (!(new_sets = realloc( sets->sets, new_size * sizeof(*new_sets) ))) return FALSE;
+        sets->sets = new_sets;
+        sets->size = new_size;
+    }
+    sets->sets[sets->count++] = font_set;
+    return TRUE;
+}
+
+static void fontconfig_prefetch_fonts( struct fontconfig_font_sets *sets, UINT flags )
+{
+    const struct font_index_entry *entry;
+    struct face_prefetch *prefetches;
+    const char *unix_name;
+    UINT i, j, count = 0;
+    struct stat st;
+    int face_index;
+
+    for (i = 0; i < sets->count; i++) count += sets->sets[i]->nfont;
+    if (!count || !(prefetches = malloc( count * sizeof(*prefetches) ))) return;
+
+    for (i = count = 0; i < sets->count; i++)
+    {
+        for (j = 0; j < sets->sets[i]->nfont; j++)
+        {
+            if (!(unix_name = fontconfig_get_font_file( sets->sets[i]->fonts[j], flags, &face_index ))) continue;
+            if ((entry = find_font_index_entry( unix_name, face_index )) && !stat( unix_name, &st ) &&
+                entry->file_size == st.st_size && entry->mtime == st.st_mtime)
+                continue;
+            if (!(prefetches[count].unix_name = strdup( unix_name ))) continue;
+            prefetches[count].face_index = face_index;
+            prefetches[count].data = NULL;
+            count++;
+        }
+    }
+
+    prefetch_unix_faces( prefetches, count );
+}
+
+static void fontconfig_add_fonts_from_dir_list( FcConfig *config, FcStrList *dir_list, FcStrSet *done_set,
+                                                struct fontconfig_font_sets *sets, UINT flags )
 {
     const FcChar8 *dir;
     FcFontSet *font_set = NULL;
@@ -1310,10 +2009,14 @@ static void fontconfig_add_fonts_from_dir_list( FcConfig *config, FcStrList *dir
         TRACE( "adding fonts from %s\n", dir );
         if (!(cache = pFcDirCacheRead( dir, FcFalse, config ))) continue;
 
+        /* the fonts are added by the caller once all the sets are collected */
         if (!(font_set = pFcCacheCopySet( cache ))) goto done;
-        for (i = 0; i < font_set->nfont; i++)
-            fontconfig_add_font( font_set->fonts[i], flags );
-        pFcFontSetDestroy( font_set );
+        if (!fontconfig_append_font_set( sets, font_set ))
+        {
+            for (i = 0; i < font_set->nfont; i++)
+                fontconfig_add_font( font_set->fonts[i], flags );
+            pFcFontSetDestroy( font_set );
+        }
         font_set = NULL;
 
         if (!(subdir_set = pFcStrSetCreate())) goto done;
@@ -1327,7 +2030,7 @@ static void fontconfig_add_fonts_from_dir_list( FcConfig *config, FcStrList *dir
         subdir_set = NULL;
 
         pFcStrSetAdd( done_set, dir );
-        fontconfig_add_fonts_from_dir_list( config, subdir_list, done_set, flags );
+        fontconfig_add_fonts_from_dir_list( config, subdir_list, done_set, sets, flags );
         pFcStrListDone( subdir_list );
         subdir_list = NULL;
     }
@@ -1339,16 +2042,29 @@ done:
 
 static void load_fontconfig_fonts( void )
 {
+    struct fontconfig_font_sets sets = { 0 };
     FcStrList *dir_list = NULL;
     FcStrSet *done_set = NULL;
     FcConfig *config;
+    UINT i;
+    int j;
 
     if (!fontconfig_enabled) return;
     if (!(config = pFcConfigGetCurrent())) goto done;
     if (!(done_set = pFcStrSetCreate())) goto done;
     if (!(dir_list = pFcConfigGetFontDirs( config ))) goto done;
 
-    fontconfig_add_fonts_from_dir_list( config, dir_list, done_set, ADDFONT_EXTERNAL_FONT );
+    fontconfig_add_fonts_from_dir_list( config, dir_list, done_set, &sets, ADDFONT_EXTERNAL_FONT );
+
+    fontconfig_prefetch_fonts( &sets, ADDFONT_EXTERNAL_FONT );
+    for (i = 0; i < sets.count; i++)
+    {
+        for (j = 0; j < sets.sets[i]->nfont; j++)
+            fontconfig_add_font( sets.sets[i]->fonts[j], ADDFONT_EXTERNAL_FONT );
+        pFcFontSetDestroy( sets.sets[i] );
+    }
+    free( sets.sets );
+    free_prefetched_faces();
 
 done:
     if (dir_list) pFcStrListDone( dir_list );
@@ -3881,6 +4597,7 @@ static UINT freetype_get_kerning_pairs( struct gdi_font *font, KERNINGPAIR **pai
 static const struct font_backend_funcs font_funcs =
 {
     freetype_load_fonts,
+    freetype_update_font_index,
     fontconfig_enum_family_fallbacks,
     freetype_add_font,
     freetype_add_mem_font,
@@ -3905,6 +4622,7 @@ const struct font_backend_funcs *init_freetype_lib(void)
     init_fontconfig();
 #endif
     NtQueryDefaultLocale( FALSE, &system_lcid );
+    open_font_index();
     return &font_funcs;
 }
 
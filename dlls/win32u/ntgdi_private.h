@@ -320,6 +320,7 @@ struct gdi_font
 struct font_backend_funcs
 {
     void  (*load_fonts)(void);
+    void  (*update_font_index)(void);
     BOOL  (*enum_family_fallbacks)( UINT pitch_and_family, int index, WCHAR buffer[LF_FACESIZE] );
     INT   (*add_font)( const WCHAR *file, UINT flags );
     INT   (*add_mem_font)( void *ptr, SIZE_T size, UINT flags );
@@ -375,6 +376,7 @@ extern BOOL opentype_enum_full_names( const struct tt_name_v0 *tt_name_v0,
 
 extern BOOL opentype_get_properties( const void *data, size_t size, const struct ttc_sfnt_v1 *ttc_sfnt_v1,
                                      DWORD *version, FONTSIGNATURE *fs, DWORD *ntm_flags, UINT *weight );
+extern void opentype_suppress_messages( BOOL *suppressed );
 
 /* gdiobj.c */
 extern HGDIOBJ alloc_gdi_handle( struct gdi_obj_header *obj, DWORD type,
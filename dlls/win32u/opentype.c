@@ -23,6 +23,7 @@
 
 #include <stdarg.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 #include "windef.h"
 #include "winbase.h"
@@ -34,6 +35,37 @@
 
 WINE_DEFAULT_DEBUG_CHANNEL(font);
 
+/* Faces may be parsed on font prefetch threads, which are not Wine threads and can't
+ * write debug output. Messages are dropped there instead, and the caller is told so
+ * that it can parse the face again on a Wine thread. */
+static pthread_key_t suppressed_key;
+static pthread_once_t suppressed_once = PTHREAD_ONCE_INIT;
+
+static void init_suppressed_key(void)
+{
+    pthread_key_create( &suppressed_key, NULL );
+}
+
+void opentype_suppress_messages( BOOL *suppressed )
+{
+    pthread_once( &suppressed_once, init_suppressed_key );
+    pthread_setspecific( suppressed_key, suppressed );
+}
+
+static BOOL messages_suppressed(void)
+{
+    BOOL *suppressed;
+
+    pthread_once( &suppressed_once, init_suppressed_key );
+    if (!(suppressed = pthread_getspecific( suppressed_key ))) return FALSE;
+    *suppressed = TRUE;
+    return TRUE;
+}
+
+#define OPENTYPE_TRACE(...) do { if (TRACE_ON(font) && !messages_suppressed()) TRACE( __VA_ARGS__ ); } while (0)
+#define OPENTYPE_WARN(...)  do { if (WARN_ON(font) && !messages_suppressed()) WARN( __VA_ARGS__ ); } while (0)
+#define OPENTYPE_FIXME(...) do { if (FIXME_ON(font) && !messages_suppressed()) FIXME( __VA_ARGS__ ); } while (0)
+
 #define MS_OTTO_TAG MS_MAKE_TAG('O','T','T','O')
 #define MS_HEAD_TAG MS_MAKE_TAG('h','e','a','d')
 #define MS_HHEA_TAG MS_MAKE_TAG('h','h','e','a')
@@ -344,7 +376,7 @@ static UINT get_name_record_codepage( enum OPENTYPE_PLATFORM_ID platform, USHORT
         case TT_NAME_MAC_ENCODING_THAI:
             return 10021;
         default:
-            WARN( "default ascii encoding used for encoding %d, platform %d\n", encoding, platform );
+            OPENTYPE_WARN( "default ascii encoding used for encoding %d, platform %d\n", encoding, platform );
             return 20127;
         }
         break;
@@ -366,12 +398,12 @@ static UINT get_name_record_codepage( enum OPENTYPE_PLATFORM_ID platform, USHORT
         case TT_NAME_WIN_ENCODING_JOHAB:
             return 1361;
         default:
-            WARN( "default ascii encoding used for encoding %d, platform %d\n", encoding, platform );
+            OPENTYPE_WARN( "default ascii encoding used for encoding %d, platform %d\n", encoding, platform );
             return 20127;
         }
         break;
     default:
-        FIXME( "unknown platform %d\n", platform );
+        OPENTYPE_FIXME( "unknown platform %d\n", platform );
         break;
     }
 
@@ -541,7 +573,7 @@ static LANGID get_name_record_langid( enum OPENTYPE_PLATFORM_ID platform, USHORT
         return language;
     case OPENTYPE_PLATFORM_MAC:
         if (language < ARRAY_SIZE(mac_langid_table)) return mac_langid_table[language];
-        WARN( "invalid mac lang id %d\n", language );
+        OPENTYPE_WARN( "invalid mac lang id %d\n", language );
         break;
     case OPENTYPE_PLATFORM_UNICODE:
         switch (encoding)
@@ -550,14 +582,14 @@ static LANGID get_name_record_langid( enum OPENTYPE_PLATFORM_ID platform, USHORT
         case TT_NAME_UNICODE_ENCODING_ISO_10646:
         case TT_NAME_UNICODE_ENCODING_2_0_BMP:
             if (language < ARRAY_SIZE(mac_langid_table)) return mac_langid_table[language];
-            WARN( "invalid unicode lang id %d\n", language );
+            OPENTYPE_WARN( "invalid unicode lang id %d\n", language );
             break;
         default:
             break;
         }
         break;
     default:
-        FIXME( "unknown platform %d\n", platform );
+        OPENTYPE_FIXME( "unknown platform %d\n", platform );
         break;
     }
 
@@ -579,7 +611,7 @@ static BOOL opentype_enum_font_names( const struct tt_name_v0 *header, enum OPEN
     case 1:
         break;
     default:
-        FIXME( "unsupported name format %d\n", GET_BE_WORD( header->format ) );
+        OPENTYPE_FIXME( "unsupported name format %d\n", GET_BE_WORD( header->format ) );
         return FALSE;
     }
 
@@ -596,7 +628,7 @@ static BOOL opentype_enum_font_names( const struct tt_name_v0 *header, enum OPEN
         language = GET_BE_WORD( record->languageID );
         if (language >= 0x8000)
         {
-            FIXME( "handle name format 1\n" );
+            OPENTYPE_FIXME( "handle name format 1\n" );
             continue;
         }
 
@@ -630,7 +662,7 @@ BOOL opentype_get_ttc_sfnt_v1( const void *data, size_t size, DWORD index, DWORD
     switch (fourcc)
     {
     default:
-        WARN( "unsupported font format %x\n", fourcc );
+        OPENTYPE_WARN( "unsupported font format %x\n", fourcc );
         return FALSE;
     case MS_TTCF_TAG:
         if (size < sizeof(ttc_header_v1)) return FALSE;
@@ -648,19 +680,19 @@ BOOL opentype_get_ttc_sfnt_v1( const void *data, size_t size, DWORD index, DWORD
 
     if (!opentype_get_table_ptr( data, size, *ttc_sfnt_v1, MS_HEAD_TAG, NULL, NULL ))
     {
-        WARN( "unsupported sfnt font: missing head table.\n" );
+        OPENTYPE_WARN( "unsupported sfnt font: missing head table.\n" );
         return FALSE;
     }
 
     if (!opentype_get_table_ptr( data, size, *ttc_sfnt_v1, MS_HHEA_TAG, NULL, NULL ))
     {
-        WARN( "unsupported sfnt font: missing hhea table.\n" );
+        OPENTYPE_WARN( "unsupported sfnt font: missing hhea table.\n" );
         return FALSE;
     }
 
     if (!opentype_get_tt_os2_v1( data, size, *ttc_sfnt_v1, &tt_os2_v1 ))
     {
-        WARN( "unsupported sfnt font: missing OS/2 table.\n" );
+        OPENTYPE_WARN( "unsupported sfnt font: missing OS/2 table.\n" );
         return FALSE;
     }
 
@@ -669,14 +701,14 @@ BOOL opentype_get_ttc_sfnt_v1( const void *data, size_t size, DWORD index, DWORD
     if (!memcmp( tt_os2_v1->achVendID, "Wine", sizeof(tt_os2_v1->achVendID) ) &&
         opentype_get_table_ptr( data, size, *ttc_sfnt_v1, MS_EBSC_TAG, NULL, NULL ))
     {
-        TRACE( "ignoring wine bitmap-only sfnt font.\n" );
+        OPENTYPE_TRACE( "ignoring wine bitmap-only sfnt font.\n" );
         return FALSE;
     }
 
     if (opentype_get_table_ptr( data, size, *ttc_sfnt_v1, MS_EBDT_TAG, NULL, NULL ) ||
         opentype_get_table_ptr( data, size, *ttc_sfnt_v1, MS_CBDT_TAG, NULL, NULL ))
     {
-        WARN( "unsupported sfnt font: embedded bitmap data.\n" );
+        OPENTYPE_WARN( "unsupported sfnt font: embedded bitmap data.\n" );
         return FALSE;
     }
 
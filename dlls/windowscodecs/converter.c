@@ -19,6 +19,9 @@
 
 #include <stdarg.h>
 #include <math.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #define COBJMACROS
 
@@ -127,6 +130,189 @@ static inline float from_sRGB_component(float f)
     return powf((f + 0.055f) / 1.055f, 2.4f);
 }
 
+#define MAX_CONVERT_THREADS     8
+#define MIN_CONVERT_BAND_HEIGHT 16
+#define MIN_CONVERT_PIXELS      (512 * 512)
+
+static INIT_ONCE converter_init_once = INIT_ONCE_STATIC_INIT;
+static float sRGB_to_linear[256];       /* from_sRGB_component(i / 255.0f) */
+static float linear_to_sRGB_min[256];   /* smallest linear value that rounds to sRGB value i */
+static UINT unpremultiply_factors[256]; /* 255 / alpha in 16.16 fixed point, rounded up */
+static UINT convert_threads;
+
+static inline BYTE linear_to_sRGB_byte_slow(float f)
+{
+    return (BYTE)floorf(to_sRGB_component(f) * 255.0f + 0.51f);
+}
+
+static BOOL WINAPI init_converter(INIT_ONCE *once, void *param, void **context)
+{
+    UINT i, lo, hi, mid, one;
+    SYSTEM_INFO info;
+    float f;
+
+    for (i = 0; i < 256; i++) sRGB_to_linear[i] = from_sRGB_component(i / 255.0f);
+
+    /* The conversion is monotonic, so the thresholds can be found by bisection
+     * over the bit patterns of the positive floats in [0, 1]. */
+    f = 1.0f;
+    memcpy(&one, &f, sizeof(one));
+    for (i = 1; i < 256; i++)
+    {
+        for (lo = 0, hi = one + 1; lo < hi;)
+        {
+            mid = lo + (hi - lo) / 2;
+            memcpy(&f, &mid, sizeof(f));
+            if (linear_to_sRGB_byte_slow(f) >= i) hi = mid;
+            else lo = mid + 1;
+        }
+        memcpy(&linear_to_sRGB_min[i], &lo, sizeof(lo));
+    }
+
+    for (i = 1; i < 256; i++) unpremultiply_factors[i] = (255 * 65536 + i - 1) / i;
+
+    GetSystemInfo(&info);
+    convert_threads = min(info.dwNumberOfProcessors, MAX_CONVERT_THREADS);
+    return TRUE;
+}
+
+static inline float sRGB_byte_to_linear(BYTE value)
+{
+    return sRGB_to_linear[value];
+}
+
+static inline BYTE linear_to_sRGB_byte(float f)
+{
+    UINT lo = 0, mid, step;
+
+    if (!(f >= 0.0f && f <= 1.0f)) return linear_to_sRGB_byte_slow(f);
+    for (step = 128; step; step >>= 1)
+        if (f >= linear_to_sRGB_min[mid = lo + step]) lo = mid;
+    return lo;
+}
+
+#ifdef __SSE2__
+static inline __m128i premultiply_pixels_sse2(__m128i pixels)
+{
+    const __m128i rgb_mask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alpha_one = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    __m128i alpha;
+
+    alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, 0xff), 0xff);
+    alpha = _mm_or_si128(_mm_and_si128(alpha, rgb_mask), alpha_one);
+    pixels = _mm_add_epi16(_mm_mullo_epi16(pixels, alpha), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(pixels, _mm_srli_epi16(pixels, 8)), 8);
+}
+#endif
+
+/* (value * alpha + 127) / 255 for each color of 32bpp pixels with alpha in the last byte */
+static void premultiply_row(BYTE *row, UINT width)
+{
+    UINT x = 0, alpha, value;
+
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    __m128i pixels, lo, hi;
+
+    for (; x + 4 <= width; x += 4, row += 16)
+    {
+        pixels = _mm_loadu_si128((const __m128i *)row);
+        lo = premultiply_pixels_sse2(_mm_unpacklo_epi8(pixels, zero));
+        hi = premultiply_pixels_sse2(_mm_unpackhi_epi8(pixels, zero));
+        _mm_storeu_si128((__m128i *)row, _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    for (; x < width; x++, row += 4)
+    {
+        if ((alpha = row[3]) == 255) continue;
+        value = row[0] * alpha + 128;
+        row[0] = (value + (value >> 8)) >> 8;
+        value = row[1] * alpha + 128;
+        row[1] = (value + (value >> 8)) >> 8;
+        value = row[2] * alpha + 128;
+        row[2] = (value + (value >> 8)) >> 8;
+    }
+}
+
+/* value * 255 / alpha for each color of 32bpp pixels with alpha in the last byte */
+static void unpremultiply_row(BYTE *row, UINT width)
+{
+    UINT x, alpha, factor;
+
+    for (x = 0; x < width; x++, row += 4)
+    {
+        if (!(alpha = row[3]) || alpha == 255) continue;
+        factor = unpremultiply_factors[alpha];
+        row[0] = (row[0] * factor) >> 16;
+        row[1] = (row[1] * factor) >> 16;
+        row[2] = (row[2] * factor) >> 16;
+    }
+}
+
+static void fill_alpha_row(BYTE *row, UINT width)
+{
+    UINT x;
+
+    for (x = 0; x < width; x++) row[4 * x + 3] = 0xff;
+}
+
+struct convert_rows_params
+{
+    void (*func)(BYTE *row, UINT width);
+    BYTE *buffer;
+    UINT stride;
+    UINT width;
+    UINT height;
+    UINT band_height;
+    UINT band_count;
+    LONG next;
+};
+
+static void convert_row_bands(struct convert_rows_params *params)
+{
+    UINT band, y, end;
+
+    while ((band = InterlockedIncrement(&params->next) - 1) < params->band_count)
+    {
+        y = band * params->band_height;
+        end = min(y + params->band_height, params->height);
+        for (; y < end; y++) params->func(params->buffer + y * params->stride, params->width);
+    }
+}
+
+static void CALLBACK convert_rows_callback(TP_CALLBACK_INSTANCE *instance, void *context, TP_WORK *work)
+{
+    convert_row_bands(context);
+}
+
+/* Apply an in-place conversion to every row of a buffer. Rows are independent,
+ * so large images are split into bands that are also processed by threadpool
+ * workers while the calling thread takes its share. */
+static void convert_rows(void (*func)(BYTE *row, UINT width), BYTE *buffer, UINT stride, UINT width, UINT height)
+{
+    struct convert_rows_params params = {.func = func, .buffer = buffer, .stride = stride, .width = width, .height = height};
+    TP_WORK *work = NULL;
+    UINT i, threads = convert_threads;
+
+    if (threads > 1 && (UINT64)width * height >= MIN_CONVERT_PIXELS && height >= 2 * MIN_CONVERT_BAND_HEIGHT)
+        work = CreateThreadpoolWork(convert_rows_callback, &params, NULL);
+
+    if (!work)
+    {
+        for (i = 0; i < height; i++) func(buffer + i * stride, width);
+        return;
+    }
+
+    params.band_height = max(MIN_CONVERT_BAND_HEIGHT, (height + threads * 4 - 1) / (threads * 4));
+    params.band_count = (height + params.band_height - 1) / params.band_height;
+    for (i = 1; i < threads; i++) SubmitThreadpoolWork(work);
+
+    convert_row_bands(&params);
+    WaitForThreadpoolWorkCallbacks(work, FALSE);
+    CloseThreadpoolWork(work);
+}
+
 #if 0 /* FIXME: enable once needed */
 
 static void from_sRGB(BYTE *bgr)
@@ -742,15 +928,12 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
         if (prc)
         {
             HRESULT res;
-            INT x, y;
 
             res = IWICBitmapSource_CopyPixels(This->source, prc, cbStride, cbBufferSize, pbBuffer);
             if (FAILED(res)) return res;
 
             /* set all alpha values to 255 */
-            for (y=0; y<prc->Height; y++)
-                for (x=0; x<prc->Width; x++)
-                    pbBuffer[cbStride*y+4*x+3] = 0xff;
+            convert_rows(fill_alpha_row, pbBuffer, cbStride, prc->Width, prc->Height);
         }
         return S_OK;
     case format_32bppRGBA:
@@ -770,22 +953,11 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
         if (prc)
         {
             HRESULT res;
-            INT x, y;
 
             res = IWICBitmapSource_CopyPixels(This->source, prc, cbStride, cbBufferSize, pbBuffer);
             if (FAILED(res)) return res;
 
-            for (y=0; y<prc->Height; y++)
-                for (x=0; x<prc->Width; x++)
-                {
-                    BYTE alpha = pbBuffer[cbStride*y+4*x+3];
-                    if (alpha != 0 && alpha != 255)
-                    {
-                        pbBuffer[cbStride*y+4*x] = pbBuffer[cbStride*y+4*x] * 255 / alpha;
-                        pbBuffer[cbStride*y+4*x+1] = pbBuffer[cbStride*y+4*x+1] * 255 / alpha;
-                        pbBuffer[cbStride*y+4*x+2] = pbBuffer[cbStride*y+4*x+2] * 255 / alpha;
-                    }
-                }
+            convert_rows(unpremultiply_row, pbBuffer, cbStride, prc->Width, prc->Height);
         }
         return S_OK;
     case format_48bppRGB:
@@ -930,9 +1102,9 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
                     {
                         BYTE red, green, blue;
 
-                        red   = (BYTE)floorf(to_sRGB_component(*srcpixel++) * 255.0f + 0.51f);
-                        green = (BYTE)floorf(to_sRGB_component(*srcpixel++) * 255.0f + 0.51f);
-                        blue  = (BYTE)floorf(to_sRGB_component(*srcpixel++) * 255.0f + 0.51f);
+                        red   = linear_to_sRGB_byte(*srcpixel++);
+                        green = linear_to_sRGB_byte(*srcpixel++);
+                        blue  = linear_to_sRGB_byte(*srcpixel++);
 
                         *dstpixel++ = 0xff000000 | red << 16 | green << 8 | blue;
                     }
@@ -978,9 +1150,9 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
                     {
                         BYTE red, green, blue, alpha;
 
-                        red   = (BYTE)floorf(to_sRGB_component(*srcpixel++) * 255.0f + 0.51f);
-                        green = (BYTE)floorf(to_sRGB_component(*srcpixel++) * 255.0f + 0.51f);
-                        blue  = (BYTE)floorf(to_sRGB_component(*srcpixel++) * 255.0f + 0.51f);
+                        red   = linear_to_sRGB_byte(*srcpixel++);
+                        green = linear_to_sRGB_byte(*srcpixel++);
+                        blue  = linear_to_sRGB_byte(*srcpixel++);
                         alpha = (BYTE)floorf(*srcpixel++ * 255.0f + 0.51f);
 
                         *dstpixel++ = alpha << 24 | red << 16 | green << 8 | blue;
@@ -1025,7 +1197,7 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
                     dstpixel = (DWORD *)dstrow;
                     for (x = 0; x < prc->Width; x++)
                     {
-                        BYTE comp = (BYTE)floorf(to_sRGB_component(float_16_to_32(*srcpixel++)) * 255.0f + 0.51f);
+                        BYTE comp = linear_to_sRGB_byte(float_16_to_32(*srcpixel++));
                         *dstpixel++ = 0xff000000 | comp << 16 | comp << 8 | comp;
                     }
                     srcrow += srcstride;
@@ -1070,9 +1242,9 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
                     {
                         BYTE red, green, blue;
 
-                        red   = (BYTE)floorf(to_sRGB_component(float_16_to_32(*srcpixel++)) * 255.0f + 0.51f);
-                        green = (BYTE)floorf(to_sRGB_component(float_16_to_32(*srcpixel++)) * 255.0f + 0.51f);
-                        blue  = (BYTE)floorf(to_sRGB_component(float_16_to_32(*srcpixel++)) * 255.0f + 0.51f);
+                        red   = linear_to_sRGB_byte(float_16_to_32(*srcpixel++));
+                        green = linear_to_sRGB_byte(float_16_to_32(*srcpixel++));
+                        blue  = linear_to_sRGB_byte(float_16_to_32(*srcpixel++));
 
                         *dstpixel++ = 0xff000000 | red << 16 | green << 8 | blue;
                     }
@@ -1102,15 +1274,11 @@ static HRESULT copypixels_to_32bppRGBA(struct FormatConverter *This, const WICRe
     case format_32bppRGB:
         if (prc)
         {
-            INT x, y;
-
             hr = IWICBitmapSource_CopyPixels(This->source, prc, cbStride, cbBufferSize, pbBuffer);
             if (FAILED(hr)) return hr;
 
             /* set all alpha values to 255 */
-            for (y=0; y<prc->Height; y++)
-                for (x=0; x<prc->Width; x++)
-                    pbBuffer[cbStride*y+4*x+3] = 0xff;
+            convert_rows(fill_alpha_row, pbBuffer, cbStride, prc->Width, prc->Height);
         }
         return S_OK;
 
@@ -1122,22 +1290,10 @@ static HRESULT copypixels_to_32bppRGBA(struct FormatConverter *This, const WICRe
     case format_32bppPRGBA:
         if (prc)
         {
-            INT x, y;
-
             hr = IWICBitmapSource_CopyPixels(This->source, prc, cbStride, cbBufferSize, pbBuffer);
             if (FAILED(hr)) return hr;
 
-            for (y=0; y<prc->Height; y++)
-                for (x=0; x<prc->Width; x++)
-                {
-                    BYTE alpha = pbBuffer[cbStride*y+4*x+3];
-                    if (alpha != 0 && alpha != 255)
-                    {
-                        pbBuffer[cbStride*y+4*x] = pbBuffer[cbStride*y+4*x] * 255 / alpha;
-                        pbBuffer[cbStride*y+4*x+1] = pbBuffer[cbStride*y+4*x+1] * 255 / alpha;
-                        pbBuffer[cbStride*y+4*x+2] = pbBuffer[cbStride*y+4*x+2] * 255 / alpha;
-                    }
-                }
+            convert_rows(unpremultiply_row, pbBuffer, cbStride, prc->Width, prc->Height);
         }
         return S_OK;
 
@@ -1195,21 +1351,7 @@ static HRESULT copypixels_to_32bppPBGRA(struct FormatConverter *This, const WICR
     default:
         hr = copypixels_to_32bppBGRA(This, prc, cbStride, cbBufferSize, pbBuffer, source_format);
         if (SUCCEEDED(hr) && prc)
-        {
-            INT x, y;
-
-            for (y=0; y<prc->Height; y++)
-                for (x=0; x<prc->Width; x++)
-                {
-                    BYTE alpha = pbBuffer[cbStride*y+4*x+3];
-                    if (alpha != 255)
-                    {
-                        pbBuffer[cbStride*y+4*x] = (pbBuffer[cbStride*y+4*x] * alpha + 127) / 255;
-                        pbBuffer[cbStride*y+4*x+1] = (pbBuffer[cbStride*y+4*x+1] * alpha + 127) / 255;
-                        pbBuffer[cbStride*y+4*x+2] = (pbBuffer[cbStride*y+4*x+2] * alpha + 127) / 255;
-                    }
-                }
-        }
+            convert_rows(premultiply_row, pbBuffer, cbStride, prc->Width, prc->Height);
         return hr;
     }
 }
@@ -1228,21 +1370,7 @@ static HRESULT copypixels_to_32bppPRGBA(struct FormatConverter *This, const WICR
     default:
         hr = copypixels_to_32bppRGBA(This, prc, cbStride, cbBufferSize, pbBuffer, source_format);
         if (SUCCEEDED(hr) && prc)
-        {
-            INT x, y;
-
-            for (y=0; y<prc->Height; y++)
-                for (x=0; x<prc->Width; x++)
-                {
-                    BYTE alpha = pbBuffer[cbStride*y+4*x+3];
-                    if (alpha != 255)
-                    {
-                        pbBuffer[cbStride*y+4*x] = (pbBuffer[cbStride*y+4*x] * alpha + 127) / 255;
-                        pbBuffer[cbStride*y+4*x+1] = (pbBuffer[cbStride*y+4*x+1] * alpha + 127) / 255;
-                        pbBuffer[cbStride*y+4*x+2] = (pbBuffer[cbStride*y+4*x+2] * alpha + 127) / 255;
-                    }
-                }
-        }
+            convert_rows(premultiply_row, pbBuffer, cbStride, prc->Width, prc->Height);
         return hr;
     }
 }
@@ -1476,7 +1604,7 @@ static HRESULT copypixels_to_24bppBGR(struct FormatConverter *This, const WICRec
 
                     for (x = 0; x < prc->Width; x++)
                     {
-                        BYTE gray = (BYTE)floorf(to_sRGB_component(gray_float[x]) * 255.0f + 0.51f);
+                        BYTE gray = linear_to_sRGB_byte(gray_float[x]);
                         *bgr++ = gray;
                         *bgr++ = gray;
                         *bgr++ = gray;
@@ -1788,7 +1916,7 @@ static HRESULT copypixels_to_8bppGray(struct FormatConverter *This, const WICRec
                     BYTE *dstpixel = dst;
 
                     for (x=0; x < prc->Width; x++)
-                        *dstpixel++ = (BYTE)floorf(to_sRGB_component(*srcpixel++) * 255.0f + 0.51f);
+                        *dstpixel++ = linear_to_sRGB_byte(*srcpixel++);
 
                     src += srcstride;
                     dst += cbStride;
@@ -2290,9 +2418,9 @@ static HRESULT copypixels_to_128bppRGBAFloat(struct FormatConverter *This, const
                 dstpixel= (float *)dstrow;
                 for (x = 0; x < prc->Width; x++)
                 {
-                    dstpixel[2] = from_sRGB_component(*srcpixel++ / 255.0f);
-                    dstpixel[1] = from_sRGB_component(*srcpixel++ / 255.0f);
-                    dstpixel[0] = from_sRGB_component(*srcpixel++ / 255.0f);
+                    dstpixel[2] = sRGB_byte_to_linear(*srcpixel++);
+                    dstpixel[1] = sRGB_byte_to_linear(*srcpixel++);
+                    dstpixel[0] = sRGB_byte_to_linear(*srcpixel++);
                     dstpixel[3] = 1.0f;
 
                     dstpixel += 4;
@@ -2335,9 +2463,9 @@ static HRESULT copypixels_to_128bppRGBAFloat(struct FormatConverter *This, const
                 dstpixel= (float *)dstrow;
                 for (x = 0; x < prc->Width; x++)
                 {
-                    dstpixel[2] = from_sRGB_component(*srcpixel++ / 255.0f);
-                    dstpixel[1] = from_sRGB_component(*srcpixel++ / 255.0f);
-                    dstpixel[0] = from_sRGB_component(*srcpixel++ / 255.0f);
+                    dstpixel[2] = sRGB_byte_to_linear(*srcpixel++);
+                    dstpixel[1] = sRGB_byte_to_linear(*srcpixel++);
+                    dstpixel[0] = sRGB_byte_to_linear(*srcpixel++);
                     dstpixel[3] = *srcpixel++ / 255.0f;
 
                     dstpixel += 4;
@@ -2731,6 +2859,7 @@ static HRESULT WINAPI FormatConverter_CopyPixels(IWICFormatConverter *iface,
             prc = &rc;
         }
 
+        InitOnceExecuteOnce(&converter_init_once, init_converter, NULL, NULL);
         return This->dst_format->copy_function(This, prc, cbStride, cbBufferSize,
             pbBuffer, This->src_format->format);
     }
@@ -1044,6 +1044,70 @@ static void test_converter_4bppGray(void)
     DeleteTestBitmap(src_obj);
 }
 
+static void test_converter_large_premultiplied(void)
+{
+    static const UINT width = 512, height = 1024, stride = 4 * 512;
+    IWICBitmapSource *converted;
+    IWICBitmap *bitmap;
+    BYTE *src, *dst, expect;
+    UINT x, y, i, alpha, mismatches;
+    HRESULT hr;
+
+    src = malloc(stride * height);
+    dst = malloc(stride * height);
+
+    for (y = 0; y < height; y++)
+    {
+        for (x = 0; x < width; x++)
+        {
+            BYTE *pixel = src + y * stride + 4 * x;
+            pixel[3] = (x / 2) ^ y;
+            pixel[0] = min(x & 0xff, pixel[3]);
+            pixel[1] = min(y & 0xff, pixel[3]);
+            pixel[2] = min((x + y) & 0xff, pixel[3]);
+        }
+    }
+
+    hr = IWICImagingFactory_CreateBitmapFromMemory(factory, width, height, &GUID_WICPixelFormat32bppBGRA,
+                                                   stride, stride * height, src, &bitmap);
+    ok(hr == S_OK, "CreateBitmapFromMemory returned %#lx\n", hr);
+    hr = WICConvertBitmapSource(&GUID_WICPixelFormat32bppPBGRA, (IWICBitmapSource *)bitmap, &converted);
+    ok(hr == S_OK, "WICConvertBitmapSource returned %#lx\n", hr);
+    hr = IWICBitmapSource_CopyPixels(converted, NULL, stride, stride * height, dst);
+    ok(hr == S_OK, "CopyPixels returned %#lx\n", hr);
+    IWICBitmapSource_Release(converted);
+    IWICBitmap_Release(bitmap);
+
+    for (i = mismatches = 0; i < stride * height; i++)
+    {
+        alpha = src[i | 3];
+        expect = (i & 3) == 3 ? alpha : (src[i] * alpha + 127) / 255;
+        if (abs(dst[i] - expect) > 1) mismatches++;
+    }
+    ok(!mismatches, "got %u mismatching premultiplied components\n", mismatches);
+
+    hr = IWICImagingFactory_CreateBitmapFromMemory(factory, width, height, &GUID_WICPixelFormat32bppPBGRA,
+                                                   stride, stride * height, src, &bitmap);
+    ok(hr == S_OK, "CreateBitmapFromMemory returned %#lx\n", hr);
+    hr = WICConvertBitmapSource(&GUID_WICPixelFormat32bppBGRA, (IWICBitmapSource *)bitmap, &converted);
+    ok(hr == S_OK, "WICConvertBitmapSource returned %#lx\n", hr);
+    hr = IWICBitmapSource_CopyPixels(converted, NULL, stride, stride * height, dst);
+    ok(hr == S_OK, "CopyPixels returned %#lx\n", hr);
+    IWICBitmapSource_Release(converted);
+    IWICBitmap_Release(bitmap);
+
+    for (i = mismatches = 0; i < stride * height; i++)
+    {
+        alpha = src[i | 3];
+        expect = (i & 3) == 3 || !alpha ? src[i] : src[i] * 255 / alpha;
+        if (abs(dst[i] - expect) > 1) mismatches++;
+    }
+    ok(!mismatches, "got %u mismatching unpremultiplied components\n", mismatches);
+
+    free(src);
+    free(dst);
+}
+
 static void test_converter_8bppGray(void)
 {
     BitmapTestSrc *src_obj;
@@ -2435,6 +2499,7 @@ START_TEST(converter)
     test_converter_4bppGray();
     test_converter_8bppGray();
     test_converter_8bppIndexed();
+    test_converter_large_premultiplied();
 
     test_encoder(&testdata_8bppIndexed, &CLSID_WICGifEncoder,
                  &testdata_8bppIndexed, &CLSID_WICGifDecoder, "GIF encoder 8bppIndexed");
@@ -455,6 +455,9 @@ static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wi
 
     wined3d_lock_init(&device_vk->allocator_cs, "wined3d_device_vk.allocator_cs");
 
+    wined3d_device_vk_init_pipeline_cache(device_vk);
+    wined3d_device_vk_init_pipeline_compiler(device_vk);
+
     *device = &device_vk->d;
 
     return WINED3D_OK;
@@ -482,6 +485,8 @@ static void adapter_vk_destroy_device(struct wined3d_device *device)
 
     wined3d_lock_cleanup(&device_vk->allocator_cs);
 
+    wined3d_device_vk_cleanup_pipeline_compiler(device_vk);
+    wined3d_device_vk_cleanup_pipeline_cache(device_vk);
     VK_CALL(vkDestroyDevice(device_vk->vk_device, NULL));
     wined3d_decref(wined3d);
     free(device_vk);
@@ -1743,7 +1748,8 @@ static void adapter_vk_draw_primitive(struct wined3d_device *device,
     if (!(vk_command_buffer = wined3d_context_vk_apply_draw_state(context_vk,
             state, indirect_vk, parameters->indexed)))
     {
-        ERR("Failed to apply draw state.\n");
+        if (!context_vk->graphics_pipeline_pending)
+            ERR("Failed to apply draw state.\n");
         context_release(&context_vk->c);
         return;
     }
@@ -2412,6 +2418,7 @@ static bool wined3d_adapter_vk_init_device_extensions(struct wined3d_adapter_vk
         {VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME,    VK_API_VERSION_1_3},
         {VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME,    ~0u},
         {VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME,            VK_API_VERSION_1_2},
+        {VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME,  VK_API_VERSION_1_3},
         {VK_EXT_SAMPLER_FILTER_MINMAX_EXTENSION_NAME,       VK_API_VERSION_1_2},
         {VK_EXT_SHADER_STENCIL_EXPORT_EXTENSION_NAME,       ~0u},
         {VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME,          ~0u},
@@ -2440,6 +2447,7 @@ static bool wined3d_adapter_vk_init_device_extensions(struct wined3d_adapter_vk
         {VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME,     WINED3D_VK_EXT_EXTENDED_DYNAMIC_STATE2},
         {VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME,     WINED3D_VK_EXT_EXTENDED_DYNAMIC_STATE3},
         {VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME,             WINED3D_VK_EXT_HOST_QUERY_RESET},
+        {VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME,   WINED3D_VK_EXT_PIPELINE_CREATION_FEEDBACK},
         {VK_EXT_SAMPLER_FILTER_MINMAX_EXTENSION_NAME,        WINED3D_VK_EXT_SAMPLER_FILTER_MINMAX},
         {VK_EXT_SHADER_STENCIL_EXPORT_EXTENSION_NAME,        WINED3D_VK_EXT_SHADER_STENCIL_EXPORT},
         {VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME,           WINED3D_VK_EXT_TRANSFORM_FEEDBACK},
@@ -2580,6 +2588,11 @@ static BOOL wined3d_adapter_vk_init(struct wined3d_adapter_vk *adapter_vk,
     else
         VK_CALL(vkGetPhysicalDeviceProperties(adapter_vk->physical_device, &properties2.properties));
     adapter_vk->device_limits = properties2.properties.limits;
+    adapter_vk->vendor_id = properties2.properties.vendorID;
+    adapter_vk->device_id = properties2.properties.deviceID;
+    adapter_vk->driver_version = properties2.properties.driverVersion;
+    memcpy(adapter_vk->pipeline_cache_uuid, properties2.properties.pipelineCacheUUID,
+            sizeof(adapter_vk->pipeline_cache_uuid));
 
     VK_CALL(vkGetPhysicalDeviceMemoryProperties(adapter_vk->physical_device, &adapter_vk->memory_properties));
 
@@ -1021,6 +1021,57 @@ void wined3d_context_gl_free_timestamp_query(struct wined3d_timestamp_query *que
     context_gl->free_timestamp_queries[context_gl->free_timestamp_query_count++] = query->id;
 }
 
+/* Context activation is done by the caller. The timestamps of the last few
+ * presents are kept in flight, and the interval between consecutive ones is
+ * reported to the frame profiler as the GPU frame time. */
+void wined3d_context_gl_profile_frame(struct wined3d_context_gl *context_gl)
+{
+    const struct wined3d_gl_info *gl_info = context_gl->gl_info;
+    GLuint64 timestamp;
+    GLuint available;
+    GLuint id;
+
+    if (!wined3d_profile_enabled || !gl_info->supported[ARB_TIMER_QUERY])
+        return;
+
+    if (!context_gl->profile_queries[0])
+    {
+        GL_EXTCALL(glGenQueries(ARRAY_SIZE(context_gl->profile_queries), context_gl->profile_queries));
+        checkGLcall("glGenQueries");
+    }
+
+    while (context_gl->profile_query_count)
+    {
+        id = context_gl->profile_queries[context_gl->profile_query_head];
+        GL_EXTCALL(glGetQueryObjectuiv(id, GL_QUERY_RESULT_AVAILABLE, &available));
+        if (!available)
+            break;
+        GL_EXTCALL(glGetQueryObjectui64v(id, GL_QUERY_RESULT, &timestamp));
+
+        if (context_gl->profile_timestamp)
+            wined3d_profile_record_counter("GPU frame time (ms)",
+                    (timestamp - context_gl->profile_timestamp) / 1000000.0);
+        context_gl->profile_timestamp = timestamp;
+        context_gl->profile_query_head = (context_gl->profile_query_head + 1) % ARRAY_SIZE(context_gl->profile_queries);
+        --context_gl->profile_query_count;
+    }
+    checkGLcall("poll profile queries");
+
+    if (context_gl->profile_query_count == ARRAY_SIZE(context_gl->profile_queries))
+    {
+        /* The GPU is too far behind; skip this frame and don't report an
+         * interval spanning it. */
+        context_gl->profile_timestamp = 0;
+        return;
+    }
+
+    id = context_gl->profile_queries[(context_gl->profile_query_head + context_gl->profile_query_count)
+            % ARRAY_SIZE(context_gl->profile_queries)];
+    GL_EXTCALL(glQueryCounter(id, GL_TIMESTAMP));
+    checkGLcall("glQueryCounter");
+    ++context_gl->profile_query_count;
+}
+
 void wined3d_context_gl_alloc_so_statistics_query(struct wined3d_context_gl *context_gl,
         struct wined3d_so_statistics_query *query)
 {
@@ -1389,6 +1440,9 @@ static void wined3d_context_gl_cleanup(struct wined3d_context_gl *context_gl)
         if (context_gl->free_timestamp_query_count)
             GL_EXTCALL(glDeleteQueries(context_gl->free_timestamp_query_count, context_gl->free_timestamp_queries));
 
+        if (context_gl->profile_queries[0])
+            GL_EXTCALL(glDeleteQueries(ARRAY_SIZE(context_gl->profile_queries), context_gl->profile_queries));
+
         if (gl_info->supported[ARB_SYNC])
         {
             for (i = 0; i < context_gl->free_fence_count; ++i)
@@ -1960,6 +1960,7 @@ void wined3d_context_vk_cleanup(struct wined3d_context_vk *context_vk)
     free(context_vk->retired.objects);
 
     wined3d_shader_descriptor_writes_vk_cleanup(&context_vk->descriptor_writes);
+    wined3d_device_vk_wait_pipeline_compiler_idle(device_vk);
     wine_rb_destroy(&context_vk->graphics_pipelines, wined3d_context_vk_destroy_graphics_pipeline, context_vk);
     wine_rb_destroy(&context_vk->pipeline_layouts, wined3d_context_vk_destroy_pipeline_layout, context_vk);
     wine_rb_destroy(&context_vk->render_passes, wined3d_context_vk_destroy_render_pass, context_vk);
@@ -3730,6 +3731,61 @@ fail:
     return NULL;
 }
 
+/* The key is copied into the pipeline, and may outlive the context's key
+ * while the pipeline is created asynchronously. */
+static void wined3d_graphics_pipeline_key_vk_fixup(struct wined3d_graphics_pipeline_key_vk *key)
+{
+    if (key->input_desc.pNext)
+        key->input_desc.pNext = &key->divisor_desc;
+    key->input_desc.pVertexBindingDescriptions = key->bindings;
+    key->input_desc.pVertexAttributeDescriptions = key->attributes;
+    key->divisor_desc.pVertexBindingDivisors = key->divisors;
+    key->ms_desc.pSampleMask = &key->sample_mask;
+    key->blend_desc.pAttachments = key->blend_attachments;
+
+    key->pipeline_desc.pStages = key->stages;
+    key->pipeline_desc.pVertexInputState = &key->input_desc;
+    key->pipeline_desc.pInputAssemblyState = &key->ia_desc;
+    key->pipeline_desc.pTessellationState = &key->ts_desc;
+    key->pipeline_desc.pViewportState = &key->vp_desc;
+    key->pipeline_desc.pRasterizationState = &key->rs_desc;
+    key->pipeline_desc.pMultisampleState = &key->ms_desc;
+    key->pipeline_desc.pDepthStencilState = &key->ds_desc;
+    key->pipeline_desc.pColorBlendState = &key->blend_desc;
+    key->pipeline_desc.pDynamicState = &key->dynamic_desc;
+}
+
+/* This may be called from pipeline compiler threads. */
+void wined3d_graphics_pipeline_vk_create(struct wined3d_device_vk *device_vk,
+        struct wined3d_graphics_pipeline_vk *pipeline_vk)
+{
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+    VkPipelineCreationFeedbackCreateInfo feedback_info;
+    VkGraphicsPipelineCreateInfo pipeline_desc;
+    uint64_t profile_start;
+
+    pipeline_desc = pipeline_vk->key.pipeline_desc;
+    pipeline_vk->feedback.flags = 0;
+    if (vk_info->supported[WINED3D_VK_EXT_PIPELINE_CREATION_FEEDBACK])
+    {
+        feedback_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO;
+        feedback_info.pNext = pipeline_desc.pNext;
+        feedback_info.pPipelineCreationFeedback = &pipeline_vk->feedback;
+        feedback_info.pipelineStageCreationFeedbackCount = 0;
+        feedback_info.pPipelineStageCreationFeedbacks = NULL;
+        pipeline_desc.pNext = &feedback_info;
+    }
+
+    profile_start = wined3d_profile_begin();
+    if ((pipeline_vk->vr = VK_CALL(vkCreateGraphicsPipelines(device_vk->vk_device,
+            device_vk->pipeline_cache.vk_pipeline_cache, 1, &pipeline_desc, NULL, &pipeline_vk->vk_pipeline))) < 0)
+    {
+        WARN("Failed to create graphics pipeline, vr %s.\n", wined3d_debug_vkresult(pipeline_vk->vr));
+        pipeline_vk->vk_pipeline = VK_NULL_HANDLE;
+    }
+    wined3d_profile_end("pipeline create", profile_start);
+}
+
 static VkPipeline wined3d_context_vk_get_graphics_pipeline(struct wined3d_context_vk *context_vk)
 {
     struct wined3d_device_vk *device_vk = wined3d_device_vk(context_vk->c.device);
@@ -3737,26 +3793,43 @@ static VkPipeline wined3d_context_vk_get_graphics_pipeline(struct wined3d_contex
     struct wined3d_graphics_pipeline_vk *pipeline_vk;
     struct wined3d_graphics_pipeline_key_vk *key;
     struct wine_rb_entry *entry;
-    VkResult vr;
+
+    context_vk->graphics_pipeline_pending = 0;
 
     key = &context_vk->graphics.pipeline_key_vk;
     if ((entry = wine_rb_get(&context_vk->graphics_pipelines, key)))
-        return WINE_RB_ENTRY_VALUE(entry, struct wined3d_graphics_pipeline_vk, entry)->vk_pipeline;
+    {
+        pipeline_vk = WINE_RB_ENTRY_VALUE(entry, struct wined3d_graphics_pipeline_vk, entry);
+    }
+    else
+    {
+        if (!(pipeline_vk = calloc(1, sizeof(*pipeline_vk))))
+            return VK_NULL_HANDLE;
+        pipeline_vk->key = *key;
+        wined3d_graphics_pipeline_key_vk_fixup(&pipeline_vk->key);
 
-    if (!(pipeline_vk = malloc(sizeof(*pipeline_vk))))
-        return VK_NULL_HANDLE;
-    pipeline_vk->key = *key;
+        if (!wined3d_device_vk_queue_graphics_pipeline(device_vk, pipeline_vk))
+            wined3d_graphics_pipeline_vk_create(device_vk, pipeline_vk);
 
-    if ((vr = VK_CALL(vkCreateGraphicsPipelines(device_vk->vk_device,
-            VK_NULL_HANDLE, 1, &key->pipeline_desc, NULL, &pipeline_vk->vk_pipeline))) < 0)
-    {
-        WARN("Failed to create graphics pipeline, vr %s.\n", wined3d_debug_vkresult(vr));
-        free(pipeline_vk);
-        return VK_NULL_HANDLE;
+        if (wine_rb_put(&context_vk->graphics_pipelines, &pipeline_vk->key, &pipeline_vk->entry) == -1)
+            ERR("Failed to insert pipeline.\n");
     }
 
-    if (wine_rb_put(&context_vk->graphics_pipelines, &pipeline_vk->key, &pipeline_vk->entry) == -1)
-        ERR("Failed to insert pipeline.\n");
+    if (!pipeline_vk->created)
+    {
+        if (!wined3d_device_vk_wait_graphics_pipeline(device_vk, pipeline_vk,
+                wined3d_settings.async_pipeline_timeout))
+        {
+            context_vk->graphics_pipeline_pending = 1;
+            ++device_vk->pipeline_compiler.skipped_draw_count;
+            return VK_NULL_HANDLE;
+        }
+
+        pipeline_vk->created = true;
+        if (pipeline_vk->vk_pipeline)
+            wined3d_device_vk_pipeline_created(device_vk,
+                    vk_info->supported[WINED3D_VK_EXT_PIPELINE_CREATION_FEEDBACK] ? &pipeline_vk->feedback : NULL);
+    }
 
     return pipeline_vk->vk_pipeline;
 }
@@ -4072,7 +4145,10 @@ VkCommandBuffer wined3d_context_vk_apply_draw_state(struct wined3d_context_vk *c
     {
         if (!(context_vk->graphics.vk_pipeline = wined3d_context_vk_get_graphics_pipeline(context_vk)))
         {
-            ERR("Failed to get graphics pipeline.\n");
+            if (context_vk->graphics_pipeline_pending)
+                TRACE("Skipping draw, graphics pipeline is still being created.\n");
+            else
+                ERR("Failed to get graphics pipeline.\n");
             return VK_NULL_HANDLE;
         }
 
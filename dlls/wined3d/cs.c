@@ -716,6 +716,7 @@ static void wined3d_cs_exec_present(struct wined3d_cs *cs, const void *data)
     }
 
     swapchain->swapchain_ops->swapchain_present(swapchain, &op->src_rect, &op->dst_rect, op->swap_interval, op->flags);
+    wined3d_profile_record_frame();
 
     /* Discard buffers if the swap effect allows it. */
     back_buffer = swapchain->back_buffers[desc->backbuffer_count - 1];
@@ -3108,9 +3109,16 @@ static void wined3d_cs_st_submit(struct wined3d_device_context *context, enum wi
 
     opcode = *(const enum wined3d_cs_op *)&data[start];
     if (opcode >= WINED3D_CS_OP_STOP)
+    {
         ERR("Invalid opcode %#x.\n", opcode);
+    }
     else
+    {
+        uint64_t profile_start = wined3d_profile_begin();
+
         wined3d_cs_op_handlers[opcode](cs, &data[start]);
+        wined3d_profile_end(debug_cs_op(opcode), profile_start);
+    }
 
     if (cs->data == data)
         cs->start = cs->end = start;
@@ -3400,13 +3408,16 @@ static void wined3d_cs_mt_finish(struct wined3d_device_context *context, enum wi
 {
     struct wined3d_cs *cs = wined3d_cs_from_context(context);
     unsigned int spin_count = 0;
+    uint64_t profile_start;
 
     if (cs->thread_id == GetCurrentThreadId())
         return wined3d_cs_st_finish(context, queue_id);
 
     TRACE_(d3d_perf)("Waiting for queue %u to be empty.\n", queue_id);
+    profile_start = wined3d_profile_begin();
     while (cs->queue[queue_id].head != *(volatile ULONG *)&cs->queue[queue_id].tail)
         wined3d_pause(&spin_count);
+    wined3d_profile_end(queue_id == WINED3D_CS_QUEUE_MAP ? "map wait" : "finish wait", profile_start);
     TRACE_(d3d_perf)("Queue is now empty.\n");
 }
 
@@ -3481,6 +3492,7 @@ static void wined3d_cs_command_unlock(const struct wined3d_cs *cs)
 static inline bool wined3d_cs_execute_next(struct wined3d_cs *cs, struct wined3d_cs_queue *queue)
 {
     struct wined3d_cs_packet *packet;
+    uint64_t profile_start;
     enum wined3d_cs_op opcode;
     SIZE_T tail;
 
@@ -3499,9 +3511,11 @@ static inline bool wined3d_cs_execute_next(struct wined3d_cs *cs, struct wined3d
             return false;
         }
 
+        profile_start = wined3d_profile_begin();
         wined3d_cs_command_lock(cs);
         wined3d_cs_op_handlers[opcode](cs, packet->data);
         wined3d_cs_command_unlock(cs);
+        wined3d_profile_end(debug_cs_op(opcode), profile_start);
         TRACE("%s executed.\n", debug_cs_packet(packet));
     }
 
@@ -4229,6 +4243,8 @@ struct wined3d_deferred_context
     struct wined3d_device_context c;
 
     SIZE_T data_size, data_capacity;
+    /* Decaying average of the data size of recorded command lists. */
+    SIZE_T data_size_estimate;
     void *data;
 
     SIZE_T resource_count, resources_capacity;
@@ -4584,8 +4600,7 @@ HRESULT CDECL wined3d_deferred_context_record_command_list(struct wined3d_device
     memory = malloc(sizeof(*object) + deferred->resource_count * sizeof(*object->resources)
             + deferred->upload_count * sizeof(*object->uploads)
             + deferred->command_list_count * sizeof(*object->command_lists)
-            + deferred->query_count * sizeof(*object->queries)
-            + deferred->data_size);
+            + deferred->query_count * sizeof(*object->queries));
 
     if (!memory)
     {
@@ -4624,9 +4639,37 @@ HRESULT CDECL wined3d_deferred_context_record_command_list(struct wined3d_device
     memcpy(object->queries, deferred->queries, deferred->query_count * sizeof(*object->queries));
     /* Transfer our references to the queries to the command list. */
 
-    object->data = memory;
+    /* The recorded packets are executed in place on the CS thread, so rather
+     * than copying them, hand the buffer itself over to the command list.
+     * Trim it first if it is mostly unused, since the command list may be
+     * kept around for a long time. */
+    object->data = deferred->data;
     object->data_size = deferred->data_size;
-    memcpy(object->data, deferred->data, deferred->data_size);
+    if (deferred->data_capacity / 2 > deferred->data_size)
+    {
+        void *data;
+
+        if (!deferred->data_size)
+        {
+            free(object->data);
+            object->data = NULL;
+        }
+        else if ((data = realloc(object->data, deferred->data_size)))
+        {
+            object->data = data;
+        }
+    }
+
+    /* Size the new buffer from the recent command lists, so that a single
+     * large list does not make every subsequent one as large. */
+    deferred->data_size_estimate = (deferred->data_size_estimate * 3 + deferred->data_size) / 4;
+    deferred->data_capacity = max(deferred->data_size_estimate, WINED3D_INITIAL_CS_SIZE);
+    if (!(deferred->data = malloc(deferred->data_capacity)))
+    {
+        /* Not fatal; the buffer will be allocated again when recording. */
+        WARN("Failed to allocate %Iu bytes of command data.\n", (size_t)deferred->data_capacity);
+        deferred->data_capacity = 0;
+    }
 
     deferred->data_size = 0;
     deferred->resource_count = 0;
@@ -4690,6 +4733,7 @@ static void wined3d_command_list_destroy_object(void *object)
         }
     }
 
+    free(list->data);
     free(list);
 }
 
@@ -210,6 +210,7 @@ void wined3d_device_cleanup(struct wined3d_device *device)
         wined3d_device_uninit_3d(device);
 
     wined3d_cs_destroy(device->cs);
+    wined3d_transfer_cleanup();
 
     for (i = 0; i < ARRAY_SIZE(device->multistate_funcs); ++i)
     {
@@ -1130,6 +1131,354 @@ void wined3d_device_vk_destroy_null_views(struct wined3d_device_vk *device_vk, s
     wined3d_context_vk_destroy_vk_buffer_view(context_vk, v->vk_view_buffer_uint, id);
 }
 
+#define WINED3D_PIPELINE_CACHE_MAGIC_VK     0x43505657 /* "WVPC" */
+#define WINED3D_PIPELINE_CACHE_VERSION_VK   1
+/* Minimum interval between periodic saves of the pipeline cache, in milliseconds. */
+#define WINED3D_PIPELINE_CACHE_SAVE_INTERVAL_VK 60000
+
+struct wined3d_pipeline_cache_header_vk
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint8_t driver_uuid[VK_UUID_SIZE];
+    uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
+    uint32_t data_size;
+};
+
+static void wined3d_pipeline_cache_vk_init_header(struct wined3d_pipeline_cache_header_vk *header,
+        const struct wined3d_adapter_vk *adapter_vk, uint32_t data_size)
+{
+    header->magic = WINED3D_PIPELINE_CACHE_MAGIC_VK;
+    header->version = WINED3D_PIPELINE_CACHE_VERSION_VK;
+    header->vendor_id = adapter_vk->vendor_id;
+    header->device_id = adapter_vk->device_id;
+    header->driver_version = adapter_vk->driver_version;
+    memcpy(header->driver_uuid, &adapter_vk->a.driver_uuid, sizeof(header->driver_uuid));
+    memcpy(header->pipeline_cache_uuid, adapter_vk->pipeline_cache_uuid, sizeof(header->pipeline_cache_uuid));
+    header->data_size = data_size;
+}
+
+static void *wined3d_pipeline_cache_vk_load(struct wined3d_pipeline_cache_vk *cache,
+        const struct wined3d_adapter_vk *adapter_vk, size_t *data_size)
+{
+    struct wined3d_pipeline_cache_header_vk header, expected;
+    LARGE_INTEGER file_size;
+    void *data = NULL;
+    DWORD size;
+    HANDLE file;
+
+    file = CreateFileA(cache->path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, 0, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= sizeof(header)
+            || !ReadFile(file, &header, sizeof(header), &size, NULL) || size != sizeof(header))
+        goto done;
+
+    wined3d_pipeline_cache_vk_init_header(&expected, adapter_vk, header.data_size);
+    if (memcmp(&header, &expected, sizeof(header)) || header.data_size != file_size.QuadPart - sizeof(header))
+    {
+        WARN("Ignoring pipeline cache %s created for a different driver.\n", debugstr_a(cache->path));
+        goto done;
+    }
+
+    if (!(data = malloc(header.data_size)))
+        goto done;
+    if (!ReadFile(file, data, header.data_size, &size, NULL) || size != header.data_size)
+    {
+        free(data);
+        data = NULL;
+        goto done;
+    }
+    *data_size = header.data_size;
+
+done:
+    CloseHandle(file);
+    return data;
+}
+
+void wined3d_device_vk_init_pipeline_cache(struct wined3d_device_vk *device_vk)
+{
+    const struct wined3d_adapter_vk *adapter_vk = wined3d_adapter_vk_const(device_vk->d.adapter);
+    struct wined3d_pipeline_cache_vk *cache = &device_vk->pipeline_cache;
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+    VkPipelineCacheCreateInfo cache_desc;
+    size_t data_size = 0;
+    void *data = NULL;
+    VkResult vr;
+
+    memset(cache, 0, sizeof(*cache));
+
+    if (!wined3d_get_shader_cache_file_name("vkpc", cache->path, ARRAY_SIZE(cache->path)))
+        cache->path[0] = 0;
+    else
+        data = wined3d_pipeline_cache_vk_load(cache, adapter_vk, &data_size);
+
+    cache_desc.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_desc.pNext = NULL;
+    cache_desc.flags = 0;
+    cache_desc.initialDataSize = data_size;
+    cache_desc.pInitialData = data;
+
+    if ((vr = VK_CALL(vkCreatePipelineCache(device_vk->vk_device, &cache_desc, NULL, &cache->vk_pipeline_cache))) < 0
+            && data)
+    {
+        WARN("Failed to create pipeline cache from %s, vr %s.\n",
+                debugstr_a(cache->path), wined3d_debug_vkresult(vr));
+        cache_desc.initialDataSize = 0;
+        cache_desc.pInitialData = NULL;
+        vr = VK_CALL(vkCreatePipelineCache(device_vk->vk_device, &cache_desc, NULL, &cache->vk_pipeline_cache));
+    }
+    if (vr < 0)
+    {
+        WARN("Failed to create pipeline cache, vr %s.\n", wined3d_debug_vkresult(vr));
+        cache->vk_pipeline_cache = VK_NULL_HANDLE;
+    }
+    else
+    {
+        TRACE("Created pipeline cache 0x%s with %Iu bytes of data from %s.\n",
+                wine_dbgstr_longlong(cache->vk_pipeline_cache), data_size, debugstr_a(cache->path));
+    }
+    cache->save_time = GetTickCount64();
+
+    free(data);
+}
+
+static void wined3d_device_vk_save_pipeline_cache(struct wined3d_device_vk *device_vk)
+{
+    const struct wined3d_adapter_vk *adapter_vk = wined3d_adapter_vk_const(device_vk->d.adapter);
+    struct wined3d_pipeline_cache_vk *cache = &device_vk->pipeline_cache;
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+    struct wined3d_pipeline_cache_header_vk *header;
+    static LONG save_serial;
+    char tmp_path[MAX_PATH + 32];
+    size_t data_size;
+    DWORD size;
+    HANDLE file;
+    VkResult vr;
+    BOOL ret;
+
+    cache->save_time = GetTickCount64();
+    if (!cache->path[0] || !cache->unsaved_count)
+        return;
+
+    if ((vr = VK_CALL(vkGetPipelineCacheData(device_vk->vk_device,
+            cache->vk_pipeline_cache, &data_size, NULL))) < 0 || !data_size || data_size > ~0u - sizeof(*header))
+        return;
+    if (!(header = malloc(sizeof(*header) + data_size)))
+        return;
+    if ((vr = VK_CALL(vkGetPipelineCacheData(device_vk->vk_device,
+            cache->vk_pipeline_cache, &data_size, header + 1))) < 0)
+    {
+        WARN("Failed to get pipeline cache data, vr %s.\n", wined3d_debug_vkresult(vr));
+        free(header);
+        return;
+    }
+    wined3d_pipeline_cache_vk_init_header(header, adapter_vk, data_size);
+
+    /* Write to a temporary file first, so that a concurrent instance of the
+     * application never reads a partially written cache. The name is unique
+     * to this save, so that concurrent saves never write to the same file. */
+    sprintf(tmp_path, "%s.%lx-%lx.tmp", cache->path, GetCurrentProcessId(), InterlockedIncrement(&save_serial));
+    if ((file = CreateFileA(tmp_path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 0, NULL)) == INVALID_HANDLE_VALUE)
+    {
+        WARN("Failed to create %s, error %lu.\n", debugstr_a(tmp_path), GetLastError());
+        free(header);
+        return;
+    }
+    ret = WriteFile(file, header, sizeof(*header) + data_size, &size, NULL) && size == sizeof(*header) + data_size;
+    CloseHandle(file);
+    if (!ret || !MoveFileExA(tmp_path, cache->path, MOVEFILE_REPLACE_EXISTING))
+    {
+        WARN("Failed to write pipeline cache %s, error %lu.\n", debugstr_a(cache->path), GetLastError());
+        DeleteFileA(tmp_path);
+    }
+    else
+    {
+        TRACE("Wrote %Iu bytes to pipeline cache %s.\n", data_size, debugstr_a(cache->path));
+        cache->unsaved_count = 0;
+    }
+    free(header);
+}
+
+void wined3d_device_vk_pipeline_created(struct wined3d_device_vk *device_vk,
+        const VkPipelineCreationFeedback *feedback)
+{
+    struct wined3d_pipeline_cache_vk *cache = &device_vk->pipeline_cache;
+
+    ++cache->created_count;
+    ++cache->unsaved_count;
+    if (feedback && (feedback->flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT))
+    {
+        if (feedback->flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT)
+            ++cache->hit_count;
+        else
+            ++cache->miss_count;
+    }
+
+    if (GetTickCount64() - cache->save_time >= WINED3D_PIPELINE_CACHE_SAVE_INTERVAL_VK)
+        wined3d_device_vk_save_pipeline_cache(device_vk);
+}
+
+void wined3d_device_vk_cleanup_pipeline_cache(struct wined3d_device_vk *device_vk)
+{
+    struct wined3d_pipeline_cache_vk *cache = &device_vk->pipeline_cache;
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+
+    if (!cache->vk_pipeline_cache)
+        return;
+
+    TRACE_(d3d_perf)("Created %u pipelines, %u pipeline cache hits, %u misses.\n",
+            cache->created_count, cache->hit_count, cache->miss_count);
+
+    wined3d_device_vk_save_pipeline_cache(device_vk);
+    VK_CALL(vkDestroyPipelineCache(device_vk->vk_device, cache->vk_pipeline_cache, NULL));
+    cache->vk_pipeline_cache = VK_NULL_HANDLE;
+}
+
+static DWORD WINAPI wined3d_pipeline_compiler_vk_thread(void *ctx)
+{
+    struct wined3d_device_vk *device_vk = ctx;
+    struct wined3d_pipeline_compiler_vk *compiler = &device_vk->pipeline_compiler;
+    struct wined3d_graphics_pipeline_vk *pipeline_vk;
+    struct list *entry;
+
+    SetThreadDescription(GetCurrentThread(), L"wined3d_pipeline_compiler");
+
+    AcquireSRWLockExclusive(&compiler->lock);
+    for (;;)
+    {
+        while (!(entry = list_head(&compiler->jobs)) && !compiler->shutdown)
+            SleepConditionVariableSRW(&compiler->job_cv, &compiler->lock, INFINITE, 0);
+        if (!entry)
+            break;
+
+        list_remove(entry);
+        ++compiler->busy_count;
+        ReleaseSRWLockExclusive(&compiler->lock);
+
+        pipeline_vk = LIST_ENTRY(entry, struct wined3d_graphics_pipeline_vk, compile_entry);
+        wined3d_graphics_pipeline_vk_create(device_vk, pipeline_vk);
+
+        AcquireSRWLockExclusive(&compiler->lock);
+        pipeline_vk->pending = false;
+        --compiler->busy_count;
+        WakeAllConditionVariable(&compiler->done_cv);
+    }
+    ReleaseSRWLockExclusive(&compiler->lock);
+
+    return 0;
+}
+
+void wined3d_device_vk_init_pipeline_compiler(struct wined3d_device_vk *device_vk)
+{
+    struct wined3d_pipeline_compiler_vk *compiler = &device_vk->pipeline_compiler;
+    unsigned int i, count;
+    SYSTEM_INFO info;
+
+    memset(compiler, 0, sizeof(*compiler));
+    InitializeSRWLock(&compiler->lock);
+    InitializeConditionVariable(&compiler->job_cv);
+    InitializeConditionVariable(&compiler->done_cv);
+    list_init(&compiler->jobs);
+
+    if (!wined3d_settings.async_pipelines)
+        return;
+
+    GetSystemInfo(&info);
+    count = min(max((info.dwNumberOfProcessors + 1) / 2, 1), ARRAY_SIZE(compiler->threads));
+    for (i = 0; i < count; ++i)
+    {
+        if (!(compiler->threads[i] = CreateThread(NULL, 0, wined3d_pipeline_compiler_vk_thread, device_vk, 0, NULL)))
+        {
+            ERR("Failed to create pipeline compiler thread, error %lu.\n", GetLastError());
+            break;
+        }
+    }
+    compiler->thread_count = i;
+
+    TRACE("Using %u pipeline compiler threads.\n", compiler->thread_count);
+}
+
+void wined3d_device_vk_cleanup_pipeline_compiler(struct wined3d_device_vk *device_vk)
+{
+    struct wined3d_pipeline_compiler_vk *compiler = &device_vk->pipeline_compiler;
+    unsigned int i;
+
+    if (!compiler->thread_count)
+        return;
+
+    AcquireSRWLockExclusive(&compiler->lock);
+    compiler->shutdown = true;
+    WakeAllConditionVariable(&compiler->job_cv);
+    ReleaseSRWLockExclusive(&compiler->lock);
+
+    WaitForMultipleObjects(compiler->thread_count, compiler->threads, TRUE, INFINITE);
+    for (i = 0; i < compiler->thread_count; ++i)
+        CloseHandle(compiler->threads[i]);
+
+    TRACE_(d3d_perf)("Created %u pipelines asynchronously, skipped %u draws.\n",
+            compiler->queued_count, compiler->skipped_draw_count);
+}
+
+/* Returns false if the pipeline should be created synchronously. */
+bool wined3d_device_vk_queue_graphics_pipeline(struct wined3d_device_vk *device_vk,
+        struct wined3d_graphics_pipeline_vk *pipeline_vk)
+{
+    struct wined3d_pipeline_compiler_vk *compiler = &device_vk->pipeline_compiler;
+
+    if (!compiler->thread_count)
+        return false;
+
+    AcquireSRWLockExclusive(&compiler->lock);
+    pipeline_vk->pending = true;
+    list_add_tail(&compiler->jobs, &pipeline_vk->compile_entry);
+    ++compiler->queued_count;
+    WakeConditionVariable(&compiler->job_cv);
+    ReleaseSRWLockExclusive(&compiler->lock);
+
+    return true;
+}
+
+/* Wait for up to "timeout" milliseconds for a queued pipeline to be created.
+ * Returns false if the pipeline is still pending. */
+bool wined3d_device_vk_wait_graphics_pipeline(struct wined3d_device_vk *device_vk,
+        struct wined3d_graphics_pipeline_vk *pipeline_vk, unsigned int timeout)
+{
+    struct wined3d_pipeline_compiler_vk *compiler = &device_vk->pipeline_compiler;
+    ULONGLONG end, now;
+    bool pending;
+
+    if (!compiler->thread_count)
+        return true;
+
+    end = GetTickCount64() + timeout;
+    AcquireSRWLockExclusive(&compiler->lock);
+    while ((pending = pipeline_vk->pending) && (now = GetTickCount64()) < end)
+        SleepConditionVariableSRW(&compiler->done_cv, &compiler->lock, end - now, 0);
+    ReleaseSRWLockExclusive(&compiler->lock);
+
+    return !pending;
+}
+
+/* Shader modules and pipeline layouts referenced by queued pipelines must
+ * not be destroyed until the pipeline has been created. */
+void wined3d_device_vk_wait_pipeline_compiler_idle(struct wined3d_device_vk *device_vk)
+{
+    struct wined3d_pipeline_compiler_vk *compiler = &device_vk->pipeline_compiler;
+
+    if (!compiler->thread_count)
+        return;
+
+    AcquireSRWLockExclusive(&compiler->lock);
+    while (!list_empty(&compiler->jobs) || compiler->busy_count)
+        SleepConditionVariableSRW(&compiler->done_cv, &compiler->lock, INFINITE, 0);
+    ReleaseSRWLockExclusive(&compiler->lock);
+}
+
 HRESULT CDECL wined3d_device_acquire_focus_window(struct wined3d_device *device, HWND window)
 {
     unsigned int screensaver_active;
@@ -5577,6 +5926,7 @@ HRESULT wined3d_device_init(struct wined3d_device *device, struct wined3d *wined
     }
 
     wined3d_lock_init(&device->bo_map_lock, "wined3d_device.bo_map_lock");
+    wined3d_transfer_init();
 
     return WINED3D_OK;
 
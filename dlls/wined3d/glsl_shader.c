@@ -37,6 +37,7 @@
 
 WINE_DEFAULT_DEBUG_CHANNEL(d3d_shader);
 WINE_DECLARE_DEBUG_CHANNEL(d3d);
+WINE_DECLARE_DEBUG_CHANNEL(d3d_perf);
 WINE_DECLARE_DEBUG_CHANNEL(winediag);
 
 #define WINED3D_GLSL_SAMPLE_PROJECTED   0x01
@@ -122,6 +123,23 @@ struct constant_heap
     unsigned int size;
 };
 
+/* On-disk cache of linked program binaries. Entries are stored one per file,
+ * named after a hash of the attached shader sources, the GL driver strings
+ * and the Wine build. */
+struct glsl_program_cache
+{
+    bool initialised;
+    char path[MAX_PATH];
+    uint64_t driver_hash[2];
+
+    unsigned int hit_count;
+    unsigned int miss_count;
+    unsigned int reject_count;
+    unsigned int store_count;
+    uint64_t read_size;
+    uint64_t write_size;
+};
+
 /* GLSL shader private data */
 struct shader_glsl_priv
 {
@@ -140,6 +158,8 @@ struct shader_glsl_priv
     struct wine_rb_tree ffp_vertex_shaders;
     struct wine_rb_tree ffp_fragment_shaders;
     BOOL legacy_lighting;
+
+    struct glsl_program_cache program_cache;
 };
 
 struct glsl_vs_program
@@ -537,6 +557,7 @@ void print_glsl_info_log(const struct wined3d_gl_info *gl_info, GLuint id, BOOL
 static void shader_glsl_compile(const struct wined3d_gl_info *gl_info, GLuint shader, const char *src)
 {
     const char *ptr, *end, *line;
+    uint64_t profile_start;
 
     TRACE("Compiling shader object %u.\n", shader);
 
@@ -552,9 +573,11 @@ static void shader_glsl_compile(const struct wined3d_gl_info *gl_info, GLuint sh
 
     GL_EXTCALL(glShaderSource(shader, 1, &src, NULL));
     checkGLcall("glShaderSource");
+    profile_start = wined3d_profile_begin();
     GL_EXTCALL(glCompileShader(shader));
     checkGLcall("glCompileShader");
     print_glsl_info_log(gl_info, shader, FALSE);
+    wined3d_profile_end("GLSL compile", profile_start);
 }
 
 /* Context activation is done by the caller. */
@@ -631,6 +654,431 @@ void shader_glsl_validate_link(const struct wined3d_gl_info *gl_info, GLuint pro
     print_glsl_info_log(gl_info, program, TRUE);
 }
 
+#define GLSL_PROGRAM_CACHE_MAGIC    0x50475747 /* "GWGP" */
+#define GLSL_PROGRAM_CACHE_VERSION  2
+
+struct glsl_program_cache_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key_hash;
+    uint64_t key_size;
+    uint32_t binary_format;
+    uint32_t binary_size;
+};
+
+struct glsl_program_cache_key
+{
+    uint64_t hash[2];
+    uint64_t size;
+};
+
+struct glsl_program_cache_shader
+{
+    GLint type;
+    GLuint id;
+    struct glsl_program_cache_key source;
+};
+
+struct glsl_program_cache_file
+{
+    ULONGLONG time;
+    uint64_t size;
+    char name[MAX_PATH];
+};
+
+/* Two FNV-1a hashes with different offset bases. The first one names the
+ * file, the second one is stored in the file and checked on load. */
+static void glsl_program_cache_key_update(struct glsl_program_cache_key *key, const void *data, size_t size)
+{
+    const unsigned char *ptr = data;
+    size_t i;
+
+    for (i = 0; i < size; ++i)
+    {
+        key->hash[0] = (key->hash[0] ^ ptr[i]) * 0x100000001b3ull;
+        key->hash[1] = (key->hash[1] ^ ptr[i]) * 0x100000001b3ull;
+    }
+    key->size += size;
+}
+
+static void glsl_program_cache_key_update_string(struct glsl_program_cache_key *key, const char *str)
+{
+    if (str)
+        glsl_program_cache_key_update(key, str, strlen(str) + 1);
+    else
+        glsl_program_cache_key_update(key, "", 1);
+}
+
+/* Context activation is done by the caller. */
+static void glsl_program_cache_init(struct glsl_program_cache *cache, const struct wined3d_gl_info *gl_info)
+{
+    const char * (CDECL *wine_get_build_id)(void);
+    struct glsl_program_cache_key key;
+    GLint format_count = 0;
+
+    cache->initialised = true;
+    cache->path[0] = 0;
+
+    if (!gl_info->supported[ARB_GET_PROGRAM_BINARY] || !wined3d_settings.shader_cache_size)
+        return;
+    gl_info->gl_ops.gl.p_glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+    if (!format_count)
+    {
+        TRACE("The GL driver doesn't support any program binary formats.\n");
+        return;
+    }
+
+    if (!wined3d_get_shader_cache_file_name("glsl", cache->path, ARRAY_SIZE(cache->path)))
+    {
+        cache->path[0] = 0;
+        return;
+    }
+    if (!CreateDirectoryA(cache->path, NULL) && GetLastError() != ERROR_ALREADY_EXISTS)
+    {
+        WARN("Failed to create program cache directory %s, error %lu.\n", debugstr_a(cache->path), GetLastError());
+        cache->path[0] = 0;
+        return;
+    }
+
+    key.hash[0] = 0xcbf29ce484222325ull;
+    key.hash[1] = 0x84222325cbf29ce4ull;
+    key.size = 0;
+    wine_get_build_id = (void *)GetProcAddress(GetModuleHandleW(L"ntdll.dll"), "wine_get_build_id");
+    glsl_program_cache_key_update_string(&key, wine_get_build_id ? wine_get_build_id() : NULL);
+    glsl_program_cache_key_update_string(&key, (const char *)gl_info->gl_ops.gl.p_glGetString(GL_VENDOR));
+    glsl_program_cache_key_update_string(&key, (const char *)gl_info->gl_ops.gl.p_glGetString(GL_RENDERER));
+    glsl_program_cache_key_update_string(&key, (const char *)gl_info->gl_ops.gl.p_glGetString(GL_VERSION));
+    cache->driver_hash[0] = key.hash[0];
+    cache->driver_hash[1] = key.hash[1];
+
+    TRACE("Using program binary cache %s.\n", debugstr_a(cache->path));
+}
+
+static int __cdecl glsl_program_cache_shader_compare(const void *a, const void *b)
+{
+    const struct glsl_program_cache_shader *s1 = a, *s2 = b;
+    int ret;
+
+    if ((ret = wined3d_uint32_compare(s1->type, s2->type)))
+        return ret;
+    if ((ret = wined3d_uint64_compare(s1->source.hash[0], s2->source.hash[0])))
+        return ret;
+    if ((ret = wined3d_uint64_compare(s1->source.hash[1], s2->source.hash[1])))
+        return ret;
+    return wined3d_uint64_compare(s1->source.size, s2->source.size);
+}
+
+/* Context activation is done by the caller. */
+static bool glsl_program_cache_get_key(const struct glsl_program_cache *cache,
+        const struct wined3d_gl_info *gl_info, GLuint program, uint32_t variant, struct glsl_program_cache_key *key)
+{
+    struct glsl_program_cache_shader *shaders;
+    GLint i, shader_count, source_size = 0;
+    char *source = NULL;
+    GLuint *shader_ids;
+    bool ret = false;
+    GLint length;
+
+    key->hash[0] = cache->driver_hash[0];
+    key->hash[1] = cache->driver_hash[1];
+    key->size = 0;
+    glsl_program_cache_key_update(key, &variant, sizeof(variant));
+
+    GL_EXTCALL(glGetProgramiv(program, GL_ATTACHED_SHADERS, &shader_count));
+    if (!shader_count || !(shader_ids = calloc(shader_count, sizeof(*shader_ids))))
+        return false;
+    if (!(shaders = calloc(shader_count, sizeof(*shaders))))
+    {
+        free(shader_ids);
+        return false;
+    }
+
+    /* The order of attached shaders is implementation defined, so sort them
+     * by type, and then by source. There is at most one shader of each type,
+     * except for the vertex shader rasterizer input setup, which is a separate
+     * vertex shader. */
+    GL_EXTCALL(glGetAttachedShaders(program, shader_count, &shader_count, shader_ids));
+    for (i = 0; i < shader_count; ++i)
+    {
+        shaders[i].id = shader_ids[i];
+        GL_EXTCALL(glGetShaderiv(shaders[i].id, GL_SHADER_TYPE, &shaders[i].type));
+        GL_EXTCALL(glGetShaderiv(shaders[i].id, GL_SHADER_SOURCE_LENGTH, &length));
+        if (length <= 0)
+            goto done;
+        if (source_size < length)
+        {
+            free(source);
+            if (!(source = malloc(length)))
+                goto done;
+            source_size = length;
+        }
+        GL_EXTCALL(glGetShaderSource(shaders[i].id, source_size, &length, source));
+        shaders[i].source.hash[0] = 0xcbf29ce484222325ull;
+        shaders[i].source.hash[1] = 0x84222325cbf29ce4ull;
+        shaders[i].source.size = 0;
+        glsl_program_cache_key_update(&shaders[i].source, source, length);
+    }
+    qsort(shaders, shader_count, sizeof(*shaders), glsl_program_cache_shader_compare);
+
+    for (i = 0; i < shader_count; ++i)
+    {
+        glsl_program_cache_key_update(key, &shaders[i].type, sizeof(shaders[i].type));
+        glsl_program_cache_key_update(key, &shaders[i].source, sizeof(shaders[i].source));
+    }
+    ret = true;
+
+done:
+    free(shader_ids);
+    free(source);
+    free(shaders);
+    return ret;
+}
+
+static void glsl_program_cache_get_file_name(const struct glsl_program_cache *cache,
+        const struct glsl_program_cache_key *key, char *path, unsigned int size)
+{
+    snprintf(path, size, "%s\\%08x%08x.bin", cache->path, (uint32_t)(key->hash[0] >> 32), (uint32_t)key->hash[0]);
+}
+
+/* Context activation is done by the caller. */
+static bool glsl_program_cache_load(struct glsl_program_cache *cache, const struct wined3d_gl_info *gl_info,
+        GLuint program, const struct glsl_program_cache_key *key)
+{
+    struct glsl_program_cache_header header;
+    LARGE_INTEGER file_size;
+    char path[MAX_PATH];
+    FILETIME now;
+    void *binary;
+    GLint status;
+    DWORD size;
+    HANDLE file;
+
+    glsl_program_cache_get_file_name(cache, key, path, ARRAY_SIZE(path));
+    file = CreateFileA(path, GENERIC_READ | FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ, NULL, OPEN_EXISTING, 0, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= sizeof(header)
+            || !ReadFile(file, &header, sizeof(header), &size, NULL) || size != sizeof(header)
+            || header.magic != GLSL_PROGRAM_CACHE_MAGIC || header.version != GLSL_PROGRAM_CACHE_VERSION
+            || header.key_hash != key->hash[1] || header.key_size != key->size
+            || header.binary_size != file_size.QuadPart - sizeof(header))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    if (!(binary = malloc(header.binary_size)))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    if (!ReadFile(file, binary, header.binary_size, &size, NULL) || size != header.binary_size)
+    {
+        free(binary);
+        CloseHandle(file);
+        return false;
+    }
+
+    GL_EXTCALL(glProgramBinary(program, header.binary_format, binary, header.binary_size));
+    free(binary);
+    GL_EXTCALL(glGetProgramiv(program, GL_LINK_STATUS, &status));
+    if (!status)
+    {
+        /* Typically the result of a driver update that wasn't reflected in
+         * the version string. The entry is overwritten after linking. */
+        TRACE("Driver rejected program binary %s.\n", debugstr_a(path));
+        ++cache->reject_count;
+        CloseHandle(file);
+        return false;
+    }
+
+    /* The modification time is used for LRU eviction. */
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(file, NULL, NULL, &now);
+    CloseHandle(file);
+
+    cache->read_size += header.binary_size;
+    return true;
+}
+
+/* Context activation is done by the caller. */
+static void glsl_program_cache_store(struct glsl_program_cache *cache, const struct wined3d_gl_info *gl_info,
+        GLuint program, const struct glsl_program_cache_key *key)
+{
+    struct glsl_program_cache_header *header;
+    char path[MAX_PATH], tmp_path[MAX_PATH + 32];
+    static LONG store_serial;
+    GLint binary_size;
+    GLenum format;
+    DWORD size;
+    HANDLE file;
+    BOOL ret;
+
+    GL_EXTCALL(glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binary_size));
+    if (binary_size <= 0 || !(header = malloc(sizeof(*header) + binary_size)))
+        return;
+    GL_EXTCALL(glGetProgramBinary(program, binary_size, &binary_size, &format, header + 1));
+    checkGLcall("glGetProgramBinary");
+    if (binary_size <= 0)
+    {
+        free(header);
+        return;
+    }
+
+    header->magic = GLSL_PROGRAM_CACHE_MAGIC;
+    header->version = GLSL_PROGRAM_CACHE_VERSION;
+    header->key_hash = key->hash[1];
+    header->key_size = key->size;
+    header->binary_format = format;
+    header->binary_size = binary_size;
+
+    /* Write to a temporary file first, so that a concurrent instance of the
+     * application never reads a partially written entry. The name is unique
+     * to this store, so that devices storing the same program don't write to
+     * the same file. */
+    glsl_program_cache_get_file_name(cache, key, path, ARRAY_SIZE(path));
+    snprintf(tmp_path, ARRAY_SIZE(tmp_path), "%s.%lx-%lx.tmp", path,
+            GetCurrentProcessId(), InterlockedIncrement(&store_serial));
+    if ((file = CreateFileA(tmp_path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 0, NULL)) == INVALID_HANDLE_VALUE)
+    {
+        WARN("Failed to create %s, error %lu.\n", debugstr_a(tmp_path), GetLastError());
+        free(header);
+        return;
+    }
+    ret = WriteFile(file, header, sizeof(*header) + binary_size, &size, NULL)
+            && size == sizeof(*header) + binary_size;
+    CloseHandle(file);
+    if (!ret || !MoveFileExA(tmp_path, path, MOVEFILE_REPLACE_EXISTING))
+    {
+        WARN("Failed to write program binary %s, error %lu.\n", debugstr_a(path), GetLastError());
+        DeleteFileA(tmp_path);
+    }
+    else
+    {
+        ++cache->store_count;
+        cache->write_size += binary_size;
+    }
+    free(header);
+}
+
+static int __cdecl glsl_program_cache_file_compare(const void *a, const void *b)
+{
+    const struct glsl_program_cache_file *f1 = a, *f2 = b;
+
+    if (f1->time != f2->time)
+        return f1->time < f2->time ? -1 : 1;
+    return 0;
+}
+
+/* Remove the least recently used entries until the cache fits in the
+ * configured size. */
+static void glsl_program_cache_evict(const struct glsl_program_cache *cache)
+{
+    struct glsl_program_cache_file *files = NULL, *file;
+    SIZE_T count = 0, capacity = 0, i;
+    uint64_t total_size = 0, max_size;
+    WIN32_FIND_DATAA data;
+    char path[MAX_PATH];
+    HANDLE handle;
+
+    max_size = (uint64_t)wined3d_settings.shader_cache_size << 20;
+
+    snprintf(path, ARRAY_SIZE(path), "%s\\*.bin", cache->path);
+    if ((handle = FindFirstFileA(path, &data)) == INVALID_HANDLE_VALUE)
+        return;
+    do
+    {
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            continue;
+        if (!wined3d_array_reserve((void **)&files, &capacity, count + 1, sizeof(*files)))
+            break;
+        file = &files[count++];
+        file->time = ((ULONGLONG)data.ftLastWriteTime.dwHighDateTime << 32) | data.ftLastWriteTime.dwLowDateTime;
+        file->size = ((uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+        lstrcpynA(file->name, data.cFileName, ARRAY_SIZE(file->name));
+        total_size += file->size;
+    } while (FindNextFileA(handle, &data));
+    FindClose(handle);
+
+    if (total_size > max_size)
+    {
+        qsort(files, count, sizeof(*files), glsl_program_cache_file_compare);
+        for (i = 0; i < count && total_size > max_size; ++i)
+        {
+            snprintf(path, ARRAY_SIZE(path), "%s\\%s", cache->path, files[i].name);
+            if (DeleteFileA(path))
+                total_size -= files[i].size;
+        }
+        TRACE_(d3d_perf)("Evicted %Iu program binaries, %s bytes remaining.\n",
+                i, wine_dbgstr_longlong(total_size));
+    }
+
+    free(files);
+}
+
+static void glsl_program_cache_cleanup(struct glsl_program_cache *cache)
+{
+    if (!cache->initialised || !cache->path[0])
+        return;
+
+    TRACE_(d3d_perf)("Program binary cache %s: %u hits, %u misses, %u rejected, %u stored, "
+            "%s bytes read, %s bytes written.\n", debugstr_a(cache->path),
+            cache->hit_count, cache->miss_count, cache->reject_count, cache->store_count,
+            wine_dbgstr_longlong(cache->read_size), wine_dbgstr_longlong(cache->write_size));
+
+    if (cache->store_count)
+        glsl_program_cache_evict(cache);
+}
+
+/* Link a program, using the program binary cache when possible. "variant"
+ * identifies any pre-link program state that isn't reflected in the shader
+ * sources. Programs with state that can't be described by "variant", e.g.
+ * transform feedback varyings, should pass "cacheable" as false.
+ *
+ * Context activation is done by the caller. */
+static void shader_glsl_link_program(struct shader_glsl_priv *priv, const struct wined3d_gl_info *gl_info,
+        GLuint program_id, bool cacheable, uint32_t variant)
+{
+    struct glsl_program_cache *cache = &priv->program_cache;
+    struct glsl_program_cache_key key;
+    uint64_t profile_start;
+    GLint status;
+
+    if (!cache->initialised)
+        glsl_program_cache_init(cache, gl_info);
+
+    if (!cacheable || !cache->path[0] || !glsl_program_cache_get_key(cache, gl_info, program_id, variant, &key))
+    {
+        TRACE("Linking GLSL shader program %u.\n", program_id);
+        profile_start = wined3d_profile_begin();
+        GL_EXTCALL(glLinkProgram(program_id));
+        shader_glsl_validate_link(gl_info, program_id);
+        wined3d_profile_end("GLSL link", profile_start);
+        return;
+    }
+
+    if (glsl_program_cache_load(cache, gl_info, program_id, &key))
+    {
+        TRACE("Loaded GLSL shader program %u from the program binary cache.\n", program_id);
+        ++cache->hit_count;
+        return;
+    }
+    ++cache->miss_count;
+
+    TRACE("Linking GLSL shader program %u.\n", program_id);
+    GL_EXTCALL(glProgramParameteri(program_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+    profile_start = wined3d_profile_begin();
+    GL_EXTCALL(glLinkProgram(program_id));
+    shader_glsl_validate_link(gl_info, program_id);
+    wined3d_profile_end("GLSL link", profile_start);
+
+    GL_EXTCALL(glGetProgramiv(program_id, GL_LINK_STATUS, &status));
+    if (status)
+        glsl_program_cache_store(cache, gl_info, program_id, &key);
+}
+
 static struct vkd3d_shader_resource_binding *create_resource_bindings(const struct wined3d_gl_info *gl_info,
         enum wined3d_shader_type shader_type, unsigned int *count)
 {
@@ -10428,9 +10876,7 @@ static HRESULT shader_glsl_compile_compute_shader(struct shader_glsl_priv *priv,
 
     list_add_head(&shader->linked_programs, &entry->cs.shader_entry);
 
-    TRACE("Linking GLSL shader program %u.\n", program_id);
-    GL_EXTCALL(glLinkProgram(program_id));
-    shader_glsl_validate_link(gl_info, program_id);
+    shader_glsl_link_program(priv, gl_info, program_id, true, 0);
 
     GL_EXTCALL(glUseProgram(program_id));
     checkGLcall("glUseProgram");
@@ -10755,9 +11201,8 @@ static void set_glsl_shader_program(const struct wined3d_context_gl *context_gl,
     }
 
     /* Link the program */
-    TRACE("Linking GLSL shader program %u.\n", program_id);
-    GL_EXTCALL(glLinkProgram(program_id));
-    shader_glsl_validate_link(gl_info, program_id);
+    shader_glsl_link_program(priv, gl_info, program_id, !gshader || !gshader->u.gs.so_desc,
+            state->blend_state && state->blend_state->dual_source);
 
     shader_glsl_init_vs_uniform_locations(gl_info, priv, program_id, &entry->vs,
             vshader ? vshader->limits->constant_float : 0);
@@ -11398,6 +11843,7 @@ static void shader_glsl_free(struct wined3d_device *device, struct wined3d_conte
 {
     struct shader_glsl_priv *priv = device->shader_priv;
 
+    glsl_program_cache_cleanup(&priv->program_cache);
     wine_rb_destroy(&priv->program_lookup, NULL, NULL);
     constant_free(&priv->pconst_heap);
     constant_free(&priv->vconst_heap);
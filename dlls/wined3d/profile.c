@@ -0,0 +1,224 @@
+/*
+ * Direct3D frame profiler
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include <stdio.h>
+
+#include "wined3d_private.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(d3d);
+WINE_DECLARE_DEBUG_CHANNEL(winediag);
+
+/* The frame profiler records CPU spans, frame markers and GPU counters, and
+ * writes them to the file given by the "profile_path" setting in the Chrome
+ * trace event format. The file can be loaded in chrome://tracing or Perfetto.
+ * Events are buffered and written out whenever the buffer fills up. The
+ * closing bracket of the event array is optional, so the file stays valid if
+ * the process is killed. */
+
+#define WINED3D_PROFILE_EVENT_COUNT 4096
+
+enum wined3d_profile_event_type
+{
+    WINED3D_PROFILE_EVENT_SPAN,
+    WINED3D_PROFILE_EVENT_FRAME,
+    WINED3D_PROFILE_EVENT_COUNTER,
+};
+
+struct wined3d_profile_event
+{
+    enum wined3d_profile_event_type type;
+    const char *name;
+    DWORD tid;
+    uint64_t start;
+    union
+    {
+        uint64_t end;
+        double value;
+    } u;
+};
+
+bool wined3d_profile_enabled;
+
+static struct
+{
+    SRWLOCK lock;
+    HANDLE file;
+    LARGE_INTEGER frequency;
+    uint64_t origin;
+    DWORD pid;
+    unsigned int frame;
+    unsigned int event_count;
+    struct wined3d_profile_event events[WINED3D_PROFILE_EVENT_COUNT];
+}
+*wined3d_profile;
+
+static double wined3d_profile_us(uint64_t time)
+{
+    return (double)(time - wined3d_profile->origin) * 1000000.0 / wined3d_profile->frequency.QuadPart;
+}
+
+static void wined3d_profile_write_events(void)
+{
+    const struct wined3d_profile_event *event;
+    char buffer[256];
+    unsigned int i;
+    DWORD written;
+    int len;
+
+    for (i = 0; i < wined3d_profile->event_count; ++i)
+    {
+        event = &wined3d_profile->events[i];
+        switch (event->type)
+        {
+            case WINED3D_PROFILE_EVENT_SPAN:
+                len = snprintf(buffer, sizeof(buffer),
+                        "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%lu,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f},\n",
+                        event->name, wined3d_profile->pid, event->tid, wined3d_profile_us(event->start),
+                        wined3d_profile_us(event->u.end) - wined3d_profile_us(event->start));
+                break;
+
+            case WINED3D_PROFILE_EVENT_FRAME:
+                len = snprintf(buffer, sizeof(buffer),
+                        "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"p\",\"pid\":%lu,\"tid\":%lu,\"ts\":%.3f},\n",
+                        event->name, wined3d_profile->pid, event->tid, wined3d_profile_us(event->start));
+                break;
+
+            case WINED3D_PROFILE_EVENT_COUNTER:
+                len = snprintf(buffer, sizeof(buffer),
+                        "{\"name\":\"%s\",\"ph\":\"C\",\"pid\":%lu,\"ts\":%.3f,\"args\":{\"value\":%.3f}},\n",
+                        event->name, wined3d_profile->pid, wined3d_profile_us(event->start), event->u.value);
+                break;
+
+            default:
+                continue;
+        }
+        if (len > 0 && len < sizeof(buffer))
+            WriteFile(wined3d_profile->file, buffer, len, &written, NULL);
+    }
+    wined3d_profile->event_count = 0;
+}
+
+static struct wined3d_profile_event *wined3d_profile_add_event(enum wined3d_profile_event_type type,
+        const char *name, uint64_t start)
+{
+    struct wined3d_profile_event *event;
+
+    if (wined3d_profile->event_count == ARRAY_SIZE(wined3d_profile->events))
+        wined3d_profile_write_events();
+
+    event = &wined3d_profile->events[wined3d_profile->event_count++];
+    event->type = type;
+    event->name = name;
+    event->tid = GetCurrentThreadId();
+    event->start = start;
+    return event;
+}
+
+uint64_t wined3d_profile_time(void)
+{
+    LARGE_INTEGER counter;
+
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+}
+
+void wined3d_profile_record_span(const char *name, uint64_t start)
+{
+    uint64_t end = wined3d_profile_time();
+
+    AcquireSRWLockExclusive(&wined3d_profile->lock);
+    wined3d_profile_add_event(WINED3D_PROFILE_EVENT_SPAN, name, start)->u.end = end;
+    ReleaseSRWLockExclusive(&wined3d_profile->lock);
+}
+
+void wined3d_profile_record_counter(const char *name, double value)
+{
+    uint64_t time;
+
+    if (!wined3d_profile_enabled)
+        return;
+
+    time = wined3d_profile_time();
+    AcquireSRWLockExclusive(&wined3d_profile->lock);
+    wined3d_profile_add_event(WINED3D_PROFILE_EVENT_COUNTER, name, time)->u.value = value;
+    ReleaseSRWLockExclusive(&wined3d_profile->lock);
+}
+
+void wined3d_profile_record_frame(void)
+{
+    uint64_t time;
+
+    if (!wined3d_profile_enabled)
+        return;
+
+    time = wined3d_profile_time();
+    AcquireSRWLockExclusive(&wined3d_profile->lock);
+    wined3d_profile_add_event(WINED3D_PROFILE_EVENT_FRAME, "present", time);
+    ++wined3d_profile->frame;
+    ReleaseSRWLockExclusive(&wined3d_profile->lock);
+}
+
+void wined3d_profile_init(void)
+{
+    static const char header[] = "[\n";
+    DWORD written;
+    HANDLE file;
+
+    if (!wined3d_settings.profile_path)
+        return;
+
+    if ((file = CreateFileA(wined3d_settings.profile_path, GENERIC_WRITE, FILE_SHARE_READ,
+            NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL)) == INVALID_HANDLE_VALUE)
+    {
+        ERR("Failed to create profile file %s, error %lu.\n",
+                debugstr_a(wined3d_settings.profile_path), GetLastError());
+        return;
+    }
+
+    if (!(wined3d_profile = calloc(1, sizeof(*wined3d_profile))))
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    InitializeSRWLock(&wined3d_profile->lock);
+    wined3d_profile->file = file;
+    QueryPerformanceFrequency(&wined3d_profile->frequency);
+    wined3d_profile->origin = wined3d_profile_time();
+    wined3d_profile->pid = GetCurrentProcessId();
+    WriteFile(file, header, sizeof(header) - 1, &written, NULL);
+
+    ERR_(winediag)("Writing frame profile to %s.\n", debugstr_a(wined3d_settings.profile_path));
+    wined3d_profile_enabled = true;
+}
+
+void wined3d_profile_cleanup(void)
+{
+    if (!wined3d_profile)
+        return;
+
+    wined3d_profile_enabled = false;
+    AcquireSRWLockExclusive(&wined3d_profile->lock);
+    wined3d_profile_write_events();
+    TRACE("Recorded %u frames.\n", wined3d_profile->frame);
+    CloseHandle(wined3d_profile->file);
+    ReleaseSRWLockExclusive(&wined3d_profile->lock);
+
+    free(wined3d_profile);
+    wined3d_profile = NULL;
+}
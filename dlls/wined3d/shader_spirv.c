@@ -359,6 +359,7 @@ static VkShaderModule shader_spirv_compile_shader(struct wined3d_context_vk *con
     VkShaderModuleCreateInfo shader_create_info;
     struct vkd3d_shader_compile_info info;
     struct vkd3d_shader_code spirv;
+    uint64_t profile_start;
     VkShaderModule module;
     char *messages;
     VkResult vr;
@@ -379,7 +380,9 @@ static VkShaderModule shader_spirv_compile_shader(struct wined3d_context_vk *con
     info.log_level = VKD3D_SHADER_LOG_WARNING;
     info.source_name = NULL;
 
+    profile_start = wined3d_profile_begin();
     ret = vkd3d_shader_compile(&info, &spirv, &messages);
+    wined3d_profile_end("SPIR-V compile", profile_start);
     if (messages && *messages && FIXME_ON(d3d_shader))
     {
         const char *ptr, *end, *line;
@@ -523,13 +526,14 @@ static struct shader_spirv_compute_program_vk *shader_spirv_find_compute_program
     pipeline_info.basePipelineHandle = VK_NULL_HANDLE;
     pipeline_info.basePipelineIndex = -1;
     if ((vr = VK_CALL(vkCreateComputePipelines(device_vk->vk_device,
-            VK_NULL_HANDLE, 1, &pipeline_info, NULL, &program->vk_pipeline))) < 0)
+            device_vk->pipeline_cache.vk_pipeline_cache, 1, &pipeline_info, NULL, &program->vk_pipeline))) < 0)
     {
         ERR("Failed to create Vulkan compute pipeline, vr %s.\n", wined3d_debug_vkresult(vr));
         VK_CALL(vkDestroyShaderModule(device_vk->vk_device, program->vk_module, NULL));
         program->vk_module = VK_NULL_HANDLE;
         return NULL;
     }
+    wined3d_device_vk_pipeline_created(device_vk, NULL);
 
     return program;
 }
@@ -1112,6 +1116,7 @@ static void shader_spirv_destroy(struct wined3d_shader *shader)
     }
 
     program_vk = shader->backend_data;
+    wined3d_device_vk_wait_pipeline_compiler_idle(device_vk);
     for (i = 0; i < program_vk->variant_count; ++i)
     {
         variant_vk = &program_vk->variants[i];
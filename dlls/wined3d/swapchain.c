@@ -662,6 +662,8 @@ static void swapchain_gl_present(struct wined3d_swapchain *swapchain,
         gl_info->gl_ops.wgl.p_wglSwapBuffers(context_gl->dc);
     }
 
+    wined3d_context_gl_profile_frame(context_gl);
+
     if (context->d3d_info->fences)
         wined3d_context_gl_submit_command_fence(context_gl);
 
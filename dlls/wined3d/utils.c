@@ -5992,6 +5992,226 @@ enum wined3d_format_id pixelformat_for_depth(DWORD depth)
     }
 }
 
+/* Large copies are split into bands of rows that are copied concurrently by
+ * the calling thread and a small pool of transfer threads. The pool is shared
+ * by all devices, and only one copy at a time is split; concurrent callers
+ * fall back to copying serially. The pool is only created when the
+ * "transfer_threads" setting asks for it.
+ *
+ * This only parallelises the copy itself. Uploads are still issued from the
+ * command stream thread, which also applies all state and submits the work;
+ * that thread is not split into separate frontend and backend stages. */
+#define WINED3D_MAX_TRANSFER_THREADS    4
+#define WINED3D_TRANSFER_MIN_SIZE       (1024 * 1024)
+#define WINED3D_TRANSFER_BAND_SIZE      (256 * 1024)
+
+struct wined3d_transfer_job
+{
+    const uint8_t *src;
+    uint8_t *dst;
+    unsigned int src_row_pitch, src_slice_pitch;
+    unsigned int dst_row_pitch, dst_slice_pitch;
+    unsigned int row_size, row_count, total_rows;
+    unsigned int band_rows, band_count;
+    LONG next;
+    unsigned int active;
+};
+
+static struct
+{
+    SRWLOCK lock;
+    SRWLOCK submit_lock;
+    CONDITION_VARIABLE start_cv;
+    CONDITION_VARIABLE done_cv;
+    struct wined3d_transfer_job *job;
+    unsigned int serial;
+    bool shutdown;
+
+    unsigned int refcount;
+    HANDLE threads[WINED3D_MAX_TRANSFER_THREADS];
+    unsigned int thread_count;
+}
+wined3d_transfer =
+{
+    .lock = SRWLOCK_INIT,
+    .submit_lock = SRWLOCK_INIT,
+    .start_cv = CONDITION_VARIABLE_INIT,
+    .done_cv = CONDITION_VARIABLE_INIT,
+};
+
+static void wined3d_transfer_job_copy(const struct wined3d_transfer_job *job, unsigned int first, unsigned int last)
+{
+    unsigned int slice, row, count;
+
+    while (first < last)
+    {
+        slice = first / job->row_count;
+        row = first % job->row_count;
+        count = min(last - first, job->row_count - row);
+        first += count;
+
+        if (job->src_row_pitch == job->row_size && job->dst_row_pitch == job->row_size)
+        {
+            memcpy(&job->dst[slice * job->dst_slice_pitch + row * job->dst_row_pitch],
+                    &job->src[slice * job->src_slice_pitch + row * job->src_row_pitch], count * job->row_size);
+            continue;
+        }
+
+        for (; count; --count, ++row)
+            memcpy(&job->dst[slice * job->dst_slice_pitch + row * job->dst_row_pitch],
+                    &job->src[slice * job->src_slice_pitch + row * job->src_row_pitch], job->row_size);
+    }
+}
+
+static void wined3d_transfer_job_process(struct wined3d_transfer_job *job)
+{
+    unsigned int band, first;
+
+    while ((band = InterlockedIncrement(&job->next) - 1) < job->band_count)
+    {
+        first = band * job->band_rows;
+        wined3d_transfer_job_copy(job, first, min(first + job->band_rows, job->total_rows));
+    }
+}
+
+static DWORD WINAPI wined3d_transfer_thread_proc(void *ctx)
+{
+    struct wined3d_transfer_job *job;
+    unsigned int serial = 0;
+
+    SetThreadDescription(GetCurrentThread(), L"wined3d_transfer");
+
+    AcquireSRWLockExclusive(&wined3d_transfer.lock);
+    for (;;)
+    {
+        while (serial == wined3d_transfer.serial && !wined3d_transfer.shutdown)
+            SleepConditionVariableSRW(&wined3d_transfer.start_cv, &wined3d_transfer.lock, INFINITE, 0);
+        if (wined3d_transfer.shutdown)
+            break;
+        serial = wined3d_transfer.serial;
+        if (!(job = wined3d_transfer.job))
+            continue;
+        ++job->active;
+        ReleaseSRWLockExclusive(&wined3d_transfer.lock);
+
+        wined3d_transfer_job_process(job);
+
+        AcquireSRWLockExclusive(&wined3d_transfer.lock);
+        if (!--job->active)
+            WakeConditionVariable(&wined3d_transfer.done_cv);
+    }
+    ReleaseSRWLockExclusive(&wined3d_transfer.lock);
+
+    return 0;
+}
+
+void wined3d_transfer_init(void)
+{
+    unsigned int count = min(wined3d_settings.transfer_threads, WINED3D_MAX_TRANSFER_THREADS);
+
+    AcquireSRWLockExclusive(&wined3d_transfer.submit_lock);
+
+    if (wined3d_transfer.refcount++)
+    {
+        ReleaseSRWLockExclusive(&wined3d_transfer.submit_lock);
+        return;
+    }
+
+    wined3d_transfer.shutdown = false;
+    for (wined3d_transfer.thread_count = 0; wined3d_transfer.thread_count < count; ++wined3d_transfer.thread_count)
+    {
+        if (!(wined3d_transfer.threads[wined3d_transfer.thread_count] = CreateThread(NULL, 0,
+                wined3d_transfer_thread_proc, NULL, 0, NULL)))
+        {
+            ERR("Failed to create transfer thread, error %lu.\n", GetLastError());
+            break;
+        }
+    }
+    if (wined3d_transfer.thread_count)
+        TRACE("Using %u transfer threads.\n", wined3d_transfer.thread_count);
+
+    ReleaseSRWLockExclusive(&wined3d_transfer.submit_lock);
+}
+
+void wined3d_transfer_cleanup(void)
+{
+    unsigned int i;
+
+    AcquireSRWLockExclusive(&wined3d_transfer.submit_lock);
+
+    if (--wined3d_transfer.refcount)
+    {
+        ReleaseSRWLockExclusive(&wined3d_transfer.submit_lock);
+        return;
+    }
+
+    AcquireSRWLockExclusive(&wined3d_transfer.lock);
+    wined3d_transfer.shutdown = true;
+    WakeAllConditionVariable(&wined3d_transfer.start_cv);
+    ReleaseSRWLockExclusive(&wined3d_transfer.lock);
+
+    for (i = 0; i < wined3d_transfer.thread_count; ++i)
+    {
+        WaitForSingleObject(wined3d_transfer.threads[i], INFINITE);
+        CloseHandle(wined3d_transfer.threads[i]);
+    }
+    wined3d_transfer.thread_count = 0;
+
+    ReleaseSRWLockExclusive(&wined3d_transfer.submit_lock);
+}
+
+static bool wined3d_transfer_copy(const uint8_t *src, unsigned int src_row_pitch, unsigned int src_slice_pitch,
+        uint8_t *dst, unsigned int dst_row_pitch, unsigned int dst_slice_pitch,
+        unsigned int row_size, unsigned int row_count, unsigned int slice_count)
+{
+    struct wined3d_transfer_job job;
+    unsigned int band_count;
+
+    if (!wined3d_transfer.thread_count || (uint64_t)row_size * row_count * slice_count < WINED3D_TRANSFER_MIN_SIZE)
+        return false;
+    if (!TryAcquireSRWLockExclusive(&wined3d_transfer.submit_lock))
+        return false;
+    if (!wined3d_transfer.thread_count)
+    {
+        ReleaseSRWLockExclusive(&wined3d_transfer.submit_lock);
+        return false;
+    }
+
+    job.src = src;
+    job.dst = dst;
+    job.src_row_pitch = src_row_pitch;
+    job.src_slice_pitch = src_slice_pitch;
+    job.dst_row_pitch = dst_row_pitch;
+    job.dst_slice_pitch = dst_slice_pitch;
+    job.row_size = row_size;
+    job.row_count = row_count;
+    job.total_rows = row_count * slice_count;
+    job.band_rows = max(1, WINED3D_TRANSFER_BAND_SIZE / row_size);
+    band_count = (wined3d_transfer.thread_count + 1) * 2;
+    job.band_rows = max(job.band_rows, (job.total_rows + band_count - 1) / band_count);
+    job.band_count = (job.total_rows + job.band_rows - 1) / job.band_rows;
+    job.next = 0;
+    job.active = 0;
+
+    AcquireSRWLockExclusive(&wined3d_transfer.lock);
+    wined3d_transfer.job = &job;
+    ++wined3d_transfer.serial;
+    WakeAllConditionVariable(&wined3d_transfer.start_cv);
+    ReleaseSRWLockExclusive(&wined3d_transfer.lock);
+
+    wined3d_transfer_job_process(&job);
+
+    AcquireSRWLockExclusive(&wined3d_transfer.lock);
+    while (job.active)
+        SleepConditionVariableSRW(&wined3d_transfer.done_cv, &wined3d_transfer.lock, INFINITE, 0);
+    wined3d_transfer.job = NULL;
+    ReleaseSRWLockExclusive(&wined3d_transfer.lock);
+
+    ReleaseSRWLockExclusive(&wined3d_transfer.submit_lock);
+
+    return true;
+}
+
 void wined3d_format_copy_data(const struct wined3d_format *format, const uint8_t *src,
         unsigned int src_row_pitch, unsigned int src_slice_pitch, uint8_t *dst, unsigned int dst_row_pitch,
         unsigned int dst_slice_pitch, unsigned int w, unsigned int h, unsigned int d)
@@ -6009,10 +6229,16 @@ void wined3d_format_copy_data(const struct wined3d_format *format, const uint8_t
     if (src_row_pitch == row_size && dst_row_pitch == row_size
             && ((src_slice_pitch == slice_size && dst_slice_pitch == slice_size) || slice_count == 1))
     {
-        memcpy(dst, src, slice_count * slice_size);
+        if (!wined3d_transfer_copy(src, row_size, slice_size, dst, row_size, slice_size,
+                row_size, row_count * slice_count, 1))
+            memcpy(dst, src, slice_count * slice_size);
         return;
     }
 
+    if (wined3d_transfer_copy(src, src_row_pitch, src_slice_pitch, dst, dst_row_pitch, dst_slice_pitch,
+            row_size, row_count, slice_count))
+        return;
+
     for (slice = 0; slice < slice_count; ++slice)
     {
         for (row = 0; row < row_count; ++row)
@@ -83,6 +83,7 @@ enum wined3d_gl_extension
     ARB_FRAMEBUFFER_OBJECT,
     ARB_FRAMEBUFFER_SRGB,
     ARB_GEOMETRY_SHADER4,
+    ARB_GET_PROGRAM_BINARY,
     ARB_GPU_SHADER5,
     ARB_HALF_FLOAT_PIXEL,
     ARB_HALF_FLOAT_VERTEX,
@@ -681,6 +682,11 @@ struct wined3d_context_gl
     SIZE_T free_timestamp_query_size;
     unsigned int free_timestamp_query_count;
 
+    GLuint profile_queries[4];
+    unsigned int profile_query_head;
+    unsigned int profile_query_count;
+    uint64_t profile_timestamp;
+
     union wined3d_gl_so_statistics_query *free_so_statistics_queries;
     SIZE_T free_so_statistics_query_size;
     unsigned int free_so_statistics_query_count;
@@ -774,6 +780,7 @@ const unsigned int *wined3d_context_gl_get_tex_unit_mapping(const struct wined3d
 HRESULT wined3d_context_gl_init(struct wined3d_context_gl *context_gl, struct wined3d_swapchain_gl *swapchain_gl);
 void *wined3d_context_gl_map_bo_address(struct wined3d_context_gl *context_gl,
         const struct wined3d_bo_address *data, size_t size, uint32_t flags);
+void wined3d_context_gl_profile_frame(struct wined3d_context_gl *context_gl);
 struct wined3d_context_gl *wined3d_context_gl_reacquire(struct wined3d_context_gl *context_gl);
 void wined3d_context_gl_release(struct wined3d_context_gl *context_gl);
 BOOL wined3d_context_gl_set_current(struct wined3d_context_gl *context_gl);
@@ -129,6 +129,8 @@ struct wined3d_settings wined3d_settings =
     .max_sm_cs = UINT_MAX,
     .renderer = WINED3D_RENDERER_AUTO,
     .shader_backend = WINED3D_SHADER_BACKEND_AUTO,
+    .shader_cache = TRUE,
+    .shader_cache_size = 256,
 };
 
 enum wined3d_renderer CDECL wined3d_get_renderer(void)
@@ -262,6 +264,40 @@ BOOL wined3d_get_app_name(char *app_name, unsigned int app_name_size)
     return TRUE;
 }
 
+/* Files in the shader cache are named after the application, and stored in
+ * %LOCALAPPDATA%\wined3d unless the "shader_cache_path" setting is used. */
+bool wined3d_get_shader_cache_file_name(const char *extension, char *path, unsigned int size)
+{
+    char app_name[MAX_PATH], dir[MAX_PATH];
+    unsigned int len;
+
+    if (!wined3d_settings.shader_cache)
+        return false;
+
+    if (wined3d_settings.shader_cache_path)
+    {
+        lstrcpynA(dir, wined3d_settings.shader_cache_path, ARRAY_SIZE(dir));
+    }
+    else
+    {
+        len = GetEnvironmentVariableA("LOCALAPPDATA", dir, ARRAY_SIZE(dir));
+        if (!len || len + strlen("\\wined3d") >= ARRAY_SIZE(dir))
+            return false;
+        strcat(dir, "\\wined3d");
+    }
+
+    if (!CreateDirectoryA(dir, NULL) && GetLastError() != ERROR_ALREADY_EXISTS)
+    {
+        WARN("Failed to create shader cache directory %s, error %lu.\n", debugstr_a(dir), GetLastError());
+        return false;
+    }
+
+    if (!wined3d_get_app_name(app_name, ARRAY_SIZE(app_name)))
+        return false;
+
+    return snprintf(path, size, "%s\\%s.%s", dir, app_name, extension) < size;
+}
+
 static void vkd3d_log_callback(const char *fmt, va_list args)
 {
     char buffer[1024];
@@ -470,6 +506,36 @@ static BOOL wined3d_dll_init(HINSTANCE hInstDLL)
             ERR_(winediag)("Using the HLSL-based FFP backend.\n");
             wined3d_settings.ffp_hlsl = tmpvalue;
         }
+        if (!get_config_key_dword(hkey, appkey, env, "shader_cache", &wined3d_settings.shader_cache))
+            TRACE("Setting shader cache to %#x.\n", wined3d_settings.shader_cache);
+        if (!get_config_key(hkey, appkey, env, "shader_cache_path", buffer, size))
+        {
+            size_t len = strlen(buffer) + 1;
+
+            if (!(wined3d_settings.shader_cache_path = malloc(len)))
+                ERR("Failed to allocate shader cache path memory.\n");
+            else
+                memcpy(wined3d_settings.shader_cache_path, buffer, len);
+        }
+        if (!get_config_key_dword(hkey, appkey, env, "shader_cache_size", &wined3d_settings.shader_cache_size))
+            TRACE("Limiting the shader cache to %u MiB.\n", wined3d_settings.shader_cache_size);
+        if (!get_config_key_dword(hkey, appkey, env, "async_pipelines", &wined3d_settings.async_pipelines)
+                && wined3d_settings.async_pipelines)
+            ERR_(winediag)("Creating pipelines asynchronously, draws may be skipped.\n");
+        if (!get_config_key_dword(hkey, appkey, env, "async_pipeline_timeout",
+                &wined3d_settings.async_pipeline_timeout))
+            TRACE("Waiting up to %u ms for asynchronous pipelines.\n", wined3d_settings.async_pipeline_timeout);
+        if (!get_config_key_dword(hkey, appkey, env, "transfer_threads", &wined3d_settings.transfer_threads))
+            TRACE("Using up to %u transfer threads.\n", wined3d_settings.transfer_threads);
+        if (!get_config_key(hkey, appkey, env, "profile_path", buffer, size))
+        {
+            size_t len = strlen(buffer) + 1;
+
+            if (!(wined3d_settings.profile_path = malloc(len)))
+                ERR("Failed to allocate profile path memory.\n");
+            else
+                memcpy(wined3d_settings.profile_path, buffer, len);
+        }
     }
 
     if (appkey) RegCloseKey( appkey );
@@ -493,6 +559,7 @@ static BOOL wined3d_dll_init(HINSTANCE hInstDLL)
     }
 
     vkd3d_utils_set_log_callback(vkd3d_log_callback);
+    wined3d_profile_init();
 
     return TRUE;
 }
@@ -529,6 +596,9 @@ static BOOL wined3d_dll_destroy(HINSTANCE hInstDLL)
     free(swapchain_state_table.hooks);
 
     free(wined3d_settings.logo);
+    free(wined3d_settings.shader_cache_path);
+    wined3d_profile_cleanup();
+    free(wined3d_settings.profile_path);
     UnregisterClassA(WINED3D_OPENGL_WINDOW_CLASS_NAME, hInstDLL);
 
     DeleteCriticalSection(&wined3d_command_cs);
@@ -486,10 +486,39 @@ struct wined3d_settings
     bool check_float_constants;
     bool cb_access_map_w;
     bool ffp_hlsl;
+    unsigned int shader_cache;
+    char *shader_cache_path;
+    unsigned int shader_cache_size;
+    unsigned int async_pipelines;
+    unsigned int async_pipeline_timeout;
+    unsigned int transfer_threads;
+    char *profile_path;
 };
 
 extern struct wined3d_settings wined3d_settings;
 
+extern bool wined3d_profile_enabled;
+
+void wined3d_profile_cleanup(void);
+void wined3d_profile_init(void);
+void wined3d_profile_record_counter(const char *name, double value);
+void wined3d_profile_record_frame(void);
+void wined3d_profile_record_span(const char *name, uint64_t start);
+uint64_t wined3d_profile_time(void);
+
+/* Returns 0 when profiling is disabled, in which case the matching
+ * wined3d_profile_end() call is a no-op. */
+static inline uint64_t wined3d_profile_begin(void)
+{
+    return wined3d_profile_enabled ? wined3d_profile_time() : 0;
+}
+
+static inline void wined3d_profile_end(const char *name, uint64_t start)
+{
+    if (start)
+        wined3d_profile_record_span(name, start);
+}
+
 enum wined3d_shader_resource_type
 {
     WINED3D_SHADER_RESOURCE_NONE,
@@ -2765,6 +2794,7 @@ HRESULT wined3d_init(struct wined3d *wined3d, uint32_t flags);
 void wined3d_unregister_window(HWND window);
 
 BOOL wined3d_get_app_name(char *app_name, unsigned int app_name_size);
+bool wined3d_get_shader_cache_file_name(const char *extension, char *path, unsigned int size);
 
 /* Direct3D 1-9 shader constants are submitted by internally feeding them into
  * wined3d_buffer objects, which are updated with
@@ -4650,6 +4680,8 @@ BOOL wined3d_format_is_depth_view(enum wined3d_format_id resource_format_id,
 uint32_t wined3d_format_pack(const struct wined3d_format *format, const struct wined3d_uvec4 *value);
 BOOL wined3d_formats_are_srgb_variants(enum wined3d_format_id format1,
         enum wined3d_format_id format2);
+void wined3d_transfer_cleanup(void);
+void wined3d_transfer_init(void);
 
 void wined3d_stateblock_invalidate_texture_lod(struct wined3d_stateblock *stateblock,
         struct wined3d_texture *texture);
@@ -256,6 +256,7 @@ enum wined3d_vk_extension
     WINED3D_VK_EXT_EXTENDED_DYNAMIC_STATE2,
     WINED3D_VK_EXT_EXTENDED_DYNAMIC_STATE3,
     WINED3D_VK_EXT_HOST_QUERY_RESET,
+    WINED3D_VK_EXT_PIPELINE_CREATION_FEEDBACK,
     WINED3D_VK_EXT_SAMPLER_FILTER_MINMAX,
     WINED3D_VK_EXT_SHADER_STENCIL_EXPORT,
     WINED3D_VK_EXT_TRANSFORM_FEEDBACK,
@@ -593,6 +594,14 @@ struct wined3d_graphics_pipeline_vk
     struct wine_rb_entry entry;
     struct wined3d_graphics_pipeline_key_vk key;
     VkPipeline vk_pipeline;
+
+    /* Asynchronous creation. "pending" and "compile_entry" are protected by
+     * the pipeline compiler lock. */
+    struct list compile_entry;
+    bool pending;
+    bool created;
+    VkResult vr;
+    VkPipelineCreationFeedback feedback;
 };
 
 enum wined3d_shader_descriptor_type
@@ -658,7 +667,8 @@ struct wined3d_context_vk
 
     uint32_t update_compute_pipeline : 1;
     uint32_t update_stream_output : 1;
-    uint32_t padding : 30;
+    uint32_t graphics_pipeline_pending : 1;
+    uint32_t padding : 29;
 
     struct
     {
@@ -810,6 +820,11 @@ struct wined3d_adapter_vk
 
     VkPhysicalDeviceLimits device_limits;
     VkPhysicalDeviceMemoryProperties memory_properties;
+
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
 };
 
 static inline struct wined3d_adapter_vk *wined3d_adapter_vk(struct wined3d_adapter *adapter)
@@ -899,6 +914,37 @@ struct wined3d_uav_clear_state_vk
     struct wined3d_pipeline_layout_vk *buffer_layout;
 };
 
+struct wined3d_pipeline_cache_vk
+{
+    VkPipelineCache vk_pipeline_cache;
+    char path[MAX_PATH];
+    ULONGLONG save_time;
+    unsigned int unsaved_count;
+
+    unsigned int created_count;
+    unsigned int hit_count;
+    unsigned int miss_count;
+};
+
+#define WINED3D_MAX_PIPELINE_COMPILER_THREADS_VK 4
+
+/* Worker threads creating graphics pipelines outside of the CS thread. */
+struct wined3d_pipeline_compiler_vk
+{
+    SRWLOCK lock;
+    CONDITION_VARIABLE job_cv;
+    CONDITION_VARIABLE done_cv;
+    struct list jobs;
+    unsigned int busy_count;
+    bool shutdown;
+
+    HANDLE threads[WINED3D_MAX_PIPELINE_COMPILER_THREADS_VK];
+    unsigned int thread_count;
+
+    unsigned int queued_count;
+    unsigned int skipped_draw_count;
+};
+
 struct wined3d_device_vk
 {
     struct wined3d_device d;
@@ -923,6 +969,9 @@ struct wined3d_device_vk
     struct wined3d_allocator allocator;
 
     struct wined3d_uav_clear_state_vk uav_clear_state;
+
+    struct wined3d_pipeline_cache_vk pipeline_cache;
+    struct wined3d_pipeline_compiler_vk pipeline_compiler;
 };
 
 static inline struct wined3d_device_vk *wined3d_device_vk(struct wined3d_device *device)
@@ -957,6 +1006,20 @@ void wined3d_device_vk_destroy_null_views(struct wined3d_device_vk *device_vk,
 void wined3d_device_vk_uav_clear_state_init(struct wined3d_device_vk *device_vk);
 void wined3d_device_vk_uav_clear_state_cleanup(struct wined3d_device_vk *device_vk);
 
+void wined3d_device_vk_init_pipeline_cache(struct wined3d_device_vk *device_vk);
+void wined3d_device_vk_cleanup_pipeline_cache(struct wined3d_device_vk *device_vk);
+void wined3d_device_vk_pipeline_created(struct wined3d_device_vk *device_vk,
+        const VkPipelineCreationFeedback *feedback);
+void wined3d_device_vk_init_pipeline_compiler(struct wined3d_device_vk *device_vk);
+void wined3d_device_vk_cleanup_pipeline_compiler(struct wined3d_device_vk *device_vk);
+bool wined3d_device_vk_queue_graphics_pipeline(struct wined3d_device_vk *device_vk,
+        struct wined3d_graphics_pipeline_vk *pipeline_vk);
+bool wined3d_device_vk_wait_graphics_pipeline(struct wined3d_device_vk *device_vk,
+        struct wined3d_graphics_pipeline_vk *pipeline_vk, unsigned int timeout);
+void wined3d_device_vk_wait_pipeline_compiler_idle(struct wined3d_device_vk *device_vk);
+void wined3d_graphics_pipeline_vk_create(struct wined3d_device_vk *device_vk,
+        struct wined3d_graphics_pipeline_vk *pipeline_vk);
+
 struct wined3d_texture_vk
 {
     struct wined3d_texture t;
@@ -107,6 +107,7 @@ typedef struct wg_sample *(*wg_allocator_request_sample_cb)(gsize size, void *co
 extern GstAllocator *wg_allocator_create(void);
 extern void wg_allocator_destroy(GstAllocator *allocator);
 extern void wg_allocator_provide_sample(GstAllocator *allocator, struct wg_sample *sample);
+extern void wg_allocator_reset_memory(GstMemory *memory);
 extern void wg_allocator_release_sample(GstAllocator *allocator, struct wg_sample *sample,
         bool discard_data);
 
@@ -57,6 +57,9 @@ typedef struct
     struct list memory_list;
 
     struct wg_sample *next_sample;
+    unsigned int late_samples;
+    unsigned int reattached;
+    unsigned int copied_back;
 } WgAllocator;
 
 typedef struct
@@ -96,8 +99,15 @@ static void release_memory_sample(WgAllocator *allocator, WgMemory *memory, bool
     if (memory->written && !discard_data)
     {
         GST_WARNING("Copying %#zx bytes from sample %p, back to memory %p", memory->written, sample, memory);
+        allocator->copied_back++;
         memcpy(get_unix_memory_data(memory), wg_sample_data(memory->sample), memory->written);
     }
+    else
+    {
+        /* Nothing has to be kept, the memory may take a new sample when it is
+         * written again. */
+        memory->written = 0;
+    }
 
     memory->sample = NULL;
     GST_INFO("Released sample %p from memory %p", sample, memory);
@@ -115,6 +125,23 @@ static gpointer wg_allocator_map(GstMemory *gst_memory, GstMapInfo *info, gsize
 
     pthread_mutex_lock(&allocator->mutex);
 
+    /* Decoders may allocate their buffers before we have a sample to provide, for
+     * instance when a pool is filled ahead of time, and pooled buffers are reused
+     * for later frames. If the memory holds nothing that has to be kept and is about
+     * to be written, attach the current sample now so the decoder still writes
+     * directly into it instead of into memory we would have to copy from. */
+    if (!memory->sample && !memory->written && (info->flags & GST_MAP_WRITE)
+            && allocator->next_sample && allocator->next_sample->max_size >= gst_memory->maxsize)
+    {
+        memory->sample = allocator->next_sample;
+        allocator->next_sample = NULL;
+        if (memory->unix_memory)
+            allocator->reattached++;
+        else
+            allocator->late_samples++;
+        GST_INFO("Attached sample %p to memory %p on map", memory->sample, memory);
+    }
+
     if (!memory->sample)
         info->data = get_unix_memory_data(memory);
     else
@@ -268,6 +295,12 @@ void wg_allocator_destroy(GstAllocator *gst_allocator)
         release_memory_sample(allocator, memory, true);
     pthread_mutex_unlock(&allocator->mutex);
 
+    if (allocator->copied_back)
+        GST_WARNING("Attached %u samples on map, %u to reused memory, copied %u samples back to unix memory",
+                allocator->late_samples, allocator->reattached, allocator->copied_back);
+    else
+        GST_INFO("Attached %u samples on map, %u to reused memory, without copying back",
+                allocator->late_samples, allocator->reattached);
     g_object_unref(allocator);
 
     GST_INFO("Destroyed buffer allocator %p", allocator);
@@ -303,6 +336,25 @@ void wg_allocator_provide_sample(GstAllocator *gst_allocator, struct wg_sample *
         InterlockedDecrement(&previous->refcount);
 }
 
+void wg_allocator_reset_memory(GstMemory *gst_memory)
+{
+    WgAllocator *allocator = (WgAllocator *)gst_memory->allocator;
+    WgMemory *memory = (WgMemory *)gst_memory;
+
+    if (gst_memory->parent)
+        return wg_allocator_reset_memory(gst_memory->parent);
+    if (!gst_memory_is_type(gst_memory, "Wine"))
+        return;
+
+    GST_LOG("memory %p", memory);
+
+    /* The memory went back to its pool, its content won't be read again. */
+    pthread_mutex_lock(&allocator->mutex);
+    if (!memory->sample)
+        memory->written = 0;
+    pthread_mutex_unlock(&allocator->mutex);
+}
+
 void wg_allocator_release_sample(GstAllocator *gst_allocator, struct wg_sample *sample,
         bool discard_data)
 {
@@ -29,6 +29,7 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include <gst/gst.h>
 #include <gst/video/video.h>
@@ -95,6 +96,9 @@ struct wg_parser
     gchar *sink_caps;
 
     struct input_cache_chunk input_cache_chunks[4];
+
+    unsigned int read_ahead_buffers;
+    gsize read_ahead_bytes;
 };
 static const unsigned int input_cache_chunk_size = 512 << 10;
 
@@ -114,6 +118,12 @@ struct wg_parser_stream
     GstBuffer *buffer;
     GstMapInfo map_info;
 
+    /* Decoded buffers queued behind "buffer", filled by the streaming threads
+     * up to the parser read-ahead limits. */
+    GQueue queue;
+    gsize queued_bytes;
+    unsigned int max_queued, underruns;
+
     bool flushing, eos, enabled, has_tags, has_buffer, no_more_pads, get_buffer_called;
 
     uint64_t duration;
@@ -253,6 +263,39 @@ static NTSTATUS wg_parser_stream_get_codec_format(void *args)
     return S_OK;
 }
 
+static void stream_flush_queue(struct wg_parser_stream *stream)
+{
+    GstBuffer *buffer;
+
+    while ((buffer = g_queue_pop_head(&stream->queue)))
+        gst_buffer_unref(buffer);
+    stream->queued_bytes = 0;
+}
+
+static bool stream_queue_full(struct wg_parser *parser, struct wg_parser_stream *stream)
+{
+    unsigned int count = g_queue_get_length(&stream->queue) + (stream->buffer ? 1 : 0);
+
+    return count && (count >= parser->read_ahead_buffers || stream->queued_bytes >= parser->read_ahead_bytes);
+}
+
+static void stream_map_next_buffer(struct wg_parser_stream *stream)
+{
+    GstBuffer *buffer = g_queue_pop_head(&stream->queue);
+
+    stream->queued_bytes -= gst_buffer_get_size(buffer);
+    pthread_cond_signal(&stream->event_empty_cond);
+
+    if (!gst_buffer_map(buffer, &stream->map_info, GST_MAP_READ))
+    {
+        GST_ERROR("Failed to map buffer.");
+        gst_buffer_unref(buffer);
+        return;
+    }
+
+    stream->buffer = buffer;
+}
+
 static NTSTATUS wg_parser_stream_enable(void *args)
 {
     const struct wg_parser_stream_enable_params *params = args;
@@ -285,6 +328,7 @@ static NTSTATUS wg_parser_stream_disable(void *args)
 
     pthread_mutex_lock(&parser->mutex);
     stream->enabled = false;
+    stream_flush_queue(stream);
     if (stream->desired_caps)
     {
         gst_caps_unref(stream->desired_caps);
@@ -298,12 +342,26 @@ static NTSTATUS wg_parser_stream_disable(void *args)
 static GstBuffer *wait_parser_stream_buffer(struct wg_parser *parser, struct wg_parser_stream *stream)
 {
     GstBuffer *buffer = NULL;
+    bool waited = false;
 
-    /* Note that we can both have a buffer and stream->eos, in which case we
-     * must return the buffer. */
+    /* Note that we can both have queued buffers and stream->eos, in which case
+     * we must return the buffers first. */
 
-    while (stream->enabled && !(buffer = stream->buffer) && !stream->eos)
+    while (stream->enabled && !(buffer = stream->buffer))
+    {
+        if (!g_queue_is_empty(&stream->queue))
+        {
+            stream_map_next_buffer(stream);
+            continue;
+        }
+        if (stream->eos)
+            break;
+
+        if (!waited)
+            stream->underruns++;
+        waited = true;
         pthread_cond_wait(&stream->event_cond, &parser->mutex);
+    }
 
     return buffer;
 }
@@ -657,6 +715,7 @@ static gboolean sink_event_cb(GstPad *pad, GstObject *parent, GstEvent *event)
             stream->flushing = true;
             pthread_cond_signal(&stream->event_empty_cond);
 
+            stream_flush_queue(stream);
             if (stream->buffer)
             {
                 gst_buffer_unmap(stream->buffer, &stream->map_info);
@@ -731,7 +790,7 @@ static GstFlowReturn sink_chain_cb(GstPad *pad, GstObject *parent, GstBuffer *bu
     /* Allow this buffer to be flushed by GStreamer. We are effectively
      * implementing a queue object here. */
 
-    while (stream->enabled && !stream->flushing && stream->buffer)
+    while (stream->enabled && !stream->flushing && stream_queue_full(parser, stream))
         pthread_cond_wait(&stream->event_empty_cond, &parser->mutex);
 
     if (!stream->enabled)
@@ -750,22 +809,16 @@ static GstFlowReturn sink_chain_cb(GstPad *pad, GstObject *parent, GstBuffer *bu
         return GST_FLOW_FLUSHING;
     }
 
-    if (!gst_buffer_map(buffer, &stream->map_info, GST_MAP_READ))
-    {
-        pthread_mutex_unlock(&parser->mutex);
-        GST_ERROR("Failed to map buffer.");
-        gst_buffer_unref(buffer);
-        return GST_FLOW_ERROR;
-    }
-
-    stream->buffer = buffer;
+    g_queue_push_tail(&stream->queue, buffer);
+    stream->queued_bytes += gst_buffer_get_size(buffer);
+    stream->max_queued = max(stream->max_queued, g_queue_get_length(&stream->queue));
 
     pthread_mutex_unlock(&parser->mutex);
     pthread_cond_signal(&stream->event_cond);
 
     /* The chain callback is given a reference to the buffer. Transfer that
-     * reference to the stream object, which will release it in
-     * wg_parser_stream_release_buffer(). */
+     * reference to the stream queue; it is mapped when it reaches the head
+     * and released in wg_parser_stream_release_buffer(). */
 
     GST_LOG("Buffer queued.");
     return GST_FLOW_OK;
@@ -864,6 +917,7 @@ static struct wg_parser_stream *create_stream(struct wg_parser *parser)
     stream->parser = parser;
     stream->number = parser->stream_count;
     stream->no_more_pads = true;
+    g_queue_init(&stream->queue);
     pthread_cond_init(&stream->event_cond, NULL);
     pthread_cond_init(&stream->event_empty_cond, NULL);
 
@@ -884,6 +938,9 @@ static void free_stream(struct wg_parser_stream *stream)
 
     gst_object_unref(stream->my_sink);
 
+    GST_INFO("Stream %u read-ahead: at most %u buffers queued, %u underruns.",
+            stream->number, stream->max_queued, stream->underruns);
+    stream_flush_queue(stream);
     if (stream->buffer)
     {
         gst_buffer_unmap(stream->buffer, &stream->map_info);
@@ -1872,6 +1929,7 @@ static NTSTATUS wg_parser_create(void *args)
 {
     struct wg_parser_create_params *params = args;
     struct wg_parser *parser;
+    const char *env;
 
     if (!(parser = calloc(1, sizeof(*parser))))
         return E_OUTOFMEMORY;
@@ -1883,6 +1941,17 @@ static NTSTATUS wg_parser_create(void *args)
     parser->output_compressed = params->output_compressed;
     parser->err_on = params->err_on;
     parser->warn_on = params->warn_on;
+
+    /* Decoded buffers are queued up to these limits, so that decoding runs
+     * ahead of the application requesting samples. The default of a single
+     * buffer hands each buffer over as soon as the previous one is released. */
+    parser->read_ahead_buffers = 1;
+    parser->read_ahead_bytes = 64 << 20;
+    if ((env = getenv("WINEGSTREAMER_READ_AHEAD")))
+        parser->read_ahead_buffers = max(1, atoi(env));
+    if ((env = getenv("WINEGSTREAMER_READ_AHEAD_MB")) && atoi(env) > 0)
+        parser->read_ahead_bytes = (gsize)atoi(env) << 20;
+
     GST_DEBUG("Created winegstreamer parser %p.", parser);
     params->parser = (wg_parser_t)(ULONG_PTR)parser;
     return S_OK;
@@ -96,6 +96,9 @@ struct wg_transform
 
     bool draining;
     INT64 ts_offset;
+
+    unsigned int video_frames_read;
+    unsigned int video_frames_copied;
 };
 
 static struct wg_transform *get_transform(wg_transform_t trans)
@@ -227,6 +230,19 @@ static GstFlowReturn wg_video_buffer_pool_alloc_buffer(GstBufferPool *gst_pool,
     return ret;
 }
 
+static void wg_video_buffer_pool_reset_buffer(GstBufferPool *gst_pool, GstBuffer *buffer)
+{
+    GstBufferPoolClass *parent_class = GST_BUFFER_POOL_CLASS(wg_video_buffer_pool_parent_class);
+    guint i, count = gst_buffer_n_memory(buffer);
+
+    GST_LOG("%"GST_PTR_FORMAT", buffer %"GST_PTR_FORMAT, gst_pool, buffer);
+
+    for (i = 0; i < count; ++i)
+        wg_allocator_reset_memory(gst_buffer_peek_memory(buffer, i));
+
+    parent_class->reset_buffer(gst_pool, buffer);
+}
+
 static void wg_video_buffer_pool_init(WgVideoBufferPool *pool)
 {
 }
@@ -235,6 +251,7 @@ static void wg_video_buffer_pool_class_init(WgVideoBufferPoolClass *klass)
 {
     GstBufferPoolClass *pool_class = GST_BUFFER_POOL_CLASS(klass);
     pool_class->alloc_buffer = wg_video_buffer_pool_alloc_buffer;
+    pool_class->reset_buffer = wg_video_buffer_pool_reset_buffer;
 }
 
 static WgVideoBufferPool *wg_video_buffer_pool_create(GstCaps *caps, gsize plane_align, gsize output_plane_stride,
@@ -496,6 +513,12 @@ NTSTATUS wg_transform_destroy(void *args)
     while ((sample = gst_atomic_queue_pop(transform->output_queue)))
         gst_sample_unref(sample);
 
+    if (transform->video_frames_copied)
+        GST_WARNING("Copied %u out of %u video frames", transform->video_frames_copied,
+                transform->video_frames_read);
+    else
+        GST_INFO("Read %u video frames without copy", transform->video_frames_read);
+
     wg_allocator_destroy(transform->allocator);
     g_object_unref(transform->container);
     g_object_unref(transform->my_sink);
@@ -1101,8 +1124,8 @@ static bool sample_needs_buffer_copy(struct wg_sample *sample, GstBuffer *buffer
     return needs_copy;
 }
 
-static NTSTATUS read_transform_output_video(struct wg_sample *sample, GstBuffer *buffer,
-        GstVideoInfo *src_video_info, GstVideoInfo *dst_video_info)
+static NTSTATUS read_transform_output_video(struct wg_transform *transform, struct wg_sample *sample,
+        GstBuffer *buffer, GstVideoInfo *src_video_info, GstVideoInfo *dst_video_info)
 {
     gsize total_size;
     NTSTATUS status;
@@ -1122,8 +1145,12 @@ static NTSTATUS read_transform_output_video(struct wg_sample *sample, GstBuffer
 
     set_sample_flags_from_buffer(sample, buffer, total_size);
 
+    transform->video_frames_read++;
     if (needs_copy)
+    {
+        transform->video_frames_copied++;
         GST_WARNING("Copied %u bytes, sample %p, flags %#x", sample->size, sample, sample->flags);
+    }
     else if (sample->flags & WG_SAMPLE_FLAG_INCOMPLETE)
         GST_ERROR("Partial read %u bytes, sample %p, flags %#x", sample->size, sample, sample->flags);
     else
@@ -1284,7 +1311,7 @@ NTSTATUS wg_transform_read_data(void *args)
     }
 
     if (!strcmp(output_mime, "video/x-raw"))
-        status = read_transform_output_video(sample, output_buffer,
+        status = read_transform_output_video(transform, sample, output_buffer,
                 &src_video_info, &dst_video_info);
     else
         status = read_transform_output(sample, output_buffer);
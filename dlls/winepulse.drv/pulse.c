@@ -24,6 +24,7 @@
 #endif
 
 #include <stdarg.h>
+#include <stdlib.h>
 #include <pthread.h>
 #include <math.h>
 #include <poll.h>
@@ -82,6 +83,7 @@ struct pulse_stream
     pa_usec_t mmdev_period_usec;
 
     INT64 clock_lastpos, clock_written;
+    struct render_shared_state *shared;
 
     struct list packet_free_head;
     struct list packet_filled_head;
@@ -119,6 +121,17 @@ static pthread_cond_t pulse_cond = PTHREAD_COND_INITIALIZER;
 
 static ULONG_PTR zero_bits = 0;
 
+/* In low latency mode render streams ask for a shorter server-side buffer,
+ * and data is pushed to PulseAudio from its write requests as well as from
+ * the period timer. Enabled with WINEPULSE_LOW_LATENCY=1. */
+static BOOL low_latency;
+
+/* Render streams share their ring buffer state with the PE side, which then
+ * exchanges buffers without calling into the driver. Released data reaches
+ * the server on the next period instead of immediately, so this is only
+ * enabled with WINEPULSE_SHARED_BUFFERS=1. */
+static BOOL shared_buffers;
+
 static NTSTATUS pulse_not_implemented(void *args)
 {
     return STATUS_SUCCESS;
@@ -241,6 +254,7 @@ static int pulse_poll_func(struct pollfd *ufds, unsigned long nfds, int timeout,
 static NTSTATUS pulse_process_attach(void *args)
 {
     pthread_mutexattr_t attr;
+    const char *env;
 
     pthread_mutexattr_init(&attr);
     pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
@@ -249,6 +263,17 @@ static NTSTATUS pulse_process_attach(void *args)
     if (pthread_mutex_init(&pulse_mutex, &attr) != 0)
         pthread_mutex_init(&pulse_mutex, NULL);
 
+    if ((env = getenv("WINEPULSE_LOW_LATENCY")) && atoi(env))
+    {
+        TRACE("Using low latency mode.\n");
+        low_latency = TRUE;
+    }
+    if ((env = getenv("WINEPULSE_SHARED_BUFFERS")) && atoi(env))
+    {
+        TRACE("Sharing render buffers with the client.\n");
+        shared_buffers = TRUE;
+    }
+
     return STATUS_SUCCESS;
 }
 
@@ -394,11 +419,31 @@ static void pulse_attr_update(pa_stream *s, void *user) {
     dump_attr(attr);
 }
 
+/* In low latency mode render streams start with a target length of two
+ * periods. Each underrun adds one period, up to the default of three. */
+static void pulse_grow_tlength(struct pulse_stream *stream)
+{
+    const pa_buffer_attr *cur = pa_stream_get_buffer_attr(stream->stream);
+    pa_buffer_attr attr;
+    pa_operation *o;
+
+    if (!cur || cur->tlength >= stream->period_bytes * 3)
+        return;
+
+    attr = *cur;
+    attr.tlength = min(cur->tlength + stream->period_bytes, stream->period_bytes * 3);
+    TRACE("%p: Growing tlength from %u to %u\n", stream, cur->tlength, attr.tlength);
+    if ((o = pa_stream_set_buffer_attr(stream->stream, &attr, NULL, NULL)))
+        pa_operation_unref(o);
+}
+
 static void pulse_underflow_callback(pa_stream *s, void *userdata)
 {
     struct pulse_stream *stream = userdata;
     WARN("%p: Underflow\n", userdata);
     stream->just_underran = TRUE;
+    if (low_latency)
+        pulse_grow_tlength(stream);
 }
 
 static void pulse_started_callback(pa_stream *s, void *userdata)
@@ -406,6 +451,28 @@ static void pulse_started_callback(pa_stream *s, void *userdata)
     TRACE("%p: (Re)started playing\n", userdata);
 }
 
+static void pulse_sync_shared(struct pulse_stream *stream);
+static void pulse_write_held(struct pulse_stream *stream, UINT32 bytes);
+
+static void pulse_write_callback(pa_stream *s, size_t bytes, void *userdata)
+{
+    struct pulse_stream *stream = userdata;
+
+    TRACE("%p: Server requested %zu bytes\n", userdata, bytes);
+
+    /* After an underrun the timer loop prebuffers silence and resyncs its
+     * clock, so leave the stream to it. */
+    if (!stream->started || stream->please_quit || stream->just_underran)
+        return;
+
+    /* Only top up the server with what we already hold. This doesn't free
+     * any space in the client's buffer, which only happens when the timer
+     * loop advances a period and signals the event. */
+    pulse_sync_shared(stream);
+    if (stream->pa_held_bytes)
+        pulse_write_held(stream, min(bytes, pa_stream_writable_size(stream->stream)));
+}
+
 static void pulse_op_cb(pa_stream *s, int success, void *user)
 {
     TRACE("Success: %i\n", success);
@@ -423,6 +490,43 @@ static BOOL pulse_stream_valid(struct pulse_stream *stream)
     return pa_stream_get_state(stream->stream) == PA_STREAM_READY;
 }
 
+/* Fold buffers released on the PE side into the stream, and publish the
+ * current ring buffer state to it. Must be called with the lock held. */
+static void pulse_sync_shared(struct pulse_stream *stream)
+{
+    struct render_shared_state *shared = stream->shared;
+    LONG pending;
+
+    if (!shared)
+        return;
+
+    __atomic_store_n(&shared->seq, shared->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    if ((pending = __atomic_load_n(&shared->pending_bytes, __ATOMIC_ACQUIRE)))
+    {
+        stream->held_bytes += pending;
+        stream->pa_held_bytes += pending;
+        if (stream->pa_held_bytes > stream->real_bufsize_bytes)
+        {
+            stream->pa_offs_bytes += stream->pa_held_bytes - stream->real_bufsize_bytes;
+            stream->pa_offs_bytes %= stream->real_bufsize_bytes;
+            stream->pa_held_bytes = stream->real_bufsize_bytes;
+        }
+        stream->clock_written += pending;
+        __atomic_sub_fetch(&shared->pending_bytes, pending, __ATOMIC_RELAXED);
+    }
+    shared->lcl_offs_bytes = stream->lcl_offs_bytes;
+    shared->held_bytes = stream->held_bytes;
+
+    __atomic_store_n(&shared->seq, shared->seq + 1, __ATOMIC_RELEASE);
+}
+
+static BOOL pulse_render_locked(const struct pulse_stream *stream)
+{
+    return stream->locked || (stream->shared && stream->shared->locked_bytes > 0);
+}
+
 static HRESULT pulse_connect(const char *name)
 {
     pa_context_state_t state;
@@ -1080,7 +1184,7 @@ static HRESULT pulse_stream_connect(struct pulse_stream *stream, const char *pul
 
     /* PulseAudio will fill in correct values */
     attr.minreq = attr.fragsize = period_bytes;
-    attr.tlength = period_bytes * 3;
+    attr.tlength = period_bytes * (low_latency ? 2 : 3);
     attr.maxlength = stream->bufsize_frames * pa_frame_size(&stream->ss);
     attr.prebuf = pa_frame_size(&stream->ss);
     dump_attr(&attr);
@@ -1107,6 +1211,8 @@ static HRESULT pulse_stream_connect(struct pulse_stream *stream, const char *pul
     if (stream->dataflow == eRender) {
         pa_stream_set_underflow_callback(stream->stream, pulse_underflow_callback, stream);
         pa_stream_set_started_callback(stream->stream, pulse_started_callback, stream);
+        if (low_latency)
+            pa_stream_set_write_callback(stream->stream, pulse_write_callback, stream);
     }
     return S_OK;
 }
@@ -1205,11 +1311,24 @@ static NTSTATUS pulse_create_stream(void *args)
         /* Update frames according to new size */
         dump_attr(attr);
         if (stream->dataflow == eRender) {
-            size = stream->real_bufsize_bytes =
-                stream->bufsize_frames * 2 * pa_frame_size(&stream->ss);
+            SIZE_T shared_offset;
+
+            stream->real_bufsize_bytes = stream->bufsize_frames * 2 * pa_frame_size(&stream->ss);
+            shared_offset = (stream->real_bufsize_bytes + 7) & ~7;
+            size = shared_offset + sizeof(*stream->shared);
             if (NtAllocateVirtualMemory(GetCurrentProcess(), (void **)&stream->local_buffer,
                                         zero_bits, &size, MEM_COMMIT, PAGE_READWRITE))
                 hr = E_OUTOFMEMORY;
+            else if (shared_buffers && params->shared)
+            {
+                stream->shared = (struct render_shared_state *)(stream->local_buffer + shared_offset);
+                stream->shared->frame_size = pa_frame_size(&stream->ss);
+                stream->shared->bufsize_frames = stream->bufsize_frames;
+                stream->shared->ring_bytes = stream->real_bufsize_bytes;
+                stream->shared->ring_offset = shared_offset;
+                stream->shared->silence = stream->ss.format == PA_SAMPLE_U8 ? 0x80 : 0;
+                *params->shared = stream->shared;
+            }
         } else {
             UINT32 i, capture_packets;
 
@@ -1431,29 +1550,11 @@ write:
     return pa_stream_write(stream->stream, buffer, bytes, NULL, 0, PA_SEEK_RELATIVE);
 }
 
-static void pulse_write(struct pulse_stream *stream)
+static void pulse_write_held(struct pulse_stream *stream, UINT32 bytes)
 {
-    /* write as much data to PA as we can */
-    UINT32 to_write;
     BYTE *buf = stream->local_buffer + stream->pa_offs_bytes;
-    UINT32 bytes = pa_stream_writable_size(stream->stream);
-
-    if (stream->just_underran)
-    {
-        /* prebuffer with silence if needed */
-        if(stream->pa_held_bytes < bytes){
-            to_write = bytes - stream->pa_held_bytes;
-            TRACE("prebuffering %u frames of silence\n",
-                    (int)(to_write / pa_frame_size(&stream->ss)));
-            buf = calloc(1, to_write);
-            pa_stream_write(stream->stream, buf, to_write, NULL, 0, PA_SEEK_RELATIVE);
-            free(buf);
-        }
-
-        stream->just_underran = FALSE;
-    }
+    UINT32 to_write;
 
-    buf = stream->local_buffer + stream->pa_offs_bytes;
     TRACE("held: %lu, avail: %u\n", stream->pa_held_bytes, bytes);
     bytes = min(stream->pa_held_bytes, bytes);
 
@@ -1477,6 +1578,31 @@ static void pulse_write(struct pulse_stream *stream)
     stream->pa_held_bytes -= to_write;
 }
 
+static void pulse_write(struct pulse_stream *stream)
+{
+    /* write as much data to PA as we can */
+    UINT32 to_write;
+    BYTE *buf = stream->local_buffer + stream->pa_offs_bytes;
+    UINT32 bytes = pa_stream_writable_size(stream->stream);
+
+    if (stream->just_underran)
+    {
+        /* prebuffer with silence if needed */
+        if(stream->pa_held_bytes < bytes){
+            to_write = bytes - stream->pa_held_bytes;
+            TRACE("prebuffering %u frames of silence\n",
+                    (int)(to_write / pa_frame_size(&stream->ss)));
+            buf = calloc(1, to_write);
+            pa_stream_write(stream->stream, buf, to_write, NULL, 0, PA_SEEK_RELATIVE);
+            free(buf);
+        }
+
+        stream->just_underran = FALSE;
+    }
+
+    pulse_write_held(stream, bytes);
+}
+
 static void pulse_read(struct pulse_stream *stream)
 {
     size_t bytes = pa_stream_readable_size(stream->stream);
@@ -1598,6 +1724,7 @@ static void pulse_timer_loop(void *args)
         NtDelayExecution(FALSE, &delay);
 
         pulse_lock();
+        pulse_sync_shared(stream);
 
         delay.QuadPart = -stream->mmdev_period_usec * 10;
 
@@ -1671,6 +1798,7 @@ static void pulse_timer_loop(void *args)
                 (int)(stream->held_bytes/ pa_frame_size(&stream->ss)),
                 (unsigned int)(-delay.QuadPart / 10));
 
+        pulse_sync_shared(stream);
         pulse_unlock();
     }
 }
@@ -1780,7 +1908,7 @@ static NTSTATUS pulse_reset(void *args)
         return STATUS_SUCCESS;
     }
 
-    if (stream->locked)
+    if (stream->dataflow == eRender ? pulse_render_locked(stream) : stream->locked)
     {
         pulse_unlock();
         params->result = AUDCLNT_E_BUFFER_OPERATION_PENDING;
@@ -1791,6 +1919,8 @@ static NTSTATUS pulse_reset(void *args)
     {
         /* If there is still data in the render buffer it needs to be removed from the server */
         int success = 0;
+
+        pulse_sync_shared(stream);
         if (stream->held_bytes)
             wait_pa_operation_complete(pa_stream_flush(stream->stream, pulse_op_cb, &success));
 
@@ -1799,6 +1929,7 @@ static NTSTATUS pulse_reset(void *args)
             stream->clock_lastpos = stream->clock_written = 0;
             stream->pa_offs_bytes = stream->lcl_offs_bytes = 0;
             stream->held_bytes = stream->pa_held_bytes = 0;
+            pulse_sync_shared(stream);
         }
     }
     else
@@ -1844,6 +1975,7 @@ static BOOL alloc_tmp_buffer(struct pulse_stream *stream, SIZE_T bytes)
 
 static UINT32 pulse_render_padding(struct pulse_stream *stream)
 {
+    pulse_sync_shared(stream);
     return stream->held_bytes / pa_frame_size(&stream->ss);
 }
 
@@ -1874,7 +2006,7 @@ static NTSTATUS pulse_get_render_buffer(void *args)
         return STATUS_SUCCESS;
     }
 
-    if (stream->locked)
+    if (pulse_render_locked(stream))
     {
         pulse_unlock();
         params->result = AUDCLNT_E_OUT_OF_ORDER;
@@ -1889,6 +2021,7 @@ static NTSTATUS pulse_get_render_buffer(void *args)
         return STATUS_SUCCESS;
     }
 
+    pulse_sync_shared(stream);
     if (stream->held_bytes / pa_frame_size(&stream->ss) + params->frames > stream->bufsize_frames)
     {
         pulse_unlock();
@@ -1916,6 +2049,8 @@ static NTSTATUS pulse_get_render_buffer(void *args)
     }
 
     silence_buffer(stream->ss.format, *params->data, bytes);
+    if (stream->shared)
+        stream->shared->locked_bytes = -1;
 
     pulse_unlock();
     params->result = S_OK;
@@ -1949,6 +2084,8 @@ static NTSTATUS pulse_release_render_buffer(void *args)
     if (!stream->locked || !params->written_frames)
     {
         stream->locked = 0;
+        if (stream->shared)
+            stream->shared->locked_bytes = 0;
         pulse_unlock();
         params->result = params->written_frames ? AUDCLNT_E_OUT_OF_ORDER : S_OK;
         return STATUS_SUCCESS;
@@ -1974,6 +2111,7 @@ static NTSTATUS pulse_release_render_buffer(void *args)
     if (stream->locked < 0)
         pulse_wrap_buffer(stream, buffer, written_bytes);
 
+    pulse_sync_shared(stream);
     stream->held_bytes += written_bytes;
     stream->pa_held_bytes += written_bytes;
     if (stream->pa_held_bytes > stream->real_bufsize_bytes)
@@ -1984,6 +2122,9 @@ static NTSTATUS pulse_release_render_buffer(void *args)
     }
     stream->clock_written += written_bytes;
     stream->locked = 0;
+    if (stream->shared)
+        stream->shared->locked_bytes = 0;
+    pulse_sync_shared(stream);
 
     /* push as much data as we can to pulseaudio too */
     pulse_write(stream);
@@ -2223,6 +2364,8 @@ static NTSTATUS pulse_get_latency(void *args)
     struct pulse_stream *stream = handle_get_stream(params->stream);
     const pa_buffer_attr *attr;
     REFERENCE_TIME lat;
+    pa_usec_t usec;
+    int negative;
 
     pulse_lock();
     if (!pulse_stream_valid(stream)) {
@@ -2231,11 +2374,20 @@ static NTSTATUS pulse_get_latency(void *args)
         return STATUS_SUCCESS;
     }
     attr = pa_stream_get_buffer_attr(stream->stream);
-    if (stream->dataflow == eRender)
-        lat = attr->minreq / pa_frame_size(&stream->ss);
+    if (low_latency && stream->dataflow == eRender
+            && !pa_stream_get_latency(stream->stream, &usec, &negative))
+    {
+        /* Report the measured latency of the server and sink. */
+        *params->latency = (negative ? 0 : usec * 10) + stream->def_period;
+    }
     else
-        lat = attr->fragsize / pa_frame_size(&stream->ss);
-    *params->latency = (lat * 10000000) / stream->ss.rate + stream->def_period;
+    {
+        if (stream->dataflow == eRender)
+            lat = attr->minreq / pa_frame_size(&stream->ss);
+        else
+            lat = attr->fragsize / pa_frame_size(&stream->ss);
+        *params->latency = (lat * 10000000) / stream->ss.rate + stream->def_period;
+    }
     pulse_unlock();
     TRACE("Latency: %u ms\n", (unsigned)(*params->latency / 10000));
     params->result = S_OK;
@@ -2318,6 +2470,7 @@ static NTSTATUS pulse_get_position(void *args)
         return STATUS_SUCCESS;
     }
 
+    pulse_sync_shared(stream);
     *params->pos = stream->clock_written - stream->held_bytes;
 
     if (stream->share == AUDCLNT_SHAREMODE_EXCLUSIVE || params->device)
@@ -2405,12 +2558,14 @@ static NTSTATUS pulse_set_sample_rate(void *args)
         goto exit;
     }
 
+    pulse_sync_shared(stream);
     if (stream->held_bytes)
         wait_pa_operation_complete(pa_stream_flush(stream->stream, pulse_op_cb, &success));
 
     stream->clock_lastpos = stream->clock_written = 0;
     stream->pa_offs_bytes = stream->lcl_offs_bytes = 0;
     stream->held_bytes = stream->pa_held_bytes = 0;
+    pulse_sync_shared(stream);
     stream->period_bytes = pa_frame_size(&new_ss) * muldiv(stream->mmdev_period_usec, new_ss.rate, 1000000);
     stream->ss = new_ss;
 
@@ -2625,7 +2780,9 @@ static NTSTATUS pulse_wow64_create_stream(void *args)
         HRESULT result;
         PTR32 channel_count;
         PTR32 stream;
+        PTR32 shared;
     } *params32 = args;
+    struct render_shared_state *shared = NULL;
     struct create_stream_params params =
     {
         .name = ULongToPtr(params32->name),
@@ -2637,10 +2794,13 @@ static NTSTATUS pulse_wow64_create_stream(void *args)
         .period = params32->period,
         .fmt = ULongToPtr(params32->fmt),
         .channel_count = ULongToPtr(params32->channel_count),
-        .stream = ULongToPtr(params32->stream)
+        .stream = ULongToPtr(params32->stream),
+        .shared = params32->shared ? &shared : NULL,
     };
     pulse_create_stream(&params);
     params32->result = params.result;
+    if (shared)
+        *(PTR32 *)ULongToPtr(params32->shared) = PtrToUlong(shared);
     return STATUS_SUCCESS;
 }
 
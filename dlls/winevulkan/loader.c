@@ -713,6 +713,24 @@ void WINAPI vkDestroyCommandPool(VkDevice device, VkCommandPool handle, const Vk
     free(cmd_pool);
 }
 
+VkResult WINAPI vkResetCommandPool(VkDevice device, VkCommandPool handle, VkCommandPoolResetFlags flags)
+{
+    struct vk_command_pool *cmd_pool = command_pool_from_handle(handle);
+    struct vkResetCommandPool_params params;
+    VkCommandBuffer buffer;
+
+    /* Command buffers in the recording state go back to the initial state,
+     * anything still waiting to be executed on them is discarded. */
+    LIST_FOR_EACH_ENTRY(buffer, &cmd_pool->command_buffers, struct VkCommandBuffer_T, pool_link)
+        buffer->stream.size = 0;
+
+    params.device = device;
+    params.commandPool = handle;
+    params.flags = flags;
+    UNIX_CALL_CHECKED(vkResetCommandPool, &params);
+    return params.result;
+}
+
 VkResult WINAPI vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *allocate_info,
                                          VkCommandBuffer *buffers)
 {
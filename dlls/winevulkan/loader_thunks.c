@@ -92,6 +92,8 @@ void WINAPI vkAntiLagUpdateAMD(VkDevice device, const VkAntiLagDataAMD *pData)
 VkResult WINAPI vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo)
 {
     struct vkBeginCommandBuffer_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBeginInfo = pBeginInfo;
     UNIX_CALL_CHECKED(vkBeginCommandBuffer, &params);
@@ -247,6 +249,8 @@ void WINAPI vkClearShaderInstrumentationMetricsARM(VkDevice device, VkShaderInst
 void WINAPI vkCmdBeginConditionalRendering2EXT(VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfo2EXT *pConditionalRenderingBegin)
 {
     struct vkCmdBeginConditionalRendering2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pConditionalRenderingBegin = pConditionalRenderingBegin;
     UNIX_CALL(vkCmdBeginConditionalRendering2EXT, &params);
@@ -255,6 +259,8 @@ void WINAPI vkCmdBeginConditionalRendering2EXT(VkCommandBuffer commandBuffer, co
 void WINAPI vkCmdBeginConditionalRenderingEXT(VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT *pConditionalRenderingBegin)
 {
     struct vkCmdBeginConditionalRenderingEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pConditionalRenderingBegin = pConditionalRenderingBegin;
     UNIX_CALL(vkCmdBeginConditionalRenderingEXT, &params);
@@ -263,6 +269,8 @@ void WINAPI vkCmdBeginConditionalRenderingEXT(VkCommandBuffer commandBuffer, con
 void WINAPI vkCmdBeginCustomResolveEXT(VkCommandBuffer commandBuffer, const VkBeginCustomResolveInfoEXT *pBeginCustomResolveInfo)
 {
     struct vkCmdBeginCustomResolveEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBeginCustomResolveInfo = pBeginCustomResolveInfo;
     UNIX_CALL(vkCmdBeginCustomResolveEXT, &params);
@@ -271,6 +279,8 @@ void WINAPI vkCmdBeginCustomResolveEXT(VkCommandBuffer commandBuffer, const VkBe
 void WINAPI vkCmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT *pLabelInfo)
 {
     struct vkCmdBeginDebugUtilsLabelEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pLabelInfo = pLabelInfo;
     UNIX_CALL(vkCmdBeginDebugUtilsLabelEXT, &params);
@@ -279,6 +289,8 @@ void WINAPI vkCmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const Vk
 VkResult WINAPI vkCmdBeginGpaSampleAMD(VkCommandBuffer commandBuffer, VkGpaSessionAMD gpaSession, const VkGpaSampleBeginInfoAMD *pGpaSampleBeginInfo, uint32_t *pSampleID)
 {
     struct vkCmdBeginGpaSampleAMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.gpaSession = gpaSession;
     params.pGpaSampleBeginInfo = pGpaSampleBeginInfo;
@@ -290,6 +302,8 @@ VkResult WINAPI vkCmdBeginGpaSampleAMD(VkCommandBuffer commandBuffer, VkGpaSessi
 VkResult WINAPI vkCmdBeginGpaSessionAMD(VkCommandBuffer commandBuffer, VkGpaSessionAMD gpaSession)
 {
     struct vkCmdBeginGpaSessionAMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.gpaSession = gpaSession;
     UNIX_CALL_CHECKED(vkCmdBeginGpaSessionAMD, &params);
@@ -299,6 +313,8 @@ VkResult WINAPI vkCmdBeginGpaSessionAMD(VkCommandBuffer commandBuffer, VkGpaSess
 void WINAPI vkCmdBeginPerTileExecutionQCOM(VkCommandBuffer commandBuffer, const VkPerTileBeginInfoQCOM *pPerTileBeginInfo)
 {
     struct vkCmdBeginPerTileExecutionQCOM_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pPerTileBeginInfo = pPerTileBeginInfo;
     UNIX_CALL(vkCmdBeginPerTileExecutionQCOM, &params);
@@ -307,6 +323,8 @@ void WINAPI vkCmdBeginPerTileExecutionQCOM(VkCommandBuffer commandBuffer, const
 void WINAPI vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags)
 {
     struct vkCmdBeginQuery_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.queryPool = queryPool;
     params.query = query;
@@ -317,6 +335,8 @@ void WINAPI vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool
 void WINAPI vkCmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags, uint32_t index)
 {
     struct vkCmdBeginQueryIndexedEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.queryPool = queryPool;
     params.query = query;
@@ -328,6 +348,8 @@ void WINAPI vkCmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool
 void WINAPI vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin, VkSubpassContents contents)
 {
     struct vkCmdBeginRenderPass_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pRenderPassBegin = pRenderPassBegin;
     params.contents = contents;
@@ -337,6 +359,8 @@ void WINAPI vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPa
 void WINAPI vkCmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin, const VkSubpassBeginInfo *pSubpassBeginInfo)
 {
     struct vkCmdBeginRenderPass2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pRenderPassBegin = pRenderPassBegin;
     params.pSubpassBeginInfo = pSubpassBeginInfo;
@@ -346,6 +370,8 @@ void WINAPI vkCmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderP
 void WINAPI vkCmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin, const VkSubpassBeginInfo *pSubpassBeginInfo)
 {
     struct vkCmdBeginRenderPass2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pRenderPassBegin = pRenderPassBegin;
     params.pSubpassBeginInfo = pSubpassBeginInfo;
@@ -355,6 +381,8 @@ void WINAPI vkCmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRend
 void WINAPI vkCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo)
 {
     struct vkCmdBeginRendering_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pRenderingInfo = pRenderingInfo;
     UNIX_CALL(vkCmdBeginRendering, &params);
@@ -363,6 +391,8 @@ void WINAPI vkCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRendering
 void WINAPI vkCmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo)
 {
     struct vkCmdBeginRenderingKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pRenderingInfo = pRenderingInfo;
     UNIX_CALL(vkCmdBeginRenderingKHR, &params);
@@ -371,6 +401,8 @@ void WINAPI vkCmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRender
 void WINAPI vkCmdBeginShaderInstrumentationARM(VkCommandBuffer commandBuffer, VkShaderInstrumentationARM instrumentation)
 {
     struct vkCmdBeginShaderInstrumentationARM_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.instrumentation = instrumentation;
     UNIX_CALL(vkCmdBeginShaderInstrumentationARM, &params);
@@ -379,6 +411,8 @@ void WINAPI vkCmdBeginShaderInstrumentationARM(VkCommandBuffer commandBuffer, Vk
 void WINAPI vkCmdBeginTransformFeedback2EXT(VkCommandBuffer commandBuffer, uint32_t firstCounterRange, uint32_t counterRangeCount, const VkBindTransformFeedbackBuffer2InfoEXT *pCounterInfos)
 {
     struct vkCmdBeginTransformFeedback2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstCounterRange = firstCounterRange;
     params.counterRangeCount = counterRangeCount;
@@ -389,6 +423,8 @@ void WINAPI vkCmdBeginTransformFeedback2EXT(VkCommandBuffer commandBuffer, uint3
 void WINAPI vkCmdBeginTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer *pCounterBuffers, const VkDeviceSize *pCounterBufferOffsets)
 {
     struct vkCmdBeginTransformFeedbackEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstCounterBuffer = firstCounterBuffer;
     params.counterBufferCount = counterBufferCount;
@@ -400,6 +436,8 @@ void WINAPI vkCmdBeginTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32
 void WINAPI vkCmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoBeginCodingInfoKHR *pBeginInfo)
 {
     struct vkCmdBeginVideoCodingKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBeginInfo = pBeginInfo;
     UNIX_CALL(vkCmdBeginVideoCodingKHR, &params);
@@ -408,6 +446,8 @@ void WINAPI vkCmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVide
 void WINAPI vkCmdBindDescriptorBufferEmbeddedSamplers2EXT(VkCommandBuffer commandBuffer, const VkBindDescriptorBufferEmbeddedSamplersInfoEXT *pBindDescriptorBufferEmbeddedSamplersInfo)
 {
     struct vkCmdBindDescriptorBufferEmbeddedSamplers2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBindDescriptorBufferEmbeddedSamplersInfo = pBindDescriptorBufferEmbeddedSamplersInfo;
     UNIX_CALL(vkCmdBindDescriptorBufferEmbeddedSamplers2EXT, &params);
@@ -416,6 +456,8 @@ void WINAPI vkCmdBindDescriptorBufferEmbeddedSamplers2EXT(VkCommandBuffer comman
 void WINAPI vkCmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set)
 {
     struct vkCmdBindDescriptorBufferEmbeddedSamplersEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineBindPoint = pipelineBindPoint;
     params.layout = layout;
@@ -426,6 +468,8 @@ void WINAPI vkCmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandBuffer command
 void WINAPI vkCmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount, const VkDescriptorBufferBindingInfoEXT *pBindingInfos)
 {
     struct vkCmdBindDescriptorBuffersEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.bufferCount = bufferCount;
     params.pBindingInfos = pBindingInfos;
@@ -435,6 +479,8 @@ void WINAPI vkCmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_
 void WINAPI vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t *pDynamicOffsets)
 {
     struct vkCmdBindDescriptorSets_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineBindPoint = pipelineBindPoint;
     params.layout = layout;
@@ -449,6 +495,8 @@ void WINAPI vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBin
 void WINAPI vkCmdBindDescriptorSets2(VkCommandBuffer commandBuffer, const VkBindDescriptorSetsInfo *pBindDescriptorSetsInfo)
 {
     struct vkCmdBindDescriptorSets2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBindDescriptorSetsInfo = pBindDescriptorSetsInfo;
     UNIX_CALL(vkCmdBindDescriptorSets2, &params);
@@ -457,6 +505,8 @@ void WINAPI vkCmdBindDescriptorSets2(VkCommandBuffer commandBuffer, const VkBind
 void WINAPI vkCmdBindDescriptorSets2KHR(VkCommandBuffer commandBuffer, const VkBindDescriptorSetsInfo *pBindDescriptorSetsInfo)
 {
     struct vkCmdBindDescriptorSets2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBindDescriptorSetsInfo = pBindDescriptorSetsInfo;
     UNIX_CALL(vkCmdBindDescriptorSets2KHR, &params);
@@ -464,17 +514,20 @@ void WINAPI vkCmdBindDescriptorSets2KHR(VkCommandBuffer commandBuffer, const VkB
 
 void WINAPI vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
 {
-    struct vkCmdBindIndexBuffer_params params;
-    params.commandBuffer = commandBuffer;
-    params.buffer = buffer;
-    params.offset = offset;
-    params.indexType = indexType;
-    UNIX_CALL(vkCmdBindIndexBuffer, &params);
+    struct vkCmdBindIndexBuffer_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdBindIndexBuffer, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->buffer = buffer;
+    params->offset = offset;
+    params->indexType = indexType;
 }
 
 void WINAPI vkCmdBindIndexBuffer2(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size, VkIndexType indexType)
 {
     struct vkCmdBindIndexBuffer2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -486,6 +539,8 @@ void WINAPI vkCmdBindIndexBuffer2(VkCommandBuffer commandBuffer, VkBuffer buffer
 void WINAPI vkCmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size, VkIndexType indexType)
 {
     struct vkCmdBindIndexBuffer2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -497,6 +552,8 @@ void WINAPI vkCmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer, VkBuffer buf
 void WINAPI vkCmdBindIndexBuffer3KHR(VkCommandBuffer commandBuffer, const VkBindIndexBuffer3InfoKHR *pInfo)
 {
     struct vkCmdBindIndexBuffer3KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdBindIndexBuffer3KHR, &params);
@@ -505,6 +562,8 @@ void WINAPI vkCmdBindIndexBuffer3KHR(VkCommandBuffer commandBuffer, const VkBind
 void WINAPI vkCmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout)
 {
     struct vkCmdBindInvocationMaskHUAWEI_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.imageView = imageView;
     params.imageLayout = imageLayout;
@@ -513,16 +572,19 @@ void WINAPI vkCmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImage
 
 void WINAPI vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
 {
-    struct vkCmdBindPipeline_params params;
-    params.commandBuffer = commandBuffer;
-    params.pipelineBindPoint = pipelineBindPoint;
-    params.pipeline = pipeline;
-    UNIX_CALL(vkCmdBindPipeline, &params);
+    struct vkCmdBindPipeline_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdBindPipeline, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->pipelineBindPoint = pipelineBindPoint;
+    params->pipeline = pipeline;
 }
 
 void WINAPI vkCmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline, uint32_t groupIndex)
 {
     struct vkCmdBindPipelineShaderGroupNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineBindPoint = pipelineBindPoint;
     params.pipeline = pipeline;
@@ -533,6 +595,8 @@ void WINAPI vkCmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer, VkPipe
 void WINAPI vkCmdBindResourceHeapEXT(VkCommandBuffer commandBuffer, const VkBindHeapInfoEXT *pBindInfo)
 {
     struct vkCmdBindResourceHeapEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBindInfo = pBindInfo;
     UNIX_CALL(vkCmdBindResourceHeapEXT, &params);
@@ -541,6 +605,8 @@ void WINAPI vkCmdBindResourceHeapEXT(VkCommandBuffer commandBuffer, const VkBind
 void WINAPI vkCmdBindSamplerHeapEXT(VkCommandBuffer commandBuffer, const VkBindHeapInfoEXT *pBindInfo)
 {
     struct vkCmdBindSamplerHeapEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBindInfo = pBindInfo;
     UNIX_CALL(vkCmdBindSamplerHeapEXT, &params);
@@ -549,6 +615,8 @@ void WINAPI vkCmdBindSamplerHeapEXT(VkCommandBuffer commandBuffer, const VkBindH
 void WINAPI vkCmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount, const VkShaderStageFlagBits *pStages, const VkShaderEXT *pShaders)
 {
     struct vkCmdBindShadersEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.stageCount = stageCount;
     params.pStages = pStages;
@@ -559,6 +627,8 @@ void WINAPI vkCmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCou
 void WINAPI vkCmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout)
 {
     struct vkCmdBindShadingRateImageNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.imageView = imageView;
     params.imageLayout = imageLayout;
@@ -568,6 +638,8 @@ void WINAPI vkCmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageVi
 void WINAPI vkCmdBindTileMemoryQCOM(VkCommandBuffer commandBuffer, const VkTileMemoryBindInfoQCOM *pTileMemoryBindInfo)
 {
     struct vkCmdBindTileMemoryQCOM_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pTileMemoryBindInfo = pTileMemoryBindInfo;
     UNIX_CALL(vkCmdBindTileMemoryQCOM, &params);
@@ -576,6 +648,8 @@ void WINAPI vkCmdBindTileMemoryQCOM(VkCommandBuffer commandBuffer, const VkTileM
 void WINAPI vkCmdBindTransformFeedbackBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBindTransformFeedbackBuffer2InfoEXT *pBindingInfos)
 {
     struct vkCmdBindTransformFeedbackBuffers2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstBinding = firstBinding;
     params.bindingCount = bindingCount;
@@ -586,6 +660,8 @@ void WINAPI vkCmdBindTransformFeedbackBuffers2EXT(VkCommandBuffer commandBuffer,
 void WINAPI vkCmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes)
 {
     struct vkCmdBindTransformFeedbackBuffersEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstBinding = firstBinding;
     params.bindingCount = bindingCount;
@@ -598,6 +674,8 @@ void WINAPI vkCmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer,
 void WINAPI vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer *pBuffers, const VkDeviceSize *pOffsets)
 {
     struct vkCmdBindVertexBuffers_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstBinding = firstBinding;
     params.bindingCount = bindingCount;
@@ -609,6 +687,8 @@ void WINAPI vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t first
 void WINAPI vkCmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes, const VkDeviceSize *pStrides)
 {
     struct vkCmdBindVertexBuffers2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstBinding = firstBinding;
     params.bindingCount = bindingCount;
@@ -622,6 +702,8 @@ void WINAPI vkCmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firs
 void WINAPI vkCmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes, const VkDeviceSize *pStrides)
 {
     struct vkCmdBindVertexBuffers2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstBinding = firstBinding;
     params.bindingCount = bindingCount;
@@ -635,6 +717,8 @@ void WINAPI vkCmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t f
 void WINAPI vkCmdBindVertexBuffers3KHR(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBindVertexBuffer3InfoKHR *pBindingInfos)
 {
     struct vkCmdBindVertexBuffers3KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstBinding = firstBinding;
     params.bindingCount = bindingCount;
@@ -645,6 +729,8 @@ void WINAPI vkCmdBindVertexBuffers3KHR(VkCommandBuffer commandBuffer, uint32_t f
 void WINAPI vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit *pRegions, VkFilter filter)
 {
     struct vkCmdBlitImage_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.srcImage = srcImage;
     params.srcImageLayout = srcImageLayout;
@@ -659,6 +745,8 @@ void WINAPI vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkIm
 void WINAPI vkCmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2 *pBlitImageInfo)
 {
     struct vkCmdBlitImage2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBlitImageInfo = pBlitImageInfo;
     UNIX_CALL(vkCmdBlitImage2, &params);
@@ -667,6 +755,8 @@ void WINAPI vkCmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo
 void WINAPI vkCmdBlitImage2KHR(VkCommandBuffer commandBuffer, const VkBlitImageInfo2 *pBlitImageInfo)
 {
     struct vkCmdBlitImage2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBlitImageInfo = pBlitImageInfo;
     UNIX_CALL(vkCmdBlitImage2KHR, &params);
@@ -675,6 +765,8 @@ void WINAPI vkCmdBlitImage2KHR(VkCommandBuffer commandBuffer, const VkBlitImageI
 void WINAPI vkCmdBuildAccelerationStructureNV(VkCommandBuffer commandBuffer, const VkAccelerationStructureInfoNV *pInfo, VkBuffer instanceData, VkDeviceSize instanceOffset, VkBool32 update, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkBuffer scratch, VkDeviceSize scratchOffset)
 {
     struct vkCmdBuildAccelerationStructureNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     params.instanceData = instanceData;
@@ -690,6 +782,8 @@ void WINAPI vkCmdBuildAccelerationStructureNV(VkCommandBuffer commandBuffer, con
 void WINAPI vkCmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, const VkDeviceAddress *pIndirectDeviceAddresses, const uint32_t *pIndirectStrides, const uint32_t * const*ppMaxPrimitiveCounts)
 {
     struct vkCmdBuildAccelerationStructuresIndirectKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.infoCount = infoCount;
     params.pInfos = pInfos;
@@ -702,6 +796,8 @@ void WINAPI vkCmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandB
 void WINAPI vkCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, const VkAccelerationStructureBuildRangeInfoKHR * const*ppBuildRangeInfos)
 {
     struct vkCmdBuildAccelerationStructuresKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.infoCount = infoCount;
     params.pInfos = pInfos;
@@ -712,6 +808,8 @@ void WINAPI vkCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, u
 void WINAPI vkCmdBuildClusterAccelerationStructureIndirectNV(VkCommandBuffer commandBuffer, const VkClusterAccelerationStructureCommandsInfoNV *pCommandInfos)
 {
     struct vkCmdBuildClusterAccelerationStructureIndirectNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCommandInfos = pCommandInfos;
     UNIX_CALL(vkCmdBuildClusterAccelerationStructureIndirectNV, &params);
@@ -720,6 +818,8 @@ void WINAPI vkCmdBuildClusterAccelerationStructureIndirectNV(VkCommandBuffer com
 void WINAPI vkCmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkMicromapBuildInfoEXT *pInfos)
 {
     struct vkCmdBuildMicromapsEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.infoCount = infoCount;
     params.pInfos = pInfos;
@@ -729,6 +829,8 @@ void WINAPI vkCmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoC
 void WINAPI vkCmdBuildPartitionedAccelerationStructuresNV(VkCommandBuffer commandBuffer, const VkBuildPartitionedAccelerationStructureInfoNV *pBuildInfo)
 {
     struct vkCmdBuildPartitionedAccelerationStructuresNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pBuildInfo = pBuildInfo;
     UNIX_CALL(vkCmdBuildPartitionedAccelerationStructuresNV, &params);
@@ -737,6 +839,8 @@ void WINAPI vkCmdBuildPartitionedAccelerationStructuresNV(VkCommandBuffer comman
 void WINAPI vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment *pAttachments, uint32_t rectCount, const VkClearRect *pRects)
 {
     struct vkCmdClearAttachments_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.attachmentCount = attachmentCount;
     params.pAttachments = pAttachments;
@@ -748,6 +852,8 @@ void WINAPI vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attach
 void WINAPI vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue *pColor, uint32_t rangeCount, const VkImageSubresourceRange *pRanges)
 {
     struct vkCmdClearColorImage_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.image = image;
     params.imageLayout = imageLayout;
@@ -760,6 +866,8 @@ void WINAPI vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, V
 void WINAPI vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue *pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange *pRanges)
 {
     struct vkCmdClearDepthStencilImage_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.image = image;
     params.imageLayout = imageLayout;
@@ -772,6 +880,8 @@ void WINAPI vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage i
 void WINAPI vkCmdControlVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoCodingControlInfoKHR *pCodingControlInfo)
 {
     struct vkCmdControlVideoCodingKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCodingControlInfo = pCodingControlInfo;
     UNIX_CALL(vkCmdControlVideoCodingKHR, &params);
@@ -780,6 +890,8 @@ void WINAPI vkCmdControlVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVi
 void WINAPI vkCmdConvertCooperativeVectorMatrixNV(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkConvertCooperativeVectorMatrixInfoNV *pInfos)
 {
     struct vkCmdConvertCooperativeVectorMatrixNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.infoCount = infoCount;
     params.pInfos = pInfos;
@@ -789,6 +901,8 @@ void WINAPI vkCmdConvertCooperativeVectorMatrixNV(VkCommandBuffer commandBuffer,
 void WINAPI vkCmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureInfoKHR *pInfo)
 {
     struct vkCmdCopyAccelerationStructureKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdCopyAccelerationStructureKHR, &params);
@@ -797,6 +911,8 @@ void WINAPI vkCmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer, con
 void WINAPI vkCmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkCopyAccelerationStructureModeKHR mode)
 {
     struct vkCmdCopyAccelerationStructureNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.dst = dst;
     params.src = src;
@@ -807,6 +923,8 @@ void WINAPI vkCmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAc
 void WINAPI vkCmdCopyAccelerationStructureToMemoryKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureToMemoryInfoKHR *pInfo)
 {
     struct vkCmdCopyAccelerationStructureToMemoryKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdCopyAccelerationStructureToMemoryKHR, &params);
@@ -815,6 +933,8 @@ void WINAPI vkCmdCopyAccelerationStructureToMemoryKHR(VkCommandBuffer commandBuf
 void WINAPI vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy *pRegions)
 {
     struct vkCmdCopyBuffer_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.srcBuffer = srcBuffer;
     params.dstBuffer = dstBuffer;
@@ -826,6 +946,8 @@ void WINAPI vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, V
 void WINAPI vkCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfo)
 {
     struct vkCmdCopyBuffer2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyBufferInfo = pCopyBufferInfo;
     UNIX_CALL(vkCmdCopyBuffer2, &params);
@@ -834,6 +956,8 @@ void WINAPI vkCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferIn
 void WINAPI vkCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfo)
 {
     struct vkCmdCopyBuffer2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyBufferInfo = pCopyBufferInfo;
     UNIX_CALL(vkCmdCopyBuffer2KHR, &params);
@@ -842,6 +966,8 @@ void WINAPI vkCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBuffe
 void WINAPI vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy *pRegions)
 {
     struct vkCmdCopyBufferToImage_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.srcBuffer = srcBuffer;
     params.dstImage = dstImage;
@@ -854,6 +980,8 @@ void WINAPI vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBu
 void WINAPI vkCmdCopyBufferToImage2(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2 *pCopyBufferToImageInfo)
 {
     struct vkCmdCopyBufferToImage2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyBufferToImageInfo = pCopyBufferToImageInfo;
     UNIX_CALL(vkCmdCopyBufferToImage2, &params);
@@ -862,6 +990,8 @@ void WINAPI vkCmdCopyBufferToImage2(VkCommandBuffer commandBuffer, const VkCopyB
 void WINAPI vkCmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2 *pCopyBufferToImageInfo)
 {
     struct vkCmdCopyBufferToImage2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyBufferToImageInfo = pCopyBufferToImageInfo;
     UNIX_CALL(vkCmdCopyBufferToImage2KHR, &params);
@@ -870,6 +1000,8 @@ void WINAPI vkCmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer, const VkCo
 void WINAPI vkCmdCopyGpaSessionResultsAMD(VkCommandBuffer commandBuffer, VkGpaSessionAMD gpaSession)
 {
     struct vkCmdCopyGpaSessionResultsAMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.gpaSession = gpaSession;
     UNIX_CALL(vkCmdCopyGpaSessionResultsAMD, &params);
@@ -878,6 +1010,8 @@ void WINAPI vkCmdCopyGpaSessionResultsAMD(VkCommandBuffer commandBuffer, VkGpaSe
 void WINAPI vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy *pRegions)
 {
     struct vkCmdCopyImage_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.srcImage = srcImage;
     params.srcImageLayout = srcImageLayout;
@@ -891,6 +1025,8 @@ void WINAPI vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkIm
 void WINAPI vkCmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2 *pCopyImageInfo)
 {
     struct vkCmdCopyImage2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyImageInfo = pCopyImageInfo;
     UNIX_CALL(vkCmdCopyImage2, &params);
@@ -899,6 +1035,8 @@ void WINAPI vkCmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo
 void WINAPI vkCmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageInfo2 *pCopyImageInfo)
 {
     struct vkCmdCopyImage2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyImageInfo = pCopyImageInfo;
     UNIX_CALL(vkCmdCopyImage2KHR, &params);
@@ -907,6 +1045,8 @@ void WINAPI vkCmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageI
 void WINAPI vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy *pRegions)
 {
     struct vkCmdCopyImageToBuffer_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.srcImage = srcImage;
     params.srcImageLayout = srcImageLayout;
@@ -919,6 +1059,8 @@ void WINAPI vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcIma
 void WINAPI vkCmdCopyImageToBuffer2(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2 *pCopyImageToBufferInfo)
 {
     struct vkCmdCopyImageToBuffer2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyImageToBufferInfo = pCopyImageToBufferInfo;
     UNIX_CALL(vkCmdCopyImageToBuffer2, &params);
@@ -927,6 +1069,8 @@ void WINAPI vkCmdCopyImageToBuffer2(VkCommandBuffer commandBuffer, const VkCopyI
 void WINAPI vkCmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2 *pCopyImageToBufferInfo)
 {
     struct vkCmdCopyImageToBuffer2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyImageToBufferInfo = pCopyImageToBufferInfo;
     UNIX_CALL(vkCmdCopyImageToBuffer2KHR, &params);
@@ -935,6 +1079,8 @@ void WINAPI vkCmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer, const VkCo
 void WINAPI vkCmdCopyImageToMemoryKHR(VkCommandBuffer commandBuffer, const VkCopyDeviceMemoryImageInfoKHR *pCopyMemoryInfo)
 {
     struct vkCmdCopyImageToMemoryKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyMemoryInfo = pCopyMemoryInfo;
     UNIX_CALL(vkCmdCopyImageToMemoryKHR, &params);
@@ -943,6 +1089,8 @@ void WINAPI vkCmdCopyImageToMemoryKHR(VkCommandBuffer commandBuffer, const VkCop
 void WINAPI vkCmdCopyMemoryIndirectKHR(VkCommandBuffer commandBuffer, const VkCopyMemoryIndirectInfoKHR *pCopyMemoryIndirectInfo)
 {
     struct vkCmdCopyMemoryIndirectKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyMemoryIndirectInfo = pCopyMemoryIndirectInfo;
     UNIX_CALL(vkCmdCopyMemoryIndirectKHR, &params);
@@ -951,6 +1099,8 @@ void WINAPI vkCmdCopyMemoryIndirectKHR(VkCommandBuffer commandBuffer, const VkCo
 void WINAPI vkCmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer, VkDeviceAddress copyBufferAddress, uint32_t copyCount, uint32_t stride)
 {
     struct vkCmdCopyMemoryIndirectNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.copyBufferAddress = copyBufferAddress;
     params.copyCount = copyCount;
@@ -961,6 +1111,8 @@ void WINAPI vkCmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer, VkDeviceAdd
 void WINAPI vkCmdCopyMemoryKHR(VkCommandBuffer commandBuffer, const VkCopyDeviceMemoryInfoKHR *pCopyMemoryInfo)
 {
     struct vkCmdCopyMemoryKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyMemoryInfo = pCopyMemoryInfo;
     UNIX_CALL(vkCmdCopyMemoryKHR, &params);
@@ -969,6 +1121,8 @@ void WINAPI vkCmdCopyMemoryKHR(VkCommandBuffer commandBuffer, const VkCopyDevice
 void WINAPI vkCmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyMemoryToAccelerationStructureInfoKHR *pInfo)
 {
     struct vkCmdCopyMemoryToAccelerationStructureKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdCopyMemoryToAccelerationStructureKHR, &params);
@@ -977,6 +1131,8 @@ void WINAPI vkCmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuf
 void WINAPI vkCmdCopyMemoryToImageIndirectKHR(VkCommandBuffer commandBuffer, const VkCopyMemoryToImageIndirectInfoKHR *pCopyMemoryToImageIndirectInfo)
 {
     struct vkCmdCopyMemoryToImageIndirectKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyMemoryToImageIndirectInfo = pCopyMemoryToImageIndirectInfo;
     UNIX_CALL(vkCmdCopyMemoryToImageIndirectKHR, &params);
@@ -985,6 +1141,8 @@ void WINAPI vkCmdCopyMemoryToImageIndirectKHR(VkCommandBuffer commandBuffer, con
 void WINAPI vkCmdCopyMemoryToImageIndirectNV(VkCommandBuffer commandBuffer, VkDeviceAddress copyBufferAddress, uint32_t copyCount, uint32_t stride, VkImage dstImage, VkImageLayout dstImageLayout, const VkImageSubresourceLayers *pImageSubresources)
 {
     struct vkCmdCopyMemoryToImageIndirectNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.copyBufferAddress = copyBufferAddress;
     params.copyCount = copyCount;
@@ -998,6 +1156,8 @@ void WINAPI vkCmdCopyMemoryToImageIndirectNV(VkCommandBuffer commandBuffer, VkDe
 void WINAPI vkCmdCopyMemoryToImageKHR(VkCommandBuffer commandBuffer, const VkCopyDeviceMemoryImageInfoKHR *pCopyMemoryInfo)
 {
     struct vkCmdCopyMemoryToImageKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyMemoryInfo = pCopyMemoryInfo;
     UNIX_CALL(vkCmdCopyMemoryToImageKHR, &params);
@@ -1006,6 +1166,8 @@ void WINAPI vkCmdCopyMemoryToImageKHR(VkCommandBuffer commandBuffer, const VkCop
 void WINAPI vkCmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMemoryToMicromapInfoEXT *pInfo)
 {
     struct vkCmdCopyMemoryToMicromapEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdCopyMemoryToMicromapEXT, &params);
@@ -1014,6 +1176,8 @@ void WINAPI vkCmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuffer, const Vk
 void WINAPI vkCmdCopyMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapInfoEXT *pInfo)
 {
     struct vkCmdCopyMicromapEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdCopyMicromapEXT, &params);
@@ -1022,6 +1186,8 @@ void WINAPI vkCmdCopyMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMicr
 void WINAPI vkCmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapToMemoryInfoEXT *pInfo)
 {
     struct vkCmdCopyMicromapToMemoryEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdCopyMicromapToMemoryEXT, &params);
@@ -1030,6 +1196,8 @@ void WINAPI vkCmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuffer, const Vk
 void WINAPI vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags)
 {
     struct vkCmdCopyQueryPoolResults_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.queryPool = queryPool;
     params.firstQuery = firstQuery;
@@ -1044,6 +1212,8 @@ void WINAPI vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool
 void WINAPI vkCmdCopyQueryPoolResultsToMemoryKHR(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, const VkStridedDeviceAddressRangeKHR *pDstRange, VkAddressCommandFlagsKHR dstFlags, VkQueryResultFlags queryResultFlags)
 {
     struct vkCmdCopyQueryPoolResultsToMemoryKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.queryPool = queryPool;
     params.firstQuery = firstQuery;
@@ -1057,6 +1227,8 @@ void WINAPI vkCmdCopyQueryPoolResultsToMemoryKHR(VkCommandBuffer commandBuffer,
 void WINAPI vkCmdCopyTensorARM(VkCommandBuffer commandBuffer, const VkCopyTensorInfoARM *pCopyTensorInfo)
 {
     struct vkCmdCopyTensorARM_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCopyTensorInfo = pCopyTensorInfo;
     UNIX_CALL(vkCmdCopyTensorARM, &params);
@@ -1065,6 +1237,8 @@ void WINAPI vkCmdCopyTensorARM(VkCommandBuffer commandBuffer, const VkCopyTensor
 void WINAPI vkCmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, const VkCuLaunchInfoNVX *pLaunchInfo)
 {
     struct vkCmdCuLaunchKernelNVX_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pLaunchInfo = pLaunchInfo;
     UNIX_CALL(vkCmdCuLaunchKernelNVX, &params);
@@ -1073,6 +1247,8 @@ void WINAPI vkCmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, const VkCuLaun
 void WINAPI vkCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT *pMarkerInfo)
 {
     struct vkCmdDebugMarkerBeginEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pMarkerInfo = pMarkerInfo;
     UNIX_CALL(vkCmdDebugMarkerBeginEXT, &params);
@@ -1081,6 +1257,8 @@ void WINAPI vkCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebu
 void WINAPI vkCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer)
 {
     struct vkCmdDebugMarkerEndEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     UNIX_CALL(vkCmdDebugMarkerEndEXT, &params);
 }
@@ -1088,6 +1266,8 @@ void WINAPI vkCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer)
 void WINAPI vkCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT *pMarkerInfo)
 {
     struct vkCmdDebugMarkerInsertEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pMarkerInfo = pMarkerInfo;
     UNIX_CALL(vkCmdDebugMarkerInsertEXT, &params);
@@ -1096,6 +1276,8 @@ void WINAPI vkCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDeb
 void WINAPI vkCmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR *pDecodeInfo)
 {
     struct vkCmdDecodeVideoKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pDecodeInfo = pDecodeInfo;
     UNIX_CALL(vkCmdDecodeVideoKHR, &params);
@@ -1104,6 +1286,8 @@ void WINAPI vkCmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDeco
 void WINAPI vkCmdDecompressMemoryEXT(VkCommandBuffer commandBuffer, const VkDecompressMemoryInfoEXT *pDecompressMemoryInfoEXT)
 {
     struct vkCmdDecompressMemoryEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pDecompressMemoryInfoEXT = pDecompressMemoryInfoEXT;
     UNIX_CALL(vkCmdDecompressMemoryEXT, &params);
@@ -1112,6 +1296,8 @@ void WINAPI vkCmdDecompressMemoryEXT(VkCommandBuffer commandBuffer, const VkDeco
 void WINAPI vkCmdDecompressMemoryIndirectCountEXT(VkCommandBuffer commandBuffer, VkMemoryDecompressionMethodFlagsEXT decompressionMethod, VkDeviceAddress indirectCommandsAddress, VkDeviceAddress indirectCommandsCountAddress, uint32_t maxDecompressionCount, uint32_t stride)
 {
     struct vkCmdDecompressMemoryIndirectCountEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.decompressionMethod = decompressionMethod;
     params.indirectCommandsAddress = indirectCommandsAddress;
@@ -1124,6 +1310,8 @@ void WINAPI vkCmdDecompressMemoryIndirectCountEXT(VkCommandBuffer commandBuffer,
 void WINAPI vkCmdDecompressMemoryIndirectCountNV(VkCommandBuffer commandBuffer, VkDeviceAddress indirectCommandsAddress, VkDeviceAddress indirectCommandsCountAddress, uint32_t stride)
 {
     struct vkCmdDecompressMemoryIndirectCountNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.indirectCommandsAddress = indirectCommandsAddress;
     params.indirectCommandsCountAddress = indirectCommandsCountAddress;
@@ -1134,6 +1322,8 @@ void WINAPI vkCmdDecompressMemoryIndirectCountNV(VkCommandBuffer commandBuffer,
 void WINAPI vkCmdDecompressMemoryNV(VkCommandBuffer commandBuffer, uint32_t decompressRegionCount, const VkDecompressMemoryRegionNV *pDecompressMemoryRegions)
 {
     struct vkCmdDecompressMemoryNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.decompressRegionCount = decompressRegionCount;
     params.pDecompressMemoryRegions = pDecompressMemoryRegions;
@@ -1142,17 +1332,20 @@ void WINAPI vkCmdDecompressMemoryNV(VkCommandBuffer commandBuffer, uint32_t deco
 
 void WINAPI vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
 {
-    struct vkCmdDispatch_params params;
-    params.commandBuffer = commandBuffer;
-    params.groupCountX = groupCountX;
-    params.groupCountY = groupCountY;
-    params.groupCountZ = groupCountZ;
-    UNIX_CALL(vkCmdDispatch, &params);
+    struct vkCmdDispatch_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdDispatch, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->groupCountX = groupCountX;
+    params->groupCountY = groupCountY;
+    params->groupCountZ = groupCountZ;
 }
 
 void WINAPI vkCmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
 {
     struct vkCmdDispatchBase_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.baseGroupX = baseGroupX;
     params.baseGroupY = baseGroupY;
@@ -1166,6 +1359,8 @@ void WINAPI vkCmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX
 void WINAPI vkCmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
 {
     struct vkCmdDispatchBaseKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.baseGroupX = baseGroupX;
     params.baseGroupY = baseGroupY;
@@ -1179,6 +1374,8 @@ void WINAPI vkCmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGro
 void WINAPI vkCmdDispatchDataGraphARM(VkCommandBuffer commandBuffer, VkDataGraphPipelineSessionARM session, const VkDataGraphPipelineDispatchInfoARM *pInfo)
 {
     struct vkCmdDispatchDataGraphARM_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.session = session;
     params.pInfo = pInfo;
@@ -1187,16 +1384,19 @@ void WINAPI vkCmdDispatchDataGraphARM(VkCommandBuffer commandBuffer, VkDataGraph
 
 void WINAPI vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
 {
-    struct vkCmdDispatchIndirect_params params;
-    params.commandBuffer = commandBuffer;
-    params.buffer = buffer;
-    params.offset = offset;
-    UNIX_CALL(vkCmdDispatchIndirect, &params);
+    struct vkCmdDispatchIndirect_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdDispatchIndirect, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->buffer = buffer;
+    params->offset = offset;
 }
 
 void WINAPI vkCmdDispatchIndirect2KHR(VkCommandBuffer commandBuffer, const VkDispatchIndirect2InfoKHR *pInfo)
 {
     struct vkCmdDispatchIndirect2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdDispatchIndirect2KHR, &params);
@@ -1205,6 +1405,8 @@ void WINAPI vkCmdDispatchIndirect2KHR(VkCommandBuffer commandBuffer, const VkDis
 void WINAPI vkCmdDispatchTileQCOM(VkCommandBuffer commandBuffer, const VkDispatchTileInfoQCOM *pDispatchTileInfo)
 {
     struct vkCmdDispatchTileQCOM_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pDispatchTileInfo = pDispatchTileInfo;
     UNIX_CALL(vkCmdDispatchTileQCOM, &params);
@@ -1212,18 +1414,21 @@ void WINAPI vkCmdDispatchTileQCOM(VkCommandBuffer commandBuffer, const VkDispatc
 
 void WINAPI vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
 {
-    struct vkCmdDraw_params params;
-    params.commandBuffer = commandBuffer;
-    params.vertexCount = vertexCount;
-    params.instanceCount = instanceCount;
-    params.firstVertex = firstVertex;
-    params.firstInstance = firstInstance;
-    UNIX_CALL(vkCmdDraw, &params);
+    struct vkCmdDraw_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdDraw, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->vertexCount = vertexCount;
+    params->instanceCount = instanceCount;
+    params->firstVertex = firstVertex;
+    params->firstInstance = firstInstance;
 }
 
 void WINAPI vkCmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
 {
     struct vkCmdDrawClusterHUAWEI_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.groupCountX = groupCountX;
     params.groupCountY = groupCountY;
@@ -1234,6 +1439,8 @@ void WINAPI vkCmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, uint32_t group
 void WINAPI vkCmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
 {
     struct vkCmdDrawClusterIndirectHUAWEI_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -1242,30 +1449,34 @@ void WINAPI vkCmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandBuffer, VkBuff
 
 void WINAPI vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
 {
-    struct vkCmdDrawIndexed_params params;
-    params.commandBuffer = commandBuffer;
-    params.indexCount = indexCount;
-    params.instanceCount = instanceCount;
-    params.firstIndex = firstIndex;
-    params.vertexOffset = vertexOffset;
-    params.firstInstance = firstInstance;
-    UNIX_CALL(vkCmdDrawIndexed, &params);
+    struct vkCmdDrawIndexed_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdDrawIndexed, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->indexCount = indexCount;
+    params->instanceCount = instanceCount;
+    params->firstIndex = firstIndex;
+    params->vertexOffset = vertexOffset;
+    params->firstInstance = firstInstance;
 }
 
 void WINAPI vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
 {
-    struct vkCmdDrawIndexedIndirect_params params;
-    params.commandBuffer = commandBuffer;
-    params.buffer = buffer;
-    params.offset = offset;
-    params.drawCount = drawCount;
-    params.stride = stride;
-    UNIX_CALL(vkCmdDrawIndexedIndirect, &params);
+    struct vkCmdDrawIndexedIndirect_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdDrawIndexedIndirect, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->buffer = buffer;
+    params->offset = offset;
+    params->drawCount = drawCount;
+    params->stride = stride;
 }
 
 void WINAPI vkCmdDrawIndexedIndirect2KHR(VkCommandBuffer commandBuffer, const VkDrawIndirect2InfoKHR *pInfo)
 {
     struct vkCmdDrawIndexedIndirect2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdDrawIndexedIndirect2KHR, &params);
@@ -1273,20 +1484,23 @@ void WINAPI vkCmdDrawIndexedIndirect2KHR(VkCommandBuffer commandBuffer, const Vk
 
 void WINAPI vkCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
 {
-    struct vkCmdDrawIndexedIndirectCount_params params;
-    params.commandBuffer = commandBuffer;
-    params.buffer = buffer;
-    params.offset = offset;
-    params.countBuffer = countBuffer;
-    params.countBufferOffset = countBufferOffset;
-    params.maxDrawCount = maxDrawCount;
-    params.stride = stride;
-    UNIX_CALL(vkCmdDrawIndexedIndirectCount, &params);
+    struct vkCmdDrawIndexedIndirectCount_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdDrawIndexedIndirectCount, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->buffer = buffer;
+    params->offset = offset;
+    params->countBuffer = countBuffer;
+    params->countBufferOffset = countBufferOffset;
+    params->maxDrawCount = maxDrawCount;
+    params->stride = stride;
 }
 
 void WINAPI vkCmdDrawIndexedIndirectCount2KHR(VkCommandBuffer commandBuffer, const VkDrawIndirectCount2InfoKHR *pInfo)
 {
     struct vkCmdDrawIndexedIndirectCount2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdDrawIndexedIndirectCount2KHR, &params);
@@ -1295,6 +1509,8 @@ void WINAPI vkCmdDrawIndexedIndirectCount2KHR(VkCommandBuffer commandBuffer, con
 void WINAPI vkCmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
 {
     struct vkCmdDrawIndexedIndirectCountAMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -1308,6 +1524,8 @@ void WINAPI vkCmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBu
 void WINAPI vkCmdDrawIndexedIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
 {
     struct vkCmdDrawIndexedIndirectCountKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -1320,18 +1538,21 @@ void WINAPI vkCmdDrawIndexedIndirectCountKHR(VkCommandBuffer commandBuffer, VkBu
 
 void WINAPI vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
 {
-    struct vkCmdDrawIndirect_params params;
-    params.commandBuffer = commandBuffer;
-    params.buffer = buffer;
-    params.offset = offset;
-    params.drawCount = drawCount;
-    params.stride = stride;
-    UNIX_CALL(vkCmdDrawIndirect, &params);
+    struct vkCmdDrawIndirect_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdDrawIndirect, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->buffer = buffer;
+    params->offset = offset;
+    params->drawCount = drawCount;
+    params->stride = stride;
 }
 
 void WINAPI vkCmdDrawIndirect2KHR(VkCommandBuffer commandBuffer, const VkDrawIndirect2InfoKHR *pInfo)
 {
     struct vkCmdDrawIndirect2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdDrawIndirect2KHR, &params);
@@ -1340,6 +1561,8 @@ void WINAPI vkCmdDrawIndirect2KHR(VkCommandBuffer commandBuffer, const VkDrawInd
 void WINAPI vkCmdDrawIndirectByteCount2EXT(VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance, const VkBindTransformFeedbackBuffer2InfoEXT *pCounterInfo, uint32_t counterOffset, uint32_t vertexStride)
 {
     struct vkCmdDrawIndirectByteCount2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.instanceCount = instanceCount;
     params.firstInstance = firstInstance;
@@ -1352,6 +1575,8 @@ void WINAPI vkCmdDrawIndirectByteCount2EXT(VkCommandBuffer commandBuffer, uint32
 void WINAPI vkCmdDrawIndirectByteCountEXT(VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance, VkBuffer counterBuffer, VkDeviceSize counterBufferOffset, uint32_t counterOffset, uint32_t vertexStride)
 {
     struct vkCmdDrawIndirectByteCountEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.instanceCount = instanceCount;
     params.firstInstance = firstInstance;
@@ -1364,20 +1589,23 @@ void WINAPI vkCmdDrawIndirectByteCountEXT(VkCommandBuffer commandBuffer, uint32_
 
 void WINAPI vkCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
 {
-    struct vkCmdDrawIndirectCount_params params;
-    params.commandBuffer = commandBuffer;
-    params.buffer = buffer;
-    params.offset = offset;
-    params.countBuffer = countBuffer;
-    params.countBufferOffset = countBufferOffset;
-    params.maxDrawCount = maxDrawCount;
-    params.stride = stride;
-    UNIX_CALL(vkCmdDrawIndirectCount, &params);
+    struct vkCmdDrawIndirectCount_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdDrawIndirectCount, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->buffer = buffer;
+    params->offset = offset;
+    params->countBuffer = countBuffer;
+    params->countBufferOffset = countBufferOffset;
+    params->maxDrawCount = maxDrawCount;
+    params->stride = stride;
 }
 
 void WINAPI vkCmdDrawIndirectCount2KHR(VkCommandBuffer commandBuffer, const VkDrawIndirectCount2InfoKHR *pInfo)
 {
     struct vkCmdDrawIndirectCount2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdDrawIndirectCount2KHR, &params);
@@ -1386,6 +1614,8 @@ void WINAPI vkCmdDrawIndirectCount2KHR(VkCommandBuffer commandBuffer, const VkDr
 void WINAPI vkCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
 {
     struct vkCmdDrawIndirectCountAMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -1399,6 +1629,8 @@ void WINAPI vkCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer bu
 void WINAPI vkCmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
 {
     struct vkCmdDrawIndirectCountKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -1412,6 +1644,8 @@ void WINAPI vkCmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer bu
 void WINAPI vkCmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
 {
     struct vkCmdDrawMeshTasksEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.groupCountX = groupCountX;
     params.groupCountY = groupCountY;
@@ -1422,6 +1656,8 @@ void WINAPI vkCmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupC
 void WINAPI vkCmdDrawMeshTasksIndirect2EXT(VkCommandBuffer commandBuffer, const VkDrawIndirect2InfoKHR *pInfo)
 {
     struct vkCmdDrawMeshTasksIndirect2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdDrawMeshTasksIndirect2EXT, &params);
@@ -1430,6 +1666,8 @@ void WINAPI vkCmdDrawMeshTasksIndirect2EXT(VkCommandBuffer commandBuffer, const
 void WINAPI vkCmdDrawMeshTasksIndirectCount2EXT(VkCommandBuffer commandBuffer, const VkDrawIndirectCount2InfoKHR *pInfo)
 {
     struct vkCmdDrawMeshTasksIndirectCount2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdDrawMeshTasksIndirectCount2EXT, &params);
@@ -1438,6 +1676,8 @@ void WINAPI vkCmdDrawMeshTasksIndirectCount2EXT(VkCommandBuffer commandBuffer, c
 void WINAPI vkCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
 {
     struct vkCmdDrawMeshTasksIndirectCountEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -1451,6 +1691,8 @@ void WINAPI vkCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer commandBuffer, Vk
 void WINAPI vkCmdDrawMeshTasksIndirectCountNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
 {
     struct vkCmdDrawMeshTasksIndirectCountNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -1464,6 +1706,8 @@ void WINAPI vkCmdDrawMeshTasksIndirectCountNV(VkCommandBuffer commandBuffer, VkB
 void WINAPI vkCmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
 {
     struct vkCmdDrawMeshTasksIndirectEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -1475,6 +1719,8 @@ void WINAPI vkCmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffe
 void WINAPI vkCmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
 {
     struct vkCmdDrawMeshTasksIndirectNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.buffer = buffer;
     params.offset = offset;
@@ -1486,6 +1732,8 @@ void WINAPI vkCmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer
 void WINAPI vkCmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask)
 {
     struct vkCmdDrawMeshTasksNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.taskCount = taskCount;
     params.firstTask = firstTask;
@@ -1495,6 +1743,8 @@ void WINAPI vkCmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCou
 void WINAPI vkCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT *pVertexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride)
 {
     struct vkCmdDrawMultiEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.drawCount = drawCount;
     params.pVertexInfo = pVertexInfo;
@@ -1507,6 +1757,8 @@ void WINAPI vkCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount,
 void WINAPI vkCmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawIndexedInfoEXT *pIndexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride, const int32_t *pVertexOffset)
 {
     struct vkCmdDrawMultiIndexedEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.drawCount = drawCount;
     params.pIndexInfo = pIndexInfo;
@@ -1520,6 +1772,8 @@ void WINAPI vkCmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer, uint32_t dra
 void WINAPI vkCmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR *pEncodeInfo)
 {
     struct vkCmdEncodeVideoKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pEncodeInfo = pEncodeInfo;
     UNIX_CALL(vkCmdEncodeVideoKHR, &params);
@@ -1528,6 +1782,8 @@ void WINAPI vkCmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEnco
 void WINAPI vkCmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer)
 {
     struct vkCmdEndConditionalRenderingEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     UNIX_CALL(vkCmdEndConditionalRenderingEXT, &params);
 }
@@ -1535,6 +1791,8 @@ void WINAPI vkCmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer)
 void WINAPI vkCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer)
 {
     struct vkCmdEndDebugUtilsLabelEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     UNIX_CALL(vkCmdEndDebugUtilsLabelEXT, &params);
 }
@@ -1542,6 +1800,8 @@ void WINAPI vkCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer)
 void WINAPI vkCmdEndGpaSampleAMD(VkCommandBuffer commandBuffer, VkGpaSessionAMD gpaSession, uint32_t sampleID)
 {
     struct vkCmdEndGpaSampleAMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.gpaSession = gpaSession;
     params.sampleID = sampleID;
@@ -1551,6 +1811,8 @@ void WINAPI vkCmdEndGpaSampleAMD(VkCommandBuffer commandBuffer, VkGpaSessionAMD
 VkResult WINAPI vkCmdEndGpaSessionAMD(VkCommandBuffer commandBuffer, VkGpaSessionAMD gpaSession)
 {
     struct vkCmdEndGpaSessionAMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.gpaSession = gpaSession;
     UNIX_CALL_CHECKED(vkCmdEndGpaSessionAMD, &params);
@@ -1560,6 +1822,8 @@ VkResult WINAPI vkCmdEndGpaSessionAMD(VkCommandBuffer commandBuffer, VkGpaSessio
 void WINAPI vkCmdEndPerTileExecutionQCOM(VkCommandBuffer commandBuffer, const VkPerTileEndInfoQCOM *pPerTileEndInfo)
 {
     struct vkCmdEndPerTileExecutionQCOM_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pPerTileEndInfo = pPerTileEndInfo;
     UNIX_CALL(vkCmdEndPerTileExecutionQCOM, &params);
@@ -1568,6 +1832,8 @@ void WINAPI vkCmdEndPerTileExecutionQCOM(VkCommandBuffer commandBuffer, const Vk
 void WINAPI vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query)
 {
     struct vkCmdEndQuery_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.queryPool = queryPool;
     params.query = query;
@@ -1577,6 +1843,8 @@ void WINAPI vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
 void WINAPI vkCmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, uint32_t index)
 {
     struct vkCmdEndQueryIndexedEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.queryPool = queryPool;
     params.query = query;
@@ -1586,14 +1854,17 @@ void WINAPI vkCmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool q
 
 void WINAPI vkCmdEndRenderPass(VkCommandBuffer commandBuffer)
 {
-    struct vkCmdEndRenderPass_params params;
-    params.commandBuffer = commandBuffer;
-    UNIX_CALL(vkCmdEndRenderPass, &params);
+    struct vkCmdEndRenderPass_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdEndRenderPass, sizeof(*params));
+    params->commandBuffer = commandBuffer;
 }
 
 void WINAPI vkCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo)
 {
     struct vkCmdEndRenderPass2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pSubpassEndInfo = pSubpassEndInfo;
     UNIX_CALL(vkCmdEndRenderPass2, &params);
@@ -1602,6 +1873,8 @@ void WINAPI vkCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEn
 void WINAPI vkCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo)
 {
     struct vkCmdEndRenderPass2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pSubpassEndInfo = pSubpassEndInfo;
     UNIX_CALL(vkCmdEndRenderPass2KHR, &params);
@@ -1610,6 +1883,8 @@ void WINAPI vkCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpas
 void WINAPI vkCmdEndRendering(VkCommandBuffer commandBuffer)
 {
     struct vkCmdEndRendering_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     UNIX_CALL(vkCmdEndRendering, &params);
 }
@@ -1617,6 +1892,8 @@ void WINAPI vkCmdEndRendering(VkCommandBuffer commandBuffer)
 void WINAPI vkCmdEndRendering2EXT(VkCommandBuffer commandBuffer, const VkRenderingEndInfoKHR *pRenderingEndInfo)
 {
     struct vkCmdEndRendering2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pRenderingEndInfo = pRenderingEndInfo;
     UNIX_CALL(vkCmdEndRendering2EXT, &params);
@@ -1625,6 +1902,8 @@ void WINAPI vkCmdEndRendering2EXT(VkCommandBuffer commandBuffer, const VkRenderi
 void WINAPI vkCmdEndRendering2KHR(VkCommandBuffer commandBuffer, const VkRenderingEndInfoKHR *pRenderingEndInfo)
 {
     struct vkCmdEndRendering2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pRenderingEndInfo = pRenderingEndInfo;
     UNIX_CALL(vkCmdEndRendering2KHR, &params);
@@ -1633,6 +1912,8 @@ void WINAPI vkCmdEndRendering2KHR(VkCommandBuffer commandBuffer, const VkRenderi
 void WINAPI vkCmdEndRenderingKHR(VkCommandBuffer commandBuffer)
 {
     struct vkCmdEndRenderingKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     UNIX_CALL(vkCmdEndRenderingKHR, &params);
 }
@@ -1640,6 +1921,8 @@ void WINAPI vkCmdEndRenderingKHR(VkCommandBuffer commandBuffer)
 void WINAPI vkCmdEndShaderInstrumentationARM(VkCommandBuffer commandBuffer)
 {
     struct vkCmdEndShaderInstrumentationARM_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     UNIX_CALL(vkCmdEndShaderInstrumentationARM, &params);
 }
@@ -1647,6 +1930,8 @@ void WINAPI vkCmdEndShaderInstrumentationARM(VkCommandBuffer commandBuffer)
 void WINAPI vkCmdEndTransformFeedback2EXT(VkCommandBuffer commandBuffer, uint32_t firstCounterRange, uint32_t counterRangeCount, const VkBindTransformFeedbackBuffer2InfoEXT *pCounterInfos)
 {
     struct vkCmdEndTransformFeedback2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstCounterRange = firstCounterRange;
     params.counterRangeCount = counterRangeCount;
@@ -1657,6 +1942,8 @@ void WINAPI vkCmdEndTransformFeedback2EXT(VkCommandBuffer commandBuffer, uint32_
 void WINAPI vkCmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer *pCounterBuffers, const VkDeviceSize *pCounterBufferOffsets)
 {
     struct vkCmdEndTransformFeedbackEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstCounterBuffer = firstCounterBuffer;
     params.counterBufferCount = counterBufferCount;
@@ -1668,6 +1955,8 @@ void WINAPI vkCmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t
 void WINAPI vkCmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoEndCodingInfoKHR *pEndCodingInfo)
 {
     struct vkCmdEndVideoCodingKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pEndCodingInfo = pEndCodingInfo;
     UNIX_CALL(vkCmdEndVideoCodingKHR, &params);
@@ -1676,6 +1965,8 @@ void WINAPI vkCmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoE
 void WINAPI vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers)
 {
     struct vkCmdExecuteCommands_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.commandBufferCount = commandBufferCount;
     params.pCommandBuffers = pCommandBuffers;
@@ -1685,6 +1976,8 @@ void WINAPI vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t command
 void WINAPI vkCmdExecuteGeneratedCommandsEXT(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed, const VkGeneratedCommandsInfoEXT *pGeneratedCommandsInfo)
 {
     struct vkCmdExecuteGeneratedCommandsEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.isPreprocessed = isPreprocessed;
     params.pGeneratedCommandsInfo = pGeneratedCommandsInfo;
@@ -1694,6 +1987,8 @@ void WINAPI vkCmdExecuteGeneratedCommandsEXT(VkCommandBuffer commandBuffer, VkBo
 void WINAPI vkCmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed, const VkGeneratedCommandsInfoNV *pGeneratedCommandsInfo)
 {
     struct vkCmdExecuteGeneratedCommandsNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.isPreprocessed = isPreprocessed;
     params.pGeneratedCommandsInfo = pGeneratedCommandsInfo;
@@ -1703,6 +1998,8 @@ void WINAPI vkCmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBoo
 void WINAPI vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data)
 {
     struct vkCmdFillBuffer_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.dstBuffer = dstBuffer;
     params.dstOffset = dstOffset;
@@ -1714,6 +2011,8 @@ void WINAPI vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, V
 void WINAPI vkCmdFillMemoryKHR(VkCommandBuffer commandBuffer, const VkDeviceAddressRangeKHR *pDstRange, VkAddressCommandFlagsKHR dstFlags, uint32_t data)
 {
     struct vkCmdFillMemoryKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pDstRange = pDstRange;
     params.dstFlags = dstFlags;
@@ -1724,6 +2023,8 @@ void WINAPI vkCmdFillMemoryKHR(VkCommandBuffer commandBuffer, const VkDeviceAddr
 void WINAPI vkCmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT *pLabelInfo)
 {
     struct vkCmdInsertDebugUtilsLabelEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pLabelInfo = pLabelInfo;
     UNIX_CALL(vkCmdInsertDebugUtilsLabelEXT, &params);
@@ -1731,15 +2032,18 @@ void WINAPI vkCmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const V
 
 void WINAPI vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents)
 {
-    struct vkCmdNextSubpass_params params;
-    params.commandBuffer = commandBuffer;
-    params.contents = contents;
-    UNIX_CALL(vkCmdNextSubpass, &params);
+    struct vkCmdNextSubpass_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdNextSubpass, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->contents = contents;
 }
 
 void WINAPI vkCmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo *pSubpassBeginInfo, const VkSubpassEndInfo *pSubpassEndInfo)
 {
     struct vkCmdNextSubpass2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pSubpassBeginInfo = pSubpassBeginInfo;
     params.pSubpassEndInfo = pSubpassEndInfo;
@@ -1749,6 +2053,8 @@ void WINAPI vkCmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBegi
 void WINAPI vkCmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo *pSubpassBeginInfo, const VkSubpassEndInfo *pSubpassEndInfo)
 {
     struct vkCmdNextSubpass2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pSubpassBeginInfo = pSubpassBeginInfo;
     params.pSubpassEndInfo = pSubpassEndInfo;
@@ -1758,6 +2064,8 @@ void WINAPI vkCmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassB
 void WINAPI vkCmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer, VkOpticalFlowSessionNV session, const VkOpticalFlowExecuteInfoNV *pExecuteInfo)
 {
     struct vkCmdOpticalFlowExecuteNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.session = session;
     params.pExecuteInfo = pExecuteInfo;
@@ -1767,6 +2075,8 @@ void WINAPI vkCmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer, VkOpticalFl
 void WINAPI vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers)
 {
     struct vkCmdPipelineBarrier_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.srcStageMask = srcStageMask;
     params.dstStageMask = dstStageMask;
@@ -1783,6 +2093,8 @@ void WINAPI vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageF
 void WINAPI vkCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo)
 {
     struct vkCmdPipelineBarrier2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pDependencyInfo = pDependencyInfo;
     UNIX_CALL(vkCmdPipelineBarrier2, &params);
@@ -1791,6 +2103,8 @@ void WINAPI vkCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDepende
 void WINAPI vkCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo)
 {
     struct vkCmdPipelineBarrier2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pDependencyInfo = pDependencyInfo;
     UNIX_CALL(vkCmdPipelineBarrier2KHR, &params);
@@ -1799,6 +2113,8 @@ void WINAPI vkCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDepe
 void WINAPI vkCmdPreprocessGeneratedCommandsEXT(VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoEXT *pGeneratedCommandsInfo, VkCommandBuffer stateCommandBuffer)
 {
     struct vkCmdPreprocessGeneratedCommandsEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pGeneratedCommandsInfo = pGeneratedCommandsInfo;
     params.stateCommandBuffer = stateCommandBuffer;
@@ -1808,6 +2124,8 @@ void WINAPI vkCmdPreprocessGeneratedCommandsEXT(VkCommandBuffer commandBuffer, c
 void WINAPI vkCmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoNV *pGeneratedCommandsInfo)
 {
     struct vkCmdPreprocessGeneratedCommandsNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pGeneratedCommandsInfo = pGeneratedCommandsInfo;
     UNIX_CALL(vkCmdPreprocessGeneratedCommandsNV, &params);
@@ -1816,6 +2134,8 @@ void WINAPI vkCmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer, co
 void WINAPI vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void *pValues)
 {
     struct vkCmdPushConstants_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.layout = layout;
     params.stageFlags = stageFlags;
@@ -1828,6 +2148,8 @@ void WINAPI vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout l
 void WINAPI vkCmdPushConstants2(VkCommandBuffer commandBuffer, const VkPushConstantsInfo *pPushConstantsInfo)
 {
     struct vkCmdPushConstants2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pPushConstantsInfo = pPushConstantsInfo;
     UNIX_CALL(vkCmdPushConstants2, &params);
@@ -1836,6 +2158,8 @@ void WINAPI vkCmdPushConstants2(VkCommandBuffer commandBuffer, const VkPushConst
 void WINAPI vkCmdPushConstants2KHR(VkCommandBuffer commandBuffer, const VkPushConstantsInfo *pPushConstantsInfo)
 {
     struct vkCmdPushConstants2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pPushConstantsInfo = pPushConstantsInfo;
     UNIX_CALL(vkCmdPushConstants2KHR, &params);
@@ -1844,6 +2168,8 @@ void WINAPI vkCmdPushConstants2KHR(VkCommandBuffer commandBuffer, const VkPushCo
 void WINAPI vkCmdPushDataEXT(VkCommandBuffer commandBuffer, const VkPushDataInfoEXT *pPushDataInfo)
 {
     struct vkCmdPushDataEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pPushDataInfo = pPushDataInfo;
     UNIX_CALL(vkCmdPushDataEXT, &params);
@@ -1852,6 +2178,8 @@ void WINAPI vkCmdPushDataEXT(VkCommandBuffer commandBuffer, const VkPushDataInfo
 void WINAPI vkCmdPushDescriptorSet(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites)
 {
     struct vkCmdPushDescriptorSet_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineBindPoint = pipelineBindPoint;
     params.layout = layout;
@@ -1864,6 +2192,8 @@ void WINAPI vkCmdPushDescriptorSet(VkCommandBuffer commandBuffer, VkPipelineBind
 void WINAPI vkCmdPushDescriptorSet2(VkCommandBuffer commandBuffer, const VkPushDescriptorSetInfo *pPushDescriptorSetInfo)
 {
     struct vkCmdPushDescriptorSet2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pPushDescriptorSetInfo = pPushDescriptorSetInfo;
     UNIX_CALL(vkCmdPushDescriptorSet2, &params);
@@ -1872,6 +2202,8 @@ void WINAPI vkCmdPushDescriptorSet2(VkCommandBuffer commandBuffer, const VkPushD
 void WINAPI vkCmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffer, const VkPushDescriptorSetInfo *pPushDescriptorSetInfo)
 {
     struct vkCmdPushDescriptorSet2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pPushDescriptorSetInfo = pPushDescriptorSetInfo;
     UNIX_CALL(vkCmdPushDescriptorSet2KHR, &params);
@@ -1880,6 +2212,8 @@ void WINAPI vkCmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffer, const VkPu
 void WINAPI vkCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites)
 {
     struct vkCmdPushDescriptorSetKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineBindPoint = pipelineBindPoint;
     params.layout = layout;
@@ -1892,6 +2226,8 @@ void WINAPI vkCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineB
 void WINAPI vkCmdPushDescriptorSetWithTemplate(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void *pData)
 {
     struct vkCmdPushDescriptorSetWithTemplate_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.descriptorUpdateTemplate = descriptorUpdateTemplate;
     params.layout = layout;
@@ -1903,6 +2239,8 @@ void WINAPI vkCmdPushDescriptorSetWithTemplate(VkCommandBuffer commandBuffer, Vk
 void WINAPI vkCmdPushDescriptorSetWithTemplate2(VkCommandBuffer commandBuffer, const VkPushDescriptorSetWithTemplateInfo *pPushDescriptorSetWithTemplateInfo)
 {
     struct vkCmdPushDescriptorSetWithTemplate2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pPushDescriptorSetWithTemplateInfo = pPushDescriptorSetWithTemplateInfo;
     UNIX_CALL(vkCmdPushDescriptorSetWithTemplate2, &params);
@@ -1911,6 +2249,8 @@ void WINAPI vkCmdPushDescriptorSetWithTemplate2(VkCommandBuffer commandBuffer, c
 void WINAPI vkCmdPushDescriptorSetWithTemplate2KHR(VkCommandBuffer commandBuffer, const VkPushDescriptorSetWithTemplateInfo *pPushDescriptorSetWithTemplateInfo)
 {
     struct vkCmdPushDescriptorSetWithTemplate2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pPushDescriptorSetWithTemplateInfo = pPushDescriptorSetWithTemplateInfo;
     UNIX_CALL(vkCmdPushDescriptorSetWithTemplate2KHR, &params);
@@ -1919,6 +2259,8 @@ void WINAPI vkCmdPushDescriptorSetWithTemplate2KHR(VkCommandBuffer commandBuffer
 void WINAPI vkCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void *pData)
 {
     struct vkCmdPushDescriptorSetWithTemplateKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.descriptorUpdateTemplate = descriptorUpdateTemplate;
     params.layout = layout;
@@ -1930,6 +2272,8 @@ void WINAPI vkCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer,
 void WINAPI vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
 {
     struct vkCmdResetEvent_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.event = event;
     params.stageMask = stageMask;
@@ -1939,6 +2283,8 @@ void WINAPI vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipe
 void WINAPI vkCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask)
 {
     struct vkCmdResetEvent2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.event = event;
     params.stageMask = stageMask;
@@ -1948,6 +2294,8 @@ void WINAPI vkCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPip
 void WINAPI vkCmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask)
 {
     struct vkCmdResetEvent2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.event = event;
     params.stageMask = stageMask;
@@ -1957,6 +2305,8 @@ void WINAPI vkCmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, Vk
 void WINAPI vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
 {
     struct vkCmdResetQueryPool_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.queryPool = queryPool;
     params.firstQuery = firstQuery;
@@ -1967,6 +2317,8 @@ void WINAPI vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool query
 void WINAPI vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve *pRegions)
 {
     struct vkCmdResolveImage_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.srcImage = srcImage;
     params.srcImageLayout = srcImageLayout;
@@ -1980,6 +2332,8 @@ void WINAPI vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, V
 void WINAPI vkCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2 *pResolveImageInfo)
 {
     struct vkCmdResolveImage2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pResolveImageInfo = pResolveImageInfo;
     UNIX_CALL(vkCmdResolveImage2, &params);
@@ -1988,6 +2342,8 @@ void WINAPI vkCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveIma
 void WINAPI vkCmdResolveImage2KHR(VkCommandBuffer commandBuffer, const VkResolveImageInfo2 *pResolveImageInfo)
 {
     struct vkCmdResolveImage2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pResolveImageInfo = pResolveImageInfo;
     UNIX_CALL(vkCmdResolveImage2KHR, &params);
@@ -1996,6 +2352,8 @@ void WINAPI vkCmdResolveImage2KHR(VkCommandBuffer commandBuffer, const VkResolve
 void WINAPI vkCmdSetAlphaToCoverageEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToCoverageEnable)
 {
     struct vkCmdSetAlphaToCoverageEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.alphaToCoverageEnable = alphaToCoverageEnable;
     UNIX_CALL(vkCmdSetAlphaToCoverageEnableEXT, &params);
@@ -2004,6 +2362,8 @@ void WINAPI vkCmdSetAlphaToCoverageEnableEXT(VkCommandBuffer commandBuffer, VkBo
 void WINAPI vkCmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToOneEnable)
 {
     struct vkCmdSetAlphaToOneEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.alphaToOneEnable = alphaToOneEnable;
     UNIX_CALL(vkCmdSetAlphaToOneEnableEXT, &params);
@@ -2012,6 +2372,8 @@ void WINAPI vkCmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer, VkBool32
 void WINAPI vkCmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer commandBuffer, VkImageAspectFlags aspectMask)
 {
     struct vkCmdSetAttachmentFeedbackLoopEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.aspectMask = aspectMask;
     UNIX_CALL(vkCmdSetAttachmentFeedbackLoopEnableEXT, &params);
@@ -2020,6 +2382,8 @@ void WINAPI vkCmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer commandBuffe
 void WINAPI vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4])
 {
     struct vkCmdSetBlendConstants_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.blendConstants = blendConstants;
     UNIX_CALL(vkCmdSetBlendConstants, &params);
@@ -2028,6 +2392,8 @@ void WINAPI vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float bl
 void WINAPI vkCmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void *pCheckpointMarker)
 {
     struct vkCmdSetCheckpointNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pCheckpointMarker = pCheckpointMarker;
     UNIX_CALL(vkCmdSetCheckpointNV, &params);
@@ -2036,6 +2402,8 @@ void WINAPI vkCmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void *pChe
 void WINAPI vkCmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuffer, VkCoarseSampleOrderTypeNV sampleOrderType, uint32_t customSampleOrderCount, const VkCoarseSampleOrderCustomNV *pCustomSampleOrders)
 {
     struct vkCmdSetCoarseSampleOrderNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.sampleOrderType = sampleOrderType;
     params.customSampleOrderCount = customSampleOrderCount;
@@ -2046,6 +2414,8 @@ void WINAPI vkCmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuffer, VkCoarseS
 void WINAPI vkCmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendAdvancedEXT *pColorBlendAdvanced)
 {
     struct vkCmdSetColorBlendAdvancedEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstAttachment = firstAttachment;
     params.attachmentCount = attachmentCount;
@@ -2056,6 +2426,8 @@ void WINAPI vkCmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBuffer, uint32_
 void WINAPI vkCmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkBool32 *pColorBlendEnables)
 {
     struct vkCmdSetColorBlendEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstAttachment = firstAttachment;
     params.attachmentCount = attachmentCount;
@@ -2066,6 +2438,8 @@ void WINAPI vkCmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer, uint32_t
 void WINAPI vkCmdSetColorBlendEquationEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendEquationEXT *pColorBlendEquations)
 {
     struct vkCmdSetColorBlendEquationEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstAttachment = firstAttachment;
     params.attachmentCount = attachmentCount;
@@ -2076,6 +2450,8 @@ void WINAPI vkCmdSetColorBlendEquationEXT(VkCommandBuffer commandBuffer, uint32_
 void WINAPI vkCmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkBool32 *pColorWriteEnables)
 {
     struct vkCmdSetColorWriteEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.attachmentCount = attachmentCount;
     params.pColorWriteEnables = pColorWriteEnables;
@@ -2085,6 +2461,8 @@ void WINAPI vkCmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t
 void WINAPI vkCmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorComponentFlags *pColorWriteMasks)
 {
     struct vkCmdSetColorWriteMaskEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstAttachment = firstAttachment;
     params.attachmentCount = attachmentCount;
@@ -2095,6 +2473,8 @@ void WINAPI vkCmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer, uint32_t fi
 void WINAPI vkCmdSetComputeOccupancyPriorityNV(VkCommandBuffer commandBuffer, const VkComputeOccupancyPriorityParametersNV *pParameters)
 {
     struct vkCmdSetComputeOccupancyPriorityNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pParameters = pParameters;
     UNIX_CALL(vkCmdSetComputeOccupancyPriorityNV, &params);
@@ -2103,6 +2483,8 @@ void WINAPI vkCmdSetComputeOccupancyPriorityNV(VkCommandBuffer commandBuffer, co
 void WINAPI vkCmdSetConservativeRasterizationModeEXT(VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode)
 {
     struct vkCmdSetConservativeRasterizationModeEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.conservativeRasterizationMode = conservativeRasterizationMode;
     UNIX_CALL(vkCmdSetConservativeRasterizationModeEXT, &params);
@@ -2111,6 +2493,8 @@ void WINAPI vkCmdSetConservativeRasterizationModeEXT(VkCommandBuffer commandBuff
 void WINAPI vkCmdSetCoverageModulationModeNV(VkCommandBuffer commandBuffer, VkCoverageModulationModeNV coverageModulationMode)
 {
     struct vkCmdSetCoverageModulationModeNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.coverageModulationMode = coverageModulationMode;
     UNIX_CALL(vkCmdSetCoverageModulationModeNV, &params);
@@ -2119,6 +2503,8 @@ void WINAPI vkCmdSetCoverageModulationModeNV(VkCommandBuffer commandBuffer, VkCo
 void WINAPI vkCmdSetCoverageModulationTableEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageModulationTableEnable)
 {
     struct vkCmdSetCoverageModulationTableEnableNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.coverageModulationTableEnable = coverageModulationTableEnable;
     UNIX_CALL(vkCmdSetCoverageModulationTableEnableNV, &params);
@@ -2127,6 +2513,8 @@ void WINAPI vkCmdSetCoverageModulationTableEnableNV(VkCommandBuffer commandBuffe
 void WINAPI vkCmdSetCoverageModulationTableNV(VkCommandBuffer commandBuffer, uint32_t coverageModulationTableCount, const float *pCoverageModulationTable)
 {
     struct vkCmdSetCoverageModulationTableNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.coverageModulationTableCount = coverageModulationTableCount;
     params.pCoverageModulationTable = pCoverageModulationTable;
@@ -2136,6 +2524,8 @@ void WINAPI vkCmdSetCoverageModulationTableNV(VkCommandBuffer commandBuffer, uin
 void WINAPI vkCmdSetCoverageReductionModeNV(VkCommandBuffer commandBuffer, VkCoverageReductionModeNV coverageReductionMode)
 {
     struct vkCmdSetCoverageReductionModeNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.coverageReductionMode = coverageReductionMode;
     UNIX_CALL(vkCmdSetCoverageReductionModeNV, &params);
@@ -2144,6 +2534,8 @@ void WINAPI vkCmdSetCoverageReductionModeNV(VkCommandBuffer commandBuffer, VkCov
 void WINAPI vkCmdSetCoverageToColorEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageToColorEnable)
 {
     struct vkCmdSetCoverageToColorEnableNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.coverageToColorEnable = coverageToColorEnable;
     UNIX_CALL(vkCmdSetCoverageToColorEnableNV, &params);
@@ -2152,6 +2544,8 @@ void WINAPI vkCmdSetCoverageToColorEnableNV(VkCommandBuffer commandBuffer, VkBoo
 void WINAPI vkCmdSetCoverageToColorLocationNV(VkCommandBuffer commandBuffer, uint32_t coverageToColorLocation)
 {
     struct vkCmdSetCoverageToColorLocationNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.coverageToColorLocation = coverageToColorLocation;
     UNIX_CALL(vkCmdSetCoverageToColorLocationNV, &params);
@@ -2159,15 +2553,18 @@ void WINAPI vkCmdSetCoverageToColorLocationNV(VkCommandBuffer commandBuffer, uin
 
 void WINAPI vkCmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode)
 {
-    struct vkCmdSetCullMode_params params;
-    params.commandBuffer = commandBuffer;
-    params.cullMode = cullMode;
-    UNIX_CALL(vkCmdSetCullMode, &params);
+    struct vkCmdSetCullMode_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetCullMode, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->cullMode = cullMode;
 }
 
 void WINAPI vkCmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode)
 {
     struct vkCmdSetCullModeEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.cullMode = cullMode;
     UNIX_CALL(vkCmdSetCullModeEXT, &params);
@@ -2175,17 +2572,20 @@ void WINAPI vkCmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags c
 
 void WINAPI vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor)
 {
-    struct vkCmdSetDepthBias_params params;
-    params.commandBuffer = commandBuffer;
-    params.depthBiasConstantFactor = depthBiasConstantFactor;
-    params.depthBiasClamp = depthBiasClamp;
-    params.depthBiasSlopeFactor = depthBiasSlopeFactor;
-    UNIX_CALL(vkCmdSetDepthBias, &params);
+    struct vkCmdSetDepthBias_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetDepthBias, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->depthBiasConstantFactor = depthBiasConstantFactor;
+    params->depthBiasClamp = depthBiasClamp;
+    params->depthBiasSlopeFactor = depthBiasSlopeFactor;
 }
 
 void WINAPI vkCmdSetDepthBias2EXT(VkCommandBuffer commandBuffer, const VkDepthBiasInfoEXT *pDepthBiasInfo)
 {
     struct vkCmdSetDepthBias2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pDepthBiasInfo = pDepthBiasInfo;
     UNIX_CALL(vkCmdSetDepthBias2EXT, &params);
@@ -2194,6 +2594,8 @@ void WINAPI vkCmdSetDepthBias2EXT(VkCommandBuffer commandBuffer, const VkDepthBi
 void WINAPI vkCmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable)
 {
     struct vkCmdSetDepthBiasEnable_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.depthBiasEnable = depthBiasEnable;
     UNIX_CALL(vkCmdSetDepthBiasEnable, &params);
@@ -2202,6 +2604,8 @@ void WINAPI vkCmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 dept
 void WINAPI vkCmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable)
 {
     struct vkCmdSetDepthBiasEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.depthBiasEnable = depthBiasEnable;
     UNIX_CALL(vkCmdSetDepthBiasEnableEXT, &params);
@@ -2209,24 +2613,28 @@ void WINAPI vkCmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 d
 
 void WINAPI vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds)
 {
-    struct vkCmdSetDepthBounds_params params;
-    params.commandBuffer = commandBuffer;
-    params.minDepthBounds = minDepthBounds;
-    params.maxDepthBounds = maxDepthBounds;
-    UNIX_CALL(vkCmdSetDepthBounds, &params);
+    struct vkCmdSetDepthBounds_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetDepthBounds, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->minDepthBounds = minDepthBounds;
+    params->maxDepthBounds = maxDepthBounds;
 }
 
 void WINAPI vkCmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable)
 {
-    struct vkCmdSetDepthBoundsTestEnable_params params;
-    params.commandBuffer = commandBuffer;
-    params.depthBoundsTestEnable = depthBoundsTestEnable;
-    UNIX_CALL(vkCmdSetDepthBoundsTestEnable, &params);
+    struct vkCmdSetDepthBoundsTestEnable_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetDepthBoundsTestEnable, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->depthBoundsTestEnable = depthBoundsTestEnable;
 }
 
 void WINAPI vkCmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable)
 {
     struct vkCmdSetDepthBoundsTestEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.depthBoundsTestEnable = depthBoundsTestEnable;
     UNIX_CALL(vkCmdSetDepthBoundsTestEnableEXT, &params);
@@ -2235,6 +2643,8 @@ void WINAPI vkCmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer, VkBo
 void WINAPI vkCmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClampEnable)
 {
     struct vkCmdSetDepthClampEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.depthClampEnable = depthClampEnable;
     UNIX_CALL(vkCmdSetDepthClampEnableEXT, &params);
@@ -2243,6 +2653,8 @@ void WINAPI vkCmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer, VkBool32
 void WINAPI vkCmdSetDepthClampRangeEXT(VkCommandBuffer commandBuffer, VkDepthClampModeEXT depthClampMode, const VkDepthClampRangeEXT *pDepthClampRange)
 {
     struct vkCmdSetDepthClampRangeEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.depthClampMode = depthClampMode;
     params.pDepthClampRange = pDepthClampRange;
@@ -2252,6 +2664,8 @@ void WINAPI vkCmdSetDepthClampRangeEXT(VkCommandBuffer commandBuffer, VkDepthCla
 void WINAPI vkCmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClipEnable)
 {
     struct vkCmdSetDepthClipEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.depthClipEnable = depthClipEnable;
     UNIX_CALL(vkCmdSetDepthClipEnableEXT, &params);
@@ -2260,6 +2674,8 @@ void WINAPI vkCmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer, VkBool32 d
 void WINAPI vkCmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer commandBuffer, VkBool32 negativeOneToOne)
 {
     struct vkCmdSetDepthClipNegativeOneToOneEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.negativeOneToOne = negativeOneToOne;
     UNIX_CALL(vkCmdSetDepthClipNegativeOneToOneEXT, &params);
@@ -2267,15 +2683,18 @@ void WINAPI vkCmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer commandBuffer,
 
 void WINAPI vkCmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp)
 {
-    struct vkCmdSetDepthCompareOp_params params;
-    params.commandBuffer = commandBuffer;
-    params.depthCompareOp = depthCompareOp;
-    UNIX_CALL(vkCmdSetDepthCompareOp, &params);
+    struct vkCmdSetDepthCompareOp_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetDepthCompareOp, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->depthCompareOp = depthCompareOp;
 }
 
 void WINAPI vkCmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp)
 {
     struct vkCmdSetDepthCompareOpEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.depthCompareOp = depthCompareOp;
     UNIX_CALL(vkCmdSetDepthCompareOpEXT, &params);
@@ -2283,15 +2702,18 @@ void WINAPI vkCmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp
 
 void WINAPI vkCmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable)
 {
-    struct vkCmdSetDepthTestEnable_params params;
-    params.commandBuffer = commandBuffer;
-    params.depthTestEnable = depthTestEnable;
-    UNIX_CALL(vkCmdSetDepthTestEnable, &params);
+    struct vkCmdSetDepthTestEnable_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetDepthTestEnable, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->depthTestEnable = depthTestEnable;
 }
 
 void WINAPI vkCmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable)
 {
     struct vkCmdSetDepthTestEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.depthTestEnable = depthTestEnable;
     UNIX_CALL(vkCmdSetDepthTestEnableEXT, &params);
@@ -2299,15 +2721,18 @@ void WINAPI vkCmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 d
 
 void WINAPI vkCmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable)
 {
-    struct vkCmdSetDepthWriteEnable_params params;
-    params.commandBuffer = commandBuffer;
-    params.depthWriteEnable = depthWriteEnable;
-    UNIX_CALL(vkCmdSetDepthWriteEnable, &params);
+    struct vkCmdSetDepthWriteEnable_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetDepthWriteEnable, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->depthWriteEnable = depthWriteEnable;
 }
 
 void WINAPI vkCmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable)
 {
     struct vkCmdSetDepthWriteEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.depthWriteEnable = depthWriteEnable;
     UNIX_CALL(vkCmdSetDepthWriteEnableEXT, &params);
@@ -2316,6 +2741,8 @@ void WINAPI vkCmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32
 void WINAPI vkCmdSetDescriptorBufferOffsets2EXT(VkCommandBuffer commandBuffer, const VkSetDescriptorBufferOffsetsInfoEXT *pSetDescriptorBufferOffsetsInfo)
 {
     struct vkCmdSetDescriptorBufferOffsets2EXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pSetDescriptorBufferOffsetsInfo = pSetDescriptorBufferOffsetsInfo;
     UNIX_CALL(vkCmdSetDescriptorBufferOffsets2EXT, &params);
@@ -2324,6 +2751,8 @@ void WINAPI vkCmdSetDescriptorBufferOffsets2EXT(VkCommandBuffer commandBuffer, c
 void WINAPI vkCmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount, const uint32_t *pBufferIndices, const VkDeviceSize *pOffsets)
 {
     struct vkCmdSetDescriptorBufferOffsetsEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineBindPoint = pipelineBindPoint;
     params.layout = layout;
@@ -2337,6 +2766,8 @@ void WINAPI vkCmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer commandBuffer, Vk
 void WINAPI vkCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask)
 {
     struct vkCmdSetDeviceMask_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.deviceMask = deviceMask;
     UNIX_CALL(vkCmdSetDeviceMask, &params);
@@ -2345,6 +2776,8 @@ void WINAPI vkCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMas
 void WINAPI vkCmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask)
 {
     struct vkCmdSetDeviceMaskKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.deviceMask = deviceMask;
     UNIX_CALL(vkCmdSetDeviceMaskKHR, &params);
@@ -2353,6 +2786,8 @@ void WINAPI vkCmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t device
 void WINAPI vkCmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D *pDiscardRectangles)
 {
     struct vkCmdSetDiscardRectangleEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstDiscardRectangle = firstDiscardRectangle;
     params.discardRectangleCount = discardRectangleCount;
@@ -2363,6 +2798,8 @@ void WINAPI vkCmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t
 void WINAPI vkCmdSetDiscardRectangleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 discardRectangleEnable)
 {
     struct vkCmdSetDiscardRectangleEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.discardRectangleEnable = discardRectangleEnable;
     UNIX_CALL(vkCmdSetDiscardRectangleEnableEXT, &params);
@@ -2371,6 +2808,8 @@ void WINAPI vkCmdSetDiscardRectangleEnableEXT(VkCommandBuffer commandBuffer, VkB
 void WINAPI vkCmdSetDiscardRectangleModeEXT(VkCommandBuffer commandBuffer, VkDiscardRectangleModeEXT discardRectangleMode)
 {
     struct vkCmdSetDiscardRectangleModeEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.discardRectangleMode = discardRectangleMode;
     UNIX_CALL(vkCmdSetDiscardRectangleModeEXT, &params);
@@ -2379,6 +2818,8 @@ void WINAPI vkCmdSetDiscardRectangleModeEXT(VkCommandBuffer commandBuffer, VkDis
 void WINAPI vkCmdSetDispatchParametersARM(VkCommandBuffer commandBuffer, const VkDispatchParametersARM *pDispatchParameters)
 {
     struct vkCmdSetDispatchParametersARM_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pDispatchParameters = pDispatchParameters;
     UNIX_CALL(vkCmdSetDispatchParametersARM, &params);
@@ -2387,6 +2828,8 @@ void WINAPI vkCmdSetDispatchParametersARM(VkCommandBuffer commandBuffer, const V
 void WINAPI vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
 {
     struct vkCmdSetEvent_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.event = event;
     params.stageMask = stageMask;
@@ -2396,6 +2839,8 @@ void WINAPI vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipeli
 void WINAPI vkCmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo *pDependencyInfo)
 {
     struct vkCmdSetEvent2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.event = event;
     params.pDependencyInfo = pDependencyInfo;
@@ -2405,6 +2850,8 @@ void WINAPI vkCmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const V
 void WINAPI vkCmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo *pDependencyInfo)
 {
     struct vkCmdSetEvent2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.event = event;
     params.pDependencyInfo = pDependencyInfo;
@@ -2414,6 +2861,8 @@ void WINAPI vkCmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, cons
 void WINAPI vkCmdSetExclusiveScissorEnableNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount, const VkBool32 *pExclusiveScissorEnables)
 {
     struct vkCmdSetExclusiveScissorEnableNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstExclusiveScissor = firstExclusiveScissor;
     params.exclusiveScissorCount = exclusiveScissorCount;
@@ -2424,6 +2873,8 @@ void WINAPI vkCmdSetExclusiveScissorEnableNV(VkCommandBuffer commandBuffer, uint
 void WINAPI vkCmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount, const VkRect2D *pExclusiveScissors)
 {
     struct vkCmdSetExclusiveScissorNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstExclusiveScissor = firstExclusiveScissor;
     params.exclusiveScissorCount = exclusiveScissorCount;
@@ -2434,6 +2885,8 @@ void WINAPI vkCmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t f
 void WINAPI vkCmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBuffer commandBuffer, float extraPrimitiveOverestimationSize)
 {
     struct vkCmdSetExtraPrimitiveOverestimationSizeEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.extraPrimitiveOverestimationSize = extraPrimitiveOverestimationSize;
     UNIX_CALL(vkCmdSetExtraPrimitiveOverestimationSizeEXT, &params);
@@ -2442,6 +2895,8 @@ void WINAPI vkCmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBuffer commandB
 void WINAPI vkCmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate, const VkFragmentShadingRateCombinerOpKHR combinerOps[2])
 {
     struct vkCmdSetFragmentShadingRateEnumNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.shadingRate = shadingRate;
     params.combinerOps = combinerOps;
@@ -2451,6 +2906,8 @@ void WINAPI vkCmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer, VkF
 void WINAPI vkCmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const VkExtent2D *pFragmentSize, const VkFragmentShadingRateCombinerOpKHR combinerOps[2])
 {
     struct vkCmdSetFragmentShadingRateKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pFragmentSize = pFragmentSize;
     params.combinerOps = combinerOps;
@@ -2459,15 +2916,18 @@ void WINAPI vkCmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const
 
 void WINAPI vkCmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace)
 {
-    struct vkCmdSetFrontFace_params params;
-    params.commandBuffer = commandBuffer;
-    params.frontFace = frontFace;
-    UNIX_CALL(vkCmdSetFrontFace, &params);
+    struct vkCmdSetFrontFace_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetFrontFace, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->frontFace = frontFace;
 }
 
 void WINAPI vkCmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace)
 {
     struct vkCmdSetFrontFaceEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.frontFace = frontFace;
     UNIX_CALL(vkCmdSetFrontFaceEXT, &params);
@@ -2476,6 +2936,8 @@ void WINAPI vkCmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace fron
 void WINAPI vkCmdSetLineRasterizationModeEXT(VkCommandBuffer commandBuffer, VkLineRasterizationModeEXT lineRasterizationMode)
 {
     struct vkCmdSetLineRasterizationModeEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.lineRasterizationMode = lineRasterizationMode;
     UNIX_CALL(vkCmdSetLineRasterizationModeEXT, &params);
@@ -2484,6 +2946,8 @@ void WINAPI vkCmdSetLineRasterizationModeEXT(VkCommandBuffer commandBuffer, VkLi
 void WINAPI vkCmdSetLineStipple(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern)
 {
     struct vkCmdSetLineStipple_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.lineStippleFactor = lineStippleFactor;
     params.lineStipplePattern = lineStipplePattern;
@@ -2493,6 +2957,8 @@ void WINAPI vkCmdSetLineStipple(VkCommandBuffer commandBuffer, uint32_t lineStip
 void WINAPI vkCmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern)
 {
     struct vkCmdSetLineStippleEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.lineStippleFactor = lineStippleFactor;
     params.lineStipplePattern = lineStipplePattern;
@@ -2502,6 +2968,8 @@ void WINAPI vkCmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineS
 void WINAPI vkCmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stippledLineEnable)
 {
     struct vkCmdSetLineStippleEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.stippledLineEnable = stippledLineEnable;
     UNIX_CALL(vkCmdSetLineStippleEnableEXT, &params);
@@ -2510,6 +2978,8 @@ void WINAPI vkCmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer, VkBool32
 void WINAPI vkCmdSetLineStippleKHR(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern)
 {
     struct vkCmdSetLineStippleKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.lineStippleFactor = lineStippleFactor;
     params.lineStipplePattern = lineStipplePattern;
@@ -2518,15 +2988,18 @@ void WINAPI vkCmdSetLineStippleKHR(VkCommandBuffer commandBuffer, uint32_t lineS
 
 void WINAPI vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth)
 {
-    struct vkCmdSetLineWidth_params params;
-    params.commandBuffer = commandBuffer;
-    params.lineWidth = lineWidth;
-    UNIX_CALL(vkCmdSetLineWidth, &params);
+    struct vkCmdSetLineWidth_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetLineWidth, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->lineWidth = lineWidth;
 }
 
 void WINAPI vkCmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp)
 {
     struct vkCmdSetLogicOpEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.logicOp = logicOp;
     UNIX_CALL(vkCmdSetLogicOpEXT, &params);
@@ -2535,6 +3008,8 @@ void WINAPI vkCmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp)
 void WINAPI vkCmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 logicOpEnable)
 {
     struct vkCmdSetLogicOpEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.logicOpEnable = logicOpEnable;
     UNIX_CALL(vkCmdSetLogicOpEnableEXT, &params);
@@ -2543,6 +3018,8 @@ void WINAPI vkCmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 log
 void WINAPI vkCmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_t patchControlPoints)
 {
     struct vkCmdSetPatchControlPointsEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.patchControlPoints = patchControlPoints;
     UNIX_CALL(vkCmdSetPatchControlPointsEXT, &params);
@@ -2551,6 +3028,8 @@ void WINAPI vkCmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_
 VkResult WINAPI vkCmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceMarkerInfoINTEL *pMarkerInfo)
 {
     struct vkCmdSetPerformanceMarkerINTEL_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pMarkerInfo = pMarkerInfo;
     UNIX_CALL_CHECKED(vkCmdSetPerformanceMarkerINTEL, &params);
@@ -2560,6 +3039,8 @@ VkResult WINAPI vkCmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer, co
 VkResult WINAPI vkCmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer, const VkPerformanceOverrideInfoINTEL *pOverrideInfo)
 {
     struct vkCmdSetPerformanceOverrideINTEL_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pOverrideInfo = pOverrideInfo;
     UNIX_CALL_CHECKED(vkCmdSetPerformanceOverrideINTEL, &params);
@@ -2569,6 +3050,8 @@ VkResult WINAPI vkCmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer,
 VkResult WINAPI vkCmdSetPerformanceStreamMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceStreamMarkerInfoINTEL *pMarkerInfo)
 {
     struct vkCmdSetPerformanceStreamMarkerINTEL_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pMarkerInfo = pMarkerInfo;
     UNIX_CALL_CHECKED(vkCmdSetPerformanceStreamMarkerINTEL, &params);
@@ -2578,6 +3061,8 @@ VkResult WINAPI vkCmdSetPerformanceStreamMarkerINTEL(VkCommandBuffer commandBuff
 void WINAPI vkCmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode polygonMode)
 {
     struct vkCmdSetPolygonModeEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.polygonMode = polygonMode;
     UNIX_CALL(vkCmdSetPolygonModeEXT, &params);
@@ -2586,6 +3071,8 @@ void WINAPI vkCmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode
 void WINAPI vkCmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable)
 {
     struct vkCmdSetPrimitiveRestartEnable_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.primitiveRestartEnable = primitiveRestartEnable;
     UNIX_CALL(vkCmdSetPrimitiveRestartEnable, &params);
@@ -2594,6 +3081,8 @@ void WINAPI vkCmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool
 void WINAPI vkCmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable)
 {
     struct vkCmdSetPrimitiveRestartEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.primitiveRestartEnable = primitiveRestartEnable;
     UNIX_CALL(vkCmdSetPrimitiveRestartEnableEXT, &params);
@@ -2602,6 +3091,8 @@ void WINAPI vkCmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer, VkB
 void WINAPI vkCmdSetPrimitiveRestartIndexEXT(VkCommandBuffer commandBuffer, uint32_t primitiveRestartIndex)
 {
     struct vkCmdSetPrimitiveRestartIndexEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.primitiveRestartIndex = primitiveRestartIndex;
     UNIX_CALL(vkCmdSetPrimitiveRestartIndexEXT, &params);
@@ -2609,15 +3100,18 @@ void WINAPI vkCmdSetPrimitiveRestartIndexEXT(VkCommandBuffer commandBuffer, uint
 
 void WINAPI vkCmdSetPrimitiveTopology(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology)
 {
-    struct vkCmdSetPrimitiveTopology_params params;
-    params.commandBuffer = commandBuffer;
-    params.primitiveTopology = primitiveTopology;
-    UNIX_CALL(vkCmdSetPrimitiveTopology, &params);
+    struct vkCmdSetPrimitiveTopology_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetPrimitiveTopology, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->primitiveTopology = primitiveTopology;
 }
 
 void WINAPI vkCmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology)
 {
     struct vkCmdSetPrimitiveTopologyEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.primitiveTopology = primitiveTopology;
     UNIX_CALL(vkCmdSetPrimitiveTopologyEXT, &params);
@@ -2626,6 +3120,8 @@ void WINAPI vkCmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer, VkPrimit
 void WINAPI vkCmdSetProvokingVertexModeEXT(VkCommandBuffer commandBuffer, VkProvokingVertexModeEXT provokingVertexMode)
 {
     struct vkCmdSetProvokingVertexModeEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.provokingVertexMode = provokingVertexMode;
     UNIX_CALL(vkCmdSetProvokingVertexModeEXT, &params);
@@ -2634,6 +3130,8 @@ void WINAPI vkCmdSetProvokingVertexModeEXT(VkCommandBuffer commandBuffer, VkProv
 void WINAPI vkCmdSetRasterizationSamplesEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits rasterizationSamples)
 {
     struct vkCmdSetRasterizationSamplesEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.rasterizationSamples = rasterizationSamples;
     UNIX_CALL(vkCmdSetRasterizationSamplesEXT, &params);
@@ -2642,6 +3140,8 @@ void WINAPI vkCmdSetRasterizationSamplesEXT(VkCommandBuffer commandBuffer, VkSam
 void WINAPI vkCmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer, uint32_t rasterizationStream)
 {
     struct vkCmdSetRasterizationStreamEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.rasterizationStream = rasterizationStream;
     UNIX_CALL(vkCmdSetRasterizationStreamEXT, &params);
@@ -2650,6 +3150,8 @@ void WINAPI vkCmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer, uint32
 void WINAPI vkCmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable)
 {
     struct vkCmdSetRasterizerDiscardEnable_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.rasterizerDiscardEnable = rasterizerDiscardEnable;
     UNIX_CALL(vkCmdSetRasterizerDiscardEnable, &params);
@@ -2658,6 +3160,8 @@ void WINAPI vkCmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBoo
 void WINAPI vkCmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable)
 {
     struct vkCmdSetRasterizerDiscardEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.rasterizerDiscardEnable = rasterizerDiscardEnable;
     UNIX_CALL(vkCmdSetRasterizerDiscardEnableEXT, &params);
@@ -2666,6 +3170,8 @@ void WINAPI vkCmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer, Vk
 void WINAPI vkCmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer, uint32_t pipelineStackSize)
 {
     struct vkCmdSetRayTracingPipelineStackSizeKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineStackSize = pipelineStackSize;
     UNIX_CALL(vkCmdSetRayTracingPipelineStackSizeKHR, &params);
@@ -2674,6 +3180,8 @@ void WINAPI vkCmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer
 void WINAPI vkCmdSetRenderingAttachmentLocations(VkCommandBuffer commandBuffer, const VkRenderingAttachmentLocationInfo *pLocationInfo)
 {
     struct vkCmdSetRenderingAttachmentLocations_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pLocationInfo = pLocationInfo;
     UNIX_CALL(vkCmdSetRenderingAttachmentLocations, &params);
@@ -2682,6 +3190,8 @@ void WINAPI vkCmdSetRenderingAttachmentLocations(VkCommandBuffer commandBuffer,
 void WINAPI vkCmdSetRenderingAttachmentLocationsKHR(VkCommandBuffer commandBuffer, const VkRenderingAttachmentLocationInfo *pLocationInfo)
 {
     struct vkCmdSetRenderingAttachmentLocationsKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pLocationInfo = pLocationInfo;
     UNIX_CALL(vkCmdSetRenderingAttachmentLocationsKHR, &params);
@@ -2690,6 +3200,8 @@ void WINAPI vkCmdSetRenderingAttachmentLocationsKHR(VkCommandBuffer commandBuffe
 void WINAPI vkCmdSetRenderingInputAttachmentIndices(VkCommandBuffer commandBuffer, const VkRenderingInputAttachmentIndexInfo *pInputAttachmentIndexInfo)
 {
     struct vkCmdSetRenderingInputAttachmentIndices_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInputAttachmentIndexInfo = pInputAttachmentIndexInfo;
     UNIX_CALL(vkCmdSetRenderingInputAttachmentIndices, &params);
@@ -2698,6 +3210,8 @@ void WINAPI vkCmdSetRenderingInputAttachmentIndices(VkCommandBuffer commandBuffe
 void WINAPI vkCmdSetRenderingInputAttachmentIndicesKHR(VkCommandBuffer commandBuffer, const VkRenderingInputAttachmentIndexInfo *pInputAttachmentIndexInfo)
 {
     struct vkCmdSetRenderingInputAttachmentIndicesKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInputAttachmentIndexInfo = pInputAttachmentIndexInfo;
     UNIX_CALL(vkCmdSetRenderingInputAttachmentIndicesKHR, &params);
@@ -2706,6 +3220,8 @@ void WINAPI vkCmdSetRenderingInputAttachmentIndicesKHR(VkCommandBuffer commandBu
 void WINAPI vkCmdSetRepresentativeFragmentTestEnableNV(VkCommandBuffer commandBuffer, VkBool32 representativeFragmentTestEnable)
 {
     struct vkCmdSetRepresentativeFragmentTestEnableNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.representativeFragmentTestEnable = representativeFragmentTestEnable;
     UNIX_CALL(vkCmdSetRepresentativeFragmentTestEnableNV, &params);
@@ -2714,6 +3230,8 @@ void WINAPI vkCmdSetRepresentativeFragmentTestEnableNV(VkCommandBuffer commandBu
 void WINAPI vkCmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT *pSampleLocationsInfo)
 {
     struct vkCmdSetSampleLocationsEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pSampleLocationsInfo = pSampleLocationsInfo;
     UNIX_CALL(vkCmdSetSampleLocationsEXT, &params);
@@ -2722,6 +3240,8 @@ void WINAPI vkCmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSa
 void WINAPI vkCmdSetSampleLocationsEnableEXT(VkCommandBuffer commandBuffer, VkBool32 sampleLocationsEnable)
 {
     struct vkCmdSetSampleLocationsEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.sampleLocationsEnable = sampleLocationsEnable;
     UNIX_CALL(vkCmdSetSampleLocationsEnableEXT, &params);
@@ -2730,6 +3250,8 @@ void WINAPI vkCmdSetSampleLocationsEnableEXT(VkCommandBuffer commandBuffer, VkBo
 void WINAPI vkCmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits samples, const VkSampleMask *pSampleMask)
 {
     struct vkCmdSetSampleMaskEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.samples = samples;
     params.pSampleMask = pSampleMask;
@@ -2739,6 +3261,8 @@ void WINAPI vkCmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, VkSampleCountFl
 void WINAPI vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D *pScissors)
 {
     struct vkCmdSetScissor_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstScissor = firstScissor;
     params.scissorCount = scissorCount;
@@ -2749,6 +3273,8 @@ void WINAPI vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor
 void WINAPI vkCmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D *pScissors)
 {
     struct vkCmdSetScissorWithCount_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.scissorCount = scissorCount;
     params.pScissors = pScissors;
@@ -2758,6 +3284,8 @@ void WINAPI vkCmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t sci
 void WINAPI vkCmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D *pScissors)
 {
     struct vkCmdSetScissorWithCountEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.scissorCount = scissorCount;
     params.pScissors = pScissors;
@@ -2767,6 +3295,8 @@ void WINAPI vkCmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t
 void WINAPI vkCmdSetShadingRateImageEnableNV(VkCommandBuffer commandBuffer, VkBool32 shadingRateImageEnable)
 {
     struct vkCmdSetShadingRateImageEnableNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.shadingRateImageEnable = shadingRateImageEnable;
     UNIX_CALL(vkCmdSetShadingRateImageEnableNV, &params);
@@ -2774,16 +3304,19 @@ void WINAPI vkCmdSetShadingRateImageEnableNV(VkCommandBuffer commandBuffer, VkBo
 
 void WINAPI vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask)
 {
-    struct vkCmdSetStencilCompareMask_params params;
-    params.commandBuffer = commandBuffer;
-    params.faceMask = faceMask;
-    params.compareMask = compareMask;
-    UNIX_CALL(vkCmdSetStencilCompareMask, &params);
+    struct vkCmdSetStencilCompareMask_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetStencilCompareMask, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->faceMask = faceMask;
+    params->compareMask = compareMask;
 }
 
 void WINAPI vkCmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp)
 {
     struct vkCmdSetStencilOp_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.faceMask = faceMask;
     params.failOp = failOp;
@@ -2796,6 +3329,8 @@ void WINAPI vkCmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags
 void WINAPI vkCmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp)
 {
     struct vkCmdSetStencilOpEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.faceMask = faceMask;
     params.failOp = failOp;
@@ -2807,24 +3342,28 @@ void WINAPI vkCmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFla
 
 void WINAPI vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference)
 {
-    struct vkCmdSetStencilReference_params params;
-    params.commandBuffer = commandBuffer;
-    params.faceMask = faceMask;
-    params.reference = reference;
-    UNIX_CALL(vkCmdSetStencilReference, &params);
+    struct vkCmdSetStencilReference_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetStencilReference, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->faceMask = faceMask;
+    params->reference = reference;
 }
 
 void WINAPI vkCmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable)
 {
-    struct vkCmdSetStencilTestEnable_params params;
-    params.commandBuffer = commandBuffer;
-    params.stencilTestEnable = stencilTestEnable;
-    UNIX_CALL(vkCmdSetStencilTestEnable, &params);
+    struct vkCmdSetStencilTestEnable_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetStencilTestEnable, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->stencilTestEnable = stencilTestEnable;
 }
 
 void WINAPI vkCmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable)
 {
     struct vkCmdSetStencilTestEnableEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.stencilTestEnable = stencilTestEnable;
     UNIX_CALL(vkCmdSetStencilTestEnableEXT, &params);
@@ -2832,16 +3371,19 @@ void WINAPI vkCmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32
 
 void WINAPI vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask)
 {
-    struct vkCmdSetStencilWriteMask_params params;
-    params.commandBuffer = commandBuffer;
-    params.faceMask = faceMask;
-    params.writeMask = writeMask;
-    UNIX_CALL(vkCmdSetStencilWriteMask, &params);
+    struct vkCmdSetStencilWriteMask_params *params;
+
+    params = vk_command_buffer_record(commandBuffer, unix_vkCmdSetStencilWriteMask, sizeof(*params));
+    params->commandBuffer = commandBuffer;
+    params->faceMask = faceMask;
+    params->writeMask = writeMask;
 }
 
 void WINAPI vkCmdSetTessellationDomainOriginEXT(VkCommandBuffer commandBuffer, VkTessellationDomainOrigin domainOrigin)
 {
     struct vkCmdSetTessellationDomainOriginEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.domainOrigin = domainOrigin;
     UNIX_CALL(vkCmdSetTessellationDomainOriginEXT, &params);
@@ -2850,6 +3392,8 @@ void WINAPI vkCmdSetTessellationDomainOriginEXT(VkCommandBuffer commandBuffer, V
 void WINAPI vkCmdSetVertexInputEXT(VkCommandBuffer commandBuffer, uint32_t vertexBindingDescriptionCount, const VkVertexInputBindingDescription2EXT *pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount, const VkVertexInputAttributeDescription2EXT *pVertexAttributeDescriptions)
 {
     struct vkCmdSetVertexInputEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.vertexBindingDescriptionCount = vertexBindingDescriptionCount;
     params.pVertexBindingDescriptions = pVertexBindingDescriptions;
@@ -2861,6 +3405,8 @@ void WINAPI vkCmdSetVertexInputEXT(VkCommandBuffer commandBuffer, uint32_t verte
 void WINAPI vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport *pViewports)
 {
     struct vkCmdSetViewport_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstViewport = firstViewport;
     params.viewportCount = viewportCount;
@@ -2871,6 +3417,8 @@ void WINAPI vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewpo
 void WINAPI vkCmdSetViewportShadingRatePaletteNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkShadingRatePaletteNV *pShadingRatePalettes)
 {
     struct vkCmdSetViewportShadingRatePaletteNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstViewport = firstViewport;
     params.viewportCount = viewportCount;
@@ -2881,6 +3429,8 @@ void WINAPI vkCmdSetViewportShadingRatePaletteNV(VkCommandBuffer commandBuffer,
 void WINAPI vkCmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportSwizzleNV *pViewportSwizzles)
 {
     struct vkCmdSetViewportSwizzleNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstViewport = firstViewport;
     params.viewportCount = viewportCount;
@@ -2891,6 +3441,8 @@ void WINAPI vkCmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer, uint32_t fi
 void WINAPI vkCmdSetViewportWScalingEnableNV(VkCommandBuffer commandBuffer, VkBool32 viewportWScalingEnable)
 {
     struct vkCmdSetViewportWScalingEnableNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.viewportWScalingEnable = viewportWScalingEnable;
     UNIX_CALL(vkCmdSetViewportWScalingEnableNV, &params);
@@ -2899,6 +3451,8 @@ void WINAPI vkCmdSetViewportWScalingEnableNV(VkCommandBuffer commandBuffer, VkBo
 void WINAPI vkCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV *pViewportWScalings)
 {
     struct vkCmdSetViewportWScalingNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.firstViewport = firstViewport;
     params.viewportCount = viewportCount;
@@ -2909,6 +3463,8 @@ void WINAPI vkCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t f
 void WINAPI vkCmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport *pViewports)
 {
     struct vkCmdSetViewportWithCount_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.viewportCount = viewportCount;
     params.pViewports = pViewports;
@@ -2918,6 +3474,8 @@ void WINAPI vkCmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t vi
 void WINAPI vkCmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport *pViewports)
 {
     struct vkCmdSetViewportWithCountEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.viewportCount = viewportCount;
     params.pViewports = pViewports;
@@ -2927,6 +3485,8 @@ void WINAPI vkCmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t
 void WINAPI vkCmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer)
 {
     struct vkCmdSubpassShadingHUAWEI_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     UNIX_CALL(vkCmdSubpassShadingHUAWEI, &params);
 }
@@ -2934,6 +3494,8 @@ void WINAPI vkCmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer)
 void WINAPI vkCmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress)
 {
     struct vkCmdTraceRaysIndirect2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.indirectDeviceAddress = indirectDeviceAddress;
     UNIX_CALL(vkCmdTraceRaysIndirect2KHR, &params);
@@ -2942,6 +3504,8 @@ void WINAPI vkCmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAd
 void WINAPI vkCmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR *pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress)
 {
     struct vkCmdTraceRaysIndirectKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pRaygenShaderBindingTable = pRaygenShaderBindingTable;
     params.pMissShaderBindingTable = pMissShaderBindingTable;
@@ -2954,6 +3518,8 @@ void WINAPI vkCmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer, const VkStr
 void WINAPI vkCmdTraceRaysKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR *pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pCallableShaderBindingTable, uint32_t width, uint32_t height, uint32_t depth)
 {
     struct vkCmdTraceRaysKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pRaygenShaderBindingTable = pRaygenShaderBindingTable;
     params.pMissShaderBindingTable = pMissShaderBindingTable;
@@ -2968,6 +3534,8 @@ void WINAPI vkCmdTraceRaysKHR(VkCommandBuffer commandBuffer, const VkStridedDevi
 void WINAPI vkCmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer, VkDeviceSize raygenShaderBindingOffset, VkBuffer missShaderBindingTableBuffer, VkDeviceSize missShaderBindingOffset, VkDeviceSize missShaderBindingStride, VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset, VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer, VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride, uint32_t width, uint32_t height, uint32_t depth)
 {
     struct vkCmdTraceRaysNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.raygenShaderBindingTableBuffer = raygenShaderBindingTableBuffer;
     params.raygenShaderBindingOffset = raygenShaderBindingOffset;
@@ -2989,6 +3557,8 @@ void WINAPI vkCmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffer raygenShade
 void WINAPI vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void *pData)
 {
     struct vkCmdUpdateBuffer_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.dstBuffer = dstBuffer;
     params.dstOffset = dstOffset;
@@ -3000,6 +3570,8 @@ void WINAPI vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer,
 void WINAPI vkCmdUpdateMemoryKHR(VkCommandBuffer commandBuffer, const VkDeviceAddressRangeKHR *pDstRange, VkAddressCommandFlagsKHR dstFlags, VkDeviceSize dataSize, const void *pData)
 {
     struct vkCmdUpdateMemoryKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pDstRange = pDstRange;
     params.dstFlags = dstFlags;
@@ -3011,6 +3583,8 @@ void WINAPI vkCmdUpdateMemoryKHR(VkCommandBuffer commandBuffer, const VkDeviceAd
 void WINAPI vkCmdUpdatePipelineIndirectBufferNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
 {
     struct vkCmdUpdatePipelineIndirectBufferNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineBindPoint = pipelineBindPoint;
     params.pipeline = pipeline;
@@ -3020,6 +3594,8 @@ void WINAPI vkCmdUpdatePipelineIndirectBufferNV(VkCommandBuffer commandBuffer, V
 void WINAPI vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers)
 {
     struct vkCmdWaitEvents_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.eventCount = eventCount;
     params.pEvents = pEvents;
@@ -3037,6 +3613,8 @@ void WINAPI vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount,
 void WINAPI vkCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents, const VkDependencyInfo *pDependencyInfos)
 {
     struct vkCmdWaitEvents2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.eventCount = eventCount;
     params.pEvents = pEvents;
@@ -3047,6 +3625,8 @@ void WINAPI vkCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount,
 void WINAPI vkCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents, const VkDependencyInfo *pDependencyInfos)
 {
     struct vkCmdWaitEvents2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.eventCount = eventCount;
     params.pEvents = pEvents;
@@ -3057,6 +3637,8 @@ void WINAPI vkCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCou
 void WINAPI vkCmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR *pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery)
 {
     struct vkCmdWriteAccelerationStructuresPropertiesKHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.accelerationStructureCount = accelerationStructureCount;
     params.pAccelerationStructures = pAccelerationStructures;
@@ -3069,6 +3651,8 @@ void WINAPI vkCmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer comman
 void WINAPI vkCmdWriteAccelerationStructuresPropertiesNV(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureNV *pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery)
 {
     struct vkCmdWriteAccelerationStructuresPropertiesNV_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.accelerationStructureCount = accelerationStructureCount;
     params.pAccelerationStructures = pAccelerationStructures;
@@ -3081,6 +3665,8 @@ void WINAPI vkCmdWriteAccelerationStructuresPropertiesNV(VkCommandBuffer command
 void WINAPI vkCmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker)
 {
     struct vkCmdWriteBufferMarker2AMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.stage = stage;
     params.dstBuffer = dstBuffer;
@@ -3092,6 +3678,8 @@ void WINAPI vkCmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipeline
 void WINAPI vkCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker)
 {
     struct vkCmdWriteBufferMarkerAMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineStage = pipelineStage;
     params.dstBuffer = dstBuffer;
@@ -3103,6 +3691,8 @@ void WINAPI vkCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineS
 void WINAPI vkCmdWriteMarkerToMemoryAMD(VkCommandBuffer commandBuffer, const VkMemoryMarkerInfoAMD *pInfo)
 {
     struct vkCmdWriteMarkerToMemoryAMD_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pInfo = pInfo;
     UNIX_CALL(vkCmdWriteMarkerToMemoryAMD, &params);
@@ -3111,6 +3701,8 @@ void WINAPI vkCmdWriteMarkerToMemoryAMD(VkCommandBuffer commandBuffer, const VkM
 void WINAPI vkCmdWriteMicromapsPropertiesEXT(VkCommandBuffer commandBuffer, uint32_t micromapCount, const VkMicromapEXT *pMicromaps, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery)
 {
     struct vkCmdWriteMicromapsPropertiesEXT_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.micromapCount = micromapCount;
     params.pMicromaps = pMicromaps;
@@ -3123,6 +3715,8 @@ void WINAPI vkCmdWriteMicromapsPropertiesEXT(VkCommandBuffer commandBuffer, uint
 void WINAPI vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query)
 {
     struct vkCmdWriteTimestamp_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.pipelineStage = pipelineStage;
     params.queryPool = queryPool;
@@ -3133,6 +3727,8 @@ void WINAPI vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFl
 void WINAPI vkCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query)
 {
     struct vkCmdWriteTimestamp2_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.stage = stage;
     params.queryPool = queryPool;
@@ -3143,6 +3739,8 @@ void WINAPI vkCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageF
 void WINAPI vkCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query)
 {
     struct vkCmdWriteTimestamp2KHR_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.stage = stage;
     params.queryPool = queryPool;
@@ -4364,6 +4962,8 @@ VkResult WINAPI vkDeviceWaitIdle(VkDevice device)
 VkResult WINAPI vkEndCommandBuffer(VkCommandBuffer commandBuffer)
 {
     struct vkEndCommandBuffer_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     UNIX_CALL_CHECKED(vkEndCommandBuffer, &params);
     return params.result;
@@ -6585,22 +7185,14 @@ VkResult WINAPI vkReleaseSwapchainImagesKHR(VkDevice device, const VkReleaseSwap
 VkResult WINAPI vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
 {
     struct vkResetCommandBuffer_params params;
+
+    vk_command_buffer_flush(commandBuffer);
     params.commandBuffer = commandBuffer;
     params.flags = flags;
     UNIX_CALL_CHECKED(vkResetCommandBuffer, &params);
     return params.result;
 }
 
-VkResult WINAPI vkResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
-{
-    struct vkResetCommandPool_params params;
-    params.device = device;
-    params.commandPool = commandPool;
-    params.flags = flags;
-    UNIX_CALL_CHECKED(vkResetCommandPool, &params);
-    return params.result;
-}
-
 VkResult WINAPI vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags)
 {
     struct vkResetDescriptorPool_params params;
@@ -22,6 +22,7 @@
 #endif
 
 #include "config.h"
+#include <pthread.h>
 #include <time.h>
 
 #include "vulkan_private.h"
@@ -31,6 +32,7 @@
 #include "ntuser.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(vulkan);
+WINE_DECLARE_DEBUG_CHANNEL(vulkan_conv);
 
 static PFN_vkEnumerateInstanceVersion p_vkEnumerateInstanceVersion;
 static PFN_vkEnumerateInstanceExtensionProperties p_vkEnumerateInstanceExtensionProperties;
@@ -247,6 +249,179 @@ static void wine_vk_free_command_buffers(struct vulkan_device *device,
     }
 }
 
+#define CONVERSION_ARENA_BLOCK_SIZE     (64 * 1024)
+#define CONVERSION_STATS_BUCKETS        6
+#define CONVERSION_STATS_INTERVAL       (1u << 16)
+
+struct conversion_arena_block
+{
+    struct list entry;
+    size_t used;
+    UINT64 data[CONVERSION_ARENA_BLOCK_SIZE / sizeof(UINT64)];
+};
+
+struct conversion_arena
+{
+    struct list blocks;
+    struct conversion_arena_block *current;
+};
+
+static pthread_key_t conversion_arena_key;
+static pthread_once_t conversion_arena_once = PTHREAD_ONCE_INIT;
+
+/* Histogram of the bytes converted per call, by entry point. Enabled with
+ * WINEDEBUG=+vulkan_conv and dumped every CONVERSION_STATS_INTERVAL calls. */
+struct conversion_stats
+{
+    LONG64 bytes;
+    LONG64 calls[CONVERSION_STATS_BUCKETS];
+};
+
+static const size_t conversion_stats_limits[CONVERSION_STATS_BUCKETS - 1] = {512, 2048, 8192, 32768, 131072};
+struct conversion_stats *conversion_stats;
+static LONG conversion_stats_count;
+
+static void conversion_arena_destroy(void *data)
+{
+    struct conversion_arena_block *block, *next;
+    struct conversion_arena *arena = data;
+
+    LIST_FOR_EACH_ENTRY_SAFE(block, next, &arena->blocks, struct conversion_arena_block, entry)
+        free(block);
+    free(arena);
+}
+
+static void conversion_arena_init_once(void)
+{
+    pthread_key_create(&conversion_arena_key, conversion_arena_destroy);
+}
+
+static struct conversion_arena *conversion_arena_get(void)
+{
+    struct conversion_arena_block *block;
+    struct conversion_arena *arena;
+
+    pthread_once(&conversion_arena_once, conversion_arena_init_once);
+    if ((arena = pthread_getspecific(conversion_arena_key)))
+        return arena;
+
+    if (!(arena = malloc(sizeof(*arena))))
+        return NULL;
+    if (!(block = malloc(sizeof(*block))))
+    {
+        free(arena);
+        return NULL;
+    }
+    block->used = 0;
+    list_init(&arena->blocks);
+    list_add_tail(&arena->blocks, &block->entry);
+    arena->current = block;
+    pthread_setspecific(conversion_arena_key, arena);
+
+    return arena;
+}
+
+static void *conversion_arena_alloc(struct conversion_context *pool, size_t size)
+{
+    struct conversion_arena_block *block;
+    struct conversion_arena *arena;
+    struct list *next;
+    void *ret;
+
+    if (!(arena = pool->arena))
+    {
+        if (!(arena = conversion_arena_get()))
+            return NULL;
+        pool->arena = arena;
+        pool->arena_block = arena->current;
+        pool->arena_used = arena->current->used;
+    }
+
+    size = (size + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1);
+    block = arena->current;
+    if (block->used + size > sizeof(block->data))
+    {
+        if ((next = list_next(&arena->blocks, &block->entry)))
+        {
+            block = LIST_ENTRY(next, struct conversion_arena_block, entry);
+        }
+        else
+        {
+            if (!(block = malloc(sizeof(*block))))
+                return NULL;
+            list_add_tail(&arena->blocks, &block->entry);
+        }
+        block->used = 0;
+        arena->current = block;
+    }
+
+    ret = (BYTE *)block->data + block->used;
+    block->used += size;
+    return ret;
+}
+
+void *conversion_context_alloc_slow(struct conversion_context *pool, size_t size)
+{
+    struct list *entry;
+    void *ret;
+
+    if (!pool->persistent && size <= CONVERSION_ARENA_BLOCK_SIZE && (ret = conversion_arena_alloc(pool, size)))
+        return ret;
+
+    if (!(entry = malloc(sizeof(*entry) + size)))
+        return NULL;
+    list_add_tail(&pool->alloc_entries, entry);
+    return entry + 1;
+}
+
+void conversion_context_release_arena(struct conversion_context *pool)
+{
+    struct conversion_arena *arena = pool->arena;
+
+    /* Contexts are freed in the reverse order of their creation on a given
+     * thread, so everything allocated after this one's mark is dead. */
+    arena->current = pool->arena_block;
+    arena->current->used = pool->arena_used;
+    pool->arena = NULL;
+}
+
+static void conversion_stats_dump(void)
+{
+    const struct conversion_stats *stats;
+    unsigned int i;
+
+    TRACE_(vulkan_conv)("Conversion bytes per call, buckets <= 512, 2K, 8K, 32K, 128K, more:\n");
+    for (i = 0; i < unix_count; ++i)
+    {
+        stats = &conversion_stats[i];
+        if (!stats->bytes)
+            continue;
+        TRACE_(vulkan_conv)("%s: %s bytes, %s %s %s %s %s %s.\n", vk_unix_call_names[i],
+                wine_dbgstr_longlong(stats->bytes), wine_dbgstr_longlong(stats->calls[0]),
+                wine_dbgstr_longlong(stats->calls[1]), wine_dbgstr_longlong(stats->calls[2]),
+                wine_dbgstr_longlong(stats->calls[3]), wine_dbgstr_longlong(stats->calls[4]),
+                wine_dbgstr_longlong(stats->calls[5]));
+    }
+}
+
+void conversion_stats_record(const struct conversion_context *pool)
+{
+    struct conversion_stats *stats = &conversion_stats[pool->entry];
+    unsigned int bucket;
+
+    for (bucket = 0; bucket < ARRAY_SIZE(conversion_stats_limits); ++bucket)
+    {
+        if (pool->size <= conversion_stats_limits[bucket])
+            break;
+    }
+
+    InterlockedExchangeAdd64(&stats->bytes, pool->size);
+    InterlockedIncrement64(&stats->calls[bucket]);
+
+    if (!(InterlockedIncrement(&conversion_stats_count) % CONVERSION_STATS_INTERVAL))
+        conversion_stats_dump();
+}
+
 NTSTATUS init_vulkan(void *arg)
 {
     const struct init_params *params = arg;
@@ -264,6 +439,9 @@ NTSTATUS init_vulkan(void *arg)
     p_vkEnumerateInstanceVersion = (PFN_vkEnumerateInstanceVersion)vk_funcs->p_vkGetInstanceProcAddr(NULL, "vkEnumerateInstanceVersion");
     p_vkEnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties)vk_funcs->p_vkGetInstanceProcAddr(NULL, "vkEnumerateInstanceExtensionProperties");
 
+    if (TRACE_ON(vulkan_conv) && !conversion_stats)
+        conversion_stats = calloc(unix_count, sizeof(*conversion_stats));
+
     *params->extensions = vk_funcs->client_extensions;
     return STATUS_SUCCESS;
 }
@@ -945,7 +1123,7 @@ VkResult wine_vkCreateDeferredOperationKHR(VkDevice device_handle,
     }
 
     vulkan_object_init(&object->obj, host_deferred_operation);
-    init_conversion_context(&object->ctx);
+    init_persistent_conversion_context(&object->ctx);
     instance->p_insert_object(instance, &object->obj);
 
     *operation = object->client.deferred_operation;
@@ -984,6 +1162,26 @@ static NTSTATUS is_available_device_function(VkDevice handle, const char *name)
     return !!vk_funcs->p_vkGetDeviceProcAddr(device->host.device, name);
 }
 
+static NTSTATUS execute_command_stream(const unixlib_entry_t *funcs, const BYTE *data, UINT32 size)
+{
+    const struct vk_command_header *header;
+    UINT32 offset;
+
+    for (offset = 0; offset < size; offset += header->size)
+    {
+        header = (const struct vk_command_header *)(data + offset);
+        if (size - offset < sizeof(*header) || header->size < sizeof(*header) || header->size > size - offset ||
+            header->code >= unix_count || header->code == unix_execute_command_stream)
+        {
+            ERR("Invalid command at offset %u, stream size %u.\n", offset, size);
+            return STATUS_INVALID_PARAMETER;
+        }
+        funcs[header->code]((void *)(header + 1));
+    }
+
+    return STATUS_SUCCESS;
+}
+
 #ifdef _WIN64
 
 NTSTATUS vk_is_available_instance_function(void *arg)
@@ -998,6 +1196,12 @@ NTSTATUS vk_is_available_device_function(void *arg)
     return is_available_device_function(params->device, params->name);
 }
 
+NTSTATUS vk_execute_command_stream(void *arg)
+{
+    struct execute_command_stream_params *params = arg;
+    return execute_command_stream(__wine_unix_call_funcs, params->data, params->size);
+}
+
 #endif /* _WIN64 */
 
 NTSTATUS wow64_init_vulkan(void *arg)
@@ -1034,3 +1238,17 @@ NTSTATUS vk_is_available_device_function32(void *arg)
     } *params = arg;
     return is_available_device_function(UlongToPtr(params->device), UlongToPtr(params->name));
 }
+
+NTSTATUS vk_execute_command_stream32(void *arg)
+{
+    struct
+    {
+        UINT32 data;
+        UINT32 size;
+    } *params = arg;
+#ifdef _WIN64
+    return execute_command_stream(__wine_unix_call_wow64_funcs, UlongToPtr(params->data), params->size);
+#else
+    return execute_command_stream(__wine_unix_call_funcs, UlongToPtr(params->data), params->size);
+#endif
+}
@@ -49,10 +49,28 @@ static inline struct vk_command_pool *command_pool_from_handle(VkCommandPool han
     return (struct vk_command_pool *)(uintptr_t)handle;
 }
 
+/* Simple vkCmd* calls are recorded into a per command buffer stream and
+ * executed in a single Unix call, when the stream is full or before any other
+ * call on the command buffer, including vkEndCommandBuffer(). */
+#define VK_COMMAND_STREAM_SIZE 4096
+
+struct vk_command_header
+{
+    UINT32 code;
+    UINT32 size; /* including the header */
+};
+
+struct vk_command_stream
+{
+    UINT32 size;
+    UINT64 data[VK_COMMAND_STREAM_SIZE / sizeof(UINT64)];
+};
+
 struct VkCommandBuffer_T
 {
     struct vulkan_client_object obj;
     struct list pool_link;
+    struct vk_command_stream stream;
 };
 
 struct vulkan_func
@@ -143,6 +161,12 @@ struct is_available_device_function_params
     const char *name;
 };
 
+struct execute_command_stream_params
+{
+    const void *data;
+    UINT32 size;
+};
+
 #define UNIX_CALL(code, params) WINE_UNIX_CALL(unix_ ## code, params)
 #define UNIX_CALL_CHECKED(code, params)                           \
     do {                                                          \
@@ -154,4 +178,37 @@ struct is_available_device_function_params
         }                                                         \
     } while (0)
 
+#ifndef WINE_UNIX_LIB
+
+static inline void vk_command_buffer_flush(VkCommandBuffer buffer)
+{
+    struct execute_command_stream_params params;
+
+    if (!buffer->stream.size)
+        return;
+
+    params.data = buffer->stream.data;
+    params.size = buffer->stream.size;
+    UNIX_CALL(execute_command_stream, &params);
+    buffer->stream.size = 0;
+}
+
+static inline void *vk_command_buffer_record(VkCommandBuffer buffer, enum unix_call code, UINT32 size)
+{
+    struct vk_command_stream *stream = &buffer->stream;
+    struct vk_command_header *header;
+
+    size = (sizeof(*header) + size + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1);
+    if (stream->size + size > sizeof(stream->data))
+        vk_command_buffer_flush(buffer);
+
+    header = (struct vk_command_header *)((BYTE *)stream->data + stream->size);
+    header->code = code;
+    header->size = size;
+    stream->size += size;
+    return header + 1;
+}
+
+#endif /* WINE_UNIX_LIB */
+
 #endif /* __WINE_VULKAN_LOADER_H */
@@ -60,43 +60,74 @@ NTSTATUS vk_is_available_instance_function(void *arg);
 NTSTATUS vk_is_available_device_function(void *arg);
 NTSTATUS vk_is_available_instance_function32(void *arg);
 NTSTATUS vk_is_available_device_function32(void *arg);
+NTSTATUS vk_execute_command_stream(void *arg);
+NTSTATUS vk_execute_command_stream32(void *arg);
+
+extern const char * const vk_unix_call_names[];
+
+/* Conversions which don't fit in the context buffer are allocated from a
+ * per-thread arena, released in LIFO order as contexts are freed. Persistent
+ * contexts, which outlive the call that created them, use the heap instead. */
+struct conversion_arena;
+struct conversion_arena_block;
 
 struct conversion_context
 {
     char buffer[2048];
     uint32_t used;
     struct list alloc_entries;
+    enum unix_call entry;
+    BOOL persistent;
+    size_t size;
+    struct conversion_arena *arena;
+    struct conversion_arena_block *arena_block;
+    size_t arena_used;
 };
 
-static inline void init_conversion_context(struct conversion_context *pool)
+extern struct conversion_stats *conversion_stats;
+
+void *conversion_context_alloc_slow(struct conversion_context *pool, size_t size);
+void conversion_context_release_arena(struct conversion_context *pool);
+void conversion_stats_record(const struct conversion_context *pool);
+
+static inline void init_conversion_context(struct conversion_context *pool, enum unix_call entry)
 {
     pool->used = 0;
     list_init(&pool->alloc_entries);
+    pool->entry = entry;
+    pool->persistent = FALSE;
+    pool->size = 0;
+    pool->arena = NULL;
+}
+
+static inline void init_persistent_conversion_context(struct conversion_context *pool)
+{
+    init_conversion_context(pool, unix_count);
+    pool->persistent = TRUE;
 }
 
 static inline void free_conversion_context(struct conversion_context *pool)
 {
     struct list *entry, *next;
+
+    if (pool->arena)
+        conversion_context_release_arena(pool);
     LIST_FOR_EACH_SAFE(entry, next, &pool->alloc_entries)
         free(entry);
+    if (conversion_stats && !pool->persistent)
+        conversion_stats_record(pool);
 }
 
 static inline void *conversion_context_alloc(struct conversion_context *pool, size_t size)
 {
+    pool->size += size;
     if (pool->used + size <= sizeof(pool->buffer))
     {
         void *ret = pool->buffer + pool->used;
         pool->used += (size + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1);
         return ret;
     }
-    else
-    {
-        struct list *entry;
-        if (!(entry = malloc(sizeof(*entry) + size)))
-            return NULL;
-        list_add_tail(&pool->alloc_entries, entry);
-        return entry + 1;
-    }
+    return conversion_context_alloc_slow(pool, size);
 }
 
 struct wine_deferred_operation
@@ -50356,7 +50356,7 @@ static NTSTATUS thunk32_vkAllocateCommandBuffers(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pAllocateInfo, params->pCommandBuffers);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkAllocateCommandBuffers);
     convert_VkCommandBufferAllocateInfo_win32_to_unwrapped_host((const VkCommandBufferAllocateInfo32 *)UlongToPtr(params->pAllocateInfo), &pAllocateInfo_host);
     pCommandBuffers_host = convert_VkCommandBuffer_array_win32_to_unwrapped_host(ctx, (PTR32 *)UlongToPtr(params->pCommandBuffers), ((const VkCommandBufferAllocateInfo32 *)UlongToPtr(params->pAllocateInfo))->commandBufferCount);
     params->result = wine_vkAllocateCommandBuffers((VkDevice)UlongToPtr(params->device), &pAllocateInfo_host, pCommandBuffers_host);
@@ -50391,7 +50391,7 @@ static NTSTATUS thunk32_vkAllocateDescriptorSets(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pAllocateInfo, params->pDescriptorSets);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkAllocateDescriptorSets);
     convert_VkDescriptorSetAllocateInfo_win32_to_host(ctx, (const VkDescriptorSetAllocateInfo32 *)UlongToPtr(params->pAllocateInfo), &pAllocateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkAllocateDescriptorSets(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pAllocateInfo_host, (VkDescriptorSet *)UlongToPtr(params->pDescriptorSets));
     free_conversion_context(ctx);
@@ -50408,7 +50408,7 @@ static NTSTATUS thunk64_vkAllocateMemory(void *args)
 
     TRACE("%p, %p, %p, %p\n", params->device, params->pAllocateInfo, params->pAllocator, params->pMemory);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkAllocateMemory);
     convert_VkMemoryAllocateInfo_win64_to_host(ctx, params->pAllocateInfo, &pAllocateInfo_host);
     params->result = vk_funcs->p_vkAllocateMemory(params->device, &pAllocateInfo_host, params->pAllocator, params->pMemory);
     free_conversion_context(ctx);
@@ -50432,7 +50432,7 @@ static NTSTATUS thunk32_vkAllocateMemory(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pAllocateInfo, params->pAllocator, params->pMemory);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkAllocateMemory);
     convert_VkMemoryAllocateInfo_win32_to_host(ctx, (const VkMemoryAllocateInfo32 *)UlongToPtr(params->pAllocateInfo), &pAllocateInfo_host);
     params->result = vk_funcs->p_vkAllocateMemory((VkDevice)UlongToPtr(params->device), &pAllocateInfo_host, (const VkAllocationCallbacks *)UlongToPtr(params->pAllocator), (VkDeviceMemory *)UlongToPtr(params->pMemory));
     free_conversion_context(ctx);
@@ -50464,7 +50464,7 @@ static NTSTATUS thunk32_vkAntiLagUpdateAMD(void *args)
 
     TRACE("%#x, %#x\n", params->device, params->pData);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkAntiLagUpdateAMD);
     convert_VkAntiLagDataAMD_win32_to_host(ctx, (const VkAntiLagDataAMD32 *)UlongToPtr(params->pData), &pData_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkAntiLagUpdateAMD(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pData_host);
     free_conversion_context(ctx);
@@ -50481,7 +50481,7 @@ static NTSTATUS thunk64_vkBeginCommandBuffer(void *args)
 
     TRACE("%p, %p\n", params->commandBuffer, params->pBeginInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBeginCommandBuffer);
     convert_VkCommandBufferBeginInfo_win64_to_host(ctx, params->pBeginInfo, &pBeginInfo_host);
     params->result = vulkan_command_buffer_from_handle(params->commandBuffer)->device->p_vkBeginCommandBuffer(vulkan_command_buffer_from_handle(params->commandBuffer)->host.command_buffer, &pBeginInfo_host);
     free_conversion_context(ctx);
@@ -50503,7 +50503,7 @@ static NTSTATUS thunk32_vkBeginCommandBuffer(void *args)
 
     TRACE("%#x, %#x\n", params->commandBuffer, params->pBeginInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBeginCommandBuffer);
     convert_VkCommandBufferBeginInfo_win32_to_host(ctx, (const VkCommandBufferBeginInfo32 *)UlongToPtr(params->pBeginInfo), &pBeginInfo_host);
     params->result = vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkBeginCommandBuffer(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pBeginInfo_host);
     free_conversion_context(ctx);
@@ -50520,7 +50520,7 @@ static NTSTATUS thunk64_vkBindAccelerationStructureMemoryNV(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindAccelerationStructureMemoryNV);
     pBindInfos_host = convert_VkBindAccelerationStructureMemoryInfoNV_array_win64_to_host(ctx, params->pBindInfos, params->bindInfoCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkBindAccelerationStructureMemoryNV(vulkan_device_from_handle(params->device)->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50543,7 +50543,7 @@ static NTSTATUS thunk32_vkBindAccelerationStructureMemoryNV(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindAccelerationStructureMemoryNV);
     pBindInfos_host = convert_VkBindAccelerationStructureMemoryInfoNV_array_win32_to_host(ctx, (const VkBindAccelerationStructureMemoryInfoNV32 *)UlongToPtr(params->pBindInfos), params->bindInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkBindAccelerationStructureMemoryNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50589,7 +50589,7 @@ static NTSTATUS thunk64_vkBindBufferMemory2(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindBufferMemory2);
     pBindInfos_host = convert_VkBindBufferMemoryInfo_array_win64_to_host(ctx, params->pBindInfos, params->bindInfoCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkBindBufferMemory2(vulkan_device_from_handle(params->device)->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50612,7 +50612,7 @@ static NTSTATUS thunk32_vkBindBufferMemory2(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindBufferMemory2);
     pBindInfos_host = convert_VkBindBufferMemoryInfo_array_win32_to_host(ctx, (const VkBindBufferMemoryInfo32 *)UlongToPtr(params->pBindInfos), params->bindInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkBindBufferMemory2(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50629,7 +50629,7 @@ static NTSTATUS thunk64_vkBindBufferMemory2KHR(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindBufferMemory2KHR);
     pBindInfos_host = convert_VkBindBufferMemoryInfo_array_win64_to_host(ctx, params->pBindInfos, params->bindInfoCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkBindBufferMemory2KHR(vulkan_device_from_handle(params->device)->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50652,7 +50652,7 @@ static NTSTATUS thunk32_vkBindBufferMemory2KHR(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindBufferMemory2KHR);
     pBindInfos_host = convert_VkBindBufferMemoryInfo_array_win32_to_host(ctx, (const VkBindBufferMemoryInfo32 *)UlongToPtr(params->pBindInfos), params->bindInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkBindBufferMemory2KHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50669,7 +50669,7 @@ static NTSTATUS thunk64_vkBindDataGraphPipelineSessionMemoryARM(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindDataGraphPipelineSessionMemoryARM);
     pBindInfos_host = convert_VkBindDataGraphPipelineSessionMemoryInfoARM_array_win64_to_host(ctx, params->pBindInfos, params->bindInfoCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkBindDataGraphPipelineSessionMemoryARM(vulkan_device_from_handle(params->device)->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50692,7 +50692,7 @@ static NTSTATUS thunk32_vkBindDataGraphPipelineSessionMemoryARM(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindDataGraphPipelineSessionMemoryARM);
     pBindInfos_host = convert_VkBindDataGraphPipelineSessionMemoryInfoARM_array_win32_to_host(ctx, (const VkBindDataGraphPipelineSessionMemoryInfoARM32 *)UlongToPtr(params->pBindInfos), params->bindInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkBindDataGraphPipelineSessionMemoryARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50738,7 +50738,7 @@ static NTSTATUS thunk64_vkBindImageMemory2(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindImageMemory2);
     pBindInfos_host = convert_VkBindImageMemoryInfo_array_win64_to_host(ctx, params->pBindInfos, params->bindInfoCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkBindImageMemory2(vulkan_device_from_handle(params->device)->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50761,7 +50761,7 @@ static NTSTATUS thunk32_vkBindImageMemory2(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindImageMemory2);
     pBindInfos_host = convert_VkBindImageMemoryInfo_array_win32_to_host(ctx, (const VkBindImageMemoryInfo32 *)UlongToPtr(params->pBindInfos), params->bindInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkBindImageMemory2(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50778,7 +50778,7 @@ static NTSTATUS thunk64_vkBindImageMemory2KHR(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindImageMemory2KHR);
     pBindInfos_host = convert_VkBindImageMemoryInfo_array_win64_to_host(ctx, params->pBindInfos, params->bindInfoCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkBindImageMemory2KHR(vulkan_device_from_handle(params->device)->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50801,7 +50801,7 @@ static NTSTATUS thunk32_vkBindImageMemory2KHR(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindImageMemory2KHR);
     pBindInfos_host = convert_VkBindImageMemoryInfo_array_win32_to_host(ctx, (const VkBindImageMemoryInfo32 *)UlongToPtr(params->pBindInfos), params->bindInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkBindImageMemory2KHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50848,7 +50848,7 @@ static NTSTATUS thunk64_vkBindTensorMemoryARM(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindTensorMemoryARM);
     pBindInfos_host = convert_VkBindTensorMemoryInfoARM_array_win64_to_host(ctx, params->pBindInfos, params->bindInfoCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkBindTensorMemoryARM(vulkan_device_from_handle(params->device)->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50871,7 +50871,7 @@ static NTSTATUS thunk32_vkBindTensorMemoryARM(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->bindInfoCount, params->pBindInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindTensorMemoryARM);
     pBindInfos_host = convert_VkBindTensorMemoryInfoARM_array_win32_to_host(ctx, (const VkBindTensorMemoryInfoARM32 *)UlongToPtr(params->pBindInfos), params->bindInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkBindTensorMemoryARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->bindInfoCount, pBindInfos_host);
     free_conversion_context(ctx);
@@ -50888,7 +50888,7 @@ static NTSTATUS thunk64_vkBindVideoSessionMemoryKHR(void *args)
 
     TRACE("%p, 0x%s, %u, %p\n", params->device, wine_dbgstr_longlong(params->videoSession), params->bindSessionMemoryInfoCount, params->pBindSessionMemoryInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindVideoSessionMemoryKHR);
     pBindSessionMemoryInfos_host = convert_VkBindVideoSessionMemoryInfoKHR_array_win64_to_host(ctx, params->pBindSessionMemoryInfos, params->bindSessionMemoryInfoCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkBindVideoSessionMemoryKHR(vulkan_device_from_handle(params->device)->host.device, params->videoSession, params->bindSessionMemoryInfoCount, pBindSessionMemoryInfos_host);
     free_conversion_context(ctx);
@@ -50912,7 +50912,7 @@ static NTSTATUS thunk32_vkBindVideoSessionMemoryKHR(void *args)
 
     TRACE("%#x, 0x%s, %u, %#x\n", params->device, wine_dbgstr_longlong(params->videoSession), params->bindSessionMemoryInfoCount, params->pBindSessionMemoryInfos);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkBindVideoSessionMemoryKHR);
     pBindSessionMemoryInfos_host = convert_VkBindVideoSessionMemoryInfoKHR_array_win32_to_host(ctx, (const VkBindVideoSessionMemoryInfoKHR32 *)UlongToPtr(params->pBindSessionMemoryInfos), params->bindSessionMemoryInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkBindVideoSessionMemoryKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->videoSession, params->bindSessionMemoryInfoCount, pBindSessionMemoryInfos_host);
     free_conversion_context(ctx);
@@ -50950,7 +50950,7 @@ static NTSTATUS thunk32_vkBuildAccelerationStructuresKHR(void *args)
     TRACE("%#x, 0x%s, %u, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->deferredOperation), params->infoCount, params->pInfos, params->ppBuildRangeInfos);
 
     if (params->deferredOperation == VK_NULL_HANDLE)
-        init_conversion_context(ctx);
+        init_conversion_context(ctx, unix_vkBuildAccelerationStructuresKHR);
     else
         ctx = &wine_deferred_operation_from_handle(params->deferredOperation)->ctx;
     pInfos_host = convert_VkAccelerationStructureBuildGeometryInfoKHR_array_win32_to_host(ctx, (const VkAccelerationStructureBuildGeometryInfoKHR32 *)UlongToPtr(params->pInfos), params->infoCount);
@@ -50990,7 +50990,7 @@ static NTSTATUS thunk32_vkBuildMicromapsEXT(void *args)
     TRACE("%#x, 0x%s, %u, %#x\n", params->device, wine_dbgstr_longlong(params->deferredOperation), params->infoCount, params->pInfos);
 
     if (params->deferredOperation == VK_NULL_HANDLE)
-        init_conversion_context(ctx);
+        init_conversion_context(ctx, unix_vkBuildMicromapsEXT);
     else
         ctx = &wine_deferred_operation_from_handle(params->deferredOperation)->ctx;
     pInfos_host = convert_VkMicromapBuildInfoEXT_array_win32_to_host(ctx, (const VkMicromapBuildInfoEXT32 *)UlongToPtr(params->pInfos), params->infoCount);
@@ -51090,7 +51090,7 @@ static void thunk32_vkCmdBeginCustomResolveEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBeginCustomResolveEXT);
     if (params->pBeginCustomResolveInfo)
     {
         pBeginCustomResolveInfo_host = conversion_context_alloc(ctx, sizeof(*pBeginCustomResolveInfo_host));
@@ -51268,7 +51268,7 @@ static void thunk32_vkCmdBeginRenderPass(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBeginRenderPass);
     convert_VkRenderPassBeginInfo_win32_to_host(ctx, (const VkRenderPassBeginInfo32 *)UlongToPtr(params->pRenderPassBegin), &pRenderPassBegin_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBeginRenderPass(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pRenderPassBegin_host, params->contents);
     free_conversion_context(ctx);
@@ -51296,7 +51296,7 @@ static void thunk32_vkCmdBeginRenderPass2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBeginRenderPass2);
     convert_VkRenderPassBeginInfo_win32_to_host(ctx, (const VkRenderPassBeginInfo32 *)UlongToPtr(params->pRenderPassBegin), &pRenderPassBegin_host);
     convert_VkSubpassBeginInfo_win32_to_host((const VkSubpassBeginInfo32 *)UlongToPtr(params->pSubpassBeginInfo), &pSubpassBeginInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBeginRenderPass2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pRenderPassBegin_host, &pSubpassBeginInfo_host);
@@ -51325,7 +51325,7 @@ static void thunk32_vkCmdBeginRenderPass2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBeginRenderPass2KHR);
     convert_VkRenderPassBeginInfo_win32_to_host(ctx, (const VkRenderPassBeginInfo32 *)UlongToPtr(params->pRenderPassBegin), &pRenderPassBegin_host);
     convert_VkSubpassBeginInfo_win32_to_host((const VkSubpassBeginInfo32 *)UlongToPtr(params->pSubpassBeginInfo), &pSubpassBeginInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBeginRenderPass2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pRenderPassBegin_host, &pSubpassBeginInfo_host);
@@ -51352,7 +51352,7 @@ static void thunk32_vkCmdBeginRendering(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBeginRendering);
     convert_VkRenderingInfo_win32_to_host(ctx, (const VkRenderingInfo32 *)UlongToPtr(params->pRenderingInfo), &pRenderingInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBeginRendering(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pRenderingInfo_host);
     free_conversion_context(ctx);
@@ -51378,7 +51378,7 @@ static void thunk32_vkCmdBeginRenderingKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBeginRenderingKHR);
     convert_VkRenderingInfo_win32_to_host(ctx, (const VkRenderingInfo32 *)UlongToPtr(params->pRenderingInfo), &pRenderingInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBeginRenderingKHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pRenderingInfo_host);
     free_conversion_context(ctx);
@@ -51426,7 +51426,7 @@ static void thunk32_vkCmdBeginTransformFeedback2EXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBeginTransformFeedback2EXT);
     pCounterInfos_host = convert_VkBindTransformFeedbackBuffer2InfoEXT_array_win32_to_host(ctx, (const VkBindTransformFeedbackBuffer2InfoEXT32 *)UlongToPtr(params->pCounterInfos), params->counterRangeCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBeginTransformFeedback2EXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->firstCounterRange, params->counterRangeCount, pCounterInfos_host);
     free_conversion_context(ctx);
@@ -51475,7 +51475,7 @@ static void thunk32_vkCmdBeginVideoCodingKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBeginVideoCodingKHR);
     convert_VkVideoBeginCodingInfoKHR_win32_to_host(ctx, (const VkVideoBeginCodingInfoKHR32 *)UlongToPtr(params->pBeginInfo), &pBeginInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBeginVideoCodingKHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pBeginInfo_host);
     free_conversion_context(ctx);
@@ -51501,7 +51501,7 @@ static void thunk32_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT);
     convert_VkBindDescriptorBufferEmbeddedSamplersInfoEXT_win32_to_host(ctx, (const VkBindDescriptorBufferEmbeddedSamplersInfoEXT32 *)UlongToPtr(params->pBindDescriptorBufferEmbeddedSamplersInfo), &pBindDescriptorBufferEmbeddedSamplersInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pBindDescriptorBufferEmbeddedSamplersInfo_host);
     free_conversion_context(ctx);
@@ -51550,7 +51550,7 @@ static void thunk32_vkCmdBindDescriptorBuffersEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBindDescriptorBuffersEXT);
     pBindingInfos_host = convert_VkDescriptorBufferBindingInfoEXT_array_win32_to_host(ctx, (const VkDescriptorBufferBindingInfoEXT32 *)UlongToPtr(params->pBindingInfos), params->bufferCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBindDescriptorBuffersEXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->bufferCount, pBindingInfos_host);
     free_conversion_context(ctx);
@@ -51602,7 +51602,7 @@ static void thunk32_vkCmdBindDescriptorSets2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBindDescriptorSets2);
     convert_VkBindDescriptorSetsInfo_win32_to_host(ctx, (const VkBindDescriptorSetsInfo32 *)UlongToPtr(params->pBindDescriptorSetsInfo), &pBindDescriptorSetsInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBindDescriptorSets2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pBindDescriptorSetsInfo_host);
     free_conversion_context(ctx);
@@ -51628,7 +51628,7 @@ static void thunk32_vkCmdBindDescriptorSets2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBindDescriptorSets2KHR);
     convert_VkBindDescriptorSetsInfo_win32_to_host(ctx, (const VkBindDescriptorSetsInfo32 *)UlongToPtr(params->pBindDescriptorSetsInfo), &pBindDescriptorSetsInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBindDescriptorSets2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pBindDescriptorSetsInfo_host);
     free_conversion_context(ctx);
@@ -51883,7 +51883,7 @@ static void thunk64_vkCmdBindTileMemoryQCOM(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBindTileMemoryQCOM);
     if (params->pTileMemoryBindInfo)
     {
         pTileMemoryBindInfo_host = conversion_context_alloc(ctx, sizeof(*pTileMemoryBindInfo_host));
@@ -51905,7 +51905,7 @@ static void thunk32_vkCmdBindTileMemoryQCOM(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBindTileMemoryQCOM);
     if (params->pTileMemoryBindInfo)
     {
         pTileMemoryBindInfo_host = conversion_context_alloc(ctx, sizeof(*pTileMemoryBindInfo_host));
@@ -51937,7 +51937,7 @@ static void thunk32_vkCmdBindTransformFeedbackBuffers2EXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBindTransformFeedbackBuffers2EXT);
     pBindingInfos_host = convert_VkBindTransformFeedbackBuffer2InfoEXT_array_win32_to_host(ctx, (const VkBindTransformFeedbackBuffer2InfoEXT32 *)UlongToPtr(params->pBindingInfos), params->bindingCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBindTransformFeedbackBuffers2EXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->firstBinding, params->bindingCount, pBindingInfos_host);
     free_conversion_context(ctx);
@@ -52062,7 +52062,7 @@ static void thunk32_vkCmdBindVertexBuffers3KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBindVertexBuffers3KHR);
     pBindingInfos_host = convert_VkBindVertexBuffer3InfoKHR_array_win32_to_host(ctx, (const VkBindVertexBuffer3InfoKHR32 *)UlongToPtr(params->pBindingInfos), params->bindingCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBindVertexBuffers3KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->firstBinding, params->bindingCount, pBindingInfos_host);
     free_conversion_context(ctx);
@@ -52114,7 +52114,7 @@ static void thunk32_vkCmdBlitImage2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBlitImage2);
     convert_VkBlitImageInfo2_win32_to_host(ctx, (const VkBlitImageInfo232 *)UlongToPtr(params->pBlitImageInfo), &pBlitImageInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBlitImage2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pBlitImageInfo_host);
     free_conversion_context(ctx);
@@ -52140,7 +52140,7 @@ static void thunk32_vkCmdBlitImage2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBlitImage2KHR);
     convert_VkBlitImageInfo2_win32_to_host(ctx, (const VkBlitImageInfo232 *)UlongToPtr(params->pBlitImageInfo), &pBlitImageInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBlitImage2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pBlitImageInfo_host);
     free_conversion_context(ctx);
@@ -52173,7 +52173,7 @@ static void thunk32_vkCmdBuildAccelerationStructureNV(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBuildAccelerationStructureNV);
     convert_VkAccelerationStructureInfoNV_win32_to_host(ctx, (const VkAccelerationStructureInfoNV32 *)UlongToPtr(params->pInfo), &pInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBuildAccelerationStructureNV(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pInfo_host, params->instanceData, params->instanceOffset, params->update, params->dst, params->src, params->scratch, params->scratchOffset);
     free_conversion_context(ctx);
@@ -52204,7 +52204,7 @@ static void thunk32_vkCmdBuildAccelerationStructuresIndirectKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBuildAccelerationStructuresIndirectKHR);
     pInfos_host = convert_VkAccelerationStructureBuildGeometryInfoKHR_array_win32_to_host(ctx, (const VkAccelerationStructureBuildGeometryInfoKHR32 *)UlongToPtr(params->pInfos), params->infoCount);
     ppMaxPrimitiveCounts_host = convert_uint32_t_array_win32_to_host(ctx, (const PTR32 *)UlongToPtr(params->ppMaxPrimitiveCounts), params->infoCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBuildAccelerationStructuresIndirectKHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->infoCount, pInfos_host, (const VkDeviceAddress *)UlongToPtr(params->pIndirectDeviceAddresses), (const uint32_t *)UlongToPtr(params->pIndirectStrides), ppMaxPrimitiveCounts_host);
@@ -52235,7 +52235,7 @@ static void thunk32_vkCmdBuildAccelerationStructuresKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBuildAccelerationStructuresKHR);
     pInfos_host = convert_VkAccelerationStructureBuildGeometryInfoKHR_array_win32_to_host(ctx, (const VkAccelerationStructureBuildGeometryInfoKHR32 *)UlongToPtr(params->pInfos), params->infoCount);
     ppBuildRangeInfos_host = convert_VkAccelerationStructureBuildRangeInfoKHR_array_win32_to_host(ctx, (const PTR32 *)UlongToPtr(params->ppBuildRangeInfos), params->infoCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBuildAccelerationStructuresKHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->infoCount, pInfos_host, ppBuildRangeInfos_host);
@@ -52262,7 +52262,7 @@ static void thunk32_vkCmdBuildClusterAccelerationStructureIndirectNV(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBuildClusterAccelerationStructureIndirectNV);
     convert_VkClusterAccelerationStructureCommandsInfoNV_win32_to_host(ctx, (const VkClusterAccelerationStructureCommandsInfoNV32 *)UlongToPtr(params->pCommandInfos), &pCommandInfos_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBuildClusterAccelerationStructureIndirectNV(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCommandInfos_host);
     free_conversion_context(ctx);
@@ -52289,7 +52289,7 @@ static void thunk32_vkCmdBuildMicromapsEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBuildMicromapsEXT);
     pInfos_host = convert_VkMicromapBuildInfoEXT_array_win32_to_host(ctx, (const VkMicromapBuildInfoEXT32 *)UlongToPtr(params->pInfos), params->infoCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBuildMicromapsEXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->infoCount, pInfos_host);
     free_conversion_context(ctx);
@@ -52315,7 +52315,7 @@ static void thunk32_vkCmdBuildPartitionedAccelerationStructuresNV(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdBuildPartitionedAccelerationStructuresNV);
     convert_VkBuildPartitionedAccelerationStructureInfoNV_win32_to_host(ctx, (const VkBuildPartitionedAccelerationStructureInfoNV32 *)UlongToPtr(params->pBuildInfo), &pBuildInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdBuildPartitionedAccelerationStructuresNV(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pBuildInfo_host);
     free_conversion_context(ctx);
@@ -52412,7 +52412,7 @@ static void thunk32_vkCmdControlVideoCodingKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdControlVideoCodingKHR);
     convert_VkVideoCodingControlInfoKHR_win32_to_host(ctx, (const VkVideoCodingControlInfoKHR32 *)UlongToPtr(params->pCodingControlInfo), &pCodingControlInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdControlVideoCodingKHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCodingControlInfo_host);
     free_conversion_context(ctx);
@@ -52439,7 +52439,7 @@ static void thunk32_vkCmdConvertCooperativeVectorMatrixNV(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdConvertCooperativeVectorMatrixNV);
     pInfos_host = convert_VkConvertCooperativeVectorMatrixInfoNV_array_win32_to_host(ctx, (const VkConvertCooperativeVectorMatrixInfoNV32 *)UlongToPtr(params->pInfos), params->infoCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdConvertCooperativeVectorMatrixNV(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->infoCount, pInfos_host);
     free_conversion_context(ctx);
@@ -52534,7 +52534,7 @@ static void thunk32_vkCmdCopyBuffer(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyBuffer);
     pRegions_host = convert_VkBufferCopy_array_win32_to_host(ctx, (const VkBufferCopy32 *)UlongToPtr(params->pRegions), params->regionCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyBuffer(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->srcBuffer, params->dstBuffer, params->regionCount, pRegions_host);
     free_conversion_context(ctx);
@@ -52560,7 +52560,7 @@ static void thunk32_vkCmdCopyBuffer2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyBuffer2);
     convert_VkCopyBufferInfo2_win32_to_host(ctx, (const VkCopyBufferInfo232 *)UlongToPtr(params->pCopyBufferInfo), &pCopyBufferInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyBuffer2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCopyBufferInfo_host);
     free_conversion_context(ctx);
@@ -52586,7 +52586,7 @@ static void thunk32_vkCmdCopyBuffer2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyBuffer2KHR);
     convert_VkCopyBufferInfo2_win32_to_host(ctx, (const VkCopyBufferInfo232 *)UlongToPtr(params->pCopyBufferInfo), &pCopyBufferInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyBuffer2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCopyBufferInfo_host);
     free_conversion_context(ctx);
@@ -52616,7 +52616,7 @@ static void thunk32_vkCmdCopyBufferToImage(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyBufferToImage);
     pRegions_host = convert_VkBufferImageCopy_array_win32_to_host(ctx, (const VkBufferImageCopy32 *)UlongToPtr(params->pRegions), params->regionCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyBufferToImage(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->srcBuffer, params->dstImage, params->dstImageLayout, params->regionCount, pRegions_host);
     free_conversion_context(ctx);
@@ -52642,7 +52642,7 @@ static void thunk32_vkCmdCopyBufferToImage2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyBufferToImage2);
     convert_VkCopyBufferToImageInfo2_win32_to_host(ctx, (const VkCopyBufferToImageInfo232 *)UlongToPtr(params->pCopyBufferToImageInfo), &pCopyBufferToImageInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyBufferToImage2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCopyBufferToImageInfo_host);
     free_conversion_context(ctx);
@@ -52668,7 +52668,7 @@ static void thunk32_vkCmdCopyBufferToImage2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyBufferToImage2KHR);
     convert_VkCopyBufferToImageInfo2_win32_to_host(ctx, (const VkCopyBufferToImageInfo232 *)UlongToPtr(params->pCopyBufferToImageInfo), &pCopyBufferToImageInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyBufferToImage2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCopyBufferToImageInfo_host);
     free_conversion_context(ctx);
@@ -52739,7 +52739,7 @@ static void thunk32_vkCmdCopyImage2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyImage2);
     convert_VkCopyImageInfo2_win32_to_host(ctx, (const VkCopyImageInfo232 *)UlongToPtr(params->pCopyImageInfo), &pCopyImageInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyImage2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCopyImageInfo_host);
     free_conversion_context(ctx);
@@ -52765,7 +52765,7 @@ static void thunk32_vkCmdCopyImage2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyImage2KHR);
     convert_VkCopyImageInfo2_win32_to_host(ctx, (const VkCopyImageInfo232 *)UlongToPtr(params->pCopyImageInfo), &pCopyImageInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyImage2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCopyImageInfo_host);
     free_conversion_context(ctx);
@@ -52795,7 +52795,7 @@ static void thunk32_vkCmdCopyImageToBuffer(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyImageToBuffer);
     pRegions_host = convert_VkBufferImageCopy_array_win32_to_host(ctx, (const VkBufferImageCopy32 *)UlongToPtr(params->pRegions), params->regionCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyImageToBuffer(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->srcImage, params->srcImageLayout, params->dstBuffer, params->regionCount, pRegions_host);
     free_conversion_context(ctx);
@@ -52821,7 +52821,7 @@ static void thunk32_vkCmdCopyImageToBuffer2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyImageToBuffer2);
     convert_VkCopyImageToBufferInfo2_win32_to_host(ctx, (const VkCopyImageToBufferInfo232 *)UlongToPtr(params->pCopyImageToBufferInfo), &pCopyImageToBufferInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyImageToBuffer2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCopyImageToBufferInfo_host);
     free_conversion_context(ctx);
@@ -52847,7 +52847,7 @@ static void thunk32_vkCmdCopyImageToBuffer2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyImageToBuffer2KHR);
     convert_VkCopyImageToBufferInfo2_win32_to_host(ctx, (const VkCopyImageToBufferInfo232 *)UlongToPtr(params->pCopyImageToBufferInfo), &pCopyImageToBufferInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyImageToBuffer2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCopyImageToBufferInfo_host);
     free_conversion_context(ctx);
@@ -52873,7 +52873,7 @@ static void thunk32_vkCmdCopyImageToMemoryKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyImageToMemoryKHR);
     if (params->pCopyMemoryInfo)
     {
         pCopyMemoryInfo_host = conversion_context_alloc(ctx, sizeof(*pCopyMemoryInfo_host));
@@ -52947,7 +52947,7 @@ static void thunk32_vkCmdCopyMemoryKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyMemoryKHR);
     if (params->pCopyMemoryInfo)
     {
         pCopyMemoryInfo_host = conversion_context_alloc(ctx, sizeof(*pCopyMemoryInfo_host));
@@ -53046,7 +53046,7 @@ static void thunk32_vkCmdCopyMemoryToImageKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyMemoryToImageKHR);
     if (params->pCopyMemoryInfo)
     {
         pCopyMemoryInfo_host = conversion_context_alloc(ctx, sizeof(*pCopyMemoryInfo_host));
@@ -53195,7 +53195,7 @@ static void thunk32_vkCmdCopyTensorARM(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdCopyTensorARM);
     convert_VkCopyTensorInfoARM_win32_to_host(ctx, (const VkCopyTensorInfoARM32 *)UlongToPtr(params->pCopyTensorInfo), &pCopyTensorInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdCopyTensorARM(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pCopyTensorInfo_host);
     free_conversion_context(ctx);
@@ -53306,7 +53306,7 @@ static void thunk32_vkCmdDecodeVideoKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdDecodeVideoKHR);
     convert_VkVideoDecodeInfoKHR_win32_to_host(ctx, (const VkVideoDecodeInfoKHR32 *)UlongToPtr(params->pDecodeInfo), &pDecodeInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdDecodeVideoKHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pDecodeInfo_host);
     free_conversion_context(ctx);
@@ -53332,7 +53332,7 @@ static void thunk32_vkCmdDecompressMemoryEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdDecompressMemoryEXT);
     convert_VkDecompressMemoryInfoEXT_win32_to_host(ctx, (const VkDecompressMemoryInfoEXT32 *)UlongToPtr(params->pDecompressMemoryInfoEXT), &pDecompressMemoryInfoEXT_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdDecompressMemoryEXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pDecompressMemoryInfoEXT_host);
     free_conversion_context(ctx);
@@ -53405,7 +53405,7 @@ static void thunk32_vkCmdDecompressMemoryNV(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdDecompressMemoryNV);
     pDecompressMemoryRegions_host = convert_VkDecompressMemoryRegionNV_array_win32_to_host(ctx, (const VkDecompressMemoryRegionNV32 *)UlongToPtr(params->pDecompressMemoryRegions), params->decompressRegionCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdDecompressMemoryNV(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->decompressRegionCount, pDecompressMemoryRegions_host);
     free_conversion_context(ctx);
@@ -53504,7 +53504,7 @@ static void thunk32_vkCmdDispatchDataGraphARM(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdDispatchDataGraphARM);
     if (params->pInfo)
     {
         pInfo_host = conversion_context_alloc(ctx, sizeof(*pInfo_host));
@@ -54257,7 +54257,7 @@ static void thunk32_vkCmdEncodeVideoKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdEncodeVideoKHR);
     convert_VkVideoEncodeInfoKHR_win32_to_host(ctx, (const VkVideoEncodeInfoKHR32 *)UlongToPtr(params->pEncodeInfo), &pEncodeInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdEncodeVideoKHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pEncodeInfo_host);
     free_conversion_context(ctx);
@@ -54453,7 +54453,7 @@ static void thunk32_vkCmdEndRenderPass2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdEndRenderPass2);
     convert_VkSubpassEndInfo_win32_to_host(ctx, (const VkSubpassEndInfo32 *)UlongToPtr(params->pSubpassEndInfo), &pSubpassEndInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdEndRenderPass2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pSubpassEndInfo_host);
     free_conversion_context(ctx);
@@ -54479,7 +54479,7 @@ static void thunk32_vkCmdEndRenderPass2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdEndRenderPass2KHR);
     convert_VkSubpassEndInfo_win32_to_host(ctx, (const VkSubpassEndInfo32 *)UlongToPtr(params->pSubpassEndInfo), &pSubpassEndInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdEndRenderPass2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pSubpassEndInfo_host);
     free_conversion_context(ctx);
@@ -54524,7 +54524,7 @@ static void thunk32_vkCmdEndRendering2EXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdEndRendering2EXT);
     if (params->pRenderingEndInfo)
     {
         pRenderingEndInfo_host = conversion_context_alloc(ctx, sizeof(*pRenderingEndInfo_host));
@@ -54554,7 +54554,7 @@ static void thunk32_vkCmdEndRendering2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdEndRendering2KHR);
     if (params->pRenderingEndInfo)
     {
         pRenderingEndInfo_host = conversion_context_alloc(ctx, sizeof(*pRenderingEndInfo_host));
@@ -54624,7 +54624,7 @@ static void thunk32_vkCmdEndTransformFeedback2EXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdEndTransformFeedback2EXT);
     pCounterInfos_host = convert_VkBindTransformFeedbackBuffer2InfoEXT_array_win32_to_host(ctx, (const VkBindTransformFeedbackBuffer2InfoEXT32 *)UlongToPtr(params->pCounterInfos), params->counterRangeCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdEndTransformFeedback2EXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->firstCounterRange, params->counterRangeCount, pCounterInfos_host);
     free_conversion_context(ctx);
@@ -54683,7 +54683,7 @@ static void thunk64_vkCmdExecuteCommands(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdExecuteCommands);
     pCommandBuffers_host = convert_VkCommandBuffer_array_win64_to_host(ctx, params->pCommandBuffers, params->commandBufferCount);
     vulkan_command_buffer_from_handle(params->commandBuffer)->device->p_vkCmdExecuteCommands(vulkan_command_buffer_from_handle(params->commandBuffer)->host.command_buffer, params->commandBufferCount, pCommandBuffers_host);
     free_conversion_context(ctx);
@@ -54702,7 +54702,7 @@ static void thunk32_vkCmdExecuteCommands(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdExecuteCommands);
     pCommandBuffers_host = convert_VkCommandBuffer_array_win32_to_host(ctx, (const PTR32 *)UlongToPtr(params->pCommandBuffers), params->commandBufferCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdExecuteCommands(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->commandBufferCount, pCommandBuffers_host);
     free_conversion_context(ctx);
@@ -54729,7 +54729,7 @@ static void thunk32_vkCmdExecuteGeneratedCommandsEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdExecuteGeneratedCommandsEXT);
     convert_VkGeneratedCommandsInfoEXT_win32_to_host(ctx, (const VkGeneratedCommandsInfoEXT32 *)UlongToPtr(params->pGeneratedCommandsInfo), &pGeneratedCommandsInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdExecuteGeneratedCommandsEXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->isPreprocessed, &pGeneratedCommandsInfo_host);
     free_conversion_context(ctx);
@@ -54756,7 +54756,7 @@ static void thunk32_vkCmdExecuteGeneratedCommandsNV(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdExecuteGeneratedCommandsNV);
     convert_VkGeneratedCommandsInfoNV_win32_to_host(ctx, (const VkGeneratedCommandsInfoNV32 *)UlongToPtr(params->pGeneratedCommandsInfo), &pGeneratedCommandsInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdExecuteGeneratedCommandsNV(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->isPreprocessed, &pGeneratedCommandsInfo_host);
     free_conversion_context(ctx);
@@ -54873,7 +54873,7 @@ static void thunk32_vkCmdNextSubpass2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdNextSubpass2);
     convert_VkSubpassBeginInfo_win32_to_host((const VkSubpassBeginInfo32 *)UlongToPtr(params->pSubpassBeginInfo), &pSubpassBeginInfo_host);
     convert_VkSubpassEndInfo_win32_to_host(ctx, (const VkSubpassEndInfo32 *)UlongToPtr(params->pSubpassEndInfo), &pSubpassEndInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdNextSubpass2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pSubpassBeginInfo_host, &pSubpassEndInfo_host);
@@ -54902,7 +54902,7 @@ static void thunk32_vkCmdNextSubpass2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdNextSubpass2KHR);
     convert_VkSubpassBeginInfo_win32_to_host((const VkSubpassBeginInfo32 *)UlongToPtr(params->pSubpassBeginInfo), &pSubpassBeginInfo_host);
     convert_VkSubpassEndInfo_win32_to_host(ctx, (const VkSubpassEndInfo32 *)UlongToPtr(params->pSubpassEndInfo), &pSubpassEndInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdNextSubpass2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pSubpassBeginInfo_host, &pSubpassEndInfo_host);
@@ -54962,7 +54962,7 @@ static void thunk32_vkCmdPipelineBarrier(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPipelineBarrier);
     pMemoryBarriers_host = convert_VkMemoryBarrier_array_win32_to_host(ctx, (const VkMemoryBarrier32 *)UlongToPtr(params->pMemoryBarriers), params->memoryBarrierCount);
     pBufferMemoryBarriers_host = convert_VkBufferMemoryBarrier_array_win32_to_host(ctx, (const VkBufferMemoryBarrier32 *)UlongToPtr(params->pBufferMemoryBarriers), params->bufferMemoryBarrierCount);
     pImageMemoryBarriers_host = convert_VkImageMemoryBarrier_array_win32_to_host(ctx, (const VkImageMemoryBarrier32 *)UlongToPtr(params->pImageMemoryBarriers), params->imageMemoryBarrierCount);
@@ -54990,7 +54990,7 @@ static void thunk32_vkCmdPipelineBarrier2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPipelineBarrier2);
     convert_VkDependencyInfo_win32_to_host(ctx, (const VkDependencyInfo32 *)UlongToPtr(params->pDependencyInfo), &pDependencyInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPipelineBarrier2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pDependencyInfo_host);
     free_conversion_context(ctx);
@@ -55016,7 +55016,7 @@ static void thunk32_vkCmdPipelineBarrier2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPipelineBarrier2KHR);
     convert_VkDependencyInfo_win32_to_host(ctx, (const VkDependencyInfo32 *)UlongToPtr(params->pDependencyInfo), &pDependencyInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPipelineBarrier2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pDependencyInfo_host);
     free_conversion_context(ctx);
@@ -55043,7 +55043,7 @@ static void thunk32_vkCmdPreprocessGeneratedCommandsEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPreprocessGeneratedCommandsEXT);
     convert_VkGeneratedCommandsInfoEXT_win32_to_host(ctx, (const VkGeneratedCommandsInfoEXT32 *)UlongToPtr(params->pGeneratedCommandsInfo), &pGeneratedCommandsInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPreprocessGeneratedCommandsEXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pGeneratedCommandsInfo_host, vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->stateCommandBuffer))->host.command_buffer);
     free_conversion_context(ctx);
@@ -55069,7 +55069,7 @@ static void thunk32_vkCmdPreprocessGeneratedCommandsNV(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPreprocessGeneratedCommandsNV);
     convert_VkGeneratedCommandsInfoNV_win32_to_host(ctx, (const VkGeneratedCommandsInfoNV32 *)UlongToPtr(params->pGeneratedCommandsInfo), &pGeneratedCommandsInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPreprocessGeneratedCommandsNV(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pGeneratedCommandsInfo_host);
     free_conversion_context(ctx);
@@ -55119,7 +55119,7 @@ static void thunk32_vkCmdPushConstants2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPushConstants2);
     convert_VkPushConstantsInfo_win32_to_host(ctx, (const VkPushConstantsInfo32 *)UlongToPtr(params->pPushConstantsInfo), &pPushConstantsInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPushConstants2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pPushConstantsInfo_host);
     free_conversion_context(ctx);
@@ -55145,7 +55145,7 @@ static void thunk32_vkCmdPushConstants2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPushConstants2KHR);
     convert_VkPushConstantsInfo_win32_to_host(ctx, (const VkPushConstantsInfo32 *)UlongToPtr(params->pPushConstantsInfo), &pPushConstantsInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPushConstants2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pPushConstantsInfo_host);
     free_conversion_context(ctx);
@@ -55171,7 +55171,7 @@ static void thunk32_vkCmdPushDataEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPushDataEXT);
     convert_VkPushDataInfoEXT_win32_to_host(ctx, (const VkPushDataInfoEXT32 *)UlongToPtr(params->pPushDataInfo), &pPushDataInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPushDataEXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pPushDataInfo_host);
     free_conversion_context(ctx);
@@ -55201,7 +55201,7 @@ static void thunk32_vkCmdPushDescriptorSet(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPushDescriptorSet);
     pDescriptorWrites_host = convert_VkWriteDescriptorSet_array_win32_to_host(ctx, (const VkWriteDescriptorSet32 *)UlongToPtr(params->pDescriptorWrites), params->descriptorWriteCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPushDescriptorSet(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->pipelineBindPoint, params->layout, params->set, params->descriptorWriteCount, pDescriptorWrites_host);
     free_conversion_context(ctx);
@@ -55227,7 +55227,7 @@ static void thunk32_vkCmdPushDescriptorSet2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPushDescriptorSet2);
     convert_VkPushDescriptorSetInfo_win32_to_host(ctx, (const VkPushDescriptorSetInfo32 *)UlongToPtr(params->pPushDescriptorSetInfo), &pPushDescriptorSetInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPushDescriptorSet2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pPushDescriptorSetInfo_host);
     free_conversion_context(ctx);
@@ -55253,7 +55253,7 @@ static void thunk32_vkCmdPushDescriptorSet2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPushDescriptorSet2KHR);
     convert_VkPushDescriptorSetInfo_win32_to_host(ctx, (const VkPushDescriptorSetInfo32 *)UlongToPtr(params->pPushDescriptorSetInfo), &pPushDescriptorSetInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPushDescriptorSet2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pPushDescriptorSetInfo_host);
     free_conversion_context(ctx);
@@ -55283,7 +55283,7 @@ static void thunk32_vkCmdPushDescriptorSetKHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPushDescriptorSetKHR);
     pDescriptorWrites_host = convert_VkWriteDescriptorSet_array_win32_to_host(ctx, (const VkWriteDescriptorSet32 *)UlongToPtr(params->pDescriptorWrites), params->descriptorWriteCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPushDescriptorSetKHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->pipelineBindPoint, params->layout, params->set, params->descriptorWriteCount, pDescriptorWrites_host);
     free_conversion_context(ctx);
@@ -55332,7 +55332,7 @@ static void thunk32_vkCmdPushDescriptorSetWithTemplate2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPushDescriptorSetWithTemplate2);
     convert_VkPushDescriptorSetWithTemplateInfo_win32_to_host(ctx, (const VkPushDescriptorSetWithTemplateInfo32 *)UlongToPtr(params->pPushDescriptorSetWithTemplateInfo), &pPushDescriptorSetWithTemplateInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPushDescriptorSetWithTemplate2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pPushDescriptorSetWithTemplateInfo_host);
     free_conversion_context(ctx);
@@ -55358,7 +55358,7 @@ static void thunk32_vkCmdPushDescriptorSetWithTemplate2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdPushDescriptorSetWithTemplate2KHR);
     convert_VkPushDescriptorSetWithTemplateInfo_win32_to_host(ctx, (const VkPushDescriptorSetWithTemplateInfo32 *)UlongToPtr(params->pPushDescriptorSetWithTemplateInfo), &pPushDescriptorSetWithTemplateInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdPushDescriptorSetWithTemplate2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pPushDescriptorSetWithTemplateInfo_host);
     free_conversion_context(ctx);
@@ -55517,7 +55517,7 @@ static void thunk32_vkCmdResolveImage2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdResolveImage2);
     convert_VkResolveImageInfo2_win32_to_host(ctx, (const VkResolveImageInfo232 *)UlongToPtr(params->pResolveImageInfo), &pResolveImageInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdResolveImage2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pResolveImageInfo_host);
     free_conversion_context(ctx);
@@ -55543,7 +55543,7 @@ static void thunk32_vkCmdResolveImage2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdResolveImage2KHR);
     convert_VkResolveImageInfo2_win32_to_host(ctx, (const VkResolveImageInfo232 *)UlongToPtr(params->pResolveImageInfo), &pResolveImageInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdResolveImage2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pResolveImageInfo_host);
     free_conversion_context(ctx);
@@ -55671,7 +55671,7 @@ static void thunk32_vkCmdSetCoarseSampleOrderNV(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdSetCoarseSampleOrderNV);
     pCustomSampleOrders_host = convert_VkCoarseSampleOrderCustomNV_array_win32_to_host(ctx, (const VkCoarseSampleOrderCustomNV32 *)UlongToPtr(params->pCustomSampleOrders), params->customSampleOrderCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdSetCoarseSampleOrderNV(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->sampleOrderType, params->customSampleOrderCount, pCustomSampleOrders_host);
     free_conversion_context(ctx);
@@ -56031,7 +56031,7 @@ static void thunk32_vkCmdSetDepthBias2EXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdSetDepthBias2EXT);
     convert_VkDepthBiasInfoEXT_win32_to_host(ctx, (const VkDepthBiasInfoEXT32 *)UlongToPtr(params->pDepthBiasInfo), &pDepthBiasInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdSetDepthBias2EXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pDepthBiasInfo_host);
     free_conversion_context(ctx);
@@ -56359,7 +56359,7 @@ static void thunk32_vkCmdSetDescriptorBufferOffsets2EXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdSetDescriptorBufferOffsets2EXT);
     convert_VkSetDescriptorBufferOffsetsInfoEXT_win32_to_host(ctx, (const VkSetDescriptorBufferOffsetsInfoEXT32 *)UlongToPtr(params->pSetDescriptorBufferOffsetsInfo), &pSetDescriptorBufferOffsetsInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdSetDescriptorBufferOffsets2EXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, &pSetDescriptorBufferOffsetsInfo_host);
     free_conversion_context(ctx);
@@ -56556,7 +56556,7 @@ static void thunk32_vkCmdSetEvent2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdSetEvent2);
     convert_VkDependencyInfo_win32_to_host(ctx, (const VkDependencyInfo32 *)UlongToPtr(params->pDependencyInfo), &pDependencyInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdSetEvent2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->event, &pDependencyInfo_host);
     free_conversion_context(ctx);
@@ -56583,7 +56583,7 @@ static void thunk32_vkCmdSetEvent2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdSetEvent2KHR);
     convert_VkDependencyInfo_win32_to_host(ctx, (const VkDependencyInfo32 *)UlongToPtr(params->pDependencyInfo), &pDependencyInfo_host);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdSetEvent2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->event, &pDependencyInfo_host);
     free_conversion_context(ctx);
@@ -57695,7 +57695,7 @@ static void thunk32_vkCmdSetVertexInputEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdSetVertexInputEXT);
     pVertexBindingDescriptions_host = convert_VkVertexInputBindingDescription2EXT_array_win32_to_host(ctx, (const VkVertexInputBindingDescription2EXT32 *)UlongToPtr(params->pVertexBindingDescriptions), params->vertexBindingDescriptionCount);
     pVertexAttributeDescriptions_host = convert_VkVertexInputAttributeDescription2EXT_array_win32_to_host(ctx, (const VkVertexInputAttributeDescription2EXT32 *)UlongToPtr(params->pVertexAttributeDescriptions), params->vertexAttributeDescriptionCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdSetVertexInputEXT(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->vertexBindingDescriptionCount, pVertexBindingDescriptions_host, params->vertexAttributeDescriptionCount, pVertexAttributeDescriptions_host);
@@ -57746,7 +57746,7 @@ static void thunk32_vkCmdSetViewportShadingRatePaletteNV(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdSetViewportShadingRatePaletteNV);
     pShadingRatePalettes_host = convert_VkShadingRatePaletteNV_array_win32_to_host(ctx, (const VkShadingRatePaletteNV32 *)UlongToPtr(params->pShadingRatePalettes), params->viewportCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdSetViewportShadingRatePaletteNV(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->firstViewport, params->viewportCount, pShadingRatePalettes_host);
     free_conversion_context(ctx);
@@ -58096,7 +58096,7 @@ static void thunk32_vkCmdWaitEvents(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdWaitEvents);
     pMemoryBarriers_host = convert_VkMemoryBarrier_array_win32_to_host(ctx, (const VkMemoryBarrier32 *)UlongToPtr(params->pMemoryBarriers), params->memoryBarrierCount);
     pBufferMemoryBarriers_host = convert_VkBufferMemoryBarrier_array_win32_to_host(ctx, (const VkBufferMemoryBarrier32 *)UlongToPtr(params->pBufferMemoryBarriers), params->bufferMemoryBarrierCount);
     pImageMemoryBarriers_host = convert_VkImageMemoryBarrier_array_win32_to_host(ctx, (const VkImageMemoryBarrier32 *)UlongToPtr(params->pImageMemoryBarriers), params->imageMemoryBarrierCount);
@@ -58126,7 +58126,7 @@ static void thunk32_vkCmdWaitEvents2(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdWaitEvents2);
     pDependencyInfos_host = convert_VkDependencyInfo_array_win32_to_host(ctx, (const VkDependencyInfo32 *)UlongToPtr(params->pDependencyInfos), params->eventCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdWaitEvents2(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->eventCount, (const VkEvent *)UlongToPtr(params->pEvents), pDependencyInfos_host);
     free_conversion_context(ctx);
@@ -58154,7 +58154,7 @@ static void thunk32_vkCmdWaitEvents2KHR(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCmdWaitEvents2KHR);
     pDependencyInfos_host = convert_VkDependencyInfo_array_win32_to_host(ctx, (const VkDependencyInfo32 *)UlongToPtr(params->pDependencyInfos), params->eventCount);
     vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->device->p_vkCmdWaitEvents2KHR(vulkan_command_buffer_from_handle((VkCommandBuffer)UlongToPtr(params->commandBuffer))->host.command_buffer, params->eventCount, (const VkEvent *)UlongToPtr(params->pEvents), pDependencyInfos_host);
     free_conversion_context(ctx);
@@ -58509,7 +58509,7 @@ static NTSTATUS thunk32_vkCopyImageToImage(void *args)
 
     TRACE("%#x, %#x\n", params->device, params->pCopyImageToImageInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCopyImageToImage);
     convert_VkCopyImageToImageInfo_win32_to_host(ctx, (const VkCopyImageToImageInfo32 *)UlongToPtr(params->pCopyImageToImageInfo), &pCopyImageToImageInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCopyImageToImage(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCopyImageToImageInfo_host);
     free_conversion_context(ctx);
@@ -58542,7 +58542,7 @@ static NTSTATUS thunk32_vkCopyImageToImageEXT(void *args)
 
     TRACE("%#x, %#x\n", params->device, params->pCopyImageToImageInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCopyImageToImageEXT);
     convert_VkCopyImageToImageInfo_win32_to_host(ctx, (const VkCopyImageToImageInfo32 *)UlongToPtr(params->pCopyImageToImageInfo), &pCopyImageToImageInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCopyImageToImageEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCopyImageToImageInfo_host);
     free_conversion_context(ctx);
@@ -58575,7 +58575,7 @@ static NTSTATUS thunk32_vkCopyImageToMemory(void *args)
 
     TRACE("%#x, %#x\n", params->device, params->pCopyImageToMemoryInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCopyImageToMemory);
     convert_VkCopyImageToMemoryInfo_win32_to_host(ctx, (const VkCopyImageToMemoryInfo32 *)UlongToPtr(params->pCopyImageToMemoryInfo), &pCopyImageToMemoryInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCopyImageToMemory(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCopyImageToMemoryInfo_host);
     free_conversion_context(ctx);
@@ -58608,7 +58608,7 @@ static NTSTATUS thunk32_vkCopyImageToMemoryEXT(void *args)
 
     TRACE("%#x, %#x\n", params->device, params->pCopyImageToMemoryInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCopyImageToMemoryEXT);
     convert_VkCopyImageToMemoryInfo_win32_to_host(ctx, (const VkCopyImageToMemoryInfo32 *)UlongToPtr(params->pCopyImageToMemoryInfo), &pCopyImageToMemoryInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCopyImageToMemoryEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCopyImageToMemoryInfo_host);
     free_conversion_context(ctx);
@@ -58671,7 +58671,7 @@ static NTSTATUS thunk32_vkCopyMemoryToImage(void *args)
 
     TRACE("%#x, %#x\n", params->device, params->pCopyMemoryToImageInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCopyMemoryToImage);
     convert_VkCopyMemoryToImageInfo_win32_to_host(ctx, (const VkCopyMemoryToImageInfo32 *)UlongToPtr(params->pCopyMemoryToImageInfo), &pCopyMemoryToImageInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCopyMemoryToImage(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCopyMemoryToImageInfo_host);
     free_conversion_context(ctx);
@@ -58704,7 +58704,7 @@ static NTSTATUS thunk32_vkCopyMemoryToImageEXT(void *args)
 
     TRACE("%#x, %#x\n", params->device, params->pCopyMemoryToImageInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCopyMemoryToImageEXT);
     convert_VkCopyMemoryToImageInfo_win32_to_host(ctx, (const VkCopyMemoryToImageInfo32 *)UlongToPtr(params->pCopyMemoryToImageInfo), &pCopyMemoryToImageInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCopyMemoryToImageEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCopyMemoryToImageInfo_host);
     free_conversion_context(ctx);
@@ -58829,7 +58829,7 @@ static NTSTATUS thunk32_vkCreateAccelerationStructure2KHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pAccelerationStructure);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateAccelerationStructure2KHR);
     convert_VkAccelerationStructureCreateInfo2KHR_win32_to_host(ctx, (const VkAccelerationStructureCreateInfo2KHR32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateAccelerationStructure2KHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkAccelerationStructureKHR *)UlongToPtr(params->pAccelerationStructure));
     free_conversion_context(ctx);
@@ -58864,7 +58864,7 @@ static NTSTATUS thunk32_vkCreateAccelerationStructureKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pAccelerationStructure);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateAccelerationStructureKHR);
     convert_VkAccelerationStructureCreateInfoKHR_win32_to_host(ctx, (const VkAccelerationStructureCreateInfoKHR32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateAccelerationStructureKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkAccelerationStructureKHR *)UlongToPtr(params->pAccelerationStructure));
     free_conversion_context(ctx);
@@ -58899,7 +58899,7 @@ static NTSTATUS thunk32_vkCreateAccelerationStructureNV(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pAccelerationStructure);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateAccelerationStructureNV);
     convert_VkAccelerationStructureCreateInfoNV_win32_to_host(ctx, (const VkAccelerationStructureCreateInfoNV32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateAccelerationStructureNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkAccelerationStructureNV *)UlongToPtr(params->pAccelerationStructure));
     free_conversion_context(ctx);
@@ -58916,7 +58916,7 @@ static NTSTATUS thunk64_vkCreateBuffer(void *args)
 
     TRACE("%p, %p, %p, %p\n", params->device, params->pCreateInfo, params->pAllocator, params->pBuffer);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateBuffer);
     convert_VkBufferCreateInfo_win64_to_host(ctx, params->pCreateInfo, &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateBuffer(params->device, &pCreateInfo_host, params->pAllocator, params->pBuffer);
     free_conversion_context(ctx);
@@ -58940,7 +58940,7 @@ static NTSTATUS thunk32_vkCreateBuffer(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pBuffer);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateBuffer);
     convert_VkBufferCreateInfo_win32_to_host(ctx, (const VkBufferCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateBuffer((VkDevice)UlongToPtr(params->device), &pCreateInfo_host, (const VkAllocationCallbacks *)UlongToPtr(params->pAllocator), (VkBuffer *)UlongToPtr(params->pBuffer));
     free_conversion_context(ctx);
@@ -58975,7 +58975,7 @@ static NTSTATUS thunk32_vkCreateBufferView(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pView);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateBufferView);
     convert_VkBufferViewCreateInfo_win32_to_host(ctx, (const VkBufferViewCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateBufferView(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkBufferView *)UlongToPtr(params->pView));
     free_conversion_context(ctx);
@@ -59010,7 +59010,7 @@ static NTSTATUS thunk32_vkCreateCommandPool(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pCommandPool);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateCommandPool);
     convert_VkCommandPoolCreateInfo_win32_to_host(ctx, (const VkCommandPoolCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = wine_vkCreateCommandPool((VkDevice)UlongToPtr(params->device), &pCreateInfo_host, (const VkAllocationCallbacks *)UlongToPtr(params->pAllocator), (VkCommandPool *)UlongToPtr(params->pCommandPool));
     free_conversion_context(ctx);
@@ -59047,7 +59047,7 @@ static NTSTATUS thunk32_vkCreateComputePipelines(void *args)
 
     TRACE("%#x, 0x%s, %u, %#x, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->pipelineCache), params->createInfoCount, params->pCreateInfos, params->pAllocator, params->pPipelines);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateComputePipelines);
     pCreateInfos_host = convert_VkComputePipelineCreateInfo_array_win32_to_host(ctx, (const VkComputePipelineCreateInfo32 *)UlongToPtr(params->pCreateInfos), params->createInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateComputePipelines(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->pipelineCache, params->createInfoCount, pCreateInfos_host, NULL, (VkPipeline *)UlongToPtr(params->pPipelines));
     convert_VkComputePipelineCreateInfo_array_host_to_win32(pCreateInfos_host, (VkComputePipelineCreateInfo32 *)UlongToPtr(params->pCreateInfos), params->createInfoCount);
@@ -59114,7 +59114,7 @@ static NTSTATUS thunk32_vkCreateCuModuleNVX(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pModule);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateCuModuleNVX);
     convert_VkCuModuleCreateInfoNVX_win32_to_host(ctx, (const VkCuModuleCreateInfoNVX32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateCuModuleNVX(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkCuModuleNVX *)UlongToPtr(params->pModule));
     free_conversion_context(ctx);
@@ -59149,7 +59149,7 @@ static NTSTATUS thunk32_vkCreateDataGraphPipelineSessionARM(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pSession);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateDataGraphPipelineSessionARM);
     convert_VkDataGraphPipelineSessionCreateInfoARM_win32_to_host(ctx, (const VkDataGraphPipelineSessionCreateInfoARM32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateDataGraphPipelineSessionARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkDataGraphPipelineSessionARM *)UlongToPtr(params->pSession));
     free_conversion_context(ctx);
@@ -59188,7 +59188,7 @@ static NTSTATUS thunk32_vkCreateDataGraphPipelinesARM(void *args)
     TRACE("%#x, 0x%s, 0x%s, %u, %#x, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->deferredOperation), wine_dbgstr_longlong(params->pipelineCache), params->createInfoCount, params->pCreateInfos, params->pAllocator, params->pPipelines);
 
     if (params->deferredOperation == VK_NULL_HANDLE)
-        init_conversion_context(ctx);
+        init_conversion_context(ctx, unix_vkCreateDataGraphPipelinesARM);
     else
         ctx = &wine_deferred_operation_from_handle(params->deferredOperation)->ctx;
     pCreateInfos_host = convert_VkDataGraphPipelineCreateInfoARM_array_win32_to_host(ctx, (const VkDataGraphPipelineCreateInfoARM32 *)UlongToPtr(params->pCreateInfos), params->createInfoCount);
@@ -59317,7 +59317,7 @@ static NTSTATUS thunk32_vkCreateDescriptorPool(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pDescriptorPool);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateDescriptorPool);
     convert_VkDescriptorPoolCreateInfo_win32_to_host(ctx, (const VkDescriptorPoolCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateDescriptorPool(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkDescriptorPool *)UlongToPtr(params->pDescriptorPool));
     free_conversion_context(ctx);
@@ -59352,7 +59352,7 @@ static NTSTATUS thunk32_vkCreateDescriptorSetLayout(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pSetLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateDescriptorSetLayout);
     convert_VkDescriptorSetLayoutCreateInfo_win32_to_host(ctx, (const VkDescriptorSetLayoutCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateDescriptorSetLayout(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkDescriptorSetLayout *)UlongToPtr(params->pSetLayout));
     free_conversion_context(ctx);
@@ -59387,7 +59387,7 @@ static NTSTATUS thunk32_vkCreateDescriptorUpdateTemplate(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pDescriptorUpdateTemplate);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateDescriptorUpdateTemplate);
     convert_VkDescriptorUpdateTemplateCreateInfo_win32_to_host(ctx, (const VkDescriptorUpdateTemplateCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateDescriptorUpdateTemplate(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkDescriptorUpdateTemplate *)UlongToPtr(params->pDescriptorUpdateTemplate));
     free_conversion_context(ctx);
@@ -59422,7 +59422,7 @@ static NTSTATUS thunk32_vkCreateDescriptorUpdateTemplateKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pDescriptorUpdateTemplate);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateDescriptorUpdateTemplateKHR);
     convert_VkDescriptorUpdateTemplateCreateInfo_win32_to_host(ctx, (const VkDescriptorUpdateTemplateCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateDescriptorUpdateTemplateKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkDescriptorUpdateTemplate *)UlongToPtr(params->pDescriptorUpdateTemplate));
     free_conversion_context(ctx);
@@ -59439,7 +59439,7 @@ static NTSTATUS thunk64_vkCreateDevice(void *args)
 
     TRACE("%p, %p, %p, %p\n", params->physicalDevice, params->pCreateInfo, params->pAllocator, params->pDevice);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateDevice);
     convert_VkDeviceCreateInfo_win64_to_host(ctx, params->pCreateInfo, &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateDevice(params->physicalDevice, &pCreateInfo_host, params->pAllocator, params->pDevice);
     free_conversion_context(ctx);
@@ -59464,7 +59464,7 @@ static NTSTATUS thunk32_vkCreateDevice(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->physicalDevice, params->pCreateInfo, params->pAllocator, params->pDevice);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateDevice);
     convert_VkDeviceCreateInfo_win32_to_host(ctx, (const VkDeviceCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     pDevice_host = UlongToPtr(*(PTR32 *)UlongToPtr(params->pDevice));
     params->result = vk_funcs->p_vkCreateDevice((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pCreateInfo_host, (const VkAllocationCallbacks *)UlongToPtr(params->pAllocator), &pDevice_host);
@@ -59514,7 +59514,7 @@ static NTSTATUS thunk64_vkCreateFence(void *args)
 
     TRACE("%p, %p, %p, %p\n", params->device, params->pCreateInfo, params->pAllocator, params->pFence);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateFence);
     convert_VkFenceCreateInfo_win64_to_host(ctx, params->pCreateInfo, &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateFence(params->device, &pCreateInfo_host, params->pAllocator, params->pFence);
     free_conversion_context(ctx);
@@ -59538,7 +59538,7 @@ static NTSTATUS thunk32_vkCreateFence(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pFence);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateFence);
     convert_VkFenceCreateInfo_win32_to_host(ctx, (const VkFenceCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateFence((VkDevice)UlongToPtr(params->device), &pCreateInfo_host, (const VkAllocationCallbacks *)UlongToPtr(params->pAllocator), (VkFence *)UlongToPtr(params->pFence));
     free_conversion_context(ctx);
@@ -59573,7 +59573,7 @@ static NTSTATUS thunk32_vkCreateFramebuffer(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pFramebuffer);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateFramebuffer);
     convert_VkFramebufferCreateInfo_win32_to_host(ctx, (const VkFramebufferCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateFramebuffer(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkFramebuffer *)UlongToPtr(params->pFramebuffer));
     free_conversion_context(ctx);
@@ -59641,7 +59641,7 @@ static NTSTATUS thunk32_vkCreateGraphicsPipelines(void *args)
 
     TRACE("%#x, 0x%s, %u, %#x, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->pipelineCache), params->createInfoCount, params->pCreateInfos, params->pAllocator, params->pPipelines);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateGraphicsPipelines);
     pCreateInfos_host = convert_VkGraphicsPipelineCreateInfo_array_win32_to_host(ctx, (const VkGraphicsPipelineCreateInfo32 *)UlongToPtr(params->pCreateInfos), params->createInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateGraphicsPipelines(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->pipelineCache, params->createInfoCount, pCreateInfos_host, NULL, (VkPipeline *)UlongToPtr(params->pPipelines));
     convert_VkGraphicsPipelineCreateInfo_array_host_to_win32(pCreateInfos_host, (VkGraphicsPipelineCreateInfo32 *)UlongToPtr(params->pCreateInfos), params->createInfoCount);
@@ -59659,7 +59659,7 @@ static NTSTATUS thunk64_vkCreateImage(void *args)
 
     TRACE("%p, %p, %p, %p\n", params->device, params->pCreateInfo, params->pAllocator, params->pImage);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateImage);
     convert_VkImageCreateInfo_win64_to_host(ctx, params->pCreateInfo, &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateImage(params->device, &pCreateInfo_host, params->pAllocator, params->pImage);
     free_conversion_context(ctx);
@@ -59683,7 +59683,7 @@ static NTSTATUS thunk32_vkCreateImage(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pImage);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateImage);
     convert_VkImageCreateInfo_win32_to_host(ctx, (const VkImageCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateImage((VkDevice)UlongToPtr(params->device), &pCreateInfo_host, (const VkAllocationCallbacks *)UlongToPtr(params->pAllocator), (VkImage *)UlongToPtr(params->pImage));
     free_conversion_context(ctx);
@@ -59718,7 +59718,7 @@ static NTSTATUS thunk32_vkCreateImageView(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pView);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateImageView);
     convert_VkImageViewCreateInfo_win32_to_host(ctx, (const VkImageViewCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateImageView(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkImageView *)UlongToPtr(params->pView));
     free_conversion_context(ctx);
@@ -59753,7 +59753,7 @@ static NTSTATUS thunk32_vkCreateIndirectCommandsLayoutEXT(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pIndirectCommandsLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateIndirectCommandsLayoutEXT);
     convert_VkIndirectCommandsLayoutCreateInfoEXT_win32_to_host(ctx, (const VkIndirectCommandsLayoutCreateInfoEXT32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateIndirectCommandsLayoutEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkIndirectCommandsLayoutEXT *)UlongToPtr(params->pIndirectCommandsLayout));
     free_conversion_context(ctx);
@@ -59788,7 +59788,7 @@ static NTSTATUS thunk32_vkCreateIndirectCommandsLayoutNV(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pIndirectCommandsLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateIndirectCommandsLayoutNV);
     convert_VkIndirectCommandsLayoutCreateInfoNV_win32_to_host(ctx, (const VkIndirectCommandsLayoutCreateInfoNV32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateIndirectCommandsLayoutNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkIndirectCommandsLayoutNV *)UlongToPtr(params->pIndirectCommandsLayout));
     free_conversion_context(ctx);
@@ -59823,7 +59823,7 @@ static NTSTATUS thunk32_vkCreateIndirectExecutionSetEXT(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pIndirectExecutionSet);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateIndirectExecutionSetEXT);
     convert_VkIndirectExecutionSetCreateInfoEXT_win32_to_host(ctx, (const VkIndirectExecutionSetCreateInfoEXT32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateIndirectExecutionSetEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkIndirectExecutionSetEXT *)UlongToPtr(params->pIndirectExecutionSet));
     free_conversion_context(ctx);
@@ -59840,7 +59840,7 @@ static NTSTATUS thunk64_vkCreateInstance(void *args)
 
     TRACE("%p, %p, %p\n", params->pCreateInfo, params->pAllocator, params->pInstance);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateInstance);
     convert_VkInstanceCreateInfo_win64_to_host(ctx, params->pCreateInfo, &pCreateInfo_host);
     params->result = wine_vkCreateInstance(&pCreateInfo_host, params->pAllocator, params->pInstance);
     free_conversion_context(ctx);
@@ -59864,7 +59864,7 @@ static NTSTATUS thunk32_vkCreateInstance(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->pCreateInfo, params->pAllocator, params->pInstance);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateInstance);
     convert_VkInstanceCreateInfo_win32_to_host(ctx, (const VkInstanceCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     pInstance_host = UlongToPtr(*(PTR32 *)UlongToPtr(params->pInstance));
     params->result = wine_vkCreateInstance(&pCreateInfo_host, (const VkAllocationCallbacks *)UlongToPtr(params->pAllocator), &pInstance_host);
@@ -59932,7 +59932,7 @@ static NTSTATUS thunk32_vkCreateOpticalFlowSessionNV(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pSession);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateOpticalFlowSessionNV);
     convert_VkOpticalFlowSessionCreateInfoNV_win32_to_host(ctx, (const VkOpticalFlowSessionCreateInfoNV32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateOpticalFlowSessionNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkOpticalFlowSessionNV *)UlongToPtr(params->pSession));
     free_conversion_context(ctx);
@@ -59968,7 +59968,7 @@ static NTSTATUS thunk32_vkCreatePipelineBinariesKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pBinaries);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreatePipelineBinariesKHR);
     convert_VkPipelineBinaryCreateInfoKHR_win32_to_host(ctx, (const VkPipelineBinaryCreateInfoKHR32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     convert_VkPipelineBinaryHandlesInfoKHR_win32_to_host((VkPipelineBinaryHandlesInfoKHR32 *)UlongToPtr(params->pBinaries), &pBinaries_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreatePipelineBinariesKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, &pBinaries_host);
@@ -60129,7 +60129,7 @@ static NTSTATUS thunk32_vkCreateQueryPool(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pQueryPool);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateQueryPool);
     convert_VkQueryPoolCreateInfo_win32_to_host(ctx, (const VkQueryPoolCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateQueryPool(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkQueryPool *)UlongToPtr(params->pQueryPool));
     free_conversion_context(ctx);
@@ -60168,7 +60168,7 @@ static NTSTATUS thunk32_vkCreateRayTracingPipelinesKHR(void *args)
     TRACE("%#x, 0x%s, 0x%s, %u, %#x, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->deferredOperation), wine_dbgstr_longlong(params->pipelineCache), params->createInfoCount, params->pCreateInfos, params->pAllocator, params->pPipelines);
 
     if (params->deferredOperation == VK_NULL_HANDLE)
-        init_conversion_context(ctx);
+        init_conversion_context(ctx, unix_vkCreateRayTracingPipelinesKHR);
     else
         ctx = &wine_deferred_operation_from_handle(params->deferredOperation)->ctx;
     pCreateInfos_host = convert_VkRayTracingPipelineCreateInfoKHR_array_win32_to_host(ctx, (const VkRayTracingPipelineCreateInfoKHR32 *)UlongToPtr(params->pCreateInfos), params->createInfoCount);
@@ -60209,7 +60209,7 @@ static NTSTATUS thunk32_vkCreateRayTracingPipelinesNV(void *args)
 
     TRACE("%#x, 0x%s, %u, %#x, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->pipelineCache), params->createInfoCount, params->pCreateInfos, params->pAllocator, params->pPipelines);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateRayTracingPipelinesNV);
     pCreateInfos_host = convert_VkRayTracingPipelineCreateInfoNV_array_win32_to_host(ctx, (const VkRayTracingPipelineCreateInfoNV32 *)UlongToPtr(params->pCreateInfos), params->createInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateRayTracingPipelinesNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->pipelineCache, params->createInfoCount, pCreateInfos_host, NULL, (VkPipeline *)UlongToPtr(params->pPipelines));
     convert_VkRayTracingPipelineCreateInfoNV_array_host_to_win32(pCreateInfos_host, (VkRayTracingPipelineCreateInfoNV32 *)UlongToPtr(params->pCreateInfos), params->createInfoCount);
@@ -60245,7 +60245,7 @@ static NTSTATUS thunk32_vkCreateRenderPass(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pRenderPass);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateRenderPass);
     convert_VkRenderPassCreateInfo_win32_to_host(ctx, (const VkRenderPassCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateRenderPass(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkRenderPass *)UlongToPtr(params->pRenderPass));
     free_conversion_context(ctx);
@@ -60280,7 +60280,7 @@ static NTSTATUS thunk32_vkCreateRenderPass2(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pRenderPass);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateRenderPass2);
     convert_VkRenderPassCreateInfo2_win32_to_host(ctx, (const VkRenderPassCreateInfo232 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateRenderPass2(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkRenderPass *)UlongToPtr(params->pRenderPass));
     free_conversion_context(ctx);
@@ -60315,7 +60315,7 @@ static NTSTATUS thunk32_vkCreateRenderPass2KHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pRenderPass);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateRenderPass2KHR);
     convert_VkRenderPassCreateInfo2_win32_to_host(ctx, (const VkRenderPassCreateInfo232 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateRenderPass2KHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkRenderPass *)UlongToPtr(params->pRenderPass));
     free_conversion_context(ctx);
@@ -60350,7 +60350,7 @@ static NTSTATUS thunk32_vkCreateSampler(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pSampler);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateSampler);
     convert_VkSamplerCreateInfo_win32_to_host(ctx, (const VkSamplerCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateSampler(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkSampler *)UlongToPtr(params->pSampler));
     free_conversion_context(ctx);
@@ -60385,7 +60385,7 @@ static NTSTATUS thunk32_vkCreateSamplerYcbcrConversion(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pYcbcrConversion);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateSamplerYcbcrConversion);
     convert_VkSamplerYcbcrConversionCreateInfo_win32_to_host(ctx, (const VkSamplerYcbcrConversionCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateSamplerYcbcrConversion(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkSamplerYcbcrConversion *)UlongToPtr(params->pYcbcrConversion));
     free_conversion_context(ctx);
@@ -60420,7 +60420,7 @@ static NTSTATUS thunk32_vkCreateSamplerYcbcrConversionKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pYcbcrConversion);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateSamplerYcbcrConversionKHR);
     convert_VkSamplerYcbcrConversionCreateInfo_win32_to_host(ctx, (const VkSamplerYcbcrConversionCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateSamplerYcbcrConversionKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkSamplerYcbcrConversion *)UlongToPtr(params->pYcbcrConversion));
     free_conversion_context(ctx);
@@ -60437,7 +60437,7 @@ static NTSTATUS thunk64_vkCreateSemaphore(void *args)
 
     TRACE("%p, %p, %p, %p\n", params->device, params->pCreateInfo, params->pAllocator, params->pSemaphore);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateSemaphore);
     convert_VkSemaphoreCreateInfo_win64_to_host(ctx, params->pCreateInfo, &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateSemaphore(params->device, &pCreateInfo_host, params->pAllocator, params->pSemaphore);
     free_conversion_context(ctx);
@@ -60461,7 +60461,7 @@ static NTSTATUS thunk32_vkCreateSemaphore(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pSemaphore);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateSemaphore);
     convert_VkSemaphoreCreateInfo_win32_to_host(ctx, (const VkSemaphoreCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateSemaphore((VkDevice)UlongToPtr(params->device), &pCreateInfo_host, (const VkAllocationCallbacks *)UlongToPtr(params->pAllocator), (VkSemaphore *)UlongToPtr(params->pSemaphore));
     free_conversion_context(ctx);
@@ -60527,7 +60527,7 @@ static NTSTATUS thunk32_vkCreateShaderModule(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pShaderModule);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateShaderModule);
     convert_VkShaderModuleCreateInfo_win32_to_host(ctx, (const VkShaderModuleCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateShaderModule(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkShaderModule *)UlongToPtr(params->pShaderModule));
     free_conversion_context(ctx);
@@ -60563,7 +60563,7 @@ static NTSTATUS thunk32_vkCreateShadersEXT(void *args)
 
     TRACE("%#x, %u, %#x, %#x, %#x\n", params->device, params->createInfoCount, params->pCreateInfos, params->pAllocator, params->pShaders);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateShadersEXT);
     pCreateInfos_host = convert_VkShaderCreateInfoEXT_array_win32_to_host(ctx, (const VkShaderCreateInfoEXT32 *)UlongToPtr(params->pCreateInfos), params->createInfoCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateShadersEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->createInfoCount, pCreateInfos_host, NULL, (VkShaderEXT *)UlongToPtr(params->pShaders));
     free_conversion_context(ctx);
@@ -60598,7 +60598,7 @@ static NTSTATUS thunk32_vkCreateSwapchainKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pSwapchain);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateSwapchainKHR);
     convert_VkSwapchainCreateInfoKHR_win32_to_unwrapped_host(ctx, (const VkSwapchainCreateInfoKHR32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vk_funcs->p_vkCreateSwapchainKHR((VkDevice)UlongToPtr(params->device), &pCreateInfo_host, (const VkAllocationCallbacks *)UlongToPtr(params->pAllocator), (VkSwapchainKHR *)UlongToPtr(params->pSwapchain));
     free_conversion_context(ctx);
@@ -60633,7 +60633,7 @@ static NTSTATUS thunk32_vkCreateTensorARM(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pTensor);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateTensorARM);
     convert_VkTensorCreateInfoARM_win32_to_host(ctx, (const VkTensorCreateInfoARM32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateTensorARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkTensorARM *)UlongToPtr(params->pTensor));
     free_conversion_context(ctx);
@@ -60668,7 +60668,7 @@ static NTSTATUS thunk32_vkCreateTensorViewARM(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pView);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateTensorViewARM);
     convert_VkTensorViewCreateInfoARM_win32_to_host(ctx, (const VkTensorViewCreateInfoARM32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateTensorViewARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkTensorViewARM *)UlongToPtr(params->pView));
     free_conversion_context(ctx);
@@ -60734,7 +60734,7 @@ static NTSTATUS thunk32_vkCreateVideoSessionKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pVideoSession);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateVideoSessionKHR);
     convert_VkVideoSessionCreateInfoKHR_win32_to_host(ctx, (const VkVideoSessionCreateInfoKHR32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateVideoSessionKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkVideoSessionKHR *)UlongToPtr(params->pVideoSession));
     free_conversion_context(ctx);
@@ -60769,7 +60769,7 @@ static NTSTATUS thunk32_vkCreateVideoSessionParametersKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pAllocator, params->pVideoSessionParameters);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkCreateVideoSessionParametersKHR);
     convert_VkVideoSessionParametersCreateInfoKHR_win32_to_host(ctx, (const VkVideoSessionParametersCreateInfoKHR32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkCreateVideoSessionParametersKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, NULL, (VkVideoSessionParametersKHR *)UlongToPtr(params->pVideoSessionParameters));
     free_conversion_context(ctx);
@@ -62478,7 +62478,7 @@ static NTSTATUS thunk32_vkEnumeratePhysicalDeviceGroups(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->instance, params->pPhysicalDeviceGroupCount, params->pPhysicalDeviceGroupProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkEnumeratePhysicalDeviceGroups);
     pPhysicalDeviceGroupProperties_host = convert_VkPhysicalDeviceGroupProperties_array_win32_to_unwrapped_host(ctx, (VkPhysicalDeviceGroupProperties32 *)UlongToPtr(params->pPhysicalDeviceGroupProperties), *(uint32_t *)UlongToPtr(params->pPhysicalDeviceGroupCount));
     params->result = wine_vkEnumeratePhysicalDeviceGroups((VkInstance)UlongToPtr(params->instance), (uint32_t *)UlongToPtr(params->pPhysicalDeviceGroupCount), pPhysicalDeviceGroupProperties_host);
     convert_VkPhysicalDeviceGroupProperties_array_unwrapped_host_to_win32(pPhysicalDeviceGroupProperties_host, (VkPhysicalDeviceGroupProperties32 *)UlongToPtr(params->pPhysicalDeviceGroupProperties), *(uint32_t *)UlongToPtr(params->pPhysicalDeviceGroupCount));
@@ -62513,7 +62513,7 @@ static NTSTATUS thunk32_vkEnumeratePhysicalDeviceGroupsKHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->instance, params->pPhysicalDeviceGroupCount, params->pPhysicalDeviceGroupProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkEnumeratePhysicalDeviceGroupsKHR);
     pPhysicalDeviceGroupProperties_host = convert_VkPhysicalDeviceGroupProperties_array_win32_to_unwrapped_host(ctx, (VkPhysicalDeviceGroupProperties32 *)UlongToPtr(params->pPhysicalDeviceGroupProperties), *(uint32_t *)UlongToPtr(params->pPhysicalDeviceGroupCount));
     params->result = wine_vkEnumeratePhysicalDeviceGroupsKHR((VkInstance)UlongToPtr(params->instance), (uint32_t *)UlongToPtr(params->pPhysicalDeviceGroupCount), pPhysicalDeviceGroupProperties_host);
     convert_VkPhysicalDeviceGroupProperties_array_unwrapped_host_to_win32(pPhysicalDeviceGroupProperties_host, (VkPhysicalDeviceGroupProperties32 *)UlongToPtr(params->pPhysicalDeviceGroupProperties), *(uint32_t *)UlongToPtr(params->pPhysicalDeviceGroupCount));
@@ -62551,7 +62551,7 @@ static NTSTATUS thunk32_vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersB
 
     TRACE("%#x, %u, %#x, %#x, %#x\n", params->physicalDevice, params->queueFamilyIndex, params->pCounterCount, params->pCounters, params->pCounterDescriptions);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM);
     pCounters_host = convert_VkPerformanceCounterARM_array_win32_to_host(ctx, (VkPerformanceCounterARM32 *)UlongToPtr(params->pCounters), *(uint32_t *)UlongToPtr(params->pCounterCount));
     pCounterDescriptions_host = convert_VkPerformanceCounterDescriptionARM_array_win32_to_host(ctx, (VkPerformanceCounterDescriptionARM32 *)UlongToPtr(params->pCounterDescriptions), *(uint32_t *)UlongToPtr(params->pCounterCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, params->queueFamilyIndex, (uint32_t *)UlongToPtr(params->pCounterCount), pCounters_host, pCounterDescriptions_host);
@@ -62591,7 +62591,7 @@ static NTSTATUS thunk32_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCoun
 
     TRACE("%#x, %u, %#x, %#x, %#x\n", params->physicalDevice, params->queueFamilyIndex, params->pCounterCount, params->pCounters, params->pCounterDescriptions);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR);
     pCounters_host = convert_VkPerformanceCounterKHR_array_win32_to_host(ctx, (VkPerformanceCounterKHR32 *)UlongToPtr(params->pCounters), *(uint32_t *)UlongToPtr(params->pCounterCount));
     pCounterDescriptions_host = convert_VkPerformanceCounterDescriptionKHR_array_win32_to_host(ctx, (VkPerformanceCounterDescriptionKHR32 *)UlongToPtr(params->pCounterDescriptions), *(uint32_t *)UlongToPtr(params->pCounterCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, params->queueFamilyIndex, (uint32_t *)UlongToPtr(params->pCounterCount), pCounters_host, pCounterDescriptions_host);
@@ -62628,7 +62628,7 @@ static NTSTATUS thunk32_vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pDescriptionCount, params->pDescriptions);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM);
     pDescriptions_host = convert_VkShaderInstrumentationMetricDescriptionARM_array_win32_to_host(ctx, (VkShaderInstrumentationMetricDescriptionARM32 *)UlongToPtr(params->pDescriptions), *(uint32_t *)UlongToPtr(params->pDescriptionCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pDescriptionCount), pDescriptions_host);
     convert_VkShaderInstrumentationMetricDescriptionARM_array_host_to_win32(pDescriptions_host, (VkShaderInstrumentationMetricDescriptionARM32 *)UlongToPtr(params->pDescriptions), *(uint32_t *)UlongToPtr(params->pDescriptionCount));
@@ -62663,7 +62663,7 @@ static NTSTATUS thunk32_vkEnumeratePhysicalDevices(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->instance, params->pPhysicalDeviceCount, params->pPhysicalDevices);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkEnumeratePhysicalDevices);
     pPhysicalDevices_host = (params->pPhysicalDevices && *(uint32_t *)UlongToPtr(params->pPhysicalDeviceCount)) ? conversion_context_alloc(ctx, sizeof(*pPhysicalDevices_host) * *(uint32_t *)UlongToPtr(params->pPhysicalDeviceCount)) : NULL;
     params->result = wine_vkEnumeratePhysicalDevices((VkInstance)UlongToPtr(params->instance), (uint32_t *)UlongToPtr(params->pPhysicalDeviceCount), pPhysicalDevices_host);
     convert_VkPhysicalDevice_array_unwrapped_host_to_win32(pPhysicalDevices_host, (PTR32 *)UlongToPtr(params->pPhysicalDevices), *(uint32_t *)UlongToPtr(params->pPhysicalDeviceCount));
@@ -62681,7 +62681,7 @@ static NTSTATUS thunk64_vkFlushMappedMemoryRanges(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->memoryRangeCount, params->pMemoryRanges);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkFlushMappedMemoryRanges);
     pMemoryRanges_host = convert_VkMappedMemoryRange_array_win64_to_host(ctx, params->pMemoryRanges, params->memoryRangeCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkFlushMappedMemoryRanges(vulkan_device_from_handle(params->device)->host.device, params->memoryRangeCount, pMemoryRanges_host);
     free_conversion_context(ctx);
@@ -62704,7 +62704,7 @@ static NTSTATUS thunk32_vkFlushMappedMemoryRanges(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->memoryRangeCount, params->pMemoryRanges);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkFlushMappedMemoryRanges);
     pMemoryRanges_host = convert_VkMappedMemoryRange_array_win32_to_host(ctx, (const VkMappedMemoryRange32 *)UlongToPtr(params->pMemoryRanges), params->memoryRangeCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkFlushMappedMemoryRanges(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->memoryRangeCount, pMemoryRanges_host);
     free_conversion_context(ctx);
@@ -62738,7 +62738,7 @@ static NTSTATUS thunk32_vkFreeCommandBuffers(void *args)
 
     TRACE("%#x, 0x%s, %u, %#x\n", params->device, wine_dbgstr_longlong(params->commandPool), params->commandBufferCount, params->pCommandBuffers);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkFreeCommandBuffers);
     pCommandBuffers_host = convert_VkCommandBuffer_array_win32_to_unwrapped_host(ctx, (const PTR32 *)UlongToPtr(params->pCommandBuffers), params->commandBufferCount);
     wine_vkFreeCommandBuffers((VkDevice)UlongToPtr(params->device), params->commandPool, params->commandBufferCount, pCommandBuffers_host);
     free_conversion_context(ctx);
@@ -62830,7 +62830,7 @@ static NTSTATUS thunk32_vkGetAccelerationStructureBuildSizesKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x, %#x\n", params->device, params->buildType, params->pBuildInfo, params->pMaxPrimitiveCounts, params->pSizeInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetAccelerationStructureBuildSizesKHR);
     convert_VkAccelerationStructureBuildGeometryInfoKHR_win32_to_host(ctx, (const VkAccelerationStructureBuildGeometryInfoKHR32 *)UlongToPtr(params->pBuildInfo), &pBuildInfo_host);
     convert_VkAccelerationStructureBuildSizesInfoKHR_win32_to_host((VkAccelerationStructureBuildSizesInfoKHR32 *)UlongToPtr(params->pSizeInfo), &pSizeInfo_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetAccelerationStructureBuildSizesKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->buildType, &pBuildInfo_host, (const uint32_t *)UlongToPtr(params->pMaxPrimitiveCounts), &pSizeInfo_host);
@@ -62924,7 +62924,7 @@ static NTSTATUS thunk32_vkGetAccelerationStructureMemoryRequirementsNV(void *arg
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetAccelerationStructureMemoryRequirementsNV);
     convert_VkAccelerationStructureMemoryRequirementsInfoNV_win32_to_host((const VkAccelerationStructureMemoryRequirementsInfoNV32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetAccelerationStructureMemoryRequirementsNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -63106,7 +63106,7 @@ static NTSTATUS thunk32_vkGetBufferMemoryRequirements2(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetBufferMemoryRequirements2);
     convert_VkBufferMemoryRequirementsInfo2_win32_to_host((const VkBufferMemoryRequirementsInfo232 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetBufferMemoryRequirements2(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -63142,7 +63142,7 @@ static NTSTATUS thunk32_vkGetBufferMemoryRequirements2KHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetBufferMemoryRequirements2KHR);
     convert_VkBufferMemoryRequirementsInfo2_win32_to_host((const VkBufferMemoryRequirementsInfo232 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetBufferMemoryRequirements2KHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -63249,7 +63249,7 @@ static NTSTATUS thunk64_vkGetCalibratedTimestampsEXT(void *args)
 
     TRACE("%p, %u, %p, %p, %p\n", params->device, params->timestampCount, params->pTimestampInfos, params->pTimestamps, params->pMaxDeviation);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetCalibratedTimestampsEXT);
     pTimestampInfos_host = convert_VkCalibratedTimestampInfoKHR_array_win64_to_host(ctx, params->pTimestampInfos, params->timestampCount);
     params->result = wine_vkGetCalibratedTimestampsEXT(params->device, params->timestampCount, pTimestampInfos_host, params->pTimestamps, params->pMaxDeviation);
     free_conversion_context(ctx);
@@ -63274,7 +63274,7 @@ static NTSTATUS thunk32_vkGetCalibratedTimestampsEXT(void *args)
 
     TRACE("%#x, %u, %#x, %#x, %#x\n", params->device, params->timestampCount, params->pTimestampInfos, params->pTimestamps, params->pMaxDeviation);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetCalibratedTimestampsEXT);
     pTimestampInfos_host = convert_VkCalibratedTimestampInfoKHR_array_win32_to_host(ctx, (const VkCalibratedTimestampInfoKHR32 *)UlongToPtr(params->pTimestampInfos), params->timestampCount);
     params->result = wine_vkGetCalibratedTimestampsEXT((VkDevice)UlongToPtr(params->device), params->timestampCount, pTimestampInfos_host, (uint64_t *)UlongToPtr(params->pTimestamps), (uint64_t *)UlongToPtr(params->pMaxDeviation));
     free_conversion_context(ctx);
@@ -63291,7 +63291,7 @@ static NTSTATUS thunk64_vkGetCalibratedTimestampsKHR(void *args)
 
     TRACE("%p, %u, %p, %p, %p\n", params->device, params->timestampCount, params->pTimestampInfos, params->pTimestamps, params->pMaxDeviation);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetCalibratedTimestampsKHR);
     pTimestampInfos_host = convert_VkCalibratedTimestampInfoKHR_array_win64_to_host(ctx, params->pTimestampInfos, params->timestampCount);
     params->result = wine_vkGetCalibratedTimestampsKHR(params->device, params->timestampCount, pTimestampInfos_host, params->pTimestamps, params->pMaxDeviation);
     free_conversion_context(ctx);
@@ -63316,7 +63316,7 @@ static NTSTATUS thunk32_vkGetCalibratedTimestampsKHR(void *args)
 
     TRACE("%#x, %u, %#x, %#x, %#x\n", params->device, params->timestampCount, params->pTimestampInfos, params->pTimestamps, params->pMaxDeviation);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetCalibratedTimestampsKHR);
     pTimestampInfos_host = convert_VkCalibratedTimestampInfoKHR_array_win32_to_host(ctx, (const VkCalibratedTimestampInfoKHR32 *)UlongToPtr(params->pTimestampInfos), params->timestampCount);
     params->result = wine_vkGetCalibratedTimestampsKHR((VkDevice)UlongToPtr(params->device), params->timestampCount, pTimestampInfos_host, (uint64_t *)UlongToPtr(params->pTimestamps), (uint64_t *)UlongToPtr(params->pMaxDeviation));
     free_conversion_context(ctx);
@@ -63350,7 +63350,7 @@ static NTSTATUS thunk32_vkGetClusterAccelerationStructureBuildSizesNV(void *args
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pSizeInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetClusterAccelerationStructureBuildSizesNV);
     convert_VkClusterAccelerationStructureInputInfoNV_win32_to_host(ctx, (const VkClusterAccelerationStructureInputInfoNV32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkAccelerationStructureBuildSizesInfoKHR_win32_to_host((VkAccelerationStructureBuildSizesInfoKHR32 *)UlongToPtr(params->pSizeInfo), &pSizeInfo_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetClusterAccelerationStructureBuildSizesNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pSizeInfo_host);
@@ -63419,7 +63419,7 @@ static NTSTATUS thunk32_vkGetDataGraphPipelinePropertiesARM(void *args)
 
     TRACE("%#x, %#x, %u, %#x\n", params->device, params->pPipelineInfo, params->propertiesCount, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDataGraphPipelinePropertiesARM);
     convert_VkDataGraphPipelineInfoARM_win32_to_host((const VkDataGraphPipelineInfoARM32 *)UlongToPtr(params->pPipelineInfo), &pPipelineInfo_host);
     pProperties_host = convert_VkDataGraphPipelinePropertyQueryResultARM_array_win32_to_host(ctx, (VkDataGraphPipelinePropertyQueryResultARM32 *)UlongToPtr(params->pProperties), params->propertiesCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDataGraphPipelinePropertiesARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pPipelineInfo_host, params->propertiesCount, pProperties_host);
@@ -63457,7 +63457,7 @@ static NTSTATUS thunk32_vkGetDataGraphPipelineSessionBindPointRequirementsARM(vo
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pInfo, params->pBindPointRequirementCount, params->pBindPointRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDataGraphPipelineSessionBindPointRequirementsARM);
     convert_VkDataGraphPipelineSessionBindPointRequirementsInfoARM_win32_to_host((const VkDataGraphPipelineSessionBindPointRequirementsInfoARM32 *)UlongToPtr(params->pInfo), &pInfo_host);
     pBindPointRequirements_host = convert_VkDataGraphPipelineSessionBindPointRequirementARM_array_win32_to_host(ctx, (VkDataGraphPipelineSessionBindPointRequirementARM32 *)UlongToPtr(params->pBindPointRequirements), *(uint32_t *)UlongToPtr(params->pBindPointRequirementCount));
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDataGraphPipelineSessionBindPointRequirementsARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, (uint32_t *)UlongToPtr(params->pBindPointRequirementCount), pBindPointRequirements_host);
@@ -63493,7 +63493,7 @@ static NTSTATUS thunk32_vkGetDataGraphPipelineSessionMemoryRequirementsARM(void
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDataGraphPipelineSessionMemoryRequirementsARM);
     convert_VkDataGraphPipelineSessionMemoryRequirementsInfoARM_win32_to_host((const VkDataGraphPipelineSessionMemoryRequirementsInfoARM32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDataGraphPipelineSessionMemoryRequirementsARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -63578,7 +63578,7 @@ static void thunk32_vkGetDescriptorEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDescriptorEXT);
     convert_VkDescriptorGetInfoEXT_win32_to_host(ctx, (const VkDescriptorGetInfoEXT32 *)UlongToPtr(params->pDescriptorInfo), &pDescriptorInfo_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDescriptorEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pDescriptorInfo_host, params->dataSize, (void *)UlongToPtr(params->pDescriptor));
     free_conversion_context(ctx);
@@ -63728,7 +63728,7 @@ static NTSTATUS thunk32_vkGetDescriptorSetLayoutSupport(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pSupport);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDescriptorSetLayoutSupport);
     convert_VkDescriptorSetLayoutCreateInfo_win32_to_host(ctx, (const VkDescriptorSetLayoutCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     convert_VkDescriptorSetLayoutSupport_win32_to_host(ctx, (VkDescriptorSetLayoutSupport32 *)UlongToPtr(params->pSupport), &pSupport_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDescriptorSetLayoutSupport(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, &pSupport_host);
@@ -63764,7 +63764,7 @@ static NTSTATUS thunk32_vkGetDescriptorSetLayoutSupportKHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pSupport);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDescriptorSetLayoutSupportKHR);
     convert_VkDescriptorSetLayoutCreateInfo_win32_to_host(ctx, (const VkDescriptorSetLayoutCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     convert_VkDescriptorSetLayoutSupport_win32_to_host(ctx, (VkDescriptorSetLayoutSupport32 *)UlongToPtr(params->pSupport), &pSupport_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDescriptorSetLayoutSupportKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, &pSupport_host);
@@ -63812,7 +63812,7 @@ static NTSTATUS thunk64_vkGetDeviceBufferMemoryRequirements(void *args)
 
     TRACE("%p, %p, %p\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceBufferMemoryRequirements);
     convert_VkDeviceBufferMemoryRequirements_win64_to_host(ctx, params->pInfo, &pInfo_host);
     vk_funcs->p_vkGetDeviceBufferMemoryRequirements(params->device, &pInfo_host, params->pMemoryRequirements);
     free_conversion_context(ctx);
@@ -63835,7 +63835,7 @@ static NTSTATUS thunk32_vkGetDeviceBufferMemoryRequirements(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceBufferMemoryRequirements);
     convert_VkDeviceBufferMemoryRequirements_win32_to_host(ctx, (const VkDeviceBufferMemoryRequirements32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vk_funcs->p_vkGetDeviceBufferMemoryRequirements((VkDevice)UlongToPtr(params->device), &pInfo_host, &pMemoryRequirements_host);
@@ -63854,7 +63854,7 @@ static NTSTATUS thunk64_vkGetDeviceBufferMemoryRequirementsKHR(void *args)
 
     TRACE("%p, %p, %p\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceBufferMemoryRequirementsKHR);
     convert_VkDeviceBufferMemoryRequirements_win64_to_host(ctx, params->pInfo, &pInfo_host);
     vk_funcs->p_vkGetDeviceBufferMemoryRequirementsKHR(params->device, &pInfo_host, params->pMemoryRequirements);
     free_conversion_context(ctx);
@@ -63877,7 +63877,7 @@ static NTSTATUS thunk32_vkGetDeviceBufferMemoryRequirementsKHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceBufferMemoryRequirementsKHR);
     convert_VkDeviceBufferMemoryRequirements_win32_to_host(ctx, (const VkDeviceBufferMemoryRequirements32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vk_funcs->p_vkGetDeviceBufferMemoryRequirementsKHR((VkDevice)UlongToPtr(params->device), &pInfo_host, &pMemoryRequirements_host);
@@ -63940,7 +63940,7 @@ static NTSTATUS thunk32_vkGetDeviceFaultDebugInfoKHR(void *args)
 
     TRACE("%#x, %#x\n", params->device, params->pDebugInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceFaultDebugInfoKHR);
     convert_VkDeviceFaultDebugInfoKHR_win32_to_host(ctx, (VkDeviceFaultDebugInfoKHR32 *)UlongToPtr(params->pDebugInfo), &pDebugInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDeviceFaultDebugInfoKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pDebugInfo_host);
     convert_VkDeviceFaultDebugInfoKHR_host_to_win32(&pDebugInfo_host, (VkDeviceFaultDebugInfoKHR32 *)UlongToPtr(params->pDebugInfo));
@@ -63976,7 +63976,7 @@ static NTSTATUS thunk32_vkGetDeviceFaultInfoEXT(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pFaultCounts, params->pFaultInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceFaultInfoEXT);
     convert_VkDeviceFaultCountsEXT_win32_to_host((VkDeviceFaultCountsEXT32 *)UlongToPtr(params->pFaultCounts), &pFaultCounts_host);
     if (params->pFaultInfo)
     {
@@ -64018,7 +64018,7 @@ static NTSTATUS thunk32_vkGetDeviceFaultReportsKHR(void *args)
 
     TRACE("%#x, 0x%s, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->timeout), params->pFaultCounts, params->pFaultInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceFaultReportsKHR);
     pFaultInfo_host = convert_VkDeviceFaultInfoKHR_array_win32_to_host(ctx, (VkDeviceFaultInfoKHR32 *)UlongToPtr(params->pFaultInfo), *(uint32_t *)UlongToPtr(params->pFaultCounts));
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDeviceFaultReportsKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->timeout, (uint32_t *)UlongToPtr(params->pFaultCounts), pFaultInfo_host);
     convert_VkDeviceFaultInfoKHR_array_host_to_win32(pFaultInfo_host, (VkDeviceFaultInfoKHR32 *)UlongToPtr(params->pFaultInfo), *(uint32_t *)UlongToPtr(params->pFaultCounts));
@@ -64152,7 +64152,7 @@ static NTSTATUS thunk64_vkGetDeviceImageMemoryRequirements(void *args)
 
     TRACE("%p, %p, %p\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageMemoryRequirements);
     convert_VkDeviceImageMemoryRequirements_win64_to_host(ctx, params->pInfo, &pInfo_host);
     vk_funcs->p_vkGetDeviceImageMemoryRequirements(params->device, &pInfo_host, params->pMemoryRequirements);
     free_conversion_context(ctx);
@@ -64175,7 +64175,7 @@ static NTSTATUS thunk32_vkGetDeviceImageMemoryRequirements(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageMemoryRequirements);
     convert_VkDeviceImageMemoryRequirements_win32_to_host(ctx, (const VkDeviceImageMemoryRequirements32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vk_funcs->p_vkGetDeviceImageMemoryRequirements((VkDevice)UlongToPtr(params->device), &pInfo_host, &pMemoryRequirements_host);
@@ -64194,7 +64194,7 @@ static NTSTATUS thunk64_vkGetDeviceImageMemoryRequirementsKHR(void *args)
 
     TRACE("%p, %p, %p\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageMemoryRequirementsKHR);
     convert_VkDeviceImageMemoryRequirements_win64_to_host(ctx, params->pInfo, &pInfo_host);
     vulkan_device_from_handle(params->device)->p_vkGetDeviceImageMemoryRequirementsKHR(vulkan_device_from_handle(params->device)->host.device, &pInfo_host, params->pMemoryRequirements);
     free_conversion_context(ctx);
@@ -64217,7 +64217,7 @@ static NTSTATUS thunk32_vkGetDeviceImageMemoryRequirementsKHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageMemoryRequirementsKHR);
     convert_VkDeviceImageMemoryRequirements_win32_to_host(ctx, (const VkDeviceImageMemoryRequirements32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDeviceImageMemoryRequirementsKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -64236,7 +64236,7 @@ static NTSTATUS thunk64_vkGetDeviceImageSparseMemoryRequirements(void *args)
 
     TRACE("%p, %p, %p, %p\n", params->device, params->pInfo, params->pSparseMemoryRequirementCount, params->pSparseMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageSparseMemoryRequirements);
     convert_VkDeviceImageMemoryRequirements_win64_to_host(ctx, params->pInfo, &pInfo_host);
     vulkan_device_from_handle(params->device)->p_vkGetDeviceImageSparseMemoryRequirements(vulkan_device_from_handle(params->device)->host.device, &pInfo_host, params->pSparseMemoryRequirementCount, params->pSparseMemoryRequirements);
     free_conversion_context(ctx);
@@ -64260,7 +64260,7 @@ static NTSTATUS thunk32_vkGetDeviceImageSparseMemoryRequirements(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pInfo, params->pSparseMemoryRequirementCount, params->pSparseMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageSparseMemoryRequirements);
     convert_VkDeviceImageMemoryRequirements_win32_to_host(ctx, (const VkDeviceImageMemoryRequirements32 *)UlongToPtr(params->pInfo), &pInfo_host);
     pSparseMemoryRequirements_host = convert_VkSparseImageMemoryRequirements2_array_win32_to_host(ctx, (VkSparseImageMemoryRequirements232 *)UlongToPtr(params->pSparseMemoryRequirements), *(uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount));
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDeviceImageSparseMemoryRequirements(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, (uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount), pSparseMemoryRequirements_host);
@@ -64279,7 +64279,7 @@ static NTSTATUS thunk64_vkGetDeviceImageSparseMemoryRequirementsKHR(void *args)
 
     TRACE("%p, %p, %p, %p\n", params->device, params->pInfo, params->pSparseMemoryRequirementCount, params->pSparseMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageSparseMemoryRequirementsKHR);
     convert_VkDeviceImageMemoryRequirements_win64_to_host(ctx, params->pInfo, &pInfo_host);
     vulkan_device_from_handle(params->device)->p_vkGetDeviceImageSparseMemoryRequirementsKHR(vulkan_device_from_handle(params->device)->host.device, &pInfo_host, params->pSparseMemoryRequirementCount, params->pSparseMemoryRequirements);
     free_conversion_context(ctx);
@@ -64303,7 +64303,7 @@ static NTSTATUS thunk32_vkGetDeviceImageSparseMemoryRequirementsKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pInfo, params->pSparseMemoryRequirementCount, params->pSparseMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageSparseMemoryRequirementsKHR);
     convert_VkDeviceImageMemoryRequirements_win32_to_host(ctx, (const VkDeviceImageMemoryRequirements32 *)UlongToPtr(params->pInfo), &pInfo_host);
     pSparseMemoryRequirements_host = convert_VkSparseImageMemoryRequirements2_array_win32_to_host(ctx, (VkSparseImageMemoryRequirements232 *)UlongToPtr(params->pSparseMemoryRequirements), *(uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount));
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDeviceImageSparseMemoryRequirementsKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, (uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount), pSparseMemoryRequirements_host);
@@ -64322,7 +64322,7 @@ static NTSTATUS thunk64_vkGetDeviceImageSubresourceLayout(void *args)
 
     TRACE("%p, %p, %p\n", params->device, params->pInfo, params->pLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageSubresourceLayout);
     convert_VkDeviceImageSubresourceInfo_win64_to_host(ctx, params->pInfo, &pInfo_host);
     vulkan_device_from_handle(params->device)->p_vkGetDeviceImageSubresourceLayout(vulkan_device_from_handle(params->device)->host.device, &pInfo_host, params->pLayout);
     free_conversion_context(ctx);
@@ -64345,7 +64345,7 @@ static NTSTATUS thunk32_vkGetDeviceImageSubresourceLayout(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageSubresourceLayout);
     convert_VkDeviceImageSubresourceInfo_win32_to_host(ctx, (const VkDeviceImageSubresourceInfo32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkSubresourceLayout2_win32_to_host(ctx, (VkSubresourceLayout232 *)UlongToPtr(params->pLayout), &pLayout_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDeviceImageSubresourceLayout(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pLayout_host);
@@ -64364,7 +64364,7 @@ static NTSTATUS thunk64_vkGetDeviceImageSubresourceLayoutKHR(void *args)
 
     TRACE("%p, %p, %p\n", params->device, params->pInfo, params->pLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageSubresourceLayoutKHR);
     convert_VkDeviceImageSubresourceInfo_win64_to_host(ctx, params->pInfo, &pInfo_host);
     vulkan_device_from_handle(params->device)->p_vkGetDeviceImageSubresourceLayoutKHR(vulkan_device_from_handle(params->device)->host.device, &pInfo_host, params->pLayout);
     free_conversion_context(ctx);
@@ -64387,7 +64387,7 @@ static NTSTATUS thunk32_vkGetDeviceImageSubresourceLayoutKHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceImageSubresourceLayoutKHR);
     convert_VkDeviceImageSubresourceInfo_win32_to_host(ctx, (const VkDeviceImageSubresourceInfo32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkSubresourceLayout2_win32_to_host(ctx, (VkSubresourceLayout232 *)UlongToPtr(params->pLayout), &pLayout_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDeviceImageSubresourceLayoutKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pLayout_host);
@@ -64632,7 +64632,7 @@ static NTSTATUS thunk32_vkGetDeviceTensorMemoryRequirementsARM(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDeviceTensorMemoryRequirementsARM);
     convert_VkDeviceTensorMemoryRequirementsARM_win32_to_host(ctx, (const VkDeviceTensorMemoryRequirementsARM32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDeviceTensorMemoryRequirementsARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -64669,7 +64669,7 @@ static NTSTATUS thunk32_vkGetDynamicRenderingTilePropertiesQCOM(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pRenderingInfo, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetDynamicRenderingTilePropertiesQCOM);
     convert_VkRenderingInfo_win32_to_host(ctx, (const VkRenderingInfo32 *)UlongToPtr(params->pRenderingInfo), &pRenderingInfo_host);
     convert_VkTilePropertiesQCOM_win32_to_host((VkTilePropertiesQCOM32 *)UlongToPtr(params->pProperties), &pProperties_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetDynamicRenderingTilePropertiesQCOM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pRenderingInfo_host, &pProperties_host);
@@ -64709,7 +64709,7 @@ static NTSTATUS thunk32_vkGetEncodedVideoSessionParametersKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x, %#x\n", params->device, params->pVideoSessionParametersInfo, params->pFeedbackInfo, params->pDataSize, params->pData);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetEncodedVideoSessionParametersKHR);
     convert_VkVideoEncodeSessionParametersGetInfoKHR_win32_to_host(ctx, (const VkVideoEncodeSessionParametersGetInfoKHR32 *)UlongToPtr(params->pVideoSessionParametersInfo), &pVideoSessionParametersInfo_host);
     if (params->pFeedbackInfo)
     {
@@ -64839,7 +64839,7 @@ static NTSTATUS thunk32_vkGetFramebufferTilePropertiesQCOM(void *args)
 
     TRACE("%#x, 0x%s, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->framebuffer), params->pPropertiesCount, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetFramebufferTilePropertiesQCOM);
     pProperties_host = convert_VkTilePropertiesQCOM_array_win32_to_host(ctx, (VkTilePropertiesQCOM32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertiesCount));
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetFramebufferTilePropertiesQCOM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->framebuffer, (uint32_t *)UlongToPtr(params->pPropertiesCount), pProperties_host);
     convert_VkTilePropertiesQCOM_array_host_to_win32(pProperties_host, (VkTilePropertiesQCOM32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertiesCount));
@@ -64874,7 +64874,7 @@ static NTSTATUS thunk32_vkGetGeneratedCommandsMemoryRequirementsEXT(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetGeneratedCommandsMemoryRequirementsEXT);
     convert_VkGeneratedCommandsMemoryRequirementsInfoEXT_win32_to_host(ctx, (const VkGeneratedCommandsMemoryRequirementsInfoEXT32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetGeneratedCommandsMemoryRequirementsEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -64910,7 +64910,7 @@ static NTSTATUS thunk32_vkGetGeneratedCommandsMemoryRequirementsNV(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetGeneratedCommandsMemoryRequirementsNV);
     convert_VkGeneratedCommandsMemoryRequirementsInfoNV_win32_to_host((const VkGeneratedCommandsMemoryRequirementsInfoNV32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetGeneratedCommandsMemoryRequirementsNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -65065,7 +65065,7 @@ static NTSTATUS thunk32_vkGetImageMemoryRequirements2(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetImageMemoryRequirements2);
     convert_VkImageMemoryRequirementsInfo2_win32_to_host(ctx, (const VkImageMemoryRequirementsInfo232 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetImageMemoryRequirements2(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -65101,7 +65101,7 @@ static NTSTATUS thunk32_vkGetImageMemoryRequirements2KHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetImageMemoryRequirements2KHR);
     convert_VkImageMemoryRequirementsInfo2_win32_to_host(ctx, (const VkImageMemoryRequirementsInfo232 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetImageMemoryRequirements2KHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -65138,7 +65138,7 @@ static NTSTATUS thunk32_vkGetImageOpaqueCaptureDataEXT(void *args)
 
     TRACE("%#x, %u, %#x, %#x\n", params->device, params->imageCount, params->pImages, params->pDatas);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetImageOpaqueCaptureDataEXT);
     pDatas_host = convert_VkHostAddressRangeEXT_array_win32_to_host(ctx, (VkHostAddressRangeEXT32 *)UlongToPtr(params->pDatas), params->imageCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetImageOpaqueCaptureDataEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->imageCount, (const VkImage *)UlongToPtr(params->pImages), pDatas_host);
     convert_VkHostAddressRangeEXT_array_host_to_win32(pDatas_host, (VkHostAddressRangeEXT32 *)UlongToPtr(params->pDatas), params->imageCount);
@@ -65203,7 +65203,7 @@ static NTSTATUS thunk32_vkGetImageSparseMemoryRequirements(void *args)
 
     TRACE("%#x, 0x%s, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->image), params->pSparseMemoryRequirementCount, params->pSparseMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetImageSparseMemoryRequirements);
     pSparseMemoryRequirements_host = (params->pSparseMemoryRequirements && *(uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount)) ? conversion_context_alloc(ctx, sizeof(*pSparseMemoryRequirements_host) * *(uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount)) : NULL;
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetImageSparseMemoryRequirements(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->image, (uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount), pSparseMemoryRequirements_host);
     convert_VkSparseImageMemoryRequirements_array_host_to_win32(pSparseMemoryRequirements_host, (VkSparseImageMemoryRequirements32 *)UlongToPtr(params->pSparseMemoryRequirements), *(uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount));
@@ -65239,7 +65239,7 @@ static NTSTATUS thunk32_vkGetImageSparseMemoryRequirements2(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pInfo, params->pSparseMemoryRequirementCount, params->pSparseMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetImageSparseMemoryRequirements2);
     convert_VkImageSparseMemoryRequirementsInfo2_win32_to_host((const VkImageSparseMemoryRequirementsInfo232 *)UlongToPtr(params->pInfo), &pInfo_host);
     pSparseMemoryRequirements_host = convert_VkSparseImageMemoryRequirements2_array_win32_to_host(ctx, (VkSparseImageMemoryRequirements232 *)UlongToPtr(params->pSparseMemoryRequirements), *(uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount));
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetImageSparseMemoryRequirements2(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, (uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount), pSparseMemoryRequirements_host);
@@ -65276,7 +65276,7 @@ static NTSTATUS thunk32_vkGetImageSparseMemoryRequirements2KHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pInfo, params->pSparseMemoryRequirementCount, params->pSparseMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetImageSparseMemoryRequirements2KHR);
     convert_VkImageSparseMemoryRequirementsInfo2_win32_to_host((const VkImageSparseMemoryRequirementsInfo232 *)UlongToPtr(params->pInfo), &pInfo_host);
     pSparseMemoryRequirements_host = convert_VkSparseImageMemoryRequirements2_array_win32_to_host(ctx, (VkSparseImageMemoryRequirements232 *)UlongToPtr(params->pSparseMemoryRequirements), *(uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount));
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetImageSparseMemoryRequirements2KHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, (uint32_t *)UlongToPtr(params->pSparseMemoryRequirementCount), pSparseMemoryRequirements_host);
@@ -65344,7 +65344,7 @@ static NTSTATUS thunk32_vkGetImageSubresourceLayout2(void *args)
 
     TRACE("%#x, 0x%s, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->image), params->pSubresource, params->pLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetImageSubresourceLayout2);
     convert_VkImageSubresource2_win32_to_host((const VkImageSubresource232 *)UlongToPtr(params->pSubresource), &pSubresource_host);
     convert_VkSubresourceLayout2_win32_to_host(ctx, (VkSubresourceLayout232 *)UlongToPtr(params->pLayout), &pLayout_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetImageSubresourceLayout2(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->image, &pSubresource_host, &pLayout_host);
@@ -65381,7 +65381,7 @@ static NTSTATUS thunk32_vkGetImageSubresourceLayout2EXT(void *args)
 
     TRACE("%#x, 0x%s, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->image), params->pSubresource, params->pLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetImageSubresourceLayout2EXT);
     convert_VkImageSubresource2_win32_to_host((const VkImageSubresource232 *)UlongToPtr(params->pSubresource), &pSubresource_host);
     convert_VkSubresourceLayout2_win32_to_host(ctx, (VkSubresourceLayout232 *)UlongToPtr(params->pLayout), &pLayout_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetImageSubresourceLayout2EXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->image, &pSubresource_host, &pLayout_host);
@@ -65418,7 +65418,7 @@ static NTSTATUS thunk32_vkGetImageSubresourceLayout2KHR(void *args)
 
     TRACE("%#x, 0x%s, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->image), params->pSubresource, params->pLayout);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetImageSubresourceLayout2KHR);
     convert_VkImageSubresource2_win32_to_host((const VkImageSubresource232 *)UlongToPtr(params->pSubresource), &pSubresource_host);
     convert_VkSubresourceLayout2_win32_to_host(ctx, (VkSubresourceLayout232 *)UlongToPtr(params->pLayout), &pLayout_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetImageSubresourceLayout2KHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->image, &pSubresource_host, &pLayout_host);
@@ -65572,7 +65572,7 @@ static NTSTATUS thunk32_vkGetLatencyTimingsNV(void *args)
 
     TRACE("%#x, 0x%s, %#x\n", params->device, wine_dbgstr_longlong(params->swapchain), params->pLatencyMarkerInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetLatencyTimingsNV);
     convert_VkGetLatencyMarkerInfoNV_win32_to_host(ctx, (VkGetLatencyMarkerInfoNV32 *)UlongToPtr(params->pLatencyMarkerInfo), &pLatencyMarkerInfo_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetLatencyTimingsNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, vulkan_swapchain_from_handle(params->swapchain)->host.swapchain, &pLatencyMarkerInfo_host);
     convert_VkGetLatencyMarkerInfoNV_host_to_win32(&pLatencyMarkerInfo_host, (VkGetLatencyMarkerInfoNV32 *)UlongToPtr(params->pLatencyMarkerInfo));
@@ -65705,7 +65705,7 @@ static NTSTATUS thunk32_vkGetMicromapBuildSizesEXT(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->buildType, params->pBuildInfo, params->pSizeInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetMicromapBuildSizesEXT);
     convert_VkMicromapBuildInfoEXT_win32_to_host(ctx, (const VkMicromapBuildInfoEXT32 *)UlongToPtr(params->pBuildInfo), &pBuildInfo_host);
     convert_VkMicromapBuildSizesInfoEXT_win32_to_host((VkMicromapBuildSizesInfoEXT32 *)UlongToPtr(params->pSizeInfo), &pSizeInfo_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetMicromapBuildSizesEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->buildType, &pBuildInfo_host, &pSizeInfo_host);
@@ -65741,7 +65741,7 @@ static NTSTATUS thunk32_vkGetPartitionedAccelerationStructuresBuildSizesNV(void
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pSizeInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPartitionedAccelerationStructuresBuildSizesNV);
     convert_VkPartitionedAccelerationStructureInstancesInputNV_win32_to_host(ctx, (const VkPartitionedAccelerationStructureInstancesInputNV32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkAccelerationStructureBuildSizesInfoKHR_win32_to_host((VkAccelerationStructureBuildSizesInfoKHR32 *)UlongToPtr(params->pSizeInfo), &pSizeInfo_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetPartitionedAccelerationStructuresBuildSizesNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pSizeInfo_host);
@@ -65781,7 +65781,7 @@ static NTSTATUS thunk32_vkGetPastPresentationTimingEXT(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pPastPresentationTimingInfo, params->pPastPresentationTimingProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPastPresentationTimingEXT);
     convert_VkPastPresentationTimingInfoEXT_win32_to_host((const VkPastPresentationTimingInfoEXT32 *)UlongToPtr(params->pPastPresentationTimingInfo), &pPastPresentationTimingInfo_host);
     convert_VkPastPresentationTimingPropertiesEXT_win32_to_host(ctx, (VkPastPresentationTimingPropertiesEXT32 *)UlongToPtr(params->pPastPresentationTimingProperties), &pPastPresentationTimingProperties_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetPastPresentationTimingEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pPastPresentationTimingInfo_host, &pPastPresentationTimingProperties_host);
@@ -65903,7 +65903,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPr
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pPropertyCount, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV);
     pProperties_host = convert_VkCooperativeMatrixFlexibleDimensionsPropertiesNV_array_win32_to_host(ctx, (VkCooperativeMatrixFlexibleDimensionsPropertiesNV32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pPropertyCount), pProperties_host);
     convert_VkCooperativeMatrixFlexibleDimensionsPropertiesNV_array_host_to_win32(pProperties_host, (VkCooperativeMatrixFlexibleDimensionsPropertiesNV32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
@@ -65938,7 +65938,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR(void *
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pPropertyCount, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR);
     pProperties_host = convert_VkCooperativeMatrixPropertiesKHR_array_win32_to_host(ctx, (VkCooperativeMatrixPropertiesKHR32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pPropertyCount), pProperties_host);
     convert_VkCooperativeMatrixPropertiesKHR_array_host_to_win32(pProperties_host, (VkCooperativeMatrixPropertiesKHR32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
@@ -65973,7 +65973,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(void *a
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pPropertyCount, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV);
     pProperties_host = convert_VkCooperativeMatrixPropertiesNV_array_win32_to_host(ctx, (VkCooperativeMatrixPropertiesNV32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pPropertyCount), pProperties_host);
     convert_VkCooperativeMatrixPropertiesNV_array_host_to_win32(pProperties_host, (VkCooperativeMatrixPropertiesNV32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
@@ -66008,7 +66008,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceCooperativeVectorPropertiesNV(void *a
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pPropertyCount, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceCooperativeVectorPropertiesNV);
     pProperties_host = convert_VkCooperativeVectorPropertiesNV_array_win32_to_host(ctx, (VkCooperativeVectorPropertiesNV32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceCooperativeVectorPropertiesNV(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pPropertyCount), pProperties_host);
     convert_VkCooperativeVectorPropertiesNV_array_host_to_win32(pProperties_host, (VkCooperativeVectorPropertiesNV32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
@@ -66072,7 +66072,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceExternalBufferProperties(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pExternalBufferInfo, params->pExternalBufferProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceExternalBufferProperties);
     convert_VkPhysicalDeviceExternalBufferInfo_win32_to_host(ctx, (const VkPhysicalDeviceExternalBufferInfo32 *)UlongToPtr(params->pExternalBufferInfo), &pExternalBufferInfo_host);
     convert_VkExternalBufferProperties_win32_to_host((VkExternalBufferProperties32 *)UlongToPtr(params->pExternalBufferProperties), &pExternalBufferProperties_host);
     vk_funcs->p_vkGetPhysicalDeviceExternalBufferProperties((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pExternalBufferInfo_host, &pExternalBufferProperties_host);
@@ -66110,7 +66110,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceExternalBufferPropertiesKHR(void *arg
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pExternalBufferInfo, params->pExternalBufferProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceExternalBufferPropertiesKHR);
     convert_VkPhysicalDeviceExternalBufferInfo_win32_to_host(ctx, (const VkPhysicalDeviceExternalBufferInfo32 *)UlongToPtr(params->pExternalBufferInfo), &pExternalBufferInfo_host);
     convert_VkExternalBufferProperties_win32_to_host((VkExternalBufferProperties32 *)UlongToPtr(params->pExternalBufferProperties), &pExternalBufferProperties_host);
     vk_funcs->p_vkGetPhysicalDeviceExternalBufferPropertiesKHR((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pExternalBufferInfo_host, &pExternalBufferProperties_host);
@@ -66216,7 +66216,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceExternalSemaphoreProperties(void *arg
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pExternalSemaphoreInfo, params->pExternalSemaphoreProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceExternalSemaphoreProperties);
     convert_VkPhysicalDeviceExternalSemaphoreInfo_win32_to_host(ctx, (const VkPhysicalDeviceExternalSemaphoreInfo32 *)UlongToPtr(params->pExternalSemaphoreInfo), &pExternalSemaphoreInfo_host);
     convert_VkExternalSemaphoreProperties_win32_to_host((VkExternalSemaphoreProperties32 *)UlongToPtr(params->pExternalSemaphoreProperties), &pExternalSemaphoreProperties_host);
     vk_funcs->p_vkGetPhysicalDeviceExternalSemaphoreProperties((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pExternalSemaphoreInfo_host, &pExternalSemaphoreProperties_host);
@@ -66254,7 +66254,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(void *
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pExternalSemaphoreInfo, params->pExternalSemaphoreProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR);
     convert_VkPhysicalDeviceExternalSemaphoreInfo_win32_to_host(ctx, (const VkPhysicalDeviceExternalSemaphoreInfo32 *)UlongToPtr(params->pExternalSemaphoreInfo), &pExternalSemaphoreInfo_host);
     convert_VkExternalSemaphoreProperties_win32_to_host((VkExternalSemaphoreProperties32 *)UlongToPtr(params->pExternalSemaphoreProperties), &pExternalSemaphoreProperties_host);
     vk_funcs->p_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pExternalSemaphoreInfo_host, &pExternalSemaphoreProperties_host);
@@ -66290,7 +66290,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceExternalTensorPropertiesARM(void *arg
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pExternalTensorInfo, params->pExternalTensorProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceExternalTensorPropertiesARM);
     convert_VkPhysicalDeviceExternalTensorInfoARM_win32_to_host(ctx, (const VkPhysicalDeviceExternalTensorInfoARM32 *)UlongToPtr(params->pExternalTensorInfo), &pExternalTensorInfo_host);
     convert_VkExternalTensorPropertiesARM_win32_to_host((VkExternalTensorPropertiesARM32 *)UlongToPtr(params->pExternalTensorProperties), &pExternalTensorProperties_host);
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceExternalTensorPropertiesARM(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pExternalTensorInfo_host, &pExternalTensorProperties_host);
@@ -66350,7 +66350,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceFeatures2(void *args)
 
     TRACE("%#x, %#x\n", params->physicalDevice, params->pFeatures);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceFeatures2);
     convert_VkPhysicalDeviceFeatures2_win32_to_host(ctx, (VkPhysicalDeviceFeatures232 *)UlongToPtr(params->pFeatures), &pFeatures_host);
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceFeatures2(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pFeatures_host);
     convert_VkPhysicalDeviceFeatures2_host_to_win32(&pFeatures_host, (VkPhysicalDeviceFeatures232 *)UlongToPtr(params->pFeatures));
@@ -66383,7 +66383,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceFeatures2KHR(void *args)
 
     TRACE("%#x, %#x\n", params->physicalDevice, params->pFeatures);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceFeatures2KHR);
     convert_VkPhysicalDeviceFeatures2_win32_to_host(ctx, (VkPhysicalDeviceFeatures232 *)UlongToPtr(params->pFeatures), &pFeatures_host);
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceFeatures2KHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pFeatures_host);
     convert_VkPhysicalDeviceFeatures2_host_to_win32(&pFeatures_host, (VkPhysicalDeviceFeatures232 *)UlongToPtr(params->pFeatures));
@@ -66444,7 +66444,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceFormatProperties2(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->format, params->pFormatProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceFormatProperties2);
     convert_VkFormatProperties2_win32_to_host(ctx, (VkFormatProperties232 *)UlongToPtr(params->pFormatProperties), &pFormatProperties_host);
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceFormatProperties2(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, params->format, &pFormatProperties_host);
     convert_VkFormatProperties2_host_to_win32(&pFormatProperties_host, (VkFormatProperties232 *)UlongToPtr(params->pFormatProperties));
@@ -66478,7 +66478,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceFormatProperties2KHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->format, params->pFormatProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceFormatProperties2KHR);
     convert_VkFormatProperties2_win32_to_host(ctx, (VkFormatProperties232 *)UlongToPtr(params->pFormatProperties), &pFormatProperties_host);
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceFormatProperties2KHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, params->format, &pFormatProperties_host);
     convert_VkFormatProperties2_host_to_win32(&pFormatProperties_host, (VkFormatProperties232 *)UlongToPtr(params->pFormatProperties));
@@ -66513,7 +66513,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceFragmentShadingRatesKHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pFragmentShadingRateCount, params->pFragmentShadingRates);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceFragmentShadingRatesKHR);
     pFragmentShadingRates_host = convert_VkPhysicalDeviceFragmentShadingRateKHR_array_win32_to_host(ctx, (VkPhysicalDeviceFragmentShadingRateKHR32 *)UlongToPtr(params->pFragmentShadingRates), *(uint32_t *)UlongToPtr(params->pFragmentShadingRateCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceFragmentShadingRatesKHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pFragmentShadingRateCount), pFragmentShadingRates_host);
     convert_VkPhysicalDeviceFragmentShadingRateKHR_array_host_to_win32(pFragmentShadingRates_host, (VkPhysicalDeviceFragmentShadingRateKHR32 *)UlongToPtr(params->pFragmentShadingRates), *(uint32_t *)UlongToPtr(params->pFragmentShadingRateCount));
@@ -66565,7 +66565,7 @@ static NTSTATUS thunk64_vkGetPhysicalDeviceImageFormatProperties2(void *args)
 
     TRACE("%p, %p, %p\n", params->physicalDevice, params->pImageFormatInfo, params->pImageFormatProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceImageFormatProperties2);
     convert_VkPhysicalDeviceImageFormatInfo2_win64_to_host(ctx, params->pImageFormatInfo, &pImageFormatInfo_host);
     params->result = vk_funcs->p_vkGetPhysicalDeviceImageFormatProperties2(params->physicalDevice, &pImageFormatInfo_host, params->pImageFormatProperties);
     free_conversion_context(ctx);
@@ -66589,7 +66589,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceImageFormatProperties2(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pImageFormatInfo, params->pImageFormatProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceImageFormatProperties2);
     convert_VkPhysicalDeviceImageFormatInfo2_win32_to_host(ctx, (const VkPhysicalDeviceImageFormatInfo232 *)UlongToPtr(params->pImageFormatInfo), &pImageFormatInfo_host);
     convert_VkImageFormatProperties2_win32_to_host(ctx, (VkImageFormatProperties232 *)UlongToPtr(params->pImageFormatProperties), &pImageFormatProperties_host);
     params->result = vk_funcs->p_vkGetPhysicalDeviceImageFormatProperties2((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pImageFormatInfo_host, &pImageFormatProperties_host);
@@ -66608,7 +66608,7 @@ static NTSTATUS thunk64_vkGetPhysicalDeviceImageFormatProperties2KHR(void *args)
 
     TRACE("%p, %p, %p\n", params->physicalDevice, params->pImageFormatInfo, params->pImageFormatProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceImageFormatProperties2KHR);
     convert_VkPhysicalDeviceImageFormatInfo2_win64_to_host(ctx, params->pImageFormatInfo, &pImageFormatInfo_host);
     params->result = vk_funcs->p_vkGetPhysicalDeviceImageFormatProperties2KHR(params->physicalDevice, &pImageFormatInfo_host, params->pImageFormatProperties);
     free_conversion_context(ctx);
@@ -66632,7 +66632,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceImageFormatProperties2KHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pImageFormatInfo, params->pImageFormatProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceImageFormatProperties2KHR);
     convert_VkPhysicalDeviceImageFormatInfo2_win32_to_host(ctx, (const VkPhysicalDeviceImageFormatInfo232 *)UlongToPtr(params->pImageFormatInfo), &pImageFormatInfo_host);
     convert_VkImageFormatProperties2_win32_to_host(ctx, (VkImageFormatProperties232 *)UlongToPtr(params->pImageFormatProperties), &pImageFormatProperties_host);
     params->result = vk_funcs->p_vkGetPhysicalDeviceImageFormatProperties2KHR((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pImageFormatInfo_host, &pImageFormatProperties_host);
@@ -66694,7 +66694,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceMemoryProperties2(void *args)
 
     TRACE("%#x, %#x\n", params->physicalDevice, params->pMemoryProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceMemoryProperties2);
     convert_VkPhysicalDeviceMemoryProperties2_win32_to_host(ctx, (VkPhysicalDeviceMemoryProperties232 *)UlongToPtr(params->pMemoryProperties), &pMemoryProperties_host);
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceMemoryProperties2(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pMemoryProperties_host);
     convert_VkPhysicalDeviceMemoryProperties2_host_to_win32(&pMemoryProperties_host, (VkPhysicalDeviceMemoryProperties232 *)UlongToPtr(params->pMemoryProperties));
@@ -66727,7 +66727,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceMemoryProperties2KHR(void *args)
 
     TRACE("%#x, %#x\n", params->physicalDevice, params->pMemoryProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceMemoryProperties2KHR);
     convert_VkPhysicalDeviceMemoryProperties2_win32_to_host(ctx, (VkPhysicalDeviceMemoryProperties232 *)UlongToPtr(params->pMemoryProperties), &pMemoryProperties_host);
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceMemoryProperties2KHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pMemoryProperties_host);
     convert_VkPhysicalDeviceMemoryProperties2_host_to_win32(&pMemoryProperties_host, (VkPhysicalDeviceMemoryProperties232 *)UlongToPtr(params->pMemoryProperties));
@@ -66794,7 +66794,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceOpticalFlowImageFormatsNV(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->physicalDevice, params->pOpticalFlowImageFormatInfo, params->pFormatCount, params->pImageFormatProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceOpticalFlowImageFormatsNV);
     convert_VkOpticalFlowImageFormatInfoNV_win32_to_host((const VkOpticalFlowImageFormatInfoNV32 *)UlongToPtr(params->pOpticalFlowImageFormatInfo), &pOpticalFlowImageFormatInfo_host);
     pImageFormatProperties_host = convert_VkOpticalFlowImageFormatPropertiesNV_array_win32_to_host(ctx, (VkOpticalFlowImageFormatPropertiesNV32 *)UlongToPtr(params->pImageFormatProperties), *(uint32_t *)UlongToPtr(params->pFormatCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceOpticalFlowImageFormatsNV(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pOpticalFlowImageFormatInfo_host, (uint32_t *)UlongToPtr(params->pFormatCount), pImageFormatProperties_host);
@@ -66870,7 +66870,7 @@ static NTSTATUS thunk64_vkGetPhysicalDeviceProperties2(void *args)
 
     TRACE("%p, %p\n", params->physicalDevice, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceProperties2);
     convert_VkPhysicalDeviceProperties2_win64_to_host(ctx, params->pProperties, &pProperties_host);
     vk_funcs->p_vkGetPhysicalDeviceProperties2(params->physicalDevice, &pProperties_host);
     convert_VkPhysicalDeviceProperties2_host_to_win64(&pProperties_host, params->pProperties);
@@ -66892,7 +66892,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceProperties2(void *args)
 
     TRACE("%#x, %#x\n", params->physicalDevice, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceProperties2);
     convert_VkPhysicalDeviceProperties2_win32_to_host(ctx, (VkPhysicalDeviceProperties232 *)UlongToPtr(params->pProperties), &pProperties_host);
     vk_funcs->p_vkGetPhysicalDeviceProperties2((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pProperties_host);
     convert_VkPhysicalDeviceProperties2_host_to_win32(&pProperties_host, (VkPhysicalDeviceProperties232 *)UlongToPtr(params->pProperties));
@@ -66910,7 +66910,7 @@ static NTSTATUS thunk64_vkGetPhysicalDeviceProperties2KHR(void *args)
 
     TRACE("%p, %p\n", params->physicalDevice, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceProperties2KHR);
     convert_VkPhysicalDeviceProperties2_win64_to_host(ctx, params->pProperties, &pProperties_host);
     vk_funcs->p_vkGetPhysicalDeviceProperties2KHR(params->physicalDevice, &pProperties_host);
     convert_VkPhysicalDeviceProperties2_host_to_win64(&pProperties_host, params->pProperties);
@@ -66932,7 +66932,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceProperties2KHR(void *args)
 
     TRACE("%#x, %#x\n", params->physicalDevice, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceProperties2KHR);
     convert_VkPhysicalDeviceProperties2_win32_to_host(ctx, (VkPhysicalDeviceProperties232 *)UlongToPtr(params->pProperties), &pProperties_host);
     vk_funcs->p_vkGetPhysicalDeviceProperties2KHR((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pProperties_host);
     convert_VkPhysicalDeviceProperties2_host_to_win32(&pProperties_host, (VkPhysicalDeviceProperties232 *)UlongToPtr(params->pProperties));
@@ -67003,7 +67003,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageF
 
     TRACE("%#x, %u, %#x, %#x, %#x, %#x\n", params->physicalDevice, params->queueFamilyIndex, params->pQueueFamilyDataGraphProperties, params->pOpticalFlowImageFormatInfo, params->pFormatCount, params->pImageFormatProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM);
     convert_VkQueueFamilyDataGraphPropertiesARM_win32_to_host((const VkQueueFamilyDataGraphPropertiesARM32 *)UlongToPtr(params->pQueueFamilyDataGraphProperties), &pQueueFamilyDataGraphProperties_host);
     convert_VkDataGraphOpticalFlowImageFormatInfoARM_win32_to_host((const VkDataGraphOpticalFlowImageFormatInfoARM32 *)UlongToPtr(params->pOpticalFlowImageFormatInfo), &pOpticalFlowImageFormatInfo_host);
     pImageFormatProperties_host = convert_VkDataGraphOpticalFlowImageFormatPropertiesARM_array_win32_to_host(ctx, (VkDataGraphOpticalFlowImageFormatPropertiesARM32 *)UlongToPtr(params->pImageFormatProperties), *(uint32_t *)UlongToPtr(params->pFormatCount));
@@ -67073,7 +67073,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM(voi
 
     TRACE("%#x, %u, %#x, %#x\n", params->physicalDevice, params->queueFamilyIndex, params->pQueueFamilyDataGraphPropertyCount, params->pQueueFamilyDataGraphProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM);
     pQueueFamilyDataGraphProperties_host = convert_VkQueueFamilyDataGraphPropertiesARM_array_win32_to_host(ctx, (VkQueueFamilyDataGraphPropertiesARM32 *)UlongToPtr(params->pQueueFamilyDataGraphProperties), *(uint32_t *)UlongToPtr(params->pQueueFamilyDataGraphPropertyCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, params->queueFamilyIndex, (uint32_t *)UlongToPtr(params->pQueueFamilyDataGraphPropertyCount), pQueueFamilyDataGraphProperties_host);
     convert_VkQueueFamilyDataGraphPropertiesARM_array_host_to_win32(pQueueFamilyDataGraphProperties_host, (VkQueueFamilyDataGraphPropertiesARM32 *)UlongToPtr(params->pQueueFamilyDataGraphProperties), *(uint32_t *)UlongToPtr(params->pQueueFamilyDataGraphPropertyCount));
@@ -67163,7 +67163,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceQueueFamilyProperties2(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pQueueFamilyPropertyCount, params->pQueueFamilyProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceQueueFamilyProperties2);
     pQueueFamilyProperties_host = convert_VkQueueFamilyProperties2_array_win32_to_host(ctx, (VkQueueFamilyProperties232 *)UlongToPtr(params->pQueueFamilyProperties), *(uint32_t *)UlongToPtr(params->pQueueFamilyPropertyCount));
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceQueueFamilyProperties2(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pQueueFamilyPropertyCount), pQueueFamilyProperties_host);
     convert_VkQueueFamilyProperties2_array_host_to_win32(pQueueFamilyProperties_host, (VkQueueFamilyProperties232 *)UlongToPtr(params->pQueueFamilyProperties), *(uint32_t *)UlongToPtr(params->pQueueFamilyPropertyCount));
@@ -67197,7 +67197,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceQueueFamilyProperties2KHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pQueueFamilyPropertyCount, params->pQueueFamilyProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceQueueFamilyProperties2KHR);
     pQueueFamilyProperties_host = convert_VkQueueFamilyProperties2_array_win32_to_host(ctx, (VkQueueFamilyProperties232 *)UlongToPtr(params->pQueueFamilyProperties), *(uint32_t *)UlongToPtr(params->pQueueFamilyPropertyCount));
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceQueueFamilyProperties2KHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pQueueFamilyPropertyCount), pQueueFamilyProperties_host);
     convert_VkQueueFamilyProperties2_array_host_to_win32(pQueueFamilyProperties_host, (VkQueueFamilyProperties232 *)UlongToPtr(params->pQueueFamilyProperties), *(uint32_t *)UlongToPtr(params->pQueueFamilyPropertyCount));
@@ -67265,7 +67265,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceSparseImageFormatProperties2(void *ar
 
     TRACE("%#x, %#x, %#x, %#x\n", params->physicalDevice, params->pFormatInfo, params->pPropertyCount, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceSparseImageFormatProperties2);
     convert_VkPhysicalDeviceSparseImageFormatInfo2_win32_to_host(ctx, (const VkPhysicalDeviceSparseImageFormatInfo232 *)UlongToPtr(params->pFormatInfo), &pFormatInfo_host);
     pProperties_host = convert_VkSparseImageFormatProperties2_array_win32_to_host(ctx, (VkSparseImageFormatProperties232 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceSparseImageFormatProperties2(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pFormatInfo_host, (uint32_t *)UlongToPtr(params->pPropertyCount), pProperties_host);
@@ -67302,7 +67302,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(void
 
     TRACE("%#x, %#x, %#x, %#x\n", params->physicalDevice, params->pFormatInfo, params->pPropertyCount, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceSparseImageFormatProperties2KHR);
     convert_VkPhysicalDeviceSparseImageFormatInfo2_win32_to_host(ctx, (const VkPhysicalDeviceSparseImageFormatInfo232 *)UlongToPtr(params->pFormatInfo), &pFormatInfo_host);
     pProperties_host = convert_VkSparseImageFormatProperties2_array_win32_to_host(ctx, (VkSparseImageFormatProperties232 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pPropertyCount));
     vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pFormatInfo_host, (uint32_t *)UlongToPtr(params->pPropertyCount), pProperties_host);
@@ -67338,7 +67338,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombi
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pCombinationCount, params->pCombinations);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV);
     pCombinations_host = convert_VkFramebufferMixedSamplesCombinationNV_array_win32_to_host(ctx, (VkFramebufferMixedSamplesCombinationNV32 *)UlongToPtr(params->pCombinations), *(uint32_t *)UlongToPtr(params->pCombinationCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pCombinationCount), pCombinations_host);
     convert_VkFramebufferMixedSamplesCombinationNV_array_host_to_win32(pCombinations_host, (VkFramebufferMixedSamplesCombinationNV32 *)UlongToPtr(params->pCombinations), *(uint32_t *)UlongToPtr(params->pCombinationCount));
@@ -67374,7 +67374,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceSurfaceCapabilities2KHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pSurfaceInfo, params->pSurfaceCapabilities);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceSurfaceCapabilities2KHR);
     convert_VkPhysicalDeviceSurfaceInfo2KHR_win32_to_unwrapped_host(ctx, (const VkPhysicalDeviceSurfaceInfo2KHR32 *)UlongToPtr(params->pSurfaceInfo), &pSurfaceInfo_host);
     convert_VkSurfaceCapabilities2KHR_win32_to_host(ctx, (VkSurfaceCapabilities2KHR32 *)UlongToPtr(params->pSurfaceCapabilities), &pSurfaceCapabilities_host);
     params->result = vk_funcs->p_vkGetPhysicalDeviceSurfaceCapabilities2KHR((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pSurfaceInfo_host, &pSurfaceCapabilities_host);
@@ -67440,7 +67440,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceSurfaceFormats2KHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->physicalDevice, params->pSurfaceInfo, params->pSurfaceFormatCount, params->pSurfaceFormats);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceSurfaceFormats2KHR);
     convert_VkPhysicalDeviceSurfaceInfo2KHR_win32_to_unwrapped_host(ctx, (const VkPhysicalDeviceSurfaceInfo2KHR32 *)UlongToPtr(params->pSurfaceInfo), &pSurfaceInfo_host);
     pSurfaceFormats_host = convert_VkSurfaceFormat2KHR_array_win32_to_host(ctx, (VkSurfaceFormat2KHR32 *)UlongToPtr(params->pSurfaceFormats), *(uint32_t *)UlongToPtr(params->pSurfaceFormatCount));
     params->result = vk_funcs->p_vkGetPhysicalDeviceSurfaceFormats2KHR((VkPhysicalDevice)UlongToPtr(params->physicalDevice), &pSurfaceInfo_host, (uint32_t *)UlongToPtr(params->pSurfaceFormatCount), pSurfaceFormats_host);
@@ -67563,7 +67563,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceToolProperties(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pToolCount, params->pToolProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceToolProperties);
     pToolProperties_host = convert_VkPhysicalDeviceToolProperties_array_win32_to_host(ctx, (VkPhysicalDeviceToolProperties32 *)UlongToPtr(params->pToolProperties), *(uint32_t *)UlongToPtr(params->pToolCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceToolProperties(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pToolCount), pToolProperties_host);
     convert_VkPhysicalDeviceToolProperties_array_host_to_win32(pToolProperties_host, (VkPhysicalDeviceToolProperties32 *)UlongToPtr(params->pToolProperties), *(uint32_t *)UlongToPtr(params->pToolCount));
@@ -67598,7 +67598,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceToolPropertiesEXT(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pToolCount, params->pToolProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceToolPropertiesEXT);
     pToolProperties_host = convert_VkPhysicalDeviceToolProperties_array_win32_to_host(ctx, (VkPhysicalDeviceToolProperties32 *)UlongToPtr(params->pToolProperties), *(uint32_t *)UlongToPtr(params->pToolCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceToolPropertiesEXT(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, (uint32_t *)UlongToPtr(params->pToolCount), pToolProperties_host);
     convert_VkPhysicalDeviceToolProperties_array_host_to_win32(pToolProperties_host, (VkPhysicalDeviceToolProperties32 *)UlongToPtr(params->pToolProperties), *(uint32_t *)UlongToPtr(params->pToolCount));
@@ -67634,7 +67634,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceVideoCapabilitiesKHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pVideoProfile, params->pCapabilities);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceVideoCapabilitiesKHR);
     convert_VkVideoProfileInfoKHR_win32_to_host(ctx, (const VkVideoProfileInfoKHR32 *)UlongToPtr(params->pVideoProfile), &pVideoProfile_host);
     convert_VkVideoCapabilitiesKHR_win32_to_host(ctx, (VkVideoCapabilitiesKHR32 *)UlongToPtr(params->pCapabilities), &pCapabilities_host);
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceVideoCapabilitiesKHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pVideoProfile_host, &pCapabilities_host);
@@ -67671,7 +67671,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR(
 
     TRACE("%#x, %#x, %#x\n", params->physicalDevice, params->pQualityLevelInfo, params->pQualityLevelProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR);
     convert_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR_win32_to_host(ctx, (const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR32 *)UlongToPtr(params->pQualityLevelInfo), &pQualityLevelInfo_host);
     convert_VkVideoEncodeQualityLevelPropertiesKHR_win32_to_host(ctx, (VkVideoEncodeQualityLevelPropertiesKHR32 *)UlongToPtr(params->pQualityLevelProperties), &pQualityLevelProperties_host);
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pQualityLevelInfo_host, &pQualityLevelProperties_host);
@@ -67709,7 +67709,7 @@ static NTSTATUS thunk32_vkGetPhysicalDeviceVideoFormatPropertiesKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->physicalDevice, params->pVideoFormatInfo, params->pVideoFormatPropertyCount, params->pVideoFormatProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPhysicalDeviceVideoFormatPropertiesKHR);
     convert_VkPhysicalDeviceVideoFormatInfoKHR_win32_to_host(ctx, (const VkPhysicalDeviceVideoFormatInfoKHR32 *)UlongToPtr(params->pVideoFormatInfo), &pVideoFormatInfo_host);
     pVideoFormatProperties_host = convert_VkVideoFormatPropertiesKHR_array_win32_to_host(ctx, (VkVideoFormatPropertiesKHR32 *)UlongToPtr(params->pVideoFormatProperties), *(uint32_t *)UlongToPtr(params->pVideoFormatPropertyCount));
     params->result = vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->instance->p_vkGetPhysicalDeviceVideoFormatPropertiesKHR(vulkan_physical_device_from_handle((VkPhysicalDevice)UlongToPtr(params->physicalDevice))->host.physical_device, &pVideoFormatInfo_host, (uint32_t *)UlongToPtr(params->pVideoFormatPropertyCount), pVideoFormatProperties_host);
@@ -67844,7 +67844,7 @@ static NTSTATUS thunk32_vkGetPipelineExecutableInternalRepresentationsKHR(void *
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pExecutableInfo, params->pInternalRepresentationCount, params->pInternalRepresentations);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPipelineExecutableInternalRepresentationsKHR);
     convert_VkPipelineExecutableInfoKHR_win32_to_host((const VkPipelineExecutableInfoKHR32 *)UlongToPtr(params->pExecutableInfo), &pExecutableInfo_host);
     pInternalRepresentations_host = convert_VkPipelineExecutableInternalRepresentationKHR_array_win32_to_host(ctx, (VkPipelineExecutableInternalRepresentationKHR32 *)UlongToPtr(params->pInternalRepresentations), *(uint32_t *)UlongToPtr(params->pInternalRepresentationCount));
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetPipelineExecutableInternalRepresentationsKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pExecutableInfo_host, (uint32_t *)UlongToPtr(params->pInternalRepresentationCount), pInternalRepresentations_host);
@@ -67882,7 +67882,7 @@ static NTSTATUS thunk32_vkGetPipelineExecutablePropertiesKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pPipelineInfo, params->pExecutableCount, params->pProperties);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPipelineExecutablePropertiesKHR);
     convert_VkPipelineInfoKHR_win32_to_host((const VkPipelineInfoKHR32 *)UlongToPtr(params->pPipelineInfo), &pPipelineInfo_host);
     pProperties_host = convert_VkPipelineExecutablePropertiesKHR_array_win32_to_host(ctx, (VkPipelineExecutablePropertiesKHR32 *)UlongToPtr(params->pProperties), *(uint32_t *)UlongToPtr(params->pExecutableCount));
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetPipelineExecutablePropertiesKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pPipelineInfo_host, (uint32_t *)UlongToPtr(params->pExecutableCount), pProperties_host);
@@ -67920,7 +67920,7 @@ static NTSTATUS thunk32_vkGetPipelineExecutableStatisticsKHR(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->device, params->pExecutableInfo, params->pStatisticCount, params->pStatistics);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPipelineExecutableStatisticsKHR);
     convert_VkPipelineExecutableInfoKHR_win32_to_host((const VkPipelineExecutableInfoKHR32 *)UlongToPtr(params->pExecutableInfo), &pExecutableInfo_host);
     pStatistics_host = convert_VkPipelineExecutableStatisticKHR_array_win32_to_host(ctx, (VkPipelineExecutableStatisticKHR32 *)UlongToPtr(params->pStatistics), *(uint32_t *)UlongToPtr(params->pStatisticCount));
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetPipelineExecutableStatisticsKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pExecutableInfo_host, (uint32_t *)UlongToPtr(params->pStatisticCount), pStatistics_host);
@@ -67985,7 +67985,7 @@ static NTSTATUS thunk32_vkGetPipelineIndirectMemoryRequirementsNV(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPipelineIndirectMemoryRequirementsNV);
     convert_VkComputePipelineCreateInfo_win32_to_host(ctx, (const VkComputePipelineCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetPipelineIndirectMemoryRequirementsNV(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, &pMemoryRequirements_host);
@@ -68023,7 +68023,7 @@ static NTSTATUS thunk32_vkGetPipelineKeyKHR(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pPipelineCreateInfo, params->pPipelineKey);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetPipelineKeyKHR);
     if (params->pPipelineCreateInfo)
     {
         pPipelineCreateInfo_host = conversion_context_alloc(ctx, sizeof(*pPipelineCreateInfo_host));
@@ -68183,7 +68183,7 @@ static NTSTATUS thunk32_vkGetQueueCheckpointData2NV(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->queue, params->pCheckpointDataCount, params->pCheckpointData);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetQueueCheckpointData2NV);
     pCheckpointData_host = convert_VkCheckpointData2NV_array_win32_to_host(ctx, (VkCheckpointData2NV32 *)UlongToPtr(params->pCheckpointData), *(uint32_t *)UlongToPtr(params->pCheckpointDataCount));
     vulkan_queue_from_handle((VkQueue)UlongToPtr(params->queue))->device->p_vkGetQueueCheckpointData2NV(vulkan_queue_from_handle((VkQueue)UlongToPtr(params->queue))->host.queue, (uint32_t *)UlongToPtr(params->pCheckpointDataCount), pCheckpointData_host);
     convert_VkCheckpointData2NV_array_host_to_win32(pCheckpointData_host, (VkCheckpointData2NV32 *)UlongToPtr(params->pCheckpointData), *(uint32_t *)UlongToPtr(params->pCheckpointDataCount));
@@ -68217,7 +68217,7 @@ static NTSTATUS thunk32_vkGetQueueCheckpointDataNV(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->queue, params->pCheckpointDataCount, params->pCheckpointData);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetQueueCheckpointDataNV);
     pCheckpointData_host = convert_VkCheckpointDataNV_array_win32_to_host(ctx, (VkCheckpointDataNV32 *)UlongToPtr(params->pCheckpointData), *(uint32_t *)UlongToPtr(params->pCheckpointDataCount));
     vulkan_queue_from_handle((VkQueue)UlongToPtr(params->queue))->device->p_vkGetQueueCheckpointDataNV(vulkan_queue_from_handle((VkQueue)UlongToPtr(params->queue))->host.queue, (uint32_t *)UlongToPtr(params->pCheckpointDataCount), pCheckpointData_host);
     convert_VkCheckpointDataNV_array_host_to_win32(pCheckpointData_host, (VkCheckpointDataNV32 *)UlongToPtr(params->pCheckpointData), *(uint32_t *)UlongToPtr(params->pCheckpointDataCount));
@@ -68674,7 +68674,7 @@ static NTSTATUS thunk32_vkGetShaderModuleCreateInfoIdentifierEXT(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pCreateInfo, params->pIdentifier);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetShaderModuleCreateInfoIdentifierEXT);
     convert_VkShaderModuleCreateInfo_win32_to_host(ctx, (const VkShaderModuleCreateInfo32 *)UlongToPtr(params->pCreateInfo), &pCreateInfo_host);
     convert_VkShaderModuleIdentifierEXT_win32_to_host((VkShaderModuleIdentifierEXT32 *)UlongToPtr(params->pIdentifier), &pIdentifier_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetShaderModuleCreateInfoIdentifierEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pCreateInfo_host, &pIdentifier_host);
@@ -68833,7 +68833,7 @@ static NTSTATUS thunk32_vkGetTensorMemoryRequirementsARM(void *args)
 
     TRACE("%#x, %#x, %#x\n", params->device, params->pInfo, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetTensorMemoryRequirementsARM);
     convert_VkTensorMemoryRequirementsInfoARM_win32_to_host((const VkTensorMemoryRequirementsInfoARM32 *)UlongToPtr(params->pInfo), &pInfo_host);
     convert_VkMemoryRequirements2_win32_to_host(ctx, (VkMemoryRequirements232 *)UlongToPtr(params->pMemoryRequirements), &pMemoryRequirements_host);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetTensorMemoryRequirementsARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pInfo_host, &pMemoryRequirements_host);
@@ -68870,7 +68870,7 @@ static NTSTATUS thunk32_vkGetTensorOpaqueCaptureDataARM(void *args)
 
     TRACE("%#x, %u, %#x, %#x\n", params->device, params->tensorCount, params->pTensors, params->pDatas);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetTensorOpaqueCaptureDataARM);
     pDatas_host = convert_VkHostAddressRangeEXT_array_win32_to_host(ctx, (VkHostAddressRangeEXT32 *)UlongToPtr(params->pDatas), params->tensorCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetTensorOpaqueCaptureDataARM(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->tensorCount, (const VkTensorARM *)UlongToPtr(params->pTensors), pDatas_host);
     convert_VkHostAddressRangeEXT_array_host_to_win32(pDatas_host, (VkHostAddressRangeEXT32 *)UlongToPtr(params->pDatas), params->tensorCount);
@@ -68998,7 +68998,7 @@ static NTSTATUS thunk32_vkGetVideoSessionMemoryRequirementsKHR(void *args)
 
     TRACE("%#x, 0x%s, %#x, %#x\n", params->device, wine_dbgstr_longlong(params->videoSession), params->pMemoryRequirementsCount, params->pMemoryRequirements);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkGetVideoSessionMemoryRequirementsKHR);
     pMemoryRequirements_host = convert_VkVideoSessionMemoryRequirementsKHR_array_win32_to_host(ctx, (VkVideoSessionMemoryRequirementsKHR32 *)UlongToPtr(params->pMemoryRequirements), *(uint32_t *)UlongToPtr(params->pMemoryRequirementsCount));
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkGetVideoSessionMemoryRequirementsKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->videoSession, (uint32_t *)UlongToPtr(params->pMemoryRequirementsCount), pMemoryRequirements_host);
     convert_VkVideoSessionMemoryRequirementsKHR_array_host_to_win32(pMemoryRequirements_host, (VkVideoSessionMemoryRequirementsKHR32 *)UlongToPtr(params->pMemoryRequirements), *(uint32_t *)UlongToPtr(params->pMemoryRequirementsCount));
@@ -69103,7 +69103,7 @@ static NTSTATUS thunk64_vkInvalidateMappedMemoryRanges(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->memoryRangeCount, params->pMemoryRanges);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkInvalidateMappedMemoryRanges);
     pMemoryRanges_host = convert_VkMappedMemoryRange_array_win64_to_host(ctx, params->pMemoryRanges, params->memoryRangeCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkInvalidateMappedMemoryRanges(vulkan_device_from_handle(params->device)->host.device, params->memoryRangeCount, pMemoryRanges_host);
     free_conversion_context(ctx);
@@ -69126,7 +69126,7 @@ static NTSTATUS thunk32_vkInvalidateMappedMemoryRanges(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->memoryRangeCount, params->pMemoryRanges);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkInvalidateMappedMemoryRanges);
     pMemoryRanges_host = convert_VkMappedMemoryRange_array_win32_to_host(ctx, (const VkMappedMemoryRange32 *)UlongToPtr(params->pMemoryRanges), params->memoryRangeCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkInvalidateMappedMemoryRanges(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->memoryRangeCount, pMemoryRanges_host);
     free_conversion_context(ctx);
@@ -69363,7 +69363,7 @@ static NTSTATUS thunk64_vkQueueBindSparse(void *args)
 
     TRACE("%p, %u, %p, 0x%s\n", params->queue, params->bindInfoCount, params->pBindInfo, wine_dbgstr_longlong(params->fence));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueueBindSparse);
     pBindInfo_host = convert_VkBindSparseInfo_array_win64_to_host(ctx, params->pBindInfo, params->bindInfoCount);
     params->result = vulkan_queue_from_handle(params->queue)->device->p_vkQueueBindSparse(vulkan_queue_from_handle(params->queue)->host.queue, params->bindInfoCount, pBindInfo_host, params->fence ? vulkan_fence_from_handle(params->fence)->host.fence : 0);
     free_conversion_context(ctx);
@@ -69387,7 +69387,7 @@ static NTSTATUS thunk32_vkQueueBindSparse(void *args)
 
     TRACE("%#x, %u, %#x, 0x%s\n", params->queue, params->bindInfoCount, params->pBindInfo, wine_dbgstr_longlong(params->fence));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueueBindSparse);
     pBindInfo_host = convert_VkBindSparseInfo_array_win32_to_host(ctx, (const VkBindSparseInfo32 *)UlongToPtr(params->pBindInfo), params->bindInfoCount);
     params->result = vulkan_queue_from_handle((VkQueue)UlongToPtr(params->queue))->device->p_vkQueueBindSparse(vulkan_queue_from_handle((VkQueue)UlongToPtr(params->queue))->host.queue, params->bindInfoCount, pBindInfo_host, params->fence ? vulkan_fence_from_handle(params->fence)->host.fence : 0);
     free_conversion_context(ctx);
@@ -69485,7 +69485,7 @@ static NTSTATUS thunk64_vkQueuePresentKHR(void *args)
 
     TRACE("%p, %p\n", params->queue, params->pPresentInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueuePresentKHR);
     convert_VkPresentInfoKHR_win64_to_unwrapped_host(ctx, params->pPresentInfo, &pPresentInfo_host);
     params->result = vk_funcs->p_vkQueuePresentKHR(params->queue, &pPresentInfo_host);
     free_conversion_context(ctx);
@@ -69507,7 +69507,7 @@ static NTSTATUS thunk32_vkQueuePresentKHR(void *args)
 
     TRACE("%#x, %#x\n", params->queue, params->pPresentInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueuePresentKHR);
     convert_VkPresentInfoKHR_win32_to_unwrapped_host(ctx, (const VkPresentInfoKHR32 *)UlongToPtr(params->pPresentInfo), &pPresentInfo_host);
     params->result = vk_funcs->p_vkQueuePresentKHR((VkQueue)UlongToPtr(params->queue), &pPresentInfo_host);
     free_conversion_context(ctx);
@@ -69580,7 +69580,7 @@ static NTSTATUS thunk64_vkQueueSubmit(void *args)
 
     TRACE("%p, %u, %p, 0x%s\n", params->queue, params->submitCount, params->pSubmits, wine_dbgstr_longlong(params->fence));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueueSubmit);
     pSubmits_host = convert_VkSubmitInfo_array_win64_to_unwrapped_host(ctx, params->pSubmits, params->submitCount);
     params->result = vk_funcs->p_vkQueueSubmit(params->queue, params->submitCount, pSubmits_host, params->fence);
     free_conversion_context(ctx);
@@ -69604,7 +69604,7 @@ static NTSTATUS thunk32_vkQueueSubmit(void *args)
 
     TRACE("%#x, %u, %#x, 0x%s\n", params->queue, params->submitCount, params->pSubmits, wine_dbgstr_longlong(params->fence));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueueSubmit);
     pSubmits_host = convert_VkSubmitInfo_array_win32_to_unwrapped_host(ctx, (const VkSubmitInfo32 *)UlongToPtr(params->pSubmits), params->submitCount);
     params->result = vk_funcs->p_vkQueueSubmit((VkQueue)UlongToPtr(params->queue), params->submitCount, pSubmits_host, params->fence);
     free_conversion_context(ctx);
@@ -69621,7 +69621,7 @@ static NTSTATUS thunk64_vkQueueSubmit2(void *args)
 
     TRACE("%p, %u, %p, 0x%s\n", params->queue, params->submitCount, params->pSubmits, wine_dbgstr_longlong(params->fence));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueueSubmit2);
     pSubmits_host = convert_VkSubmitInfo2_array_win64_to_unwrapped_host(ctx, params->pSubmits, params->submitCount);
     params->result = vk_funcs->p_vkQueueSubmit2(params->queue, params->submitCount, pSubmits_host, params->fence);
     free_conversion_context(ctx);
@@ -69645,7 +69645,7 @@ static NTSTATUS thunk32_vkQueueSubmit2(void *args)
 
     TRACE("%#x, %u, %#x, 0x%s\n", params->queue, params->submitCount, params->pSubmits, wine_dbgstr_longlong(params->fence));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueueSubmit2);
     pSubmits_host = convert_VkSubmitInfo2_array_win32_to_unwrapped_host(ctx, (const VkSubmitInfo232 *)UlongToPtr(params->pSubmits), params->submitCount);
     params->result = vk_funcs->p_vkQueueSubmit2((VkQueue)UlongToPtr(params->queue), params->submitCount, pSubmits_host, params->fence);
     free_conversion_context(ctx);
@@ -69662,7 +69662,7 @@ static NTSTATUS thunk64_vkQueueSubmit2KHR(void *args)
 
     TRACE("%p, %u, %p, 0x%s\n", params->queue, params->submitCount, params->pSubmits, wine_dbgstr_longlong(params->fence));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueueSubmit2KHR);
     pSubmits_host = convert_VkSubmitInfo2_array_win64_to_unwrapped_host(ctx, params->pSubmits, params->submitCount);
     params->result = vk_funcs->p_vkQueueSubmit2KHR(params->queue, params->submitCount, pSubmits_host, params->fence);
     free_conversion_context(ctx);
@@ -69686,7 +69686,7 @@ static NTSTATUS thunk32_vkQueueSubmit2KHR(void *args)
 
     TRACE("%#x, %u, %#x, 0x%s\n", params->queue, params->submitCount, params->pSubmits, wine_dbgstr_longlong(params->fence));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkQueueSubmit2KHR);
     pSubmits_host = convert_VkSubmitInfo2_array_win32_to_unwrapped_host(ctx, (const VkSubmitInfo232 *)UlongToPtr(params->pSubmits), params->submitCount);
     params->result = vk_funcs->p_vkQueueSubmit2KHR((VkQueue)UlongToPtr(params->queue), params->submitCount, pSubmits_host, params->fence);
     free_conversion_context(ctx);
@@ -70014,7 +70014,7 @@ static NTSTATUS thunk64_vkResetFences(void *args)
 
     TRACE("%p, %u, %p\n", params->device, params->fenceCount, params->pFences);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkResetFences);
     pFences_host = convert_VkFence_array_win64_to_host(ctx, params->pFences, params->fenceCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkResetFences(vulkan_device_from_handle(params->device)->host.device, params->fenceCount, pFences_host);
     free_conversion_context(ctx);
@@ -70037,7 +70037,7 @@ static NTSTATUS thunk32_vkResetFences(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->fenceCount, params->pFences);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkResetFences);
     pFences_host = convert_VkFence_array_win32_to_host(ctx, (const VkFence *)UlongToPtr(params->pFences), params->fenceCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkResetFences(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->fenceCount, pFences_host);
     free_conversion_context(ctx);
@@ -70283,7 +70283,7 @@ static NTSTATUS thunk64_vkSetHdrMetadataEXT(void *args)
 
     TRACE("%p, %u, %p, %p\n", params->device, params->swapchainCount, params->pSwapchains, params->pMetadata);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkSetHdrMetadataEXT);
     pSwapchains_host = convert_VkSwapchainKHR_array_win64_to_host(ctx, params->pSwapchains, params->swapchainCount);
     vulkan_device_from_handle(params->device)->p_vkSetHdrMetadataEXT(vulkan_device_from_handle(params->device)->host.device, params->swapchainCount, pSwapchains_host, params->pMetadata);
     free_conversion_context(ctx);
@@ -70307,7 +70307,7 @@ static NTSTATUS thunk32_vkSetHdrMetadataEXT(void *args)
 
     TRACE("%#x, %u, %#x, %#x\n", params->device, params->swapchainCount, params->pSwapchains, params->pMetadata);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkSetHdrMetadataEXT);
     pSwapchains_host = convert_VkSwapchainKHR_array_win32_to_host(ctx, (const VkSwapchainKHR *)UlongToPtr(params->pSwapchains), params->swapchainCount);
     pMetadata_host = convert_VkHdrMetadataEXT_array_win32_to_host(ctx, (const VkHdrMetadataEXT32 *)UlongToPtr(params->pMetadata), params->swapchainCount);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkSetHdrMetadataEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->swapchainCount, pSwapchains_host, pMetadata_host);
@@ -70534,7 +70534,7 @@ static NTSTATUS thunk64_vkSubmitDebugUtilsMessageEXT(void *args)
 
     TRACE("%p, %#x, %#x, %p\n", params->instance, params->messageSeverity, params->messageTypes, params->pCallbackData);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkSubmitDebugUtilsMessageEXT);
     convert_VkDebugUtilsMessengerCallbackDataEXT_win64_to_host(ctx, params->pCallbackData, &pCallbackData_host);
     vulkan_instance_from_handle(params->instance)->p_vkSubmitDebugUtilsMessageEXT(vulkan_instance_from_handle(params->instance)->host.instance, params->messageSeverity, params->messageTypes, &pCallbackData_host);
     free_conversion_context(ctx);
@@ -70557,7 +70557,7 @@ static NTSTATUS thunk32_vkSubmitDebugUtilsMessageEXT(void *args)
 
     TRACE("%#x, %#x, %#x, %#x\n", params->instance, params->messageSeverity, params->messageTypes, params->pCallbackData);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkSubmitDebugUtilsMessageEXT);
     convert_VkDebugUtilsMessengerCallbackDataEXT_win32_to_host(ctx, (const VkDebugUtilsMessengerCallbackDataEXT32 *)UlongToPtr(params->pCallbackData), &pCallbackData_host);
     vulkan_instance_from_handle((VkInstance)UlongToPtr(params->instance))->p_vkSubmitDebugUtilsMessageEXT(vulkan_instance_from_handle((VkInstance)UlongToPtr(params->instance))->host.instance, params->messageSeverity, params->messageTypes, &pCallbackData_host);
     free_conversion_context(ctx);
@@ -70591,7 +70591,7 @@ static NTSTATUS thunk32_vkTransitionImageLayout(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->transitionCount, params->pTransitions);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkTransitionImageLayout);
     pTransitions_host = convert_VkHostImageLayoutTransitionInfo_array_win32_to_host(ctx, (const VkHostImageLayoutTransitionInfo32 *)UlongToPtr(params->pTransitions), params->transitionCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkTransitionImageLayout(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->transitionCount, pTransitions_host);
     free_conversion_context(ctx);
@@ -70625,7 +70625,7 @@ static NTSTATUS thunk32_vkTransitionImageLayoutEXT(void *args)
 
     TRACE("%#x, %u, %#x\n", params->device, params->transitionCount, params->pTransitions);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkTransitionImageLayoutEXT);
     pTransitions_host = convert_VkHostImageLayoutTransitionInfo_array_win32_to_host(ctx, (const VkHostImageLayoutTransitionInfo32 *)UlongToPtr(params->pTransitions), params->transitionCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkTransitionImageLayoutEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->transitionCount, pTransitions_host);
     free_conversion_context(ctx);
@@ -70897,7 +70897,7 @@ static void thunk32_vkUpdateDescriptorSets(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkUpdateDescriptorSets);
     pDescriptorWrites_host = convert_VkWriteDescriptorSet_array_win32_to_host(ctx, (const VkWriteDescriptorSet32 *)UlongToPtr(params->pDescriptorWrites), params->descriptorWriteCount);
     pDescriptorCopies_host = convert_VkCopyDescriptorSet_array_win32_to_host(ctx, (const VkCopyDescriptorSet32 *)UlongToPtr(params->pDescriptorCopies), params->descriptorCopyCount);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkUpdateDescriptorSets(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->descriptorWriteCount, pDescriptorWrites_host, params->descriptorCopyCount, pDescriptorCopies_host);
@@ -70931,7 +70931,7 @@ static NTSTATUS thunk32_vkUpdateIndirectExecutionSetPipelineEXT(void *args)
 
     TRACE("%#x, 0x%s, %u, %#x\n", params->device, wine_dbgstr_longlong(params->indirectExecutionSet), params->executionSetWriteCount, params->pExecutionSetWrites);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkUpdateIndirectExecutionSetPipelineEXT);
     pExecutionSetWrites_host = convert_VkWriteIndirectExecutionSetPipelineEXT_array_win32_to_host(ctx, (const VkWriteIndirectExecutionSetPipelineEXT32 *)UlongToPtr(params->pExecutionSetWrites), params->executionSetWriteCount);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkUpdateIndirectExecutionSetPipelineEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->indirectExecutionSet, params->executionSetWriteCount, pExecutionSetWrites_host);
     free_conversion_context(ctx);
@@ -70965,7 +70965,7 @@ static NTSTATUS thunk32_vkUpdateIndirectExecutionSetShaderEXT(void *args)
 
     TRACE("%#x, 0x%s, %u, %#x\n", params->device, wine_dbgstr_longlong(params->indirectExecutionSet), params->executionSetWriteCount, params->pExecutionSetWrites);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkUpdateIndirectExecutionSetShaderEXT);
     pExecutionSetWrites_host = convert_VkWriteIndirectExecutionSetShaderEXT_array_win32_to_host(ctx, (const VkWriteIndirectExecutionSetShaderEXT32 *)UlongToPtr(params->pExecutionSetWrites), params->executionSetWriteCount);
     vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkUpdateIndirectExecutionSetShaderEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->indirectExecutionSet, params->executionSetWriteCount, pExecutionSetWrites_host);
     free_conversion_context(ctx);
@@ -70999,7 +70999,7 @@ static NTSTATUS thunk32_vkUpdateVideoSessionParametersKHR(void *args)
 
     TRACE("%#x, 0x%s, %#x\n", params->device, wine_dbgstr_longlong(params->videoSessionParameters), params->pUpdateInfo);
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkUpdateVideoSessionParametersKHR);
     convert_VkVideoSessionParametersUpdateInfoKHR_win32_to_host(ctx, (const VkVideoSessionParametersUpdateInfoKHR32 *)UlongToPtr(params->pUpdateInfo), &pUpdateInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkUpdateVideoSessionParametersKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->videoSessionParameters, &pUpdateInfo_host);
     free_conversion_context(ctx);
@@ -71016,7 +71016,7 @@ static NTSTATUS thunk64_vkWaitForFences(void *args)
 
     TRACE("%p, %u, %p, %u, 0x%s\n", params->device, params->fenceCount, params->pFences, params->waitAll, wine_dbgstr_longlong(params->timeout));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkWaitForFences);
     pFences_host = convert_VkFence_array_win64_to_host(ctx, params->pFences, params->fenceCount);
     params->result = vulkan_device_from_handle(params->device)->p_vkWaitForFences(vulkan_device_from_handle(params->device)->host.device, params->fenceCount, pFences_host, params->waitAll, params->timeout);
     free_conversion_context(ctx);
@@ -71041,7 +71041,7 @@ static NTSTATUS thunk32_vkWaitForFences(void *args)
 
     TRACE("%#x, %u, %#x, %u, 0x%s\n", params->device, params->fenceCount, params->pFences, params->waitAll, wine_dbgstr_longlong(params->timeout));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkWaitForFences);
     pFences_host = convert_VkFence_array_win32_to_host(ctx, (const VkFence *)UlongToPtr(params->pFences), params->fenceCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkWaitForFences(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->fenceCount, pFences_host, params->waitAll, params->timeout);
     free_conversion_context(ctx);
@@ -71117,7 +71117,7 @@ static NTSTATUS thunk64_vkWaitSemaphores(void *args)
 
     TRACE("%p, %p, 0x%s\n", params->device, params->pWaitInfo, wine_dbgstr_longlong(params->timeout));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkWaitSemaphores);
     convert_VkSemaphoreWaitInfo_win64_to_host(ctx, params->pWaitInfo, &pWaitInfo_host);
     params->result = vulkan_device_from_handle(params->device)->p_vkWaitSemaphores(vulkan_device_from_handle(params->device)->host.device, &pWaitInfo_host, params->timeout);
     free_conversion_context(ctx);
@@ -71140,7 +71140,7 @@ static NTSTATUS thunk32_vkWaitSemaphores(void *args)
 
     TRACE("%#x, %#x, 0x%s\n", params->device, params->pWaitInfo, wine_dbgstr_longlong(params->timeout));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkWaitSemaphores);
     convert_VkSemaphoreWaitInfo_win32_to_host(ctx, (const VkSemaphoreWaitInfo32 *)UlongToPtr(params->pWaitInfo), &pWaitInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkWaitSemaphores(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pWaitInfo_host, params->timeout);
     free_conversion_context(ctx);
@@ -71157,7 +71157,7 @@ static NTSTATUS thunk64_vkWaitSemaphoresKHR(void *args)
 
     TRACE("%p, %p, 0x%s\n", params->device, params->pWaitInfo, wine_dbgstr_longlong(params->timeout));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkWaitSemaphoresKHR);
     convert_VkSemaphoreWaitInfo_win64_to_host(ctx, params->pWaitInfo, &pWaitInfo_host);
     params->result = vulkan_device_from_handle(params->device)->p_vkWaitSemaphoresKHR(vulkan_device_from_handle(params->device)->host.device, &pWaitInfo_host, params->timeout);
     free_conversion_context(ctx);
@@ -71180,7 +71180,7 @@ static NTSTATUS thunk32_vkWaitSemaphoresKHR(void *args)
 
     TRACE("%#x, %#x, 0x%s\n", params->device, params->pWaitInfo, wine_dbgstr_longlong(params->timeout));
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkWaitSemaphoresKHR);
     convert_VkSemaphoreWaitInfo_win32_to_host(ctx, (const VkSemaphoreWaitInfo32 *)UlongToPtr(params->pWaitInfo), &pWaitInfo_host);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkWaitSemaphoresKHR(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, &pWaitInfo_host, params->timeout);
     free_conversion_context(ctx);
@@ -71275,7 +71275,7 @@ static void thunk32_vkWriteResourceDescriptorsEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkWriteResourceDescriptorsEXT);
     pResources_host = convert_VkResourceDescriptorInfoEXT_array_win32_to_host(ctx, (const VkResourceDescriptorInfoEXT32 *)UlongToPtr(params->pResources), params->resourceCount);
     pDescriptors_host = convert_VkHostAddressRangeEXT_array_win32_to_host(ctx, (const VkHostAddressRangeEXT32 *)UlongToPtr(params->pDescriptors), params->resourceCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkWriteResourceDescriptorsEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->resourceCount, pResources_host, pDescriptors_host);
@@ -71306,7 +71306,7 @@ static void thunk32_vkWriteSamplerDescriptorsEXT(void *args)
     struct conversion_context local_ctx;
     struct conversion_context *ctx = &local_ctx;
 
-    init_conversion_context(ctx);
+    init_conversion_context(ctx, unix_vkWriteSamplerDescriptorsEXT);
     pSamplers_host = convert_VkSamplerCreateInfo_array_win32_to_host(ctx, (const VkSamplerCreateInfo32 *)UlongToPtr(params->pSamplers), params->samplerCount);
     pDescriptors_host = convert_VkHostAddressRangeEXT_array_win32_to_host(ctx, (const VkHostAddressRangeEXT32 *)UlongToPtr(params->pDescriptors), params->samplerCount);
     params->result = vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->p_vkWriteSamplerDescriptorsEXT(vulkan_device_from_handle((VkDevice)UlongToPtr(params->device))->host.device, params->samplerCount, pSamplers_host, pDescriptors_host);
@@ -71339,6 +71339,7 @@ const unixlib_entry_t __wine_unix_call_funcs[] =
     init_vulkan,
     vk_is_available_instance_function,
     vk_is_available_device_function,
+    vk_execute_command_stream,
     thunk64_vkAcquireNextImage2KHR,
     thunk64_vkAcquireNextImageKHR,
     thunk64_vkAcquirePerformanceConfigurationINTEL,
@@ -72088,6 +72089,7 @@ const unixlib_entry_t __wine_unix_call_funcs[] =
     wow64_init_vulkan,
     vk_is_available_instance_function32,
     vk_is_available_device_function32,
+    vk_execute_command_stream32,
     thunk32_vkAcquireNextImage2KHR,
     thunk32_vkAcquireNextImageKHR,
     thunk32_vkAcquirePerformanceConfigurationINTEL,
@@ -72825,3 +72827,747 @@ const unixlib_entry_t __wine_unix_call_funcs[] =
     (void *)thunk32_vkWriteSamplerDescriptorsEXT,
 };
 C_ASSERT(ARRAYSIZE(__wine_unix_call_funcs) == unix_count);
+
+const char * const vk_unix_call_names[] =
+{
+    "init",
+    "is_available_instance_function",
+    "is_available_device_function",
+    "execute_command_stream",
+    "vkAcquireNextImage2KHR",
+    "vkAcquireNextImageKHR",
+    "vkAcquirePerformanceConfigurationINTEL",
+    "vkAcquireProfilingLockKHR",
+    "vkAllocateCommandBuffers",
+    "vkAllocateDescriptorSets",
+    "vkAllocateMemory",
+    "vkAntiLagUpdateAMD",
+    "vkBeginCommandBuffer",
+    "vkBindAccelerationStructureMemoryNV",
+    "vkBindBufferMemory",
+    "vkBindBufferMemory2",
+    "vkBindBufferMemory2KHR",
+    "vkBindDataGraphPipelineSessionMemoryARM",
+    "vkBindImageMemory",
+    "vkBindImageMemory2",
+    "vkBindImageMemory2KHR",
+    "vkBindOpticalFlowSessionImageNV",
+    "vkBindTensorMemoryARM",
+    "vkBindVideoSessionMemoryKHR",
+    "vkBuildAccelerationStructuresKHR",
+    "vkBuildMicromapsEXT",
+    "vkClearShaderInstrumentationMetricsARM",
+    "vkCmdBeginConditionalRendering2EXT",
+    "vkCmdBeginConditionalRenderingEXT",
+    "vkCmdBeginCustomResolveEXT",
+    "vkCmdBeginDebugUtilsLabelEXT",
+    "vkCmdBeginGpaSampleAMD",
+    "vkCmdBeginGpaSessionAMD",
+    "vkCmdBeginPerTileExecutionQCOM",
+    "vkCmdBeginQuery",
+    "vkCmdBeginQueryIndexedEXT",
+    "vkCmdBeginRenderPass",
+    "vkCmdBeginRenderPass2",
+    "vkCmdBeginRenderPass2KHR",
+    "vkCmdBeginRendering",
+    "vkCmdBeginRenderingKHR",
+    "vkCmdBeginShaderInstrumentationARM",
+    "vkCmdBeginTransformFeedback2EXT",
+    "vkCmdBeginTransformFeedbackEXT",
+    "vkCmdBeginVideoCodingKHR",
+    "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT",
+    "vkCmdBindDescriptorBufferEmbeddedSamplersEXT",
+    "vkCmdBindDescriptorBuffersEXT",
+    "vkCmdBindDescriptorSets",
+    "vkCmdBindDescriptorSets2",
+    "vkCmdBindDescriptorSets2KHR",
+    "vkCmdBindIndexBuffer",
+    "vkCmdBindIndexBuffer2",
+    "vkCmdBindIndexBuffer2KHR",
+    "vkCmdBindIndexBuffer3KHR",
+    "vkCmdBindInvocationMaskHUAWEI",
+    "vkCmdBindPipeline",
+    "vkCmdBindPipelineShaderGroupNV",
+    "vkCmdBindResourceHeapEXT",
+    "vkCmdBindSamplerHeapEXT",
+    "vkCmdBindShadersEXT",
+    "vkCmdBindShadingRateImageNV",
+    "vkCmdBindTileMemoryQCOM",
+    "vkCmdBindTransformFeedbackBuffers2EXT",
+    "vkCmdBindTransformFeedbackBuffersEXT",
+    "vkCmdBindVertexBuffers",
+    "vkCmdBindVertexBuffers2",
+    "vkCmdBindVertexBuffers2EXT",
+    "vkCmdBindVertexBuffers3KHR",
+    "vkCmdBlitImage",
+    "vkCmdBlitImage2",
+    "vkCmdBlitImage2KHR",
+    "vkCmdBuildAccelerationStructureNV",
+    "vkCmdBuildAccelerationStructuresIndirectKHR",
+    "vkCmdBuildAccelerationStructuresKHR",
+    "vkCmdBuildClusterAccelerationStructureIndirectNV",
+    "vkCmdBuildMicromapsEXT",
+    "vkCmdBuildPartitionedAccelerationStructuresNV",
+    "vkCmdClearAttachments",
+    "vkCmdClearColorImage",
+    "vkCmdClearDepthStencilImage",
+    "vkCmdControlVideoCodingKHR",
+    "vkCmdConvertCooperativeVectorMatrixNV",
+    "vkCmdCopyAccelerationStructureKHR",
+    "vkCmdCopyAccelerationStructureNV",
+    "vkCmdCopyAccelerationStructureToMemoryKHR",
+    "vkCmdCopyBuffer",
+    "vkCmdCopyBuffer2",
+    "vkCmdCopyBuffer2KHR",
+    "vkCmdCopyBufferToImage",
+    "vkCmdCopyBufferToImage2",
+    "vkCmdCopyBufferToImage2KHR",
+    "vkCmdCopyGpaSessionResultsAMD",
+    "vkCmdCopyImage",
+    "vkCmdCopyImage2",
+    "vkCmdCopyImage2KHR",
+    "vkCmdCopyImageToBuffer",
+    "vkCmdCopyImageToBuffer2",
+    "vkCmdCopyImageToBuffer2KHR",
+    "vkCmdCopyImageToMemoryKHR",
+    "vkCmdCopyMemoryIndirectKHR",
+    "vkCmdCopyMemoryIndirectNV",
+    "vkCmdCopyMemoryKHR",
+    "vkCmdCopyMemoryToAccelerationStructureKHR",
+    "vkCmdCopyMemoryToImageIndirectKHR",
+    "vkCmdCopyMemoryToImageIndirectNV",
+    "vkCmdCopyMemoryToImageKHR",
+    "vkCmdCopyMemoryToMicromapEXT",
+    "vkCmdCopyMicromapEXT",
+    "vkCmdCopyMicromapToMemoryEXT",
+    "vkCmdCopyQueryPoolResults",
+    "vkCmdCopyQueryPoolResultsToMemoryKHR",
+    "vkCmdCopyTensorARM",
+    "vkCmdCuLaunchKernelNVX",
+    "vkCmdDebugMarkerBeginEXT",
+    "vkCmdDebugMarkerEndEXT",
+    "vkCmdDebugMarkerInsertEXT",
+    "vkCmdDecodeVideoKHR",
+    "vkCmdDecompressMemoryEXT",
+    "vkCmdDecompressMemoryIndirectCountEXT",
+    "vkCmdDecompressMemoryIndirectCountNV",
+    "vkCmdDecompressMemoryNV",
+    "vkCmdDispatch",
+    "vkCmdDispatchBase",
+    "vkCmdDispatchBaseKHR",
+    "vkCmdDispatchDataGraphARM",
+    "vkCmdDispatchIndirect",
+    "vkCmdDispatchIndirect2KHR",
+    "vkCmdDispatchTileQCOM",
+    "vkCmdDraw",
+    "vkCmdDrawClusterHUAWEI",
+    "vkCmdDrawClusterIndirectHUAWEI",
+    "vkCmdDrawIndexed",
+    "vkCmdDrawIndexedIndirect",
+    "vkCmdDrawIndexedIndirect2KHR",
+    "vkCmdDrawIndexedIndirectCount",
+    "vkCmdDrawIndexedIndirectCount2KHR",
+    "vkCmdDrawIndexedIndirectCountAMD",
+    "vkCmdDrawIndexedIndirectCountKHR",
+    "vkCmdDrawIndirect",
+    "vkCmdDrawIndirect2KHR",
+    "vkCmdDrawIndirectByteCount2EXT",
+    "vkCmdDrawIndirectByteCountEXT",
+    "vkCmdDrawIndirectCount",
+    "vkCmdDrawIndirectCount2KHR",
+    "vkCmdDrawIndirectCountAMD",
+    "vkCmdDrawIndirectCountKHR",
+    "vkCmdDrawMeshTasksEXT",
+    "vkCmdDrawMeshTasksIndirect2EXT",
+    "vkCmdDrawMeshTasksIndirectCount2EXT",
+    "vkCmdDrawMeshTasksIndirectCountEXT",
+    "vkCmdDrawMeshTasksIndirectCountNV",
+    "vkCmdDrawMeshTasksIndirectEXT",
+    "vkCmdDrawMeshTasksIndirectNV",
+    "vkCmdDrawMeshTasksNV",
+    "vkCmdDrawMultiEXT",
+    "vkCmdDrawMultiIndexedEXT",
+    "vkCmdEncodeVideoKHR",
+    "vkCmdEndConditionalRenderingEXT",
+    "vkCmdEndDebugUtilsLabelEXT",
+    "vkCmdEndGpaSampleAMD",
+    "vkCmdEndGpaSessionAMD",
+    "vkCmdEndPerTileExecutionQCOM",
+    "vkCmdEndQuery",
+    "vkCmdEndQueryIndexedEXT",
+    "vkCmdEndRenderPass",
+    "vkCmdEndRenderPass2",
+    "vkCmdEndRenderPass2KHR",
+    "vkCmdEndRendering",
+    "vkCmdEndRendering2EXT",
+    "vkCmdEndRendering2KHR",
+    "vkCmdEndRenderingKHR",
+    "vkCmdEndShaderInstrumentationARM",
+    "vkCmdEndTransformFeedback2EXT",
+    "vkCmdEndTransformFeedbackEXT",
+    "vkCmdEndVideoCodingKHR",
+    "vkCmdExecuteCommands",
+    "vkCmdExecuteGeneratedCommandsEXT",
+    "vkCmdExecuteGeneratedCommandsNV",
+    "vkCmdFillBuffer",
+    "vkCmdFillMemoryKHR",
+    "vkCmdInsertDebugUtilsLabelEXT",
+    "vkCmdNextSubpass",
+    "vkCmdNextSubpass2",
+    "vkCmdNextSubpass2KHR",
+    "vkCmdOpticalFlowExecuteNV",
+    "vkCmdPipelineBarrier",
+    "vkCmdPipelineBarrier2",
+    "vkCmdPipelineBarrier2KHR",
+    "vkCmdPreprocessGeneratedCommandsEXT",
+    "vkCmdPreprocessGeneratedCommandsNV",
+    "vkCmdPushConstants",
+    "vkCmdPushConstants2",
+    "vkCmdPushConstants2KHR",
+    "vkCmdPushDataEXT",
+    "vkCmdPushDescriptorSet",
+    "vkCmdPushDescriptorSet2",
+    "vkCmdPushDescriptorSet2KHR",
+    "vkCmdPushDescriptorSetKHR",
+    "vkCmdPushDescriptorSetWithTemplate",
+    "vkCmdPushDescriptorSetWithTemplate2",
+    "vkCmdPushDescriptorSetWithTemplate2KHR",
+    "vkCmdPushDescriptorSetWithTemplateKHR",
+    "vkCmdResetEvent",
+    "vkCmdResetEvent2",
+    "vkCmdResetEvent2KHR",
+    "vkCmdResetQueryPool",
+    "vkCmdResolveImage",
+    "vkCmdResolveImage2",
+    "vkCmdResolveImage2KHR",
+    "vkCmdSetAlphaToCoverageEnableEXT",
+    "vkCmdSetAlphaToOneEnableEXT",
+    "vkCmdSetAttachmentFeedbackLoopEnableEXT",
+    "vkCmdSetBlendConstants",
+    "vkCmdSetCheckpointNV",
+    "vkCmdSetCoarseSampleOrderNV",
+    "vkCmdSetColorBlendAdvancedEXT",
+    "vkCmdSetColorBlendEnableEXT",
+    "vkCmdSetColorBlendEquationEXT",
+    "vkCmdSetColorWriteEnableEXT",
+    "vkCmdSetColorWriteMaskEXT",
+    "vkCmdSetComputeOccupancyPriorityNV",
+    "vkCmdSetConservativeRasterizationModeEXT",
+    "vkCmdSetCoverageModulationModeNV",
+    "vkCmdSetCoverageModulationTableEnableNV",
+    "vkCmdSetCoverageModulationTableNV",
+    "vkCmdSetCoverageReductionModeNV",
+    "vkCmdSetCoverageToColorEnableNV",
+    "vkCmdSetCoverageToColorLocationNV",
+    "vkCmdSetCullMode",
+    "vkCmdSetCullModeEXT",
+    "vkCmdSetDepthBias",
+    "vkCmdSetDepthBias2EXT",
+    "vkCmdSetDepthBiasEnable",
+    "vkCmdSetDepthBiasEnableEXT",
+    "vkCmdSetDepthBounds",
+    "vkCmdSetDepthBoundsTestEnable",
+    "vkCmdSetDepthBoundsTestEnableEXT",
+    "vkCmdSetDepthClampEnableEXT",
+    "vkCmdSetDepthClampRangeEXT",
+    "vkCmdSetDepthClipEnableEXT",
+    "vkCmdSetDepthClipNegativeOneToOneEXT",
+    "vkCmdSetDepthCompareOp",
+    "vkCmdSetDepthCompareOpEXT",
+    "vkCmdSetDepthTestEnable",
+    "vkCmdSetDepthTestEnableEXT",
+    "vkCmdSetDepthWriteEnable",
+    "vkCmdSetDepthWriteEnableEXT",
+    "vkCmdSetDescriptorBufferOffsets2EXT",
+    "vkCmdSetDescriptorBufferOffsetsEXT",
+    "vkCmdSetDeviceMask",
+    "vkCmdSetDeviceMaskKHR",
+    "vkCmdSetDiscardRectangleEXT",
+    "vkCmdSetDiscardRectangleEnableEXT",
+    "vkCmdSetDiscardRectangleModeEXT",
+    "vkCmdSetDispatchParametersARM",
+    "vkCmdSetEvent",
+    "vkCmdSetEvent2",
+    "vkCmdSetEvent2KHR",
+    "vkCmdSetExclusiveScissorEnableNV",
+    "vkCmdSetExclusiveScissorNV",
+    "vkCmdSetExtraPrimitiveOverestimationSizeEXT",
+    "vkCmdSetFragmentShadingRateEnumNV",
+    "vkCmdSetFragmentShadingRateKHR",
+    "vkCmdSetFrontFace",
+    "vkCmdSetFrontFaceEXT",
+    "vkCmdSetLineRasterizationModeEXT",
+    "vkCmdSetLineStipple",
+    "vkCmdSetLineStippleEXT",
+    "vkCmdSetLineStippleEnableEXT",
+    "vkCmdSetLineStippleKHR",
+    "vkCmdSetLineWidth",
+    "vkCmdSetLogicOpEXT",
+    "vkCmdSetLogicOpEnableEXT",
+    "vkCmdSetPatchControlPointsEXT",
+    "vkCmdSetPerformanceMarkerINTEL",
+    "vkCmdSetPerformanceOverrideINTEL",
+    "vkCmdSetPerformanceStreamMarkerINTEL",
+    "vkCmdSetPolygonModeEXT",
+    "vkCmdSetPrimitiveRestartEnable",
+    "vkCmdSetPrimitiveRestartEnableEXT",
+    "vkCmdSetPrimitiveRestartIndexEXT",
+    "vkCmdSetPrimitiveTopology",
+    "vkCmdSetPrimitiveTopologyEXT",
+    "vkCmdSetProvokingVertexModeEXT",
+    "vkCmdSetRasterizationSamplesEXT",
+    "vkCmdSetRasterizationStreamEXT",
+    "vkCmdSetRasterizerDiscardEnable",
+    "vkCmdSetRasterizerDiscardEnableEXT",
+    "vkCmdSetRayTracingPipelineStackSizeKHR",
+    "vkCmdSetRenderingAttachmentLocations",
+    "vkCmdSetRenderingAttachmentLocationsKHR",
+    "vkCmdSetRenderingInputAttachmentIndices",
+    "vkCmdSetRenderingInputAttachmentIndicesKHR",
+    "vkCmdSetRepresentativeFragmentTestEnableNV",
+    "vkCmdSetSampleLocationsEXT",
+    "vkCmdSetSampleLocationsEnableEXT",
+    "vkCmdSetSampleMaskEXT",
+    "vkCmdSetScissor",
+    "vkCmdSetScissorWithCount",
+    "vkCmdSetScissorWithCountEXT",
+    "vkCmdSetShadingRateImageEnableNV",
+    "vkCmdSetStencilCompareMask",
+    "vkCmdSetStencilOp",
+    "vkCmdSetStencilOpEXT",
+    "vkCmdSetStencilReference",
+    "vkCmdSetStencilTestEnable",
+    "vkCmdSetStencilTestEnableEXT",
+    "vkCmdSetStencilWriteMask",
+    "vkCmdSetTessellationDomainOriginEXT",
+    "vkCmdSetVertexInputEXT",
+    "vkCmdSetViewport",
+    "vkCmdSetViewportShadingRatePaletteNV",
+    "vkCmdSetViewportSwizzleNV",
+    "vkCmdSetViewportWScalingEnableNV",
+    "vkCmdSetViewportWScalingNV",
+    "vkCmdSetViewportWithCount",
+    "vkCmdSetViewportWithCountEXT",
+    "vkCmdSubpassShadingHUAWEI",
+    "vkCmdTraceRaysIndirect2KHR",
+    "vkCmdTraceRaysIndirectKHR",
+    "vkCmdTraceRaysKHR",
+    "vkCmdTraceRaysNV",
+    "vkCmdUpdateBuffer",
+    "vkCmdUpdateMemoryKHR",
+    "vkCmdUpdatePipelineIndirectBufferNV",
+    "vkCmdWaitEvents",
+    "vkCmdWaitEvents2",
+    "vkCmdWaitEvents2KHR",
+    "vkCmdWriteAccelerationStructuresPropertiesKHR",
+    "vkCmdWriteAccelerationStructuresPropertiesNV",
+    "vkCmdWriteBufferMarker2AMD",
+    "vkCmdWriteBufferMarkerAMD",
+    "vkCmdWriteMarkerToMemoryAMD",
+    "vkCmdWriteMicromapsPropertiesEXT",
+    "vkCmdWriteTimestamp",
+    "vkCmdWriteTimestamp2",
+    "vkCmdWriteTimestamp2KHR",
+    "vkCompileDeferredNV",
+    "vkConvertCooperativeVectorMatrixNV",
+    "vkCopyAccelerationStructureKHR",
+    "vkCopyAccelerationStructureToMemoryKHR",
+    "vkCopyImageToImage",
+    "vkCopyImageToImageEXT",
+    "vkCopyImageToMemory",
+    "vkCopyImageToMemoryEXT",
+    "vkCopyMemoryToAccelerationStructureKHR",
+    "vkCopyMemoryToImage",
+    "vkCopyMemoryToImageEXT",
+    "vkCopyMemoryToMicromapEXT",
+    "vkCopyMicromapEXT",
+    "vkCopyMicromapToMemoryEXT",
+    "vkCreateAccelerationStructure2KHR",
+    "vkCreateAccelerationStructureKHR",
+    "vkCreateAccelerationStructureNV",
+    "vkCreateBuffer",
+    "vkCreateBufferView",
+    "vkCreateCommandPool",
+    "vkCreateComputePipelines",
+    "vkCreateCuFunctionNVX",
+    "vkCreateCuModuleNVX",
+    "vkCreateDataGraphPipelineSessionARM",
+    "vkCreateDataGraphPipelinesARM",
+    "vkCreateDebugReportCallbackEXT",
+    "vkCreateDebugUtilsMessengerEXT",
+    "vkCreateDeferredOperationKHR",
+    "vkCreateDescriptorPool",
+    "vkCreateDescriptorSetLayout",
+    "vkCreateDescriptorUpdateTemplate",
+    "vkCreateDescriptorUpdateTemplateKHR",
+    "vkCreateDevice",
+    "vkCreateEvent",
+    "vkCreateFence",
+    "vkCreateFramebuffer",
+    "vkCreateGpaSessionAMD",
+    "vkCreateGraphicsPipelines",
+    "vkCreateImage",
+    "vkCreateImageView",
+    "vkCreateIndirectCommandsLayoutEXT",
+    "vkCreateIndirectCommandsLayoutNV",
+    "vkCreateIndirectExecutionSetEXT",
+    "vkCreateInstance",
+    "vkCreateMicromapEXT",
+    "vkCreateOpticalFlowSessionNV",
+    "vkCreatePipelineBinariesKHR",
+    "vkCreatePipelineCache",
+    "vkCreatePipelineLayout",
+    "vkCreatePrivateDataSlot",
+    "vkCreatePrivateDataSlotEXT",
+    "vkCreateQueryPool",
+    "vkCreateRayTracingPipelinesKHR",
+    "vkCreateRayTracingPipelinesNV",
+    "vkCreateRenderPass",
+    "vkCreateRenderPass2",
+    "vkCreateRenderPass2KHR",
+    "vkCreateSampler",
+    "vkCreateSamplerYcbcrConversion",
+    "vkCreateSamplerYcbcrConversionKHR",
+    "vkCreateSemaphore",
+    "vkCreateShaderInstrumentationARM",
+    "vkCreateShaderModule",
+    "vkCreateShadersEXT",
+    "vkCreateSwapchainKHR",
+    "vkCreateTensorARM",
+    "vkCreateTensorViewARM",
+    "vkCreateValidationCacheEXT",
+    "vkCreateVideoSessionKHR",
+    "vkCreateVideoSessionParametersKHR",
+    "vkCreateWin32SurfaceKHR",
+    "vkDebugMarkerSetObjectNameEXT",
+    "vkDebugMarkerSetObjectTagEXT",
+    "vkDebugReportMessageEXT",
+    "vkDeferredOperationJoinKHR",
+    "vkDestroyAccelerationStructureKHR",
+    "vkDestroyAccelerationStructureNV",
+    "vkDestroyBuffer",
+    "vkDestroyBufferView",
+    "vkDestroyCommandPool",
+    "vkDestroyCuFunctionNVX",
+    "vkDestroyCuModuleNVX",
+    "vkDestroyDataGraphPipelineSessionARM",
+    "vkDestroyDebugReportCallbackEXT",
+    "vkDestroyDebugUtilsMessengerEXT",
+    "vkDestroyDeferredOperationKHR",
+    "vkDestroyDescriptorPool",
+    "vkDestroyDescriptorSetLayout",
+    "vkDestroyDescriptorUpdateTemplate",
+    "vkDestroyDescriptorUpdateTemplateKHR",
+    "vkDestroyDevice",
+    "vkDestroyEvent",
+    "vkDestroyFence",
+    "vkDestroyFramebuffer",
+    "vkDestroyGpaSessionAMD",
+    "vkDestroyImage",
+    "vkDestroyImageView",
+    "vkDestroyIndirectCommandsLayoutEXT",
+    "vkDestroyIndirectCommandsLayoutNV",
+    "vkDestroyIndirectExecutionSetEXT",
+    "vkDestroyInstance",
+    "vkDestroyMicromapEXT",
+    "vkDestroyOpticalFlowSessionNV",
+    "vkDestroyPipeline",
+    "vkDestroyPipelineBinaryKHR",
+    "vkDestroyPipelineCache",
+    "vkDestroyPipelineLayout",
+    "vkDestroyPrivateDataSlot",
+    "vkDestroyPrivateDataSlotEXT",
+    "vkDestroyQueryPool",
+    "vkDestroyRenderPass",
+    "vkDestroySampler",
+    "vkDestroySamplerYcbcrConversion",
+    "vkDestroySamplerYcbcrConversionKHR",
+    "vkDestroySemaphore",
+    "vkDestroyShaderEXT",
+    "vkDestroyShaderInstrumentationARM",
+    "vkDestroyShaderModule",
+    "vkDestroySurfaceKHR",
+    "vkDestroySwapchainKHR",
+    "vkDestroyTensorARM",
+    "vkDestroyTensorViewARM",
+    "vkDestroyValidationCacheEXT",
+    "vkDestroyVideoSessionKHR",
+    "vkDestroyVideoSessionParametersKHR",
+    "vkDeviceWaitIdle",
+    "vkEndCommandBuffer",
+    "vkEnumerateDeviceExtensionProperties",
+    "vkEnumerateDeviceLayerProperties",
+    "vkEnumerateInstanceExtensionProperties",
+    "vkEnumerateInstanceVersion",
+    "vkEnumeratePhysicalDeviceGroups",
+    "vkEnumeratePhysicalDeviceGroupsKHR",
+    "vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM",
+    "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+    "vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM",
+    "vkEnumeratePhysicalDevices",
+    "vkFlushMappedMemoryRanges",
+    "vkFreeCommandBuffers",
+    "vkFreeDescriptorSets",
+    "vkFreeMemory",
+    "vkGetAccelerationStructureBuildSizesKHR",
+    "vkGetAccelerationStructureDeviceAddressKHR",
+    "vkGetAccelerationStructureHandleNV",
+    "vkGetAccelerationStructureMemoryRequirementsNV",
+    "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT",
+    "vkGetBufferDeviceAddress",
+    "vkGetBufferDeviceAddressEXT",
+    "vkGetBufferDeviceAddressKHR",
+    "vkGetBufferMemoryRequirements",
+    "vkGetBufferMemoryRequirements2",
+    "vkGetBufferMemoryRequirements2KHR",
+    "vkGetBufferOpaqueCaptureAddress",
+    "vkGetBufferOpaqueCaptureAddressKHR",
+    "vkGetBufferOpaqueCaptureDescriptorDataEXT",
+    "vkGetCalibratedTimestampsEXT",
+    "vkGetCalibratedTimestampsKHR",
+    "vkGetClusterAccelerationStructureBuildSizesNV",
+    "vkGetDataGraphPipelineAvailablePropertiesARM",
+    "vkGetDataGraphPipelinePropertiesARM",
+    "vkGetDataGraphPipelineSessionBindPointRequirementsARM",
+    "vkGetDataGraphPipelineSessionMemoryRequirementsARM",
+    "vkGetDeferredOperationMaxConcurrencyKHR",
+    "vkGetDeferredOperationResultKHR",
+    "vkGetDescriptorEXT",
+    "vkGetDescriptorSetHostMappingVALVE",
+    "vkGetDescriptorSetLayoutBindingOffsetEXT",
+    "vkGetDescriptorSetLayoutHostMappingInfoVALVE",
+    "vkGetDescriptorSetLayoutSizeEXT",
+    "vkGetDescriptorSetLayoutSupport",
+    "vkGetDescriptorSetLayoutSupportKHR",
+    "vkGetDeviceAccelerationStructureCompatibilityKHR",
+    "vkGetDeviceBufferMemoryRequirements",
+    "vkGetDeviceBufferMemoryRequirementsKHR",
+    "vkGetDeviceCombinedImageSamplerIndexNVX",
+    "vkGetDeviceFaultDebugInfoKHR",
+    "vkGetDeviceFaultInfoEXT",
+    "vkGetDeviceFaultReportsKHR",
+    "vkGetDeviceGroupPeerMemoryFeatures",
+    "vkGetDeviceGroupPeerMemoryFeaturesKHR",
+    "vkGetDeviceGroupPresentCapabilitiesKHR",
+    "vkGetDeviceGroupSurfacePresentModesKHR",
+    "vkGetDeviceImageMemoryRequirements",
+    "vkGetDeviceImageMemoryRequirementsKHR",
+    "vkGetDeviceImageSparseMemoryRequirements",
+    "vkGetDeviceImageSparseMemoryRequirementsKHR",
+    "vkGetDeviceImageSubresourceLayout",
+    "vkGetDeviceImageSubresourceLayoutKHR",
+    "vkGetDeviceMemoryCommitment",
+    "vkGetDeviceMemoryOpaqueCaptureAddress",
+    "vkGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "vkGetDeviceMicromapCompatibilityEXT",
+    "vkGetDeviceQueue",
+    "vkGetDeviceQueue2",
+    "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+    "vkGetDeviceTensorMemoryRequirementsARM",
+    "vkGetDynamicRenderingTilePropertiesQCOM",
+    "vkGetEncodedVideoSessionParametersKHR",
+    "vkGetEventStatus",
+    "vkGetFenceStatus",
+    "vkGetFenceWin32HandleKHR",
+    "vkGetFramebufferTilePropertiesQCOM",
+    "vkGetGeneratedCommandsMemoryRequirementsEXT",
+    "vkGetGeneratedCommandsMemoryRequirementsNV",
+    "vkGetGpaDeviceClockInfoAMD",
+    "vkGetGpaSessionResultsAMD",
+    "vkGetGpaSessionStatusAMD",
+    "vkGetImageMemoryRequirements",
+    "vkGetImageMemoryRequirements2",
+    "vkGetImageMemoryRequirements2KHR",
+    "vkGetImageOpaqueCaptureDataEXT",
+    "vkGetImageOpaqueCaptureDescriptorDataEXT",
+    "vkGetImageSparseMemoryRequirements",
+    "vkGetImageSparseMemoryRequirements2",
+    "vkGetImageSparseMemoryRequirements2KHR",
+    "vkGetImageSubresourceLayout",
+    "vkGetImageSubresourceLayout2",
+    "vkGetImageSubresourceLayout2EXT",
+    "vkGetImageSubresourceLayout2KHR",
+    "vkGetImageViewAddressNVX",
+    "vkGetImageViewHandle64NVX",
+    "vkGetImageViewHandleNVX",
+    "vkGetImageViewOpaqueCaptureDescriptorDataEXT",
+    "vkGetLatencyTimingsNV",
+    "vkGetMemoryHostPointerPropertiesEXT",
+    "vkGetMemoryWin32HandleKHR",
+    "vkGetMemoryWin32HandlePropertiesKHR",
+    "vkGetMicromapBuildSizesEXT",
+    "vkGetPartitionedAccelerationStructuresBuildSizesNV",
+    "vkGetPastPresentationTimingEXT",
+    "vkGetPerformanceParameterINTEL",
+    "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT",
+    "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR",
+    "vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV",
+    "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR",
+    "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV",
+    "vkGetPhysicalDeviceCooperativeVectorPropertiesNV",
+    "vkGetPhysicalDeviceDescriptorSizeEXT",
+    "vkGetPhysicalDeviceExternalBufferProperties",
+    "vkGetPhysicalDeviceExternalBufferPropertiesKHR",
+    "vkGetPhysicalDeviceExternalFenceProperties",
+    "vkGetPhysicalDeviceExternalFencePropertiesKHR",
+    "vkGetPhysicalDeviceExternalSemaphoreProperties",
+    "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR",
+    "vkGetPhysicalDeviceExternalTensorPropertiesARM",
+    "vkGetPhysicalDeviceFeatures",
+    "vkGetPhysicalDeviceFeatures2",
+    "vkGetPhysicalDeviceFeatures2KHR",
+    "vkGetPhysicalDeviceFormatProperties",
+    "vkGetPhysicalDeviceFormatProperties2",
+    "vkGetPhysicalDeviceFormatProperties2KHR",
+    "vkGetPhysicalDeviceFragmentShadingRatesKHR",
+    "vkGetPhysicalDeviceImageFormatProperties",
+    "vkGetPhysicalDeviceImageFormatProperties2",
+    "vkGetPhysicalDeviceImageFormatProperties2KHR",
+    "vkGetPhysicalDeviceMemoryProperties",
+    "vkGetPhysicalDeviceMemoryProperties2",
+    "vkGetPhysicalDeviceMemoryProperties2KHR",
+    "vkGetPhysicalDeviceMultisamplePropertiesEXT",
+    "vkGetPhysicalDeviceOpticalFlowImageFormatsNV",
+    "vkGetPhysicalDevicePresentRectanglesKHR",
+    "vkGetPhysicalDeviceProperties",
+    "vkGetPhysicalDeviceProperties2",
+    "vkGetPhysicalDeviceProperties2KHR",
+    "vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM",
+    "vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM",
+    "vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM",
+    "vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM",
+    "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+    "vkGetPhysicalDeviceQueueFamilyProperties",
+    "vkGetPhysicalDeviceQueueFamilyProperties2",
+    "vkGetPhysicalDeviceQueueFamilyProperties2KHR",
+    "vkGetPhysicalDeviceSparseImageFormatProperties",
+    "vkGetPhysicalDeviceSparseImageFormatProperties2",
+    "vkGetPhysicalDeviceSparseImageFormatProperties2KHR",
+    "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",
+    "vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+    "vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+    "vkGetPhysicalDeviceSurfaceFormats2KHR",
+    "vkGetPhysicalDeviceSurfaceFormatsKHR",
+    "vkGetPhysicalDeviceSurfacePresentModesKHR",
+    "vkGetPhysicalDeviceSurfaceSupportKHR",
+    "vkGetPhysicalDeviceToolProperties",
+    "vkGetPhysicalDeviceToolPropertiesEXT",
+    "vkGetPhysicalDeviceVideoCapabilitiesKHR",
+    "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR",
+    "vkGetPhysicalDeviceVideoFormatPropertiesKHR",
+    "vkGetPhysicalDeviceWin32PresentationSupportKHR",
+    "vkGetPipelineBinaryDataKHR",
+    "vkGetPipelineCacheData",
+    "vkGetPipelineExecutableInternalRepresentationsKHR",
+    "vkGetPipelineExecutablePropertiesKHR",
+    "vkGetPipelineExecutableStatisticsKHR",
+    "vkGetPipelineIndirectDeviceAddressNV",
+    "vkGetPipelineIndirectMemoryRequirementsNV",
+    "vkGetPipelineKeyKHR",
+    "vkGetPipelinePropertiesEXT",
+    "vkGetPrivateData",
+    "vkGetPrivateDataEXT",
+    "vkGetQueryPoolResults",
+    "vkGetQueueCheckpointData2NV",
+    "vkGetQueueCheckpointDataNV",
+    "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+    "vkGetRayTracingShaderGroupHandlesKHR",
+    "vkGetRayTracingShaderGroupHandlesNV",
+    "vkGetRayTracingShaderGroupStackSizeKHR",
+    "vkGetRenderAreaGranularity",
+    "vkGetRenderingAreaGranularity",
+    "vkGetRenderingAreaGranularityKHR",
+    "vkGetSamplerOpaqueCaptureDescriptorDataEXT",
+    "vkGetSemaphoreCounterValue",
+    "vkGetSemaphoreCounterValueKHR",
+    "vkGetSemaphoreWin32HandleKHR",
+    "vkGetShaderBinaryDataEXT",
+    "vkGetShaderInfoAMD",
+    "vkGetShaderInstrumentationValuesARM",
+    "vkGetShaderModuleCreateInfoIdentifierEXT",
+    "vkGetShaderModuleIdentifierEXT",
+    "vkGetSwapchainImagesKHR",
+    "vkGetSwapchainTimeDomainPropertiesEXT",
+    "vkGetSwapchainTimingPropertiesEXT",
+    "vkGetTensorMemoryRequirementsARM",
+    "vkGetTensorOpaqueCaptureDataARM",
+    "vkGetTensorOpaqueCaptureDescriptorDataARM",
+    "vkGetTensorViewOpaqueCaptureDescriptorDataARM",
+    "vkGetValidationCacheDataEXT",
+    "vkGetVideoSessionMemoryRequirementsKHR",
+    "vkImportFenceWin32HandleKHR",
+    "vkImportSemaphoreWin32HandleKHR",
+    "vkInitializePerformanceApiINTEL",
+    "vkInvalidateMappedMemoryRanges",
+    "vkLatencySleepNV",
+    "vkMapMemory",
+    "vkMapMemory2",
+    "vkMapMemory2KHR",
+    "vkMergePipelineCaches",
+    "vkMergeValidationCachesEXT",
+    "vkQueueBeginDebugUtilsLabelEXT",
+    "vkQueueBindSparse",
+    "vkQueueEndDebugUtilsLabelEXT",
+    "vkQueueInsertDebugUtilsLabelEXT",
+    "vkQueueNotifyOutOfBandNV",
+    "vkQueuePresentKHR",
+    "vkQueueSetPerfHintQCOM",
+    "vkQueueSetPerformanceConfigurationINTEL",
+    "vkQueueSubmit",
+    "vkQueueSubmit2",
+    "vkQueueSubmit2KHR",
+    "vkQueueWaitIdle",
+    "vkRegisterCustomBorderColorEXT",
+    "vkReleaseCapturedPipelineDataKHR",
+    "vkReleasePerformanceConfigurationINTEL",
+    "vkReleaseProfilingLockKHR",
+    "vkReleaseSwapchainImagesEXT",
+    "vkReleaseSwapchainImagesKHR",
+    "vkResetCommandBuffer",
+    "vkResetCommandPool",
+    "vkResetDescriptorPool",
+    "vkResetEvent",
+    "vkResetFences",
+    "vkResetGpaSessionAMD",
+    "vkResetQueryPool",
+    "vkResetQueryPoolEXT",
+    "vkSetDebugUtilsObjectNameEXT",
+    "vkSetDebugUtilsObjectTagEXT",
+    "vkSetDeviceMemoryPriorityEXT",
+    "vkSetEvent",
+    "vkSetGpaDeviceClockModeAMD",
+    "vkSetHdrMetadataEXT",
+    "vkSetLatencyMarkerNV",
+    "vkSetLatencySleepModeNV",
+    "vkSetPrivateData",
+    "vkSetPrivateDataEXT",
+    "vkSetSwapchainPresentTimingQueueSizeEXT",
+    "vkSignalSemaphore",
+    "vkSignalSemaphoreKHR",
+    "vkSubmitDebugUtilsMessageEXT",
+    "vkTransitionImageLayout",
+    "vkTransitionImageLayoutEXT",
+    "vkTrimCommandPool",
+    "vkTrimCommandPoolKHR",
+    "vkUninitializePerformanceApiINTEL",
+    "vkUnmapMemory",
+    "vkUnmapMemory2",
+    "vkUnmapMemory2KHR",
+    "vkUnregisterCustomBorderColorEXT",
+    "vkUpdateDescriptorSetWithTemplate",
+    "vkUpdateDescriptorSetWithTemplateKHR",
+    "vkUpdateDescriptorSets",
+    "vkUpdateIndirectExecutionSetPipelineEXT",
+    "vkUpdateIndirectExecutionSetShaderEXT",
+    "vkUpdateVideoSessionParametersKHR",
+    "vkWaitForFences",
+    "vkWaitForPresent2KHR",
+    "vkWaitForPresentKHR",
+    "vkWaitSemaphores",
+    "vkWaitSemaphoresKHR",
+    "vkWriteAccelerationStructuresPropertiesKHR",
+    "vkWriteMicromapsPropertiesEXT",
+    "vkWriteResourceDescriptorsEXT",
+    "vkWriteSamplerDescriptorsEXT",
+};
+C_ASSERT(ARRAYSIZE(vk_unix_call_names) == unix_count);
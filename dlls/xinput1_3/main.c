@@ -43,6 +43,7 @@
 #include "xinput.h"
 
 #include "wine/debug.h"
+#include "wine/hid.h"
 
 DEFINE_GUID(GUID_DEVINTERFACE_WINEXINPUT,0x6c53d5fd,0x6480,0x440f,0xb6,0x18,0x47,0x67,0x50,0xc5,0xe1,0xa6);
 
@@ -50,6 +51,26 @@ DEFINE_GUID(GUID_DEVINTERFACE_WINEXINPUT,0x6c53d5fd,0x6480,0x440f,0xb6,0x18,0x47
 #define XINPUT_GAMEPAD_GUIDE 0x0400
 
 WINE_DEFAULT_DEBUG_CHANNEL(xinput);
+WINE_DECLARE_DEBUG_CHANNEL(hid_latency);
+
+enum report_op_type
+{
+    REPORT_OP_BUTTON,
+    REPORT_OP_HATSWITCH,
+    REPORT_OP_LX,
+    REPORT_OP_LY,
+    REPORT_OP_LT,
+    REPORT_OP_RX,
+    REPORT_OP_RY,
+    REPORT_OP_RT,
+};
+
+struct report_op
+{
+    enum report_op_type type;
+    WORD button;
+    struct hid_report_field field;
+};
 
 struct xinput_controller
 {
@@ -80,6 +101,15 @@ struct xinput_controller
         BYTE haptics_report;
         HIDP_VALUE_CAPS haptics_rumble_caps;
         HIDP_VALUE_CAPS haptics_buzz_caps;
+
+        HANDLE shared_mapping;
+        const struct hid_shared_input *shared_input;
+        char *shared_report_buf;
+        LONG shared_seq;
+
+        struct report_op *report_ops;
+        UINT report_op_count;
+        UCHAR report_id;
     } hid;
 };
 
@@ -358,6 +388,157 @@ static void controller_disable(struct xinput_controller *controller)
     SetEvent(update_event);
 }
 
+/* map the latest input report published by hidclass, xinput_cs must be held */
+static void controller_open_shared_input(struct xinput_controller *controller, const WCHAR *device_path)
+{
+    WCHAR name[MAX_PATH + 8] = L"Global\\";
+    HANDLE mapping;
+    void *view;
+
+    hid_shared_input_name(device_path, wcslen(device_path), name + 7, ARRAY_SIZE(name) - 7);
+    if (!(mapping = OpenFileMappingW(FILE_MAP_READ, FALSE, name)))
+    {
+        TRACE("no shared input for %s, error %lu\n", debugstr_w(device_path), GetLastError());
+        return;
+    }
+
+    if (!(view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)) ||
+        !(controller->hid.shared_report_buf = calloc(1, controller->hid.caps.InputReportByteLength)))
+    {
+        WARN("failed to map shared input for %s\n", debugstr_w(device_path));
+        if (view) UnmapViewOfFile(view);
+        CloseHandle(mapping);
+        return;
+    }
+
+    controller->hid.shared_mapping = mapping;
+    controller->hid.shared_input = view;
+    controller->hid.shared_seq = -1;
+}
+
+/* xinput_cs must be held */
+static void controller_close_shared_input(struct xinput_controller *controller)
+{
+    if (!controller->hid.shared_mapping) return;
+
+    UnmapViewOfFile(controller->hid.shared_input);
+    CloseHandle(controller->hid.shared_mapping);
+    free(controller->hid.shared_report_buf);
+    controller->hid.shared_input = NULL;
+    controller->hid.shared_mapping = NULL;
+    controller->hid.shared_report_buf = NULL;
+}
+
+enum shared_input_status
+{
+    SHARED_INPUT_UNCHANGED,
+    SHARED_INPUT_UPDATED,
+    SHARED_INPUT_UNAVAILABLE,
+};
+
+/* copy the latest input report if it changed since the last call, xinput_cs must be held */
+static enum shared_input_status controller_read_shared_input(struct xinput_controller *controller, const char *path)
+{
+    const struct hid_shared_input *shared = controller->hid.shared_input;
+    ULONG report_len = min(controller->hid.caps.InputReportByteLength, shared->max_length);
+    LARGE_INTEGER time, now, freq;
+    LONG seq;
+    int i;
+
+    for (i = 0; i < 16; i++)
+    {
+        if ((seq = ReadAcquire(&shared->seq)) & 1)
+        {
+            YieldProcessor();
+            continue;
+        }
+        /* the section is zero filled until hidclass publishes its first report */
+        if (!seq) return SHARED_INPUT_UNAVAILABLE;
+        if (seq == controller->hid.shared_seq) return SHARED_INPUT_UNCHANGED;
+
+        memcpy(controller->hid.shared_report_buf, shared->report, report_len);
+        time = shared->time;
+        MemoryBarrier();
+        if (ReadNoFence(&shared->seq) != seq) continue;
+
+        controller->hid.shared_seq = seq;
+        if (TRACE_ON(hid_latency))
+        {
+            QueryPerformanceCounter(&now);
+            QueryPerformanceFrequency(&freq);
+            TRACE_(hid_latency)("controller %Iu, report %ld, %s path, %.3f ms after hidclass received it\n",
+                                controller - controllers, seq / 2, path,
+                                (now.QuadPart - time.QuadPart) * 1000.0 / freq.QuadPart);
+        }
+        return SHARED_INPUT_UPDATED;
+    }
+
+    return SHARED_INPUT_UNAVAILABLE;
+}
+
+/* flatten the report fields used by parse_controller_report into a list of operations */
+static void controller_compile_report(struct xinput_controller *controller, PHIDP_PREPARSED_DATA preparsed)
+{
+    static const struct
+    {
+        USAGE usage;
+        enum report_op_type type;
+    }
+    values[] =
+    {
+        {HID_USAGE_GENERIC_HATSWITCH, REPORT_OP_HATSWITCH},
+        {HID_USAGE_GENERIC_X, REPORT_OP_LX},
+        {HID_USAGE_GENERIC_Y, REPORT_OP_LY},
+        {HID_USAGE_GENERIC_RX, REPORT_OP_RX},
+        {HID_USAGE_GENERIC_RY, REPORT_OP_RY},
+        {HID_USAGE_GENERIC_RZ, REPORT_OP_RT},
+        {HID_USAGE_GENERIC_Z, REPORT_OP_LT},
+    };
+    static const WORD buttons[] =
+    {
+        XINPUT_GAMEPAD_A, XINPUT_GAMEPAD_B, XINPUT_GAMEPAD_X, XINPUT_GAMEPAD_Y,
+        XINPUT_GAMEPAD_LEFT_SHOULDER, XINPUT_GAMEPAD_RIGHT_SHOULDER, XINPUT_GAMEPAD_BACK,
+        XINPUT_GAMEPAD_START, XINPUT_GAMEPAD_LEFT_THUMB, XINPUT_GAMEPAD_RIGHT_THUMB,
+    };
+    struct hid_report_field *fields, field;
+    struct report_op *ops;
+    int i, count;
+    UINT op_count = 0;
+
+    if ((count = hid_report_compile((struct hid_preparsed_data *)preparsed, NULL, 0)) <= 0) return;
+    if (!(fields = calloc(count, sizeof(*fields)))) return;
+    hid_report_compile((struct hid_preparsed_data *)preparsed, fields, count);
+
+    for (i = 1; i < count; i++) if (fields[i].report_id != fields[0].report_id) break;
+    if (i < count || !(ops = calloc(count + ARRAY_SIZE(values), sizeof(*ops))))
+    {
+        TRACE("not compiling report for device with several input reports\n");
+        free(fields);
+        return;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (!fields[i].is_button) continue;
+        if (fields[i].usage_page == HID_USAGE_PAGE_BUTTON && fields[i].usage && fields[i].usage <= ARRAY_SIZE(buttons))
+            ops[op_count++] = (struct report_op){.type = REPORT_OP_BUTTON, .button = buttons[fields[i].usage - 1], .field = fields[i]};
+        else if (fields[i].usage_page == HID_USAGE_PAGE_VENDOR_DEFINED_BEGIN)
+            ops[op_count++] = (struct report_op){.type = REPORT_OP_BUTTON, .button = XINPUT_GAMEPAD_GUIDE, .field = fields[i]};
+    }
+
+    for (i = 0; i < ARRAY_SIZE(values); i++)
+    {
+        field = hid_report_find_field(fields, count, fields[0].report_id, HID_USAGE_PAGE_GENERIC, values[i].usage, FALSE);
+        if (field.bit_size) ops[op_count++] = (struct report_op){.type = values[i].type, .field = field};
+    }
+
+    TRACE("compiled %d report fields into %u operations\n", count, op_count);
+    controller->hid.report_ops = ops;
+    controller->hid.report_op_count = op_count;
+    controller->hid.report_id = fields[0].report_id;
+    free(fields);
+}
+
 /* opened a new controller device, xinput_cs must be held */
 static BOOL controller_init(struct xinput_controller *controller, PHIDP_PREPARSED_DATA preparsed,
                             HIDP_CAPS *caps, HANDLE device, const WCHAR *device_path)
@@ -371,6 +552,7 @@ static BOOL controller_init(struct xinput_controller *controller, PHIDP_PREPARSE
     TRACE("Found gamepad %s\n", debugstr_w(device_path));
 
     controller->hid.preparsed = preparsed;
+    controller_compile_report(controller, preparsed);
     if (!(controller->hid.input_report_buf = calloc(1, controller->hid.caps.InputReportByteLength))) goto failed;
     if (!(controller->hid.output_report_buf = calloc(1, controller->hid.caps.OutputReportByteLength))) goto failed;
 
@@ -381,10 +563,12 @@ static BOOL controller_init(struct xinput_controller *controller, PHIDP_PREPARSE
     controller->device = device;
     if (!controller_enable(controller)) goto failed;
 
+    controller_open_shared_input(controller, device_path);
     set_current_state(controller - controllers, &state);
     return TRUE;
 
 failed:
+    free(controller->hid.report_ops);
     free(controller->hid.input_report_buf);
     free(controller->hid.output_report_buf);
     free(controller->hid.feature_report_buf);
@@ -553,6 +737,8 @@ static void controller_destroy(struct xinput_controller *controller, BOOL alread
         CloseHandle(controller->device);
         controller->device = NULL;
 
+        controller_close_shared_input(controller);
+        free(controller->hid.report_ops);
         free(controller->hid.input_report_buf);
         free(controller->hid.output_report_buf);
         free(controller->hid.feature_report_buf);
@@ -576,103 +762,170 @@ static LONG scale_value(ULONG value, const HIDP_VALUE_CAPS *caps, LONG min, LONG
     return min + MulDiv(tmp - caps->LogicalMin, max - min, caps->LogicalMax - caps->LogicalMin);
 }
 
-/* read the controller state from the HID device, xinput_cs must be held */
-static void read_controller_state(struct xinput_controller *controller)
+static WORD hatswitch_buttons(ULONG value)
 {
-    ULONG read_len, report_len = controller->hid.caps.InputReportByteLength;
-    char *report_buf = controller->hid.input_report_buf;
-    XINPUT_STATE state;
-    NTSTATUS status;
-    USAGE buttons[11];
-    ULONG i, button_length, value;
-    BOOL ret;
+    switch (value)
+    {
+    /* 8 1 2
+     * 7 0 3
+     * 6 5 4 */
+    case 1: return XINPUT_GAMEPAD_DPAD_UP;
+    case 2: return XINPUT_GAMEPAD_DPAD_UP | XINPUT_GAMEPAD_DPAD_RIGHT;
+    case 3: return XINPUT_GAMEPAD_DPAD_RIGHT;
+    case 4: return XINPUT_GAMEPAD_DPAD_RIGHT | XINPUT_GAMEPAD_DPAD_DOWN;
+    case 5: return XINPUT_GAMEPAD_DPAD_DOWN;
+    case 6: return XINPUT_GAMEPAD_DPAD_DOWN | XINPUT_GAMEPAD_DPAD_LEFT;
+    case 7: return XINPUT_GAMEPAD_DPAD_LEFT;
+    case 8: return XINPUT_GAMEPAD_DPAD_LEFT | XINPUT_GAMEPAD_DPAD_UP;
+    }
+    return 0;
+}
 
-    if (!GetOverlappedResult(controller->device, &controller->hid.read_ovl, &read_len, TRUE))
+/* parse an input report in a single pass over the compiled report operations */
+static BOOL run_report_ops(struct xinput_controller *controller, const BYTE *report_buf, XINPUT_STATE *state)
+{
+    const struct report_op *op, *end = controller->hid.report_ops + controller->hid.report_op_count;
+    ULONG value;
+
+    if (report_buf[0] != controller->hid.report_id) return FALSE;
+
+    state->Gamepad.wButtons = 0;
+    for (op = controller->hid.report_ops; op != end; op++)
     {
-        if (GetLastError() == ERROR_OPERATION_ABORTED) return;
-        if (GetLastError() == ERROR_ACCESS_DENIED || GetLastError() == ERROR_INVALID_HANDLE ||
-            GetLastError() == ERROR_DEVICE_NOT_CONNECTED)
+        value = hid_report_field_value(&op->field, report_buf);
+        switch (op->type)
         {
-            controller_destroy(controller, TRUE);
+        case REPORT_OP_BUTTON: if (value) state->Gamepad.wButtons |= op->button; break;
+        case REPORT_OP_HATSWITCH: state->Gamepad.wButtons |= hatswitch_buttons(value); break;
+        case REPORT_OP_LX: state->Gamepad.sThumbLX = scale_value(value, &controller->hid.lx_caps, -32768, 32767); break;
+        case REPORT_OP_LY: state->Gamepad.sThumbLY = scale_value(value, &controller->hid.ly_caps, -32768, 32767); break;
+        case REPORT_OP_RX: state->Gamepad.sThumbRX = scale_value(value, &controller->hid.rx_caps, -32768, 32767); break;
+        case REPORT_OP_RY: state->Gamepad.sThumbRY = scale_value(value, &controller->hid.ry_caps, -32768, 32767); break;
+        case REPORT_OP_RT: state->Gamepad.bRightTrigger = scale_value(value, &controller->hid.rt_caps, 0, 255); break;
+        case REPORT_OP_LT: state->Gamepad.bLeftTrigger = scale_value(value, &controller->hid.lt_caps, 0, 255); break;
         }
-        else ERR("Failed to read input report, GetOverlappedResult failed with error %lu\n", GetLastError());
-        return;
     }
 
+    return TRUE;
+}
+
+/* parse an input report into the controller state, xinput_cs must be held */
+static BOOL parse_controller_report(struct xinput_controller *controller, char *report_buf, XINPUT_STATE *state)
+{
+    ULONG report_len = controller->hid.caps.InputReportByteLength;
+    NTSTATUS status;
+    USAGE buttons[11];
+    ULONG i, button_length, value;
+
+    if (controller->hid.report_ops) return run_report_ops(controller, (BYTE *)report_buf, state);
+
     button_length = ARRAY_SIZE(buttons);
     status = HidP_GetUsages(HidP_Input, HID_USAGE_PAGE_BUTTON, 0, buttons, &button_length, controller->hid.preparsed, report_buf, report_len);
+    if (status == HIDP_STATUS_INCOMPATIBLE_REPORT_ID) return FALSE;
     if (status != HIDP_STATUS_SUCCESS) WARN("HidP_GetUsages HID_USAGE_PAGE_BUTTON returned %#lx\n", status);
 
-    get_current_state(controller - controllers, &state);
-
-    state.Gamepad.wButtons = 0;
+    state->Gamepad.wButtons = 0;
     for (i = 0; i < button_length; i++)
     {
         switch (buttons[i])
         {
-        case 1: state.Gamepad.wButtons |= XINPUT_GAMEPAD_A; break;
-        case 2: state.Gamepad.wButtons |= XINPUT_GAMEPAD_B; break;
-        case 3: state.Gamepad.wButtons |= XINPUT_GAMEPAD_X; break;
-        case 4: state.Gamepad.wButtons |= XINPUT_GAMEPAD_Y; break;
-        case 5: state.Gamepad.wButtons |= XINPUT_GAMEPAD_LEFT_SHOULDER; break;
-        case 6: state.Gamepad.wButtons |= XINPUT_GAMEPAD_RIGHT_SHOULDER; break;
-        case 7: state.Gamepad.wButtons |= XINPUT_GAMEPAD_BACK; break;
-        case 8: state.Gamepad.wButtons |= XINPUT_GAMEPAD_START; break;
-        case 9: state.Gamepad.wButtons |= XINPUT_GAMEPAD_LEFT_THUMB; break;
-        case 10: state.Gamepad.wButtons |= XINPUT_GAMEPAD_RIGHT_THUMB; break;
+        case 1: state->Gamepad.wButtons |= XINPUT_GAMEPAD_A; break;
+        case 2: state->Gamepad.wButtons |= XINPUT_GAMEPAD_B; break;
+        case 3: state->Gamepad.wButtons |= XINPUT_GAMEPAD_X; break;
+        case 4: state->Gamepad.wButtons |= XINPUT_GAMEPAD_Y; break;
+        case 5: state->Gamepad.wButtons |= XINPUT_GAMEPAD_LEFT_SHOULDER; break;
+        case 6: state->Gamepad.wButtons |= XINPUT_GAMEPAD_RIGHT_SHOULDER; break;
+        case 7: state->Gamepad.wButtons |= XINPUT_GAMEPAD_BACK; break;
+        case 8: state->Gamepad.wButtons |= XINPUT_GAMEPAD_START; break;
+        case 9: state->Gamepad.wButtons |= XINPUT_GAMEPAD_LEFT_THUMB; break;
+        case 10: state->Gamepad.wButtons |= XINPUT_GAMEPAD_RIGHT_THUMB; break;
         }
     }
 
     button_length = ARRAY_SIZE(buttons);
     status = HidP_GetUsages(HidP_Input, HID_USAGE_PAGE_VENDOR_DEFINED_BEGIN, 0, buttons, &button_length, controller->hid.preparsed, report_buf, report_len);
     if (status != HIDP_STATUS_SUCCESS) WARN("HidP_GetUsages HID_USAGE_PAGE_VENDOR_DEFINED_BEGIN returned %#lx\n", status);
-    if (button_length) state.Gamepad.wButtons |= XINPUT_GAMEPAD_GUIDE;
+    if (button_length) state->Gamepad.wButtons |= XINPUT_GAMEPAD_GUIDE;
 
     status = HidP_GetUsageValue(HidP_Input, HID_USAGE_PAGE_GENERIC, 0, HID_USAGE_GENERIC_HATSWITCH, &value, controller->hid.preparsed, report_buf, report_len);
     if (status != HIDP_STATUS_SUCCESS) WARN("HidP_GetUsageValue HID_USAGE_PAGE_GENERIC / HID_USAGE_GENERIC_HATSWITCH returned %#lx\n", status);
-    else switch (value)
-    {
-    /* 8 1 2
-     * 7 0 3
-     * 6 5 4 */
-    case 0: break;
-    case 1: state.Gamepad.wButtons |= XINPUT_GAMEPAD_DPAD_UP; break;
-    case 2: state.Gamepad.wButtons |= XINPUT_GAMEPAD_DPAD_UP | XINPUT_GAMEPAD_DPAD_RIGHT; break;
-    case 3: state.Gamepad.wButtons |= XINPUT_GAMEPAD_DPAD_RIGHT; break;
-    case 4: state.Gamepad.wButtons |= XINPUT_GAMEPAD_DPAD_RIGHT | XINPUT_GAMEPAD_DPAD_DOWN; break;
-    case 5: state.Gamepad.wButtons |= XINPUT_GAMEPAD_DPAD_DOWN; break;
-    case 6: state.Gamepad.wButtons |= XINPUT_GAMEPAD_DPAD_DOWN | XINPUT_GAMEPAD_DPAD_LEFT; break;
-    case 7: state.Gamepad.wButtons |= XINPUT_GAMEPAD_DPAD_LEFT; break;
-    case 8: state.Gamepad.wButtons |= XINPUT_GAMEPAD_DPAD_LEFT | XINPUT_GAMEPAD_DPAD_UP; break;
-    }
+    else state->Gamepad.wButtons |= hatswitch_buttons(value);
 
     status = HidP_GetUsageValue(HidP_Input, HID_USAGE_PAGE_GENERIC, 0, HID_USAGE_GENERIC_X, &value, controller->hid.preparsed, report_buf, report_len);
     if (status != HIDP_STATUS_SUCCESS) WARN("HidP_GetUsageValue HID_USAGE_PAGE_GENERIC / HID_USAGE_GENERIC_X returned %#lx\n", status);
-    else state.Gamepad.sThumbLX = scale_value(value, &controller->hid.lx_caps, -32768, 32767);
+    else state->Gamepad.sThumbLX = scale_value(value, &controller->hid.lx_caps, -32768, 32767);
 
     status = HidP_GetUsageValue(HidP_Input, HID_USAGE_PAGE_GENERIC, 0, HID_USAGE_GENERIC_Y, &value, controller->hid.preparsed, report_buf, report_len);
     if (status != HIDP_STATUS_SUCCESS) WARN("HidP_GetUsageValue HID_USAGE_PAGE_GENERIC / HID_USAGE_GENERIC_Y returned %#lx\n", status);
-    else state.Gamepad.sThumbLY = scale_value(value, &controller->hid.ly_caps, -32768, 32767);
+    else state->Gamepad.sThumbLY = scale_value(value, &controller->hid.ly_caps, -32768, 32767);
 
     status = HidP_GetUsageValue(HidP_Input, HID_USAGE_PAGE_GENERIC, 0, HID_USAGE_GENERIC_RX, &value, controller->hid.preparsed, report_buf, report_len);
     if (status != HIDP_STATUS_SUCCESS) WARN("HidP_GetUsageValue HID_USAGE_PAGE_GENERIC / HID_USAGE_GENERIC_RX returned %#lx\n", status);
-    else state.Gamepad.sThumbRX = scale_value(value, &controller->hid.rx_caps, -32768, 32767);
+    else state->Gamepad.sThumbRX = scale_value(value, &controller->hid.rx_caps, -32768, 32767);
 
     status = HidP_GetUsageValue(HidP_Input, HID_USAGE_PAGE_GENERIC, 0, HID_USAGE_GENERIC_RY, &value, controller->hid.preparsed, report_buf, report_len);
     if (status != HIDP_STATUS_SUCCESS) WARN("HidP_GetUsageValue HID_USAGE_PAGE_GENERIC / HID_USAGE_GENERIC_RY returned %#lx\n", status);
-    else state.Gamepad.sThumbRY = scale_value(value, &controller->hid.ry_caps, -32768, 32767);
+    else state->Gamepad.sThumbRY = scale_value(value, &controller->hid.ry_caps, -32768, 32767);
 
     status = HidP_GetUsageValue(HidP_Input, HID_USAGE_PAGE_GENERIC, 0, HID_USAGE_GENERIC_RZ, &value, controller->hid.preparsed, report_buf, report_len);
     if (status != HIDP_STATUS_SUCCESS) WARN("HidP_GetUsageValue HID_USAGE_PAGE_GENERIC / HID_USAGE_GENERIC_RZ returned %#lx\n", status);
-    else state.Gamepad.bRightTrigger = scale_value(value, &controller->hid.rt_caps, 0, 255);
+    else state->Gamepad.bRightTrigger = scale_value(value, &controller->hid.rt_caps, 0, 255);
 
     status = HidP_GetUsageValue(HidP_Input, HID_USAGE_PAGE_GENERIC, 0, HID_USAGE_GENERIC_Z, &value, controller->hid.preparsed, report_buf, report_len);
     if (status != HIDP_STATUS_SUCCESS) WARN("HidP_GetUsageValue HID_USAGE_PAGE_GENERIC / HID_USAGE_GENERIC_Z returned %#lx\n", status);
-    else state.Gamepad.bLeftTrigger = scale_value(value, &controller->hid.lt_caps, 0, 255);
+    else state->Gamepad.bLeftTrigger = scale_value(value, &controller->hid.lt_caps, 0, 255);
+
+    return TRUE;
+}
+
+/* read the controller state from the HID device, xinput_cs must be held */
+static void read_controller_state(struct xinput_controller *controller)
+{
+    ULONG read_len, report_len = controller->hid.caps.InputReportByteLength;
+    char *report_buf = controller->hid.input_report_buf;
+    XINPUT_STATE state;
+    BOOL ret;
+
+    if (!GetOverlappedResult(controller->device, &controller->hid.read_ovl, &read_len, TRUE))
+    {
+        if (GetLastError() == ERROR_OPERATION_ABORTED) return;
+        if (GetLastError() == ERROR_ACCESS_DENIED || GetLastError() == ERROR_INVALID_HANDLE ||
+            GetLastError() == ERROR_DEVICE_NOT_CONNECTED)
+        {
+            controller_destroy(controller, TRUE);
+        }
+        else ERR("Failed to read input report, GetOverlappedResult failed with error %lu\n", GetLastError());
+        return;
+    }
+
+    get_current_state(controller - controllers, &state);
+
+    /* The shared report is at least as recent as the one we read; if it
+     * hasn't changed since it was last parsed, the state is already current.
+     * Use the report we read when the shared one can't be read right now. */
+    if (!controller->hid.shared_input)
+        ret = parse_controller_report(controller, report_buf, &state);
+    else switch (controller_read_shared_input(controller, "read"))
+    {
+    case SHARED_INPUT_UNCHANGED:
+        ret = FALSE;
+        break;
+    case SHARED_INPUT_UNAVAILABLE:
+        ret = parse_controller_report(controller, report_buf, &state);
+        break;
+    case SHARED_INPUT_UPDATED:
+        if (!(ret = parse_controller_report(controller, controller->hid.shared_report_buf, &state)))
+        {
+            WARN("device uses several input reports, not using shared input\n");
+            controller_close_shared_input(controller);
+            ret = parse_controller_report(controller, report_buf, &state);
+        }
+        break;
+    }
 
     if (controller->enabled)
     {
-        set_current_state(controller - controllers, &state);
+        if (ret) set_current_state(controller - controllers, &state);
         memset(&controller->hid.read_ovl, 0, sizeof(controller->hid.read_ovl));
         controller->hid.read_ovl.hEvent = controller->read_event;
         ret = ReadFile(controller->device, report_buf, report_len, NULL, &controller->hid.read_ovl);
@@ -850,6 +1103,25 @@ DWORD WINAPI DECLSPEC_HOTPATCH XInputSetState(DWORD index, XINPUT_VIBRATION *vib
     return ret;
 }
 
+/* update the state from the shared input report without waiting for the update thread */
+static void poll_shared_input(DWORD index)
+{
+    struct xinput_controller *controller = &controllers[index];
+    XINPUT_STATE state;
+
+    if (!TryEnterCriticalSection(&xinput_cs)) return;
+    if (controller->device && controller->enabled && controller->hid.shared_input &&
+        controller_read_shared_input(controller, "poll") == SHARED_INPUT_UPDATED)
+    {
+        get_current_state(index, &state);
+        if (parse_controller_report(controller, controller->hid.shared_report_buf, &state))
+            set_current_state(index, &state);
+        else
+            controller->hid.shared_seq = -1;
+    }
+    LeaveCriticalSection(&xinput_cs);
+}
+
 /* Some versions of SteamOverlayRenderer hot-patch XInputGetStateEx() and call
  * XInputGetState() in the hook, so we need a wrapper. */
 static DWORD xinput_get_state(DWORD index, XINPUT_STATE *state)
@@ -861,6 +1133,7 @@ static DWORD xinput_get_state(DWORD index, XINPUT_STATE *state)
     start_update_thread();
 
     if (index >= XUSER_MAX_COUNT) return ERROR_BAD_ARGUMENTS;
+    poll_shared_input(index);
     if (get_current_state(index, state)) return ERROR_SUCCESS;
 
     EnterCriticalSection(&xinput_cs);
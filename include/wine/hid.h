@@ -241,4 +241,111 @@ struct hid_preparsed_data
 
 #define IOCTL_HID_GET_WINE_RAWINPUT_HANDLE         HID_BUFFER_CTL_CODE(300)
 
+/* Latest input report of a HID device, published by hidclass.sys in a named
+ * section so that clients can read the current state without a read request. */
+struct hid_shared_input
+{
+    LONG seq;              /* odd while the report is being updated */
+    ULONG max_length;      /* size of the report buffer */
+    ULONG length;          /* length of the current report */
+    LARGE_INTEGER time;    /* performance counter when hidclass received the report */
+    BYTE report[1];
+};
+
+/* Section name for the device interface with the given path, relative to the
+ * BaseNamedObjects directory. */
+static inline void hid_shared_input_name( const WCHAR *path, SIZE_T length, WCHAR *name, SIZE_T size )
+{
+    static const WCHAR prefix[] = {'w','i','n','e','_','h','i','d','_','i','n','p','u','t','_'};
+    SIZE_T i, pos;
+
+    /* skip the \??\ or \\?\ prefix, which differs between user and kernel paths */
+    if (length >= 4 && path[0] == '\\') { path += 4; length -= 4; }
+
+    for (pos = 0; pos < ARRAY_SIZE(prefix) && pos < size - 1; pos++) name[pos] = prefix[pos];
+    for (i = 0; i < length && path[i] && pos < size - 1; i++, pos++)
+    {
+        if (path[i] >= 'A' && path[i] <= 'Z') name[pos] = path[i] + 'a' - 'A';
+        else if (path[i] == '\\') name[pos] = '#';
+        else name[pos] = path[i];
+    }
+    name[pos] = 0;
+}
+
+/* Location of a single input value or button in a report, flattened from the
+ * preparsed data so that reports can be decoded without walking the caps. */
+struct hid_report_field
+{
+    USAGE usage_page;
+    USAGE usage;
+    USHORT bit_offset;     /* from the start of the report, including the report ID */
+    USHORT bit_size;       /* zero if the usage isn't present */
+    UCHAR report_id;
+    UCHAR is_button;
+};
+
+/* Flatten the input caps of preparsed data into a table of report fields, one
+ * per value or button usage, in caps order. Returns the number of fields, which
+ * may be larger than size, or -1 if the descriptor uses array items or values
+ * larger than 32 bits, which can't be described by a single field. */
+static inline int hid_report_compile( const struct hid_preparsed_data *preparsed,
+                                      struct hid_report_field *fields, int size )
+{
+    const struct hid_value_caps *caps = HID_INPUT_VALUE_CAPS( preparsed ), *end = caps + preparsed->input_caps_count;
+    struct hid_report_field *field;
+    int count = 0;
+    ULONG usage;
+
+    for (; caps != end; caps++)
+    {
+        if (!caps->usage_page || (!caps->usage_min && !caps->usage_max)) continue;
+        if (HID_VALUE_CAPS_IS_ARRAY( caps ) || caps->bit_size > 32) return -1;
+
+        for (usage = caps->usage_min; usage <= caps->usage_max; usage++, count++)
+        {
+            if (count >= size) continue;
+            field = fields + count;
+            field->usage_page = caps->usage_page;
+            field->usage = usage;
+            field->bit_offset = caps->start_byte * 8 + caps->start_bit + (usage - caps->usage_min) * caps->bit_size;
+            field->bit_size = caps->bit_size;
+            field->report_id = caps->report_id;
+            field->is_button = !!(caps->flags & HID_VALUE_CAPS_IS_BUTTON);
+        }
+    }
+
+    return count;
+}
+
+/* Find the first field with the given usage, like HidP_GetUsageValue and
+ * HidP_GetUsages do, or return an empty field if there isn't any. */
+static inline struct hid_report_field hid_report_find_field( const struct hid_report_field *fields, int count,
+                                                             UCHAR report_id, USAGE usage_page, USAGE usage,
+                                                             BOOL is_button )
+{
+    struct hid_report_field none = {.usage_page = usage_page, .usage = usage, .report_id = report_id};
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (fields[i].report_id != report_id || !fields[i].is_button != !is_button) continue;
+        if (fields[i].usage_page == usage_page && fields[i].usage == usage) return fields[i];
+    }
+
+    return none;
+}
+
+/* Read the raw, unsigned value of a field, like HidP_GetUsageValue does. */
+static inline ULONG hid_report_field_value( const struct hid_report_field *field, const BYTE *report )
+{
+    const BYTE *src = report + field->bit_offset / 8;
+    UINT i, bytes = (field->bit_offset % 8 + field->bit_size + 7) / 8;
+    ULONG64 bits = 0;
+
+    for (i = 0; i < bytes; i++) bits |= (ULONG64)src[i] << (i * 8);
+    bits >>= field->bit_offset % 8;
+    if (field->bit_size < 32) bits &= ((ULONG64)1 << field->bit_size) - 1;
+    return bits;
+}
+
 #endif /* __WINE_PARSE_H */
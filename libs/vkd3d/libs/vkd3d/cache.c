@@ -17,6 +17,9 @@
  */
 
 #include "vkd3d_private.h"
+#ifndef _WIN32
+# include <unistd.h>
+#endif
 
 struct vkd3d_cache_entry_header
 {
@@ -31,6 +34,24 @@ struct vkd3d_shader_cache
     struct vkd3d_mutex lock;
 
     struct rb_tree tree;
+
+    /* Disk-backed caches only. */
+    char *file_name;
+    uint64_t version;
+    uint64_t max_size;
+    uint64_t size;
+    bool dirty;
+};
+
+#define VKD3D_SHADER_CACHE_FILE_MAGIC   VKD3D_MAKE_TAG('V', 'K', 'S', 'C')
+#define VKD3D_SHADER_CACHE_FILE_VERSION 1
+
+struct vkd3d_shader_cache_file_header
+{
+    uint32_t magic;
+    uint32_t format_version;
+    uint64_t version;
+    uint64_t entry_count;
 };
 
 struct shader_cache_entry
@@ -79,19 +100,231 @@ static void vkd3d_shader_cache_add_entry(struct vkd3d_shader_cache *cache,
     rb_put(&cache->tree, &k, &e->entry);
 }
 
-int vkd3d_shader_open_cache(struct vkd3d_shader_cache **cache)
+static unsigned int vkd3d_get_process_id(void)
+{
+#ifdef _WIN32
+    return GetCurrentProcessId();
+#else
+    return getpid();
+#endif
+}
+
+/* Disk caches are stored in the directory given by VKD3D_SHADER_CACHE_PATH.
+ * If it isn't set, all caches are kept in memory only. */
+char *vkd3d_cache_get_file_name(const char *name)
+{
+    const char *path;
+    char *file_name;
+    size_t size;
+
+    if (!(path = getenv("VKD3D_SHADER_CACHE_PATH")) || !*path)
+        return NULL;
+
+    size = strlen(path) + strlen(name) + 2;
+    if (!(file_name = vkd3d_malloc(size)))
+        return NULL;
+    snprintf(file_name, size, "%s/%s", path, name);
+
+    return file_name;
+}
+
+void *vkd3d_cache_read_file(const char *file_name, size_t *size)
+{
+    void *data = NULL;
+    long file_size;
+    FILE *f;
+
+    if (!(f = fopen(file_name, "rb")))
+        return NULL;
+
+    if (!fseek(f, 0, SEEK_END) && (file_size = ftell(f)) > 0 && !fseek(f, 0, SEEK_SET)
+            && (data = vkd3d_malloc(file_size)))
+    {
+        if (fread(data, 1, file_size, f) == (size_t)file_size)
+        {
+            *size = file_size;
+        }
+        else
+        {
+            vkd3d_free(data);
+            data = NULL;
+        }
+    }
+
+    fclose(f);
+    return data;
+}
+
+/* Caches are written to a temporary file which then replaces the old file,
+ * so that concurrent processes and devices never see a partially written
+ * cache. */
+FILE *vkd3d_cache_create_file(const char *file_name, char **tmp_name)
+{
+    static uint32_t serial;
+    size_t size;
+    FILE *f;
+
+    size = strlen(file_name) + 32;
+    if (!(*tmp_name = vkd3d_malloc(size)))
+        return NULL;
+    snprintf(*tmp_name, size, "%s.%x-%x.tmp", file_name, vkd3d_get_process_id(),
+            vkd3d_atomic_increment_u32(&serial));
+
+    if (!(f = fopen(*tmp_name, "wb")))
+    {
+        WARN("Failed to create %s.\n", debugstr_a(*tmp_name));
+        vkd3d_free(*tmp_name);
+        *tmp_name = NULL;
+    }
+
+    return f;
+}
+
+bool vkd3d_cache_commit_file(FILE *f, char *tmp_name, const char *file_name, bool success)
+{
+    if (fclose(f))
+        success = false;
+
+#ifdef _WIN32
+    if (success && !MoveFileExA(tmp_name, file_name, MOVEFILE_REPLACE_EXISTING))
+        success = false;
+#else
+    if (success && rename(tmp_name, file_name))
+        success = false;
+#endif
+
+    if (!success)
+    {
+        WARN("Failed to write %s.\n", debugstr_a(file_name));
+        remove(tmp_name);
+    }
+
+    vkd3d_free(tmp_name);
+    return success;
+}
+
+static void vkd3d_shader_cache_load(struct vkd3d_shader_cache *cache)
+{
+    const struct vkd3d_shader_cache_file_header *header;
+    const struct vkd3d_cache_entry_header *h;
+    struct shader_cache_entry *e;
+    size_t size, offset;
+    uint64_t i, payload_size;
+    uint8_t *data;
+
+    if (!(data = vkd3d_cache_read_file(cache->file_name, &size)))
+        return;
+
+    header = (const struct vkd3d_shader_cache_file_header *)data;
+    if (size < sizeof(*header) || header->magic != VKD3D_SHADER_CACHE_FILE_MAGIC
+            || header->format_version != VKD3D_SHADER_CACHE_FILE_VERSION || header->version != cache->version)
+    {
+        WARN("Ignoring incompatible cache file %s.\n", debugstr_a(cache->file_name));
+        vkd3d_free(data);
+        return;
+    }
+
+    offset = sizeof(*header);
+    for (i = 0; i < header->entry_count; ++i)
+    {
+        if (size - offset < sizeof(*h))
+            break;
+        h = (const struct vkd3d_cache_entry_header *)(data + offset);
+        offset += sizeof(*h);
+
+        payload_size = h->key_size + h->value_size;
+        if (h->key_size > size - offset || h->value_size > size - offset - h->key_size)
+            break;
+        if (cache->size + payload_size > cache->max_size)
+            break;
+
+        if (!(e = vkd3d_malloc(sizeof(*e))))
+            break;
+        if (!(e->payload = vkd3d_malloc(payload_size)))
+        {
+            vkd3d_free(e);
+            break;
+        }
+        e->h = *h;
+        memcpy(e->payload, data + offset, payload_size);
+        offset += payload_size;
+
+        vkd3d_shader_cache_add_entry(cache, e);
+        cache->size += payload_size;
+    }
+
+    if (i != header->entry_count)
+        WARN("Cache file %s is truncated.\n", debugstr_a(cache->file_name));
+    TRACE("Loaded %"PRIu64" entries from %s.\n", i, debugstr_a(cache->file_name));
+
+    vkd3d_free(data);
+}
+
+static void vkd3d_shader_cache_save(struct vkd3d_shader_cache *cache)
+{
+    struct vkd3d_shader_cache_file_header header;
+    struct shader_cache_entry *e;
+    bool success = true;
+    char *tmp_name;
+    FILE *f;
+
+    if (!(f = vkd3d_cache_create_file(cache->file_name, &tmp_name)))
+        return;
+
+    header.magic = VKD3D_SHADER_CACHE_FILE_MAGIC;
+    header.format_version = VKD3D_SHADER_CACHE_FILE_VERSION;
+    header.version = cache->version;
+    header.entry_count = 0;
+    RB_FOR_EACH_ENTRY(e, &cache->tree, struct shader_cache_entry, entry)
+    {
+        ++header.entry_count;
+    }
+
+    if (fwrite(&header, sizeof(header), 1, f) != 1)
+        success = false;
+    RB_FOR_EACH_ENTRY(e, &cache->tree, struct shader_cache_entry, entry)
+    {
+        if (!success)
+            break;
+        if (fwrite(&e->h, sizeof(e->h), 1, f) != 1
+                || fwrite(e->payload, 1, e->h.key_size + e->h.value_size, f) != e->h.key_size + e->h.value_size)
+            success = false;
+    }
+
+    if (vkd3d_cache_commit_file(f, tmp_name, cache->file_name, success))
+        TRACE("Wrote %"PRIu64" entries to %s.\n", header.entry_count, debugstr_a(cache->file_name));
+}
+
+/* "file_name" is NULL for in-memory caches. Disk-backed caches are loaded
+ * here and written back when the last reference is released. Entries stored
+ * with a different "version" are discarded. */
+int vkd3d_shader_open_cache(const char *file_name, uint64_t version, uint64_t max_size,
+        struct vkd3d_shader_cache **cache)
 {
     struct vkd3d_shader_cache *object;
 
-    TRACE("%p.\n", cache);
+    TRACE("%s, %#"PRIx64", %#"PRIx64", %p.\n", debugstr_a(file_name), version, max_size, cache);
 
-    object = vkd3d_malloc(sizeof(*object));
+    object = vkd3d_calloc(1, sizeof(*object));
     if (!object)
         return VKD3D_ERROR_OUT_OF_MEMORY;
 
     object->refcount = 1;
     rb_init(&object->tree, vkd3d_shader_cache_compare_key);
     vkd3d_mutex_init(&object->lock);
+    object->version = version;
+    object->max_size = max_size ? max_size : UINT64_MAX;
+
+    if (file_name)
+    {
+        if (!(object->file_name = vkd3d_strdup(file_name)))
+        {
+            vkd3d_mutex_destroy(&object->lock);
+            vkd3d_free(object);
+            return VKD3D_ERROR_OUT_OF_MEMORY;
+        }
+        vkd3d_shader_cache_load(object);
+    }
 
     *cache = object;
 
@@ -120,6 +353,10 @@ unsigned int vkd3d_shader_cache_decref(struct vkd3d_shader_cache *cache)
     if (refcount)
         return refcount;
 
+    if (cache->file_name && cache->dirty)
+        vkd3d_shader_cache_save(cache);
+    vkd3d_free(cache->file_name);
+
     rb_destroy(&cache->tree, vkd3d_shader_cache_destroy_entry, NULL);
     vkd3d_mutex_destroy(&cache->lock);
 
@@ -176,6 +413,13 @@ int vkd3d_shader_cache_put(struct vkd3d_shader_cache *cache,
         goto done;
     }
 
+    if (key_size + value_size > cache->max_size - cache->size)
+    {
+        WARN("Cache is full, returning VKD3D_ERROR_OUT_OF_MEMORY.\n");
+        ret = VKD3D_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
     e = vkd3d_malloc(sizeof(*e));
     if (!e)
     {
@@ -197,6 +441,8 @@ int vkd3d_shader_cache_put(struct vkd3d_shader_cache *cache,
     memcpy(e->payload + key_size, value, value_size);
 
     vkd3d_shader_cache_add_entry(cache, e);
+    cache->size += key_size + value_size;
+    cache->dirty = true;
     TRACE("Cache entry %#"PRIx64" stored.\n", k.hash);
     ret = VKD3D_OK;
 
@@ -2406,26 +2406,212 @@ static HRESULT vkd3d_create_vk_device(struct d3d12_device *device,
     return hr;
 }
 
+#define VKD3D_PIPELINE_CACHE_FILE_MAGIC     VKD3D_MAKE_TAG('V', 'K', 'P', 'C')
+#define VKD3D_PIPELINE_CACHE_FILE_VERSION   1
+/* Larger pipeline caches are not written to disk. */
+#define VKD3D_PIPELINE_CACHE_MAX_FILE_SIZE  (256u * 1024 * 1024)
+/* The pipeline cache is also saved after this many new pipelines, so that
+ * it isn't lost if the process never destroys the device. The interval doubles
+ * after each save, since writing the file stalls the compiling thread. */
+#define VKD3D_PIPELINE_CACHE_SAVE_INTERVAL  256
+
+struct vkd3d_pipeline_cache_file_header
+{
+    uint32_t magic;
+    uint32_t format_version;
+    char vkd3d_version[32];
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
+    uint64_t data_size;
+};
+
+/* The pipeline cache of a previous run is only reused with the same vkd3d
+ * build and the same driver. The driver validates the data again. */
+static void d3d12_device_init_pipeline_cache_header(struct d3d12_device *device,
+        struct vkd3d_pipeline_cache_file_header *header, uint64_t data_size)
+{
+    const struct vkd3d_vk_instance_procs *vk_procs = &device->vkd3d_instance->vk_procs;
+    VkPhysicalDeviceProperties properties;
+
+    VK_CALL(vkGetPhysicalDeviceProperties(device->vk_physical_device, &properties));
+
+    memset(header, 0, sizeof(*header));
+    header->magic = VKD3D_PIPELINE_CACHE_FILE_MAGIC;
+    header->format_version = VKD3D_PIPELINE_CACHE_FILE_VERSION;
+    snprintf(header->vkd3d_version, sizeof(header->vkd3d_version), "%s", PACKAGE_VERSION VKD3D_VCS_ID);
+    header->vendor_id = properties.vendorID;
+    header->device_id = properties.deviceID;
+    header->driver_version = properties.driverVersion;
+    memcpy(header->pipeline_cache_uuid, properties.pipelineCacheUUID, VK_UUID_SIZE);
+    header->data_size = data_size;
+}
+
+static void *d3d12_device_load_pipeline_cache(struct d3d12_device *device, size_t *data_size)
+{
+    struct vkd3d_pipeline_cache_file_header expected;
+    const struct vkd3d_pipeline_cache_file_header *header;
+    size_t size;
+    void *data;
+
+    if (!device->pipeline_cache_file_name
+            || !(data = vkd3d_cache_read_file(device->pipeline_cache_file_name, &size)))
+        return NULL;
+
+    header = data;
+    if (size >= sizeof(*header))
+        d3d12_device_init_pipeline_cache_header(device, &expected, size - sizeof(*header));
+    if (size < sizeof(*header) || memcmp(header, &expected, sizeof(*header)))
+    {
+        WARN("Ignoring pipeline cache %s created for a different driver.\n",
+                debugstr_a(device->pipeline_cache_file_name));
+        vkd3d_free(data);
+        return NULL;
+    }
+
+    *data_size = size - sizeof(*header);
+    return data;
+}
+
+static void d3d12_device_save_pipeline_cache(struct d3d12_device *device)
+{
+    const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
+    struct vkd3d_pipeline_cache_file_header header;
+    size_t data_size;
+    bool success;
+    char *tmp_name;
+    void *data;
+    VkResult vr;
+    FILE *f;
+
+    if (!device->pipeline_cache_file_name)
+        return;
+
+    if ((vr = VK_CALL(vkGetPipelineCacheData(device->vk_device, device->vk_pipeline_cache, &data_size, NULL))) < 0
+            || data_size <= device->pipeline_cache_saved_size)
+        return;
+    if (data_size > VKD3D_PIPELINE_CACHE_MAX_FILE_SIZE)
+    {
+        WARN("Not writing pipeline cache of %zu bytes.\n", data_size);
+        return;
+    }
+    if (!(data = vkd3d_malloc(data_size)))
+        return;
+    if ((vr = VK_CALL(vkGetPipelineCacheData(device->vk_device, device->vk_pipeline_cache, &data_size, data))) < 0)
+    {
+        WARN("Failed to get pipeline cache data, vr %d.\n", vr);
+        vkd3d_free(data);
+        return;
+    }
+
+    if ((f = vkd3d_cache_create_file(device->pipeline_cache_file_name, &tmp_name)))
+    {
+        d3d12_device_init_pipeline_cache_header(device, &header, data_size);
+        success = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(data, 1, data_size, f) == data_size;
+        if (vkd3d_cache_commit_file(f, tmp_name, device->pipeline_cache_file_name, success))
+        {
+            TRACE("Wrote %zu bytes to %s.\n", data_size, debugstr_a(device->pipeline_cache_file_name));
+            device->pipeline_cache_saved_size = data_size;
+        }
+    }
+
+    vkd3d_free(data);
+}
+
+void d3d12_device_pipeline_cache_grown(struct d3d12_device *device)
+{
+    uint32_t count;
+
+    if (!device->pipeline_cache_file_name)
+        return;
+
+    count = vkd3d_atomic_increment_u32(&device->pipeline_cache_new_count);
+    if (count < device->pipeline_cache_next_save)
+        return;
+
+    /* Only one thread saves at a time; the others don't wait for it. */
+    if (!vkd3d_atomic_compare_exchange_u32(&device->pipeline_cache_saving, 0, 1))
+        return;
+    if (count >= device->pipeline_cache_next_save)
+    {
+        device->pipeline_cache_next_save = count * 2;
+        d3d12_device_save_pipeline_cache(device);
+    }
+    vkd3d_atomic_exchange_u32(&device->pipeline_cache_saving, 0);
+}
+
+/* Each application gets its own pipeline cache file for each driver, so
+ * that applications don't evict each other's pipelines, and switching
+ * between drivers doesn't discard the cache. */
+static char *d3d12_device_get_pipeline_cache_file_name(struct d3d12_device *device)
+{
+    const struct vkd3d_vk_instance_procs *vk_procs = &device->vkd3d_instance->vk_procs;
+    VkPhysicalDeviceProperties properties;
+    char program_name[PATH_MAX];
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const unsigned char *p;
+    char name[64];
+    size_t i;
+
+    VK_CALL(vkGetPhysicalDeviceProperties(device->vk_physical_device, &properties));
+    vkd3d_get_program_name(program_name);
+
+    for (p = (const unsigned char *)program_name; *p; ++p)
+        hash = (hash ^ *p) * 0x100000001b3ull;
+    for (i = 0; i < VK_UUID_SIZE; ++i)
+        hash = (hash ^ properties.pipelineCacheUUID[i]) * 0x100000001b3ull;
+    hash = (hash ^ properties.vendorID) * 0x100000001b3ull;
+    hash = (hash ^ properties.deviceID) * 0x100000001b3ull;
+
+    snprintf(name, sizeof(name), "pipeline-%016"PRIx64".cache", hash);
+    return vkd3d_cache_get_file_name(name);
+}
+
 static HRESULT d3d12_device_init_pipeline_cache(struct d3d12_device *device)
 {
     const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
+    const struct vkd3d_pipeline_cache_file_header *header;
     VkPipelineCacheCreateInfo cache_info;
+    size_t data_size = 0;
+    void *data;
     VkResult vr;
 
     vkd3d_mutex_init(&device->pipeline_cache_mutex);
 
+    device->pipeline_cache_file_name = d3d12_device_get_pipeline_cache_file_name(device);
+    device->pipeline_cache_saved_size = 0;
+    device->pipeline_cache_new_count = 0;
+    device->pipeline_cache_next_save = VKD3D_PIPELINE_CACHE_SAVE_INTERVAL;
+    device->pipeline_cache_saving = 0;
+    header = data = d3d12_device_load_pipeline_cache(device, &data_size);
+
     cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
     cache_info.pNext = NULL;
     cache_info.flags = 0;
-    cache_info.initialDataSize = 0;
-    cache_info.pInitialData = NULL;
+    cache_info.initialDataSize = data_size;
+    cache_info.pInitialData = header ? header + 1 : NULL;
     if ((vr = VK_CALL(vkCreatePipelineCache(device->vk_device, &cache_info, NULL,
-            &device->vk_pipeline_cache))) < 0)
+            &device->vk_pipeline_cache))) < 0 && data)
+    {
+        WARN("Failed to create Vulkan pipeline cache from %s, vr %d.\n",
+                debugstr_a(device->pipeline_cache_file_name), vr);
+        cache_info.initialDataSize = 0;
+        cache_info.pInitialData = NULL;
+        vr = VK_CALL(vkCreatePipelineCache(device->vk_device, &cache_info, NULL, &device->vk_pipeline_cache));
+    }
+    if (vr < 0)
     {
         ERR("Failed to create Vulkan pipeline cache, vr %d.\n", vr);
         device->vk_pipeline_cache = VK_NULL_HANDLE;
     }
+    else if (data)
+    {
+        TRACE("Loaded %zu bytes from %s.\n", data_size, debugstr_a(device->pipeline_cache_file_name));
+        device->pipeline_cache_saved_size = data_size;
+    }
 
+    vkd3d_free(data);
     return S_OK;
 }
 
@@ -2434,7 +2620,11 @@ static void d3d12_device_destroy_pipeline_cache(struct d3d12_device *device)
     const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
 
     if (device->vk_pipeline_cache)
+    {
+        d3d12_device_save_pipeline_cache(device);
         VK_CALL(vkDestroyPipelineCache(device->vk_device, device->vk_pipeline_cache, NULL));
+    }
+    vkd3d_free(device->pipeline_cache_file_name);
 
     vkd3d_mutex_destroy(&device->pipeline_cache_mutex);
 }
@@ -3053,10 +3243,23 @@ static HRESULT d3d12_cache_session_init(struct d3d12_cache_session *session,
 
     if (!session->cache)
     {
+        const GUID *id = &session->desc.Identifier;
+        char *file_name = NULL;
+        uint64_t max_size = 0;
+        char name[64];
+
         if (session->desc.Mode == D3D12_SHADER_CACHE_MODE_DISK)
-            FIXME("Disk caches are not yet implemented.\n");
+        {
+            snprintf(name, sizeof(name), "d3d12-%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x.cache",
+                    (unsigned int)id->Data1, id->Data2, id->Data3, id->Data4[0], id->Data4[1], id->Data4[2],
+                    id->Data4[3], id->Data4[4], id->Data4[5], id->Data4[6], id->Data4[7]);
+            if (!(file_name = vkd3d_cache_get_file_name(name)))
+                WARN("VKD3D_SHADER_CACHE_PATH is not set, using an in-memory cache.\n");
+            max_size = session->desc.MaximumValueFileSizeBytes;
+        }
 
-        ret = vkd3d_shader_open_cache(&session->cache);
+        ret = vkd3d_shader_open_cache(file_name, session->desc.Version, max_size, &session->cache);
+        vkd3d_free(file_name);
         if (ret)
         {
             WARN("Failed to open shader cache.\n");
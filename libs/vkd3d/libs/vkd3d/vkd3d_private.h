@@ -1610,6 +1610,12 @@ struct d3d12_device
     struct vkd3d_mutex pipeline_cache_mutex;
     struct vkd3d_render_pass_cache render_pass_cache;
     VkPipelineCache vk_pipeline_cache;
+    char *pipeline_cache_file_name;
+    /* Only accessed by the thread holding pipeline_cache_saving. */
+    size_t pipeline_cache_saved_size;
+    uint32_t pipeline_cache_new_count;
+    uint32_t pipeline_cache_next_save;
+    uint32_t pipeline_cache_saving;
 
     VkPhysicalDeviceMemoryProperties memory_properties;
 
@@ -1658,6 +1664,7 @@ void d3d12_device_mark_as_removed(struct d3d12_device *device, HRESULT reason,
 struct d3d12_device *unsafe_impl_from_ID3D12Device9(ID3D12Device9 *iface);
 HRESULT d3d12_device_add_descriptor_heap(struct d3d12_device *device, struct d3d12_descriptor_heap *heap);
 void d3d12_device_remove_descriptor_heap(struct d3d12_device *device, struct d3d12_descriptor_heap *heap);
+void d3d12_device_pipeline_cache_grown(struct d3d12_device *device);
 
 static inline HRESULT d3d12_device_query_interface(struct d3d12_device *device, REFIID iid, void **object)
 {
@@ -1839,7 +1846,8 @@ static inline void vkd3d_prepend_struct(void *header, void *structure)
 
 struct vkd3d_shader_cache;
 
-int vkd3d_shader_open_cache(struct vkd3d_shader_cache **cache);
+int vkd3d_shader_open_cache(const char *file_name, uint64_t version, uint64_t max_size,
+        struct vkd3d_shader_cache **cache);
 unsigned int vkd3d_shader_cache_incref(struct vkd3d_shader_cache *cache);
 unsigned int vkd3d_shader_cache_decref(struct vkd3d_shader_cache *cache);
 int vkd3d_shader_cache_put(struct vkd3d_shader_cache *cache,
@@ -1847,4 +1855,9 @@ int vkd3d_shader_cache_put(struct vkd3d_shader_cache *cache,
 int vkd3d_shader_cache_get(struct vkd3d_shader_cache *cache,
         const void *key, size_t key_size, void *value, size_t *value_size);
 
+char *vkd3d_cache_get_file_name(const char *name);
+void *vkd3d_cache_read_file(const char *file_name, size_t *size);
+FILE *vkd3d_cache_create_file(const char *file_name, char **tmp_name);
+bool vkd3d_cache_commit_file(FILE *f, char *tmp_name, const char *file_name, bool success);
+
 #endif  /* __VKD3D_PRIVATE_H */